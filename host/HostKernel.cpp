@@ -0,0 +1,197 @@
+/*
+      This file is part of Smoothie (http://smoothieware.org/). The motion control part is heavily based on Grbl (https://github.com/simen/grbl).
+      Smoothie is free software: you can redistribute it and/or modify it under the terms of the GNU General Public License as published by the Free Software Foundation, either version 3 of the License, or (at your option) any later version.
+      Smoothie is distributed in the hope that it will be useful, but WITHOUT ANY WARRANTY; without even the implied warranty of MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the GNU General Public License for more details.
+      You should have received a copy of the GNU General Public License along with Smoothie. If not, see <http://www.gnu.org/licenses/>.
+*/
+
+/**
+Host replacement for src/libs/Kernel.cpp, only the motion modules are loaded, and the idle loop advances the virtual clock
+*/
+
+#include "HostKernel.h"
+#include "HostHal.h"
+
+#include "libs/Kernel.h"
+#include "libs/Module.h"
+#include "libs/Config.h"
+#include "libs/nuts_bolts.h"
+#include "libs/StreamOutputPool.h"
+#include "checksumm.h"
+#include "ConfigValue.h"
+#include "libs/StepTicker.h"
+#include "libs/StepperMotor.h"
+#include "modules/communication/GcodeDispatch.h"
+#include "modules/robot/Planner.h"
+#include "modules/robot/Robot.h"
+#include "modules/robot/Conveyor.h"
+#include "SimpleShell.h"
+#include "FirmConfigSource.h"
+#include "us_ticker_api.h"
+
+#include <string>
+
+#define base_stepping_frequency_checksum            CHECKSUM("base_stepping_frequency")
+#define microseconds_per_step_pulse_checksum        CHECKSUM("microseconds_per_step_pulse")
+#define step_loops_checksum                         CHECKSUM("step_loops")
+#define step_loops_threshold_checksum               CHECKSUM("step_loops_threshold")
+#define grbl_mode_checksum                          CHECKSUM("grbl_mode")
+#define ok_per_line_checksum                        CHECKSUM("ok_per_line")
+
+Kernel* Kernel::instance;
+
+// there is no config.default linked into the host build
+char _binary_config_default_start;
+char _binary_config_default_end;
+
+static uint32_t idle_time_us= 10;
+
+// config text for the kernel being constructed, set by host_kernel_setup()
+static const char *config_start, *config_end;
+
+// The kernel is the central point in Smoothie : it stores modules, and handles event calls
+Kernel::Kernel(){
+    halted= false;
+    feed_hold= false;
+    use_leds= false;
+
+    instance= this; // setup the Singleton instance of the kernel
+
+    this->serial= nullptr;
+    this->slow_ticker= nullptr;
+    this->adc= nullptr;
+    this->simpleshell= nullptr;
+    this->configurator= nullptr;
+
+    this->config= new Config(new FirmConfigSource("host", config_start, config_end));
+    this->config->config_cache_load();
+
+    this->streams = new StreamOutputPool();
+    this->current_path   = "/";
+
+    this->grbl_mode= this->config->value( grbl_mode_checksum )->by_default(false)->as_bool();
+    this->ok_per_line= this->config->value( ok_per_line_checksum )->by_default(true)->as_bool();
+
+    this->step_ticker = new StepTicker();
+
+    // Configure the step ticker
+    this->base_stepping_frequency = this->config->value(base_stepping_frequency_checksum)->by_default(100000)->as_number();
+    float microseconds_per_step_pulse = this->config->value(microseconds_per_step_pulse_checksum)->by_default(1)->as_number();
+    this->step_ticker->set_frequency( this->base_stepping_frequency );
+    this->step_ticker->set_unstep_time( microseconds_per_step_pulse );
+
+    // at step rates above the threshold do several ticks per step ticker interrupt
+    uint8_t step_loops = this->config->value(step_loops_checksum)->by_default(1)->as_number();
+    float step_loops_threshold = this->config->value(step_loops_threshold_checksum)->by_default(this->base_stepping_frequency / 4.0F)->as_number();
+    if(this->step_ticker->set_step_loops( step_loops, step_loops_threshold ) < step_loops) {
+        printf("WARNING: step_loops is off, microseconds_per_step_pulse is more than a quarter of a step tick\n");
+    }
+
+    // Core modules
+    this->add_module( this->conveyor       = new Conveyor()      );
+    this->add_module( this->gcode_dispatch = new GcodeDispatch() );
+    this->add_module( this->robot          = new Robot()         );
+
+    this->planner = new Planner();
+}
+
+// called once per pass of the main loop, keeps the number of passes in the last whole second
+void Kernel::count_main_loop()
+{
+    ++main_loops;
+    uint32_t now= us_ticker_read();
+    if(now - main_loop_second >= 1000000) {
+        // the first second is partial so is not counted towards the minimum
+        if(main_loop_second != 0 && main_loops < min_main_loops_per_second) min_main_loops_per_second= main_loops;
+        main_loops_per_second= main_loops;
+        main_loops= 0;
+        main_loop_second= now;
+    }
+}
+
+// Add a module to Kernel. We don't actually hold a list of modules we just call its on_module_loaded
+void Kernel::add_module(Module* module){
+    module->on_module_loaded();
+}
+
+// Adds a hook for a given module and event
+void Kernel::register_for_event(_EVENT_ENUM id_event, Module *mod){
+    this->hooks[id_event].push_back(mod);
+}
+
+// Call a specific event with an argument
+void Kernel::call_event(_EVENT_ENUM id_event, void * argument){
+    bool was_idle= true;
+    if(id_event == ON_HALT) {
+        this->halted= (argument == nullptr);
+        was_idle= conveyor->is_idle(); // see if we were doing anything like printing
+    }
+
+    // the time a pass of the idle loop takes on the board, this is when the step ticker gets to run
+    if(id_event == ON_IDLE) host_clock_advance_us(idle_time_us);
+
+    // send to all registered modules
+    for (auto m : hooks[id_event]) {
+        (m->*kernel_callback_functions[id_event])(argument);
+    }
+
+    if(id_event == ON_HALT && this->halted && !was_idle) {
+        // we need to try to correct current positions if we were running
+        this->robot->reset_position_from_current_actuator_position();
+    }
+}
+
+bool Kernel::kernel_has_event(_EVENT_ENUM id_event, Module *mod)
+{
+    for (auto m : hooks[id_event]) {
+        if(m == mod) return true;
+    }
+    return false;
+}
+
+void Kernel::unregister_for_event(_EVENT_ENUM id_event, Module *mod)
+{
+    for (auto i = hooks[id_event].begin(); i != hooks[id_event].end(); ++i) {
+        if(*i == mod) {
+            hooks[id_event].erase(i);
+            return;
+        }
+    }
+}
+
+std::string Kernel::get_query_string()
+{
+    return "<Sim>\r\n";
+}
+
+void host_kernel_setup(const char* start, const char* end)
+{
+    host_hal_reset();
+
+    config_start= start;
+    config_end= end;
+    Kernel *kernel= new Kernel();
+
+    // unlike the board the config cache is kept, so the simulator can look up pins and settings after boot
+
+    // start the timers and interrupts
+    kernel->conveyor->start(kernel->robot->get_number_registered_motors());
+    kernel->step_ticker->start();
+}
+
+void host_kernel_teardown()
+{
+    // modules are not written to be deleted, just drop the kernel and let the process exit
+    Kernel::instance= nullptr;
+}
+
+void host_kernel_set_idle_time(uint32_t us)
+{
+    idle_time_us= us;
+}
+
+// the shell is not part of the host build, commands passed through M1000 are reported as not found
+bool SimpleShell::parse_command(const char *cmd, string args, StreamOutput *stream)
+{
+    return false;
+}
@@ -0,0 +1,17 @@
+/*
+      This file is part of Smoothie (http://smoothieware.org/). The motion control part is heavily based on Grbl (https://github.com/simen/grbl).
+      Smoothie is free software: you can redistribute it and/or modify it under the terms of the GNU General Public License as published by the Free Software Foundation, either version 3 of the License, or (at your option) any later version.
+      Smoothie is distributed in the hope that it will be useful, but WITHOUT ANY WARRANTY; without even the implied warranty of MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the GNU General Public License for more details.
+      You should have received a copy of the GNU General Public License along with Smoothie. If not, see <http://www.gnu.org/licenses/>.
+*/
+
+#pragma once
+
+#include <stdint.h>
+
+// boot the host kernel with the given config text, this mirrors init() in src/main.cpp for the motion modules only
+void host_kernel_setup(const char* start, const char* end);
+void host_kernel_teardown();
+
+// virtual time used by one pass of the idle loop, the main loop spins on ON_IDLE while it waits for the queue
+void host_kernel_set_idle_time(uint32_t us);
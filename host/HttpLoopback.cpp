@@ -0,0 +1,252 @@
+/*
+      This file is part of Smoothie (http://smoothieware.org/). The motion control part is heavily based on Grbl (https://github.com/simen/grbl).
+      Smoothie is free software: you can redistribute it and/or modify it under the terms of the GNU General Public License as published by the Free Software Foundation, either version 3 of the License, or (at your option) any later version.
+      Smoothie is distributed in the hope that it will be useful, but WITHOUT ANY WARRANTY; without even the implied warranty of MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the GNU General Public License for more details.
+      You should have received a copy of the GNU General Public License along with Smoothie. If not, see <http://www.gnu.org/licenses/>.
+*/
+
+#include "HttpLoopback.h"
+
+extern "C" {
+#include "uip.h"
+#include "httpd.h"
+#include "CallbackStream.h"
+}
+
+#include <algorithm>
+#include <deque>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+
+// the rest of the uIP stand in is with Plan9Loopback
+extern "C" {
+extern void *uip_sappdata;
+extern u16_t uip_slen;
+}
+
+static const int MAX_STEPS= 100000;    // without a response, the server has stalled
+
+std::vector<std::string> HttpLoopback::commands;
+static std::string sd_root;
+
+void HttpLoopback::set_sd_root(const char *dir)
+{
+    sd_root= dir == nullptr ? "" : dir;
+}
+
+std::string HttpLoopback::rom_page(const char *name)
+{
+    struct httpd_fs_file file;
+    if(!httpd_fs_open(name, &file)) return "";
+    return std::string(file.data, file.len);
+}
+
+// smoothie-sim is linked with --wrap=fopen so that the files the server opens on the sd card can be elsewhere
+extern "C" FILE *__real_fopen(const char *path, const char *mode);
+
+extern "C" FILE *__wrap_fopen(const char *path, const char *mode)
+{
+    if(!sd_root.empty() && strncmp(path, "/sd/", 4) == 0) {
+        return __real_fopen((sd_root + (path + 3)).c_str(), mode);
+    }
+    return __real_fopen(path, mode);
+}
+
+// the command queue and the callback streams the server uses, the commands are taken off the queue at the
+// start of the next call of the server, as the main loop would, and each one with a stream is answered with an ok
+namespace {
+    struct Stream {
+        cb_t callback;
+        void *user;
+        int queued;
+        bool closed;
+    };
+    struct Pending {
+        Stream *stream;
+        bool ok_sent;
+    };
+    std::deque<Pending> pending;
+}
+
+extern "C" void *new_callback_stream(cb_t cb, void *u)
+{
+    return new Stream{ cb, u, 0, false };
+}
+
+extern "C" void delete_callback_stream(void *p)
+{
+    // it is deleted once its commands are off the queue
+    Stream *stream= (Stream *)p;
+    stream->closed= true;
+    if(stream->queued == 0) delete stream;
+}
+
+extern "C" int network_add_command(const char *cmd, void *pstream)
+{
+    HttpLoopback::commands.push_back(cmd);
+    if(pstream != nullptr) {
+        Stream *stream= (Stream *)pstream;
+        stream->queued++;
+        pending.push_back(Pending{ stream, false });
+    }
+    return 1;
+}
+
+static void run_commands()
+{
+    while(!pending.empty()) {
+        Pending& p= pending.front();
+        if(!p.stream->closed) {
+            // a full fifo is tried again next time
+            if(!p.ok_sent && p.stream->callback("ok\n", p.stream->user) == 0) return;
+            p.ok_sent= true;
+            p.stream->callback(nullptr, p.stream->user);
+        }
+        if(--p.stream->queued == 0 && p.stream->closed) delete p.stream;
+        pending.pop_front();
+    }
+}
+
+HttpLoopback::HttpLoopback()
+{
+    conn= new struct uip_conn;
+    memset(conn, 0, sizeof(*conn));
+    mss= UIP_TCP_MSS;
+    conn->mss= conn->initialmss= mss;
+    conn->lport= HTONS(80);
+    conn->tcpstateflags= UIP_ESTABLISHED;
+
+    uip_conn= conn;
+    uip_appdata= uip_sappdata= &uip_buf[UIP_LLH_LEN + UIP_TCPIP_HLEN];
+    uip_len= uip_slen= 0;
+    uip_flags= UIP_CONNECTED;
+    httpd_appcall();
+}
+
+HttpLoopback::~HttpLoopback()
+{
+    if(!closed) {
+        uip_conn= conn;
+        uip_len= uip_slen= 0;
+        uip_flags= UIP_CLOSE;
+        httpd_appcall();
+    }
+    delete conn;
+}
+
+bool HttpLoopback::step()
+{
+    run_commands();
+
+    uip_conn= conn;
+    uip_appdata= uip_sappdata= &uip_buf[UIP_LLH_LEN + UIP_TCPIP_HLEN];
+    uip_len= uip_slen= 0;
+    uip_flags= 0;
+
+    if(!outstanding.empty()) {
+        outstanding.clear();
+        uip_flags |= UIP_ACKDATA;
+    }
+    if(!to_server.empty() && !uip_stopped(conn)) {
+        uip_len= std::min<size_t>(mss, to_server.size());
+        memcpy(uip_appdata, to_server.data(), uip_len);
+        to_server.erase(0, uip_len);
+        uip_flags |= UIP_NEWDATA;
+        segments_in++;
+    }
+    if(uip_flags == 0) uip_flags= UIP_POLL;
+
+    httpd_appcall();
+    if(uip_flags & UIP_ABORT) {
+        // uIP does not call the application again after it has aborted
+        closed= true;
+        error= "the server aborted the connection";
+        return false;
+    }
+    bool closing= uip_flags & UIP_CLOSE;
+
+    if(uip_slen > 0) {
+        outstanding.assign((const char *)uip_sappdata, uip_slen);
+        from_server.append(outstanding);
+        segments_out++;
+
+        if(segments_out % 7 == 0 && !closing) {
+            uip_len= uip_slen= 0;
+            uip_flags= UIP_REXMIT;
+            httpd_appcall();
+            if(outstanding != std::string((const char *)uip_sappdata, uip_slen)) {
+                error= "the server sent something else again";
+                return false;
+            }
+            resent++;
+        }
+    }
+
+    if(closing) {
+        // and once the close has gone through, uIP calls it to say the connection has closed
+        uip_len= uip_slen= 0;
+        uip_flags= UIP_CLOSE;
+        httpd_appcall();
+        closed= true;
+    }
+    return true;
+}
+
+bool HttpLoopback::parse_response(int& status, std::string& body)
+{
+    size_t end= from_server.find("\r\n\r\n");
+    if(end == std::string::npos) return false;
+    std::string headers= from_server.substr(0, end + 2);
+    size_t start= end + 4;
+
+    size_t space= headers.find(' ');
+    status= space == std::string::npos ? 0 : atoi(headers.c_str() + space + 1);
+    keep_alive= headers.find("\r\nConnection: keep-alive\r\n") != std::string::npos;
+
+    long length= -1;
+    size_t p= headers.find("\r\nContent-Length: ");
+    if(p != std::string::npos) length= strtol(headers.c_str() + p + 18, nullptr, 10);
+    if(status == 304) length= 0;
+    if(length < 0) {
+        // the body is everything up to the close
+        if(!closed) return false;
+        length= from_server.size() - start;
+    }
+    if(from_server.size() - start < (size_t)length) return false;
+
+    body= from_server.substr(start, length);
+    from_server.erase(0, start + length);
+    return true;
+}
+
+bool HttpLoopback::request(const std::string& request, int& status, std::string& body)
+{
+    if(closed) {
+        error= "the connection has closed";
+        return false;
+    }
+    to_server.append(request);
+
+    for(int i= 0; i < MAX_STEPS; i++) {
+        if(!step()) return false;
+        if(parse_response(status, body)) {
+            // a connection that is not kept alive is closed once the last segment has been acked
+            while(!keep_alive && !closed && ++i < MAX_STEPS) {
+                if(!step()) return false;
+            }
+            if(!keep_alive && !closed) break;
+            if(!from_server.empty()) {
+                error= "the server sent more than the response";
+                return false;
+            }
+            return true;
+        }
+        if(closed) {
+            error= "the server closed the connection before the response was sent";
+            return false;
+        }
+    }
+    error= "the server stalled";
+    return false;
+}
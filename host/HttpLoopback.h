@@ -0,0 +1,59 @@
+/*
+      This file is part of Smoothie (http://smoothieware.org/). The motion control part is heavily based on Grbl (https://github.com/simen/grbl).
+      Smoothie is free software: you can redistribute it and/or modify it under the terms of the GNU General Public License as published by the Free Software Foundation, either version 3 of the License, or (at your option) any later version.
+      Smoothie is distributed in the hope that it will be useful, but WITHOUT ANY WARRANTY; without even the implied warranty of MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the GNU General Public License for more details.
+      You should have received a copy of the GNU General Public License along with Smoothie. If not, see <http://www.gnu.org/licenses/>.
+*/
+
+#pragma once
+
+#include <stddef.h>
+#include <stdint.h>
+#include <string>
+#include <vector>
+
+struct uip_conn;
+
+// Stands in for uIP and for the HTTP client at the other end of one TCP connection to the real web server,
+// with the same one segment in flight each way and every seventh segment sent again as Plan9Loopback.
+// The client takes each segment as soon as it is sent but only acks it on the next call, and holds the ack
+// of the last segment of a kept alive response until it sends the next request, so the two arrive together.
+// Files the server opens under /sd/ are in the directory given to set_sd_root().
+class HttpLoopback {
+    public:
+        HttpLoopback();
+        ~HttpLoopback();
+
+        // sends the request and runs the connection until the whole response has come, and if the server said
+        // it would close the connection, until it has, returns false and sets the error if it stalled
+        bool request(const std::string& request, int& status, std::string& body);
+
+        bool is_keep_alive() const { return keep_alive; }
+        bool is_closed() const { return closed; }
+        const std::string& get_error() const { return error; }
+        uint32_t get_segments_in() const { return segments_in; }
+        uint32_t get_segments_out() const { return segments_out; }
+        uint32_t get_resent() const { return resent; }
+
+        static void set_sd_root(const char *dir);
+        // a page in the server's ROM filesystem, empty if there is none
+        static std::string rom_page(const char *name);
+        // the lines the server put on the command queue, as the main loop takes them off
+        static std::vector<std::string> commands;
+
+    private:
+        // one call of the application, as uIP makes when a segment arrives, is acked, or on a poll
+        bool step();
+        // the response is whole once its headers and Content-Length bytes, or everything up to the close, are in
+        bool parse_response(int& status, std::string& body);
+
+        std::string to_server;      // not yet sent as segments
+        std::string from_server;    // not yet taken as a response
+        std::string outstanding;    // sent by the server and not yet acked
+        std::string error;
+        struct uip_conn *conn;
+        uint32_t segments_in{0}, segments_out{0}, resent{0};
+        uint16_t mss;
+        bool keep_alive{false};
+        bool closed{false};
+};
@@ -0,0 +1,358 @@
+/*
+      This file is part of Smoothie (http://smoothieware.org/). The motion control part is heavily based on Grbl (https://github.com/simen/grbl).
+      Smoothie is free software: you can redistribute it and/or modify it under the terms of the GNU General Public License as published by the Free Software Foundation, either version 3 of the License, or (at your option) any later version.
+      Smoothie is distributed in the hope that it will be useful, but WITHOUT ANY WARRANTY; without even the implied warranty of MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the GNU General Public License for more details.
+      You should have received a copy of the GNU General Public License along with Smoothie. If not, see <http://www.gnu.org/licenses/>.
+*/
+
+#include "Plan9Loopback.h"
+#include "plan9.h"
+
+extern "C" {
+#include "uip.h"
+}
+
+#include <algorithm>
+#include <deque>
+#include <string.h>
+
+// the parts of uIP the servers and the protosockets use, HttpLoopback shares them
+extern "C" {
+u8_t uip_buf[UIP_BUFSIZE + 4];
+void *uip_appdata;
+u16_t uip_len;
+u8_t uip_flags;
+struct uip_conn *uip_conn;
+
+void *uip_sappdata;
+u16_t uip_slen;
+
+void uip_send(const void *data, int len)
+{
+    if(len > 0) {
+        uip_slen= len;
+        if(data != uip_sappdata) memcpy(uip_sappdata, data, len);
+    }
+}
+
+void uip_listen(u16_t port) {}
+}
+
+enum { Tversion= 100, Tattach= 104, Rerror= 107, Twalk= 110, Topen= 112, Tcreate= 114, Tread= 116, Twrite= 118,
+       Tclunk= 120, Tremove= 122, Tstat= 124 };
+
+static const uint32_t NOFID= 0xFFFFFFFF;
+static const int MAX_STEPS= 100000;    // without a response, the server has stalled
+
+static void put(std::string& s, uint64_t v, int bytes)
+{
+    for(int i= 0; i < bytes; i++) s.push_back((char)(v >> (8 * i)));
+}
+
+static void put_string(std::string& s, const std::string& v)
+{
+    put(s, v.size(), 2);
+    s.append(v);
+}
+
+static uint64_t get(const std::string& s, size_t pos, int bytes)
+{
+    uint64_t v= 0;
+    for(int i= bytes - 1; i >= 0; i--) v= (v << 8) | (uint8_t)s[pos + i];
+    return v;
+}
+
+Plan9Loopback::Plan9Loopback()
+{
+    conn= new struct uip_conn;
+    memset(conn, 0, sizeof(*conn));
+    mss= UIP_TCP_MSS;
+    conn->mss= conn->initialmss= mss;
+    conn->tcpstateflags= UIP_ESTABLISHED;
+
+    uip_conn= conn;
+    uip_appdata= uip_sappdata= &uip_buf[UIP_LLH_LEN + UIP_TCPIP_HLEN];
+    uip_len= uip_slen= 0;
+    uip_flags= UIP_CONNECTED;
+    Plan9::appcall();
+}
+
+Plan9Loopback::~Plan9Loopback()
+{
+    uip_conn= conn;
+    uip_len= uip_slen= 0;
+    uip_flags= UIP_CLOSE;
+    Plan9::appcall();
+    delete conn;
+}
+
+bool Plan9Loopback::step()
+{
+    uip_conn= conn;
+    uip_appdata= uip_sappdata= &uip_buf[UIP_LLH_LEN + UIP_TCPIP_HLEN];
+    uip_len= uip_slen= 0;
+    uip_flags= 0;
+
+    if(!outstanding.empty()) {
+        from_server.append(outstanding);
+        outstanding.clear();
+        uip_flags |= UIP_ACKDATA;
+    }
+    // a stopped connection does not take data, the client sends it again later
+    if(!to_server.empty() && !uip_stopped(conn)) {
+        uip_len= std::min<size_t>(mss, to_server.size());
+        memcpy(uip_appdata, to_server.data(), uip_len);
+        to_server.erase(0, uip_len);
+        uip_flags |= UIP_NEWDATA;
+        segments_in++;
+    }
+    if(uip_flags == 0) uip_flags= UIP_POLL;
+
+    Plan9::appcall();
+    if(uip_flags & (UIP_CLOSE | UIP_ABORT)) {
+        error= "the server closed the connection";
+        return false;
+    }
+
+    if(uip_slen > 0) {
+        outstanding.assign((const char *)uip_sappdata, uip_slen);
+        segments_out++;
+
+        if(segments_out % 7 == 0) {
+            uip_len= uip_slen= 0;
+            uip_flags= UIP_REXMIT;
+            Plan9::appcall();
+            if(outstanding != std::string((const char *)uip_sappdata, uip_slen)) {
+                error= "the server sent something else again";
+                return false;
+            }
+            resent++;
+        }
+    }
+
+    while(from_server.size() >= 7) {
+        uint32_t size= get(from_server, 0, 4);
+        if(from_server.size() < size) break;
+        responses[get(from_server, 5, 2)]= from_server.substr(0, size);
+        from_server.erase(0, size);
+    }
+    return true;
+}
+
+uint16_t Plan9Loopback::request(uint8_t type, const std::string& body)
+{
+    uint16_t tag= next_tag++;
+    put(to_server, 7 + body.size(), 4);
+    put(to_server, type, 1);
+    put(to_server, tag, 2);
+    to_server.append(body);
+    return tag;
+}
+
+bool Plan9Loopback::response(uint16_t tag, uint8_t type, std::string& body)
+{
+    for(int i= 0; i < MAX_STEPS; i++) {
+        auto r= responses.find(tag);
+        if(r != responses.end()) {
+            uint8_t got= r->second[4];
+            body= r->second.substr(7);
+            responses.erase(r);
+            if(got == Rerror) {
+                error= body.substr(2);
+                return false;
+            }
+            if(got != type + 1) {
+                error= "response " + std::to_string(got) + " to request " + std::to_string(type);
+                return false;
+            }
+            return true;
+        }
+        if(!step()) return false;
+    }
+    error= "no response to request " + std::to_string(type);
+    return false;
+}
+
+uint32_t Plan9Loopback::version(uint32_t msize)
+{
+    std::string body;
+    put(body, msize, 4);
+    put_string(body, "9P2000");
+    if(!response(request(Tversion, body), Tversion, body)) return 0;
+    return get(body, 0, 4);
+}
+
+bool Plan9Loopback::attach(uint32_t fid)
+{
+    std::string body;
+    put(body, fid, 4);
+    put(body, NOFID, 4);
+    put_string(body, "smoothie");
+    put_string(body, "");
+    return response(request(Tattach, body), Tattach, body);
+}
+
+bool Plan9Loopback::walk(uint32_t fid, uint32_t newfid, const std::vector<std::string>& names)
+{
+    std::string body;
+    put(body, fid, 4);
+    put(body, newfid, 4);
+    put(body, names.size(), 2);
+    for(auto& n : names) put_string(body, n);
+    if(!response(request(Twalk, body), Twalk, body)) return false;
+    if(get(body, 0, 2) != names.size()) {
+        error= "walk stopped short";
+        return false;
+    }
+    return true;
+}
+
+uint32_t Plan9Loopback::create(uint32_t fid, const std::string& name)
+{
+    std::string body;
+    put(body, fid, 4);
+    put_string(body, name);
+    put(body, 0644, 4);
+    put(body, 1, 1);
+    if(!response(request(Tcreate, body), Tcreate, body)) return 0;
+    return get(body, 13, 4);
+}
+
+uint32_t Plan9Loopback::open(uint32_t fid, uint8_t mode)
+{
+    std::string body;
+    put(body, fid, 4);
+    put(body, mode, 1);
+    if(!response(request(Topen, body), Topen, body)) return 0;
+    return get(body, 13, 4);
+}
+
+bool Plan9Loopback::stat(uint32_t fid, uint64_t& length)
+{
+    std::string body;
+    put(body, fid, 4);
+    if(!response(request(Tstat, body), Tstat, body)) return false;
+    // stat_size[2] size[2] type[2] dev[4] qid[13] mode[4] atime[4] mtime[4] length[8]
+    length= get(body, 35, 8);
+    return true;
+}
+
+bool Plan9Loopback::clunk(uint32_t fid)
+{
+    std::string body;
+    put(body, fid, 4);
+    return response(request(Tclunk, body), Tclunk, body);
+}
+
+bool Plan9Loopback::remove(uint32_t fid)
+{
+    std::string body;
+    put(body, fid, 4);
+    return response(request(Tremove, body), Tremove, body);
+}
+
+bool Plan9Loopback::write(uint32_t fid, const std::string& data, uint32_t iounit, int depth)
+{
+    std::deque<std::pair<uint16_t, uint32_t>> waiting;
+    size_t sent= 0, done= 0;
+    while(done < data.size()) {
+        while(sent < data.size() && (int)waiting.size() < depth) {
+            uint32_t n= std::min<size_t>(iounit, data.size() - sent);
+            std::string body;
+            put(body, fid, 4);
+            put(body, sent, 8);
+            put(body, n, 4);
+            body.append(data, sent, n);
+            waiting.push_back(std::make_pair(request(Twrite, body), n));
+            sent += n;
+        }
+
+        std::string body;
+        if(!response(waiting.front().first, Twrite, body)) return false;
+        if(get(body, 0, 4) != waiting.front().second) {
+            error= "short write";
+            return false;
+        }
+        done += waiting.front().second;
+        waiting.pop_front();
+    }
+    return true;
+}
+
+bool Plan9Loopback::read(uint32_t fid, std::string& data, uint32_t size, uint32_t iounit, int depth)
+{
+    std::deque<std::pair<uint16_t, uint32_t>> waiting;
+    size_t asked= 0;
+    data.clear();
+    while(data.size() < size) {
+        while(asked < size && (int)waiting.size() < depth) {
+            uint32_t n= std::min<size_t>(iounit, size - asked);
+            std::string body;
+            put(body, fid, 4);
+            put(body, asked, 8);
+            put(body, n, 4);
+            waiting.push_back(std::make_pair(request(Tread, body), n));
+            asked += n;
+        }
+
+        std::string body;
+        if(!response(waiting.front().first, Tread, body)) return false;
+        if(get(body, 0, 4) != waiting.front().second || body.size() != 4 + waiting.front().second) {
+            error= "short read";
+            return false;
+        }
+        data.append(body, 4, std::string::npos);
+        waiting.pop_front();
+    }
+    return true;
+}
+
+bool Plan9Loopback::overwrite(uint32_t fid, uint32_t newfid, const std::vector<std::string>& names, const std::string& data)
+{
+    std::string walk, open, write, body;
+    put(walk, fid, 4);
+    put(walk, newfid, 4);
+    put(walk, names.size(), 2);
+    for(auto& n : names) put_string(walk, n);
+    put(open, newfid, 4);
+    put(open, 0x11, 1);    // OWRITE | OTRUNC
+    put(write, newfid, 4);
+    put(write, 0, 8);
+    put(write, data.size(), 4);
+    write.append(data);
+
+    uint16_t walk_tag= request(Twalk, walk);
+    uint16_t open_tag= request(Topen, open);
+    uint16_t write_tag= request(Twrite, write);
+    if(!response(walk_tag, Twalk, body) || !response(open_tag, Topen, body) || !response(write_tag, Twrite, body)) return false;
+    if(get(body, 0, 4) != data.size()) {
+        error= "short write";
+        return false;
+    }
+    return true;
+}
+
+bool Plan9Loopback::read_write(uint32_t fid, std::string& before, uint32_t size, const std::string& data)
+{
+    std::string read, write, body;
+    put(read, fid, 4);
+    put(read, 0, 8);
+    put(read, size, 4);
+    put(write, fid, 4);
+    put(write, size - data.size(), 8);
+    put(write, data.size(), 4);
+    write.append(data);
+
+    // the write follows once the read has arrived on its own, while its response may still be being sent
+    uint16_t read_tag= request(Tread, read);
+    if(!step()) return false;
+    uint16_t write_tag= request(Twrite, write);
+    if(!response(read_tag, Tread, body)) return false;
+    before= body.substr(4);
+    if(!response(write_tag, Twrite, body)) return false;
+    if(get(body, 0, 4) != data.size()) {
+        error= "short write";
+        return false;
+    }
+    return true;
+}
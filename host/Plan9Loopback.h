@@ -0,0 +1,71 @@
+/*
+      This file is part of Smoothie (http://smoothieware.org/). The motion control part is heavily based on Grbl (https://github.com/simen/grbl).
+      Smoothie is free software: you can redistribute it and/or modify it under the terms of the GNU General Public License as published by the Free Software Foundation, either version 3 of the License, or (at your option) any later version.
+      Smoothie is distributed in the hope that it will be useful, but WITHOUT ANY WARRANTY; without even the implied warranty of MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the GNU General Public License for more details.
+      You should have received a copy of the GNU General Public License along with Smoothie. If not, see <http://www.gnu.org/licenses/>.
+*/
+
+#pragma once
+
+#include <stddef.h>
+#include <stdint.h>
+#include <map>
+#include <string>
+#include <vector>
+
+struct uip_conn;
+
+// Stands in for uIP and for the 9P client at the other end of one TCP connection to the real Plan9 server.
+// As with uIP there is one segment in flight each way, at most the MSS of a 400 byte uIP buffer, and what
+// arrives and what is sent share the one buffer. Every seventh segment the server is asked to send it again,
+// as if it had been lost, and must send the same bytes. The files are the host's own.
+class Plan9Loopback {
+    public:
+        Plan9Loopback();
+        ~Plan9Loopback();
+
+        // each returns false and sets the error if the response was not the one expected
+        uint32_t version(uint32_t msize);
+        bool attach(uint32_t fid);
+        bool walk(uint32_t fid, uint32_t newfid, const std::vector<std::string>& names);
+        // these give the iounit
+        uint32_t create(uint32_t fid, const std::string& name);
+        uint32_t open(uint32_t fid, uint8_t mode);
+        bool stat(uint32_t fid, uint64_t& length);
+        bool clunk(uint32_t fid);
+        bool remove(uint32_t fid);
+
+        // sends the data in Twrites of iounit bytes, keeping up to depth of them waiting for their Rwrite
+        bool write(uint32_t fid, const std::string& data, uint32_t iounit, int depth);
+        bool read(uint32_t fid, std::string& data, uint32_t size, uint32_t iounit, int depth);
+
+        // these send all their requests before waiting for the first response, as a client does that does not
+        // wait for one request to be answered before the next depends on it
+        // walks newfid to a file, opens it truncated and writes data to it
+        bool overwrite(uint32_t fid, uint32_t newfid, const std::vector<std::string>& names, const std::string& data);
+        // reads size bytes of an open file, which must be what was there before data is written over the last of
+        // them, the write following in the next segment
+        bool read_write(uint32_t fid, std::string& before, uint32_t size, const std::string& data);
+
+        const std::string& get_error() const { return error; }
+        uint32_t get_segments_in() const { return segments_in; }
+        uint32_t get_segments_out() const { return segments_out; }
+        uint32_t get_resent() const { return resent; }
+
+    private:
+        uint16_t request(uint8_t type, const std::string& body);
+        // runs the connection until the response to tag has come, body is what follows its tag
+        bool response(uint16_t tag, uint8_t type, std::string& body);
+        // one call of the application, as uIP makes when a segment arrives, is acked, or on a poll
+        bool step();
+
+        std::string to_server;                      // not yet sent as segments
+        std::string from_server;                    // not yet split into responses
+        std::string outstanding;                    // sent by the server and not yet acked
+        std::map<uint16_t, std::string> responses;  // by tag
+        std::string error;
+        struct uip_conn *conn;
+        uint32_t segments_in{0}, segments_out{0}, resent{0};
+        uint16_t next_tag{1};
+        uint16_t mss;
+};
@@ -0,0 +1,191 @@
+/*
+      This file is part of Smoothie (http://smoothieware.org/). The motion control part is heavily based on Grbl (https://github.com/simen/grbl).
+      Smoothie is free software: you can redistribute it and/or modify it under the terms of the GNU General Public License as published by the Free Software Foundation, either version 3 of the License, or (at your option) any later version.
+      Smoothie is distributed in the hope that it will be useful, but WITHOUT ANY WARRANTY; without even the implied warranty of MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the GNU General Public License for more details.
+      You should have received a copy of the GNU General Public License along with Smoothie. If not, see <http://www.gnu.org/licenses/>.
+*/
+
+#include "SdCardModel.h"
+#include "HostHal.h"
+#include "libs/LPC17xx/sLPC17xx.h"
+
+#include <string.h>
+
+SdCardModel::SdCardModel(uint32_t sectors, uint8_t cs_port, uint8_t cs_pin) : storage((size_t)sectors * 512, 0), sectors(sectors), cs_port(cs_port), cs_pin(cs_pin)
+{
+    app_cmd= false;
+    initialized= false;
+
+    // version 2 CSD, 25MHz TRAN_SPEED, C_SIZE is the size in 512K units less one
+    memset(csd, 0, sizeof(csd));
+    csd[0]= 0x40;
+    csd[3]= 0x32;
+    uint32_t c_size= sectors / 1024 - 1;
+    csd[7]= (c_size >> 16) & 0x3F;
+    csd[8]= c_size >> 8;
+    csd[9]= c_size;
+}
+
+bool SdCardModel::cs_low() const
+{
+    return !(host_gpio[cs_port].FIOPIN.value & (1UL << cs_pin));
+}
+
+void SdCardModel::queue_block(const uint8_t *data, size_t size)
+{
+    out.push_back(0xFE);
+    out.insert(out.end(), data, data + size);
+    out.push_back(0xFF); // crc, not checked
+    out.push_back(0xFF);
+}
+
+void SdCardModel::start_busy(uint32_t us)
+{
+    ready_ns= host_clock_ns() + us * 1000ULL;
+    busy= true;
+}
+
+void SdCardModel::command(uint8_t cmd, uint32_t arg)
+{
+    ++commands;
+    bool acmd= app_cmd;
+    app_cmd= false;
+
+    switch(acmd ? cmd + 100 : cmd) {
+        case 0:
+            initialized= false;
+            op_cond_calls= 0;
+            state= IDLE;
+            respond(0x01);
+            break;
+
+        case 8:
+            respond(0x01);
+            out.push_back(0x00);
+            out.push_back(0x00);
+            out.push_back((arg >> 8) & 0x0F);
+            out.push_back(arg & 0xFF);
+            break;
+
+        case 55:
+            app_cmd= true;
+            respond(initialized ? 0x00 : 0x01);
+            break;
+
+        case 141: // ACMD41, takes a couple of goes to come out of idle
+            if(++op_cond_calls > 2) initialized= true;
+            respond(initialized ? 0x00 : 0x01);
+            break;
+
+        case 58: // OCR, powered up and high capacity
+            respond(initialized ? 0x00 : 0x01);
+            out.push_back(0xC0);
+            out.push_back(0xFF);
+            out.push_back(0x80);
+            out.push_back(0x00);
+            break;
+
+        case 9:
+            respond(0x00);
+            out.push_back(0xFF);
+            queue_block(csd, sizeof(csd));
+            break;
+
+        case 16:
+        case 123: // ACMD23, the pre-erase count is only a hint
+            respond(0x00);
+            break;
+
+        case 12:
+            // stop the block being sent, a stuff byte then R1b
+            out.clear();
+            state= IDLE;
+            out.push_back(0xFF);
+            respond(0x00);
+            start_busy(10);
+            break;
+
+        case 17:
+        case 18:
+        case 24:
+        case 25:
+            if(arg >= sectors) {
+                respond(0x20); // address error
+                break;
+            }
+            respond(0x00);
+            block= arg;
+            state= cmd == 17 ? READ_SINGLE : cmd == 18 ? READ_MULTI : cmd == 24 ? WRITE_SINGLE : WRITE_MULTI;
+            if(cmd == 17 || cmd == 18) ready_ns= host_clock_ns() + read_latency_us * 1000ULL;
+            break;
+
+        default:
+            respond(0x04); // illegal command
+            break;
+    }
+}
+
+uint8_t SdCardModel::exchange(uint8_t in)
+{
+    if(!cs_low()) {
+        cmd_len= 0;
+        return 0xFF;
+    }
+
+    // what goes out, something queued, or busy after a write, or a read waiting for its data
+    uint8_t r= 0xFF;
+    if(!out.empty()) {
+        r= out.front();
+        out.pop_front();
+
+    } else if(busy) {
+        if(host_clock_ns() < ready_ns) {
+            r= 0x00;
+        } else {
+            busy= false;
+        }
+
+    } else if((state == READ_SINGLE || state == READ_MULTI) && host_clock_ns() >= ready_ns) {
+        if(block >= sectors) {
+            out.push_back(0x08); // out of range error token
+            state= IDLE;
+        } else {
+            queue_block(&storage[(size_t)block * 512], 512);
+            ++block;
+            if(state == READ_SINGLE) state= IDLE;
+            ready_ns= host_clock_ns() + read_next_us * 1000ULL;
+        }
+    }
+
+    // what comes in, a data block being written, a data token, or a command
+    if(state == RECEIVE_BLOCK) {
+        rx_block.push_back(in);
+        if(rx_block.size() == 514) {
+            memcpy(&storage[(size_t)block * 512], rx_block.data(), 512);
+            ++block;
+            out.push_back(0xE5); // data accepted
+            state= (write_state == WRITE_MULTI && block < sectors) ? WRITE_MULTI : IDLE;
+            start_busy(write_state == WRITE_MULTI ? write_next_busy_us : write_busy_us);
+        }
+
+    } else if((state == WRITE_SINGLE && in == 0xFE) || (state == WRITE_MULTI && in == 0xFC)) {
+        write_state= state;
+        state= RECEIVE_BLOCK;
+        rx_block.clear();
+
+    } else if(state == WRITE_MULTI && in == 0xFD) {
+        // stop tran, a byte later the card goes busy while it finishes
+        state= IDLE;
+        out.push_back(0xFF);
+        start_busy(write_stop_busy_us);
+
+    } else if(cmd_len > 0 || (in & 0xC0) == 0x40) {
+        cmd_buf[cmd_len++]= in;
+        if(cmd_len == 6) {
+            cmd_len= 0;
+            command(cmd_buf[0] & 0x3F, (cmd_buf[1] << 24) | (cmd_buf[2] << 16) | (cmd_buf[3] << 8) | cmd_buf[4]);
+        }
+    }
+
+    return r;
+}
@@ -0,0 +1,64 @@
+/*
+      This file is part of Smoothie (http://smoothieware.org/). The motion control part is heavily based on Grbl (https://github.com/simen/grbl).
+      Smoothie is free software: you can redistribute it and/or modify it under the terms of the GNU General Public License as published by the Free Software Foundation, either version 3 of the License, or (at your option) any later version.
+      Smoothie is distributed in the hope that it will be useful, but WITHOUT ANY WARRANTY; without even the implied warranty of MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the GNU General Public License for more details.
+      You should have received a copy of the GNU General Public License along with Smoothie. If not, see <http://www.gnu.org/licenses/>.
+*/
+
+#pragma once
+
+#include <stddef.h>
+#include <stdint.h>
+#include <deque>
+#include <vector>
+
+// An SDHC card in SPI mode, attach exchange() to the SSP the SDCard driver uses.
+// It answers the commands SDCard.cpp sends, and takes time against the virtual clock to find data and to
+// program it. The times are rough figures for a class 10 card, they set the absolute MB/s but not which
+// way round the different ways of driving the card come out.
+class SdCardModel {
+    public:
+        SdCardModel(uint32_t sectors, uint8_t cs_port, uint8_t cs_pin);
+
+        uint8_t exchange(uint8_t out);
+
+        uint32_t get_commands() const { return commands; }
+        void reset_commands() { commands= 0; }
+
+        // time from a read command to the first block, and between the blocks of a multiple block read
+        uint32_t read_latency_us{100};
+        uint32_t read_next_us{10};
+        // busy time after a single block write, after each block of a multiple block write, and after stop tran
+        uint32_t write_busy_us{400};
+        uint32_t write_next_busy_us{50};
+        uint32_t write_stop_busy_us{400};
+
+    private:
+        enum state_t { IDLE, READ_SINGLE, READ_MULTI, WRITE_SINGLE, WRITE_MULTI, RECEIVE_BLOCK };
+
+        void command(uint8_t cmd, uint32_t arg);
+        void respond(uint8_t r1) { out.push_back(0xFF); out.push_back(r1); }
+        void queue_block(const uint8_t *data, size_t size);
+        void start_busy(uint32_t us);
+        bool cs_low() const;
+
+        std::vector<uint8_t> storage;
+        std::deque<uint8_t> out;        // bytes waiting to go out
+        uint8_t cmd_buf[6];
+        uint8_t cmd_len{0};
+        uint8_t csd[16];
+        state_t state{IDLE};
+        state_t write_state{IDLE};      // what RECEIVE_BLOCK goes back to
+        uint32_t block{0};
+        std::vector<uint8_t> rx_block;
+        uint64_t ready_ns{0};           // nothing is sent (read) or the card is busy (write) until then
+        bool busy{false};
+        uint32_t sectors;
+        uint32_t commands{0};
+        uint8_t op_cond_calls{0};
+        uint8_t cs_port, cs_pin;
+        struct {
+            bool app_cmd:1;
+            bool initialized:1;
+        };
+};
@@ -0,0 +1,90 @@
+/*
+      This file is part of Smoothie (http://smoothieware.org/). The motion control part is heavily based on Grbl (https://github.com/simen/grbl).
+      Smoothie is free software: you can redistribute it and/or modify it under the terms of the GNU General Public License as published by the Free Software Foundation, either version 3 of the License, or (at your option) any later version.
+      Smoothie is distributed in the hope that it will be useful, but WITHOUT ANY WARRANTY; without even the implied warranty of MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the GNU General Public License for more details.
+      You should have received a copy of the GNU General Public License along with Smoothie. If not, see <http://www.gnu.org/licenses/>.
+*/
+
+#include "StepTimeline.h"
+#include "HostHal.h"
+#include "Pin.h"
+
+StepTimeline::StepTimeline()
+{
+}
+
+void StepTimeline::add_actuator(const char *name, const Pin& step, const Pin& dir)
+{
+    actuator_t a;
+    a.name= name;
+    a.step_port= step.port_number;
+    a.step_pin= step.pin;
+    a.step_inverting= step.is_inverting();
+    a.dir_port= dir.port_number;
+    a.dir_pin= dir.pin;
+    a.dir_inverting= dir.is_inverting();
+    actuators.push_back(a);
+}
+
+void StepTimeline::set_dump_file(FILE *fp)
+{
+    dump_fp= fp;
+    if(dump_fp != nullptr) fprintf(dump_fp, "time_ns,actuator,signal,level\n");
+}
+
+void StepTimeline::on_gpio_edge(uint8_t port, uint8_t pin, bool level)
+{
+    uint64_t now= host_clock_ns();
+
+    for(auto &a : actuators) {
+        if(port == a.step_port && pin == a.step_pin) {
+            bool asserted= level ^ a.step_inverting;
+            if(asserted == a.step_level) continue;
+            a.step_level= asserted;
+
+            if(asserted) {
+                // a step is taken on the leading edge, direction as set by StepperMotor::set_direction()
+                a.position += a.dir_level ? -1 : 1;
+                if(a.steps > 0 && now - a.last_step_ns < a.min_step_period_ns) a.min_step_period_ns= now - a.last_step_ns;
+                if(a.dir_pending) {
+                    if(now - a.last_dir_ns < a.min_dir_setup_ns) a.min_dir_setup_ns= now - a.last_dir_ns;
+                    a.dir_pending= false;
+                }
+                a.last_step_ns= now;
+                ++a.steps;
+
+            }else if(now - a.last_step_ns < a.min_pulse_ns) {
+                a.min_pulse_ns= now - a.last_step_ns;
+            }
+
+            if(dump_fp != nullptr) fprintf(dump_fp, "%llu,%s,step,%d\n", (unsigned long long)now, a.name.c_str(), asserted);
+
+        }else if(port == a.dir_port && pin == a.dir_pin) {
+            bool d= level ^ a.dir_inverting;
+            if(d == a.dir_level) continue;
+            a.dir_level= d;
+            a.last_dir_ns= now;
+            a.dir_pending= true;
+            ++a.dir_changes;
+
+            if(dump_fp != nullptr) fprintf(dump_fp, "%llu,%s,dir,%d\n", (unsigned long long)now, a.name.c_str(), d);
+        }
+    }
+}
+
+void StepTimeline::report(FILE *fp) const
+{
+    for(auto &a : actuators) {
+        fprintf(fp, "  %-6s steps: %u position: %d dir changes: %u", a.name.c_str(), a.steps, a.position, a.dir_changes);
+        if(a.min_step_period_ns != UINT64_MAX) {
+            fprintf(fp, " max rate: %1.1f steps/s", 1e9 / a.min_step_period_ns);
+        }
+        if(a.min_pulse_ns != UINT64_MAX) {
+            fprintf(fp, " min pulse: %llu ns", (unsigned long long)a.min_pulse_ns);
+        }
+        if(a.min_dir_setup_ns != UINT64_MAX) {
+            fprintf(fp, " min dir setup: %llu ns", (unsigned long long)a.min_dir_setup_ns);
+        }
+        fprintf(fp, "\n");
+    }
+}
@@ -0,0 +1,59 @@
+/*
+      This file is part of Smoothie (http://smoothieware.org/). The motion control part is heavily based on Grbl (https://github.com/simen/grbl).
+      Smoothie is free software: you can redistribute it and/or modify it under the terms of the GNU General Public License as published by the Free Software Foundation, either version 3 of the License, or (at your option) any later version.
+      Smoothie is distributed in the hope that it will be useful, but WITHOUT ANY WARRANTY; without even the implied warranty of MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the GNU General Public License for more details.
+      You should have received a copy of the GNU General Public License along with Smoothie. If not, see <http://www.gnu.org/licenses/>.
+*/
+
+#pragma once
+
+#include <stdint.h>
+#include <stdio.h>
+#include <string>
+#include <vector>
+
+class Pin;
+
+// Records every step and dir edge of each actuator against the virtual clock
+// and keeps the statistics needed to check the step timing
+class StepTimeline {
+    public:
+        StepTimeline();
+
+        void add_actuator(const char *name, const Pin& step, const Pin& dir);
+        void on_gpio_edge(uint8_t port, uint8_t pin, bool level);
+
+        // optionally write every edge as csv: time_ns,actuator,signal,level
+        void set_dump_file(FILE *fp);
+
+        size_t get_num_actuators() const { return actuators.size(); }
+        int32_t get_position(size_t i) const { return actuators[i].position; }
+        // the starting position, non cartesian arm solutions do not start at 0 steps
+        void set_position(size_t i, int32_t steps) { actuators[i].position= steps; }
+        uint32_t get_steps(size_t i) const { return actuators[i].steps; }
+        const char *get_name(size_t i) const { return actuators[i].name.c_str(); }
+
+        void report(FILE *fp) const;
+
+    private:
+        struct actuator_t {
+            std::string name;
+            uint8_t step_port, step_pin, dir_port, dir_pin;
+            bool step_inverting, dir_inverting;
+
+            bool step_level{false};
+            bool dir_level{false};
+            int32_t position{0};               // net steps, same sign convention as StepperMotor
+            uint32_t steps{0};                 // total step pulses
+            uint32_t dir_changes{0};
+            uint64_t last_step_ns{0};
+            uint64_t last_dir_ns{0};
+            uint64_t min_step_period_ns{UINT64_MAX};
+            uint64_t min_pulse_ns{UINT64_MAX};
+            uint64_t min_dir_setup_ns{UINT64_MAX}; // time from a dir change to the next step
+            bool dir_pending{false};
+        };
+
+        std::vector<actuator_t> actuators;
+        FILE *dump_fp{nullptr};
+};
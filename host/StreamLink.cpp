@@ -0,0 +1,240 @@
+/*
+      This file is part of Smoothie (http://smoothieware.org/). The motion control part is heavily based on Grbl (https://github.com/simen/grbl).
+      Smoothie is free software: you can redistribute it and/or modify it under the terms of the GNU General Public License as published by the Free Software Foundation, either version 3 of the License, or (at your option) any later version.
+      Smoothie is distributed in the hope that it will be useful, but WITHOUT ANY WARRANTY; without even the implied warranty of MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the GNU General Public License for more details.
+      You should have received a copy of the GNU General Public License along with Smoothie. If not, see <http://www.gnu.org/licenses/>.
+*/
+
+#include "StreamLink.h"
+#include "HostHal.h"
+
+#include "libs/Kernel.h"
+#include "modules/robot/Conveyor.h"
+#include "us_ticker_api.h"
+
+#include <algorithm>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+
+// as USBSerial keeps back for ^X and ?, which is the size of its packets
+#define PACKET_SIZE 64
+#define BINBUF_SIZE 512
+// a reply the host is waiting for has been lost, as the window would swallow an ok
+#define STALL_US 1000000
+
+static uint64_t now_us() { return host_clock_ns() / 1000; }
+
+StreamLink::StreamLink(const std::vector<std::string>& lines, uint32_t latency_us, bool windowed)
+    : lines(lines), latency_us(latency_us), windowed(windowed)
+{
+}
+
+// the host has sent window and this is where the board gets it, the first ack is the reply
+void StreamLink::on_module_loaded()
+{
+    this->register_for_event(ON_IDLE);
+    if(windowed) start_window(true);
+}
+
+// the bytes go out one after another at a byte a microsecond, and each arrives latency_us after it went
+void StreamLink::send_to(std::deque<chunk_t>& link, uint64_t& free_us, const std::string& bytes)
+{
+    uint64_t start= std::max(free_us, now_us());
+    free_us= start + bytes.size();
+    link.push_back({free_us + latency_us, bytes});
+}
+
+int StreamLink::puts(const char *str)
+{
+    size_t n= strlen(str);
+    if(!window.is_ok(str)) send_to(to_host, to_host_free_us, str);
+    return n;
+}
+
+bool StreamLink::start_binary()
+{
+    if(binary || window.is_active()) return false;
+    decoder.reset();
+    binbuf.clear();
+    binary= true;
+    return true;
+}
+
+bool StreamLink::start_window(bool on)
+{
+    if(binary) return false;
+    if(on) {
+        window.start(us_ticker_read());
+    } else {
+        window.stop();
+    }
+    return true;
+}
+
+bool StreamLink::get_line(std::string& line)
+{
+    if(!rxbuf.has_line()) return false;
+    rxbuf.get_line(line);
+    window.line_taken(line.size() + 1);
+    ++taken;
+    return true;
+}
+
+void StreamLink::line_done()
+{
+    window.line_done();
+    report_window();
+    last_done_ns= host_clock_ns();
+}
+
+bool StreamLink::command(const std::string& line)
+{
+    if(line == "binary") {
+        if(start_binary()) {
+            puts("ok\n");
+        } else {
+            puts("error:binary streaming is not supported on this connection, or needs window off first\n");
+        }
+    } else if(line == "window off") {
+        start_window(false);
+        puts("ok\n");
+    } else {
+        return false;
+    }
+    line_done();
+    return true;
+}
+
+// the motion and text records are dispatched by the caller, the end record is answered here as USBSerial does
+BinaryGcodeDecoder::result_t StreamLink::get_record()
+{
+    size_t used;
+    BinaryGcodeDecoder::result_t r= decoder.put(binbuf.data(), binbuf.size(), used);
+    binbuf.erase(0, used);
+    if(r == BinaryGcodeDecoder::ENDED) {
+        binary= false;
+        char buf[32];
+        snprintf(buf, sizeof(buf), "ok binary %lu\r\n", (unsigned long)decoder.get_records() - 1);
+        puts(buf);
+    } else if(r == BinaryGcodeDecoder::ERROR) {
+        binary= false;
+    }
+    return r;
+}
+
+void StreamLink::report_window()
+{
+    char buf[32];
+    int room= rxbuf.free() - PACKET_SIZE;
+    if(window.report(rxbuf.line_count(), room > 0 ? room : 0, THECONVEYOR->get_free_blocks(), us_ticker_read(), buf, sizeof(buf)) > 0) {
+        puts(buf);
+    }
+}
+
+// the records before the end record of a file in the binary format, which the ok binary reply has to match
+static long count_records(const std::string& file)
+{
+    BinaryGcodeDecoder decoder;
+    for(size_t i= 0, used; i < file.size(); i += used) {
+        BinaryGcodeDecoder::result_t r= decoder.put(&file[i], file.size() - i, used);
+        if(r == BinaryGcodeDecoder::ENDED) return decoder.get_records() - 1;
+        if(r == BinaryGcodeDecoder::ERROR) break;
+    }
+    return -1;
+}
+
+void StreamLink::host_receive(const std::string& reply)
+{
+    unsigned long done, window, records;
+    bool ok= reply.compare(0, 2, "ok") == 0;
+    if(windowed && sscanf(reply.c_str(), "ack %lu %lu", &done, &window) == 2) {
+        acked= done;
+        limit= done + window;
+        started= true;
+        ++acks;
+
+    } else if(phase == BINARY_SENT && sscanf(reply.c_str(), "ok binary %lu", &records) == 1) {
+        // any other ok is from a text record, and the board is still taking records
+        if((long)records != count_records(lines[next])) {
+            error= "the ok binary reply has the wrong number of records: " + reply;
+        }
+        binary_records += records;
+        phase= SENDING;
+        ++next;
+
+    } else if(phase == BINARY_ASKED && (ok || reply.compare(0, 6, "error:") == 0)) {
+        if(!ok && windowed) {
+            // the lines before it are done once window off has its ok, as the window no longer swallows them
+            ++binary_refused;
+            host_send("window off");
+            phase= WINDOW_OFF_ASKED;
+            return;
+        }
+        if(!ok) {
+            error= "the binary command failed: " + reply;
+            return;
+        }
+        ++oks;
+        const std::string& file= lines[next];
+        for(size_t i= 0; i < file.size(); i += PACKET_SIZE) {
+            send_to(to_board, to_board_free_us, file.substr(i, PACKET_SIZE));
+        }
+        phase= BINARY_SENT;
+
+    } else if(phase == WINDOW_OFF_ASKED && ok) {
+        windowed= false;
+        oks= sent;
+        phase= SENDING;
+
+    } else if(!windowed && phase == SENDING && ok) {
+        ++oks;
+    } else if(verbose && !ok) {
+        fputs(reply.c_str(), stdout);
+    }
+}
+
+void StreamLink::host_send(const std::string& line)
+{
+    send_to(to_board, to_board_free_us, line + "\n");
+    ++sent;
+}
+
+void StreamLink::on_idle(void *)
+{
+    uint64_t now= now_us();
+
+    // the board receives what has arrived, as long as there is room for it
+    while(!to_board.empty() && to_board.front().at_us <= now) {
+        const std::string& bytes= to_board.front().bytes;
+        if(binary) {
+            if(binbuf.size() + bytes.size() > BINBUF_SIZE) break;
+            binbuf += bytes;
+        } else {
+            if((size_t)rxbuf.free() < bytes.size()) break;
+            for(char c : bytes) rxbuf.put(c);
+        }
+        to_board.pop_front();
+    }
+    report_window();
+
+    // the host reads the replies that have arrived and sends what it may
+    while(!to_host.empty() && to_host.front().at_us <= now) {
+        host_receive(to_host.front().bytes);
+        to_host.pop_front();
+    }
+    if(phase == SENDING || !binbuf.empty() || !to_board.empty() || !to_host.empty() || rxbuf.has_line()) {
+        waiting_since_us= now;
+    } else if(now - waiting_since_us > STALL_US) {
+        error= "the host never had the reply it was waiting for";
+    }
+
+    while(phase == SENDING && next < lines.size() && (windowed ? started && sent < limit : sent == oks)) {
+        if(BinaryGcodeDecoder::is_header(lines[next].data(), lines[next].size())) {
+            host_send("binary");
+            phase= BINARY_ASKED;
+        } else {
+            host_send(lines[next++]);
+        }
+    }
+}
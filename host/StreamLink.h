@@ -0,0 +1,103 @@
+/*
+      This file is part of Smoothie (http://smoothieware.org/). The motion control part is heavily based on Grbl (https://github.com/simen/grbl).
+      Smoothie is free software: you can redistribute it and/or modify it under the terms of the GNU General Public License as published by the Free Software Foundation, either version 3 of the License, or (at your option) any later version.
+      Smoothie is distributed in the hope that it will be useful, but WITHOUT ANY WARRANTY; without even the implied warranty of MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the GNU General Public License for more details.
+      You should have received a copy of the GNU General Public License along with Smoothie. If not, see <http://www.gnu.org/licenses/>.
+*/
+
+#pragma once
+
+#include "libs/Module.h"
+#include "libs/StreamOutput.h"
+#include "LineBuffer.h"
+#include "AckWindow.h"
+#include "BinaryGcode.h"
+
+#include <deque>
+#include <string>
+#include <vector>
+
+// Stands in for the USB serial stream and for a host streaming a job to it. Each way the bytes take latency_us to
+// arrive and then come at a byte a microsecond, and what arrives for the board waits while rxbuf is full, as USB
+// holds the host off. The host either sends a line and waits for its ok, or with the window sends as the acks of
+// AckWindow allow. On the board a line is taken out of rxbuf by the main loop and its ok or ack is sent as
+// USBSerial does, the host side runs in the idle loop.
+// A line that is a whole file in the binary format is streamed the way BinaryGcode.h says, the host sends binary and
+// waits for its ok, sends the file a packet at a time, and sends text again once the ok binary reply to the end record
+// has come, not at the oks of the text records before it. On the board the bytes go into binbuf and are decoded as
+// USBSerial::feed_binary() does. With the window on the binary command is refused, and the host turns it off and
+// carries on with an ok for each line.
+class StreamLink : public Module, public StreamOutput {
+    public:
+        StreamLink(const std::vector<std::string>& lines, uint32_t latency_us, bool windowed);
+
+        void on_module_loaded();
+        void on_idle(void *);
+
+        int puts(const char *str);
+        bool start_binary();
+        bool start_window(bool on);
+
+        // the board side, a line from rxbuf to be dispatched, and then done
+        bool get_line(std::string& line);
+        void line_done();
+        // runs the binary and window commands as SimpleShell does, returns false for any other line
+        bool command(const std::string& line);
+        // in binary mode, decodes what has arrived up to the end of the next record
+        bool is_binary() const { return binary; }
+        BinaryGcodeDecoder::result_t get_record();
+        const BinaryGcodeDecoder& get_decoder() const { return decoder; }
+
+        // the host has heard that every line is done, or has given up
+        bool is_finished() const { return !error.empty() || (next == lines.size() && phase == SENDING && (windowed ? acked : oks) == sent); }
+        const std::string& get_error() const { return error; }
+        uint32_t get_oks() const { return oks; }
+        uint32_t get_acks() const { return acks; }
+        uint32_t get_binary_records() const { return binary_records; }
+        uint32_t get_binary_refused() const { return binary_refused; }
+        // text sent while the board was still taking records is lost
+        uint32_t get_sent() const { return sent; }
+        uint32_t get_taken() const { return taken; }
+        uint64_t get_last_done_ns() const { return last_done_ns; }
+
+        bool verbose{false};
+
+    private:
+        struct chunk_t {
+            uint64_t at_us;
+            std::string bytes;
+        };
+
+        void send_to(std::deque<chunk_t>& link, uint64_t& free_us, const std::string& bytes);
+        void report_window();
+        void host_receive(const std::string& reply);
+        void host_send(const std::string& line);
+
+        const std::vector<std::string>& lines;
+        uint32_t latency_us;
+        bool windowed;
+
+        LineBuffer<256> rxbuf;
+        std::string binbuf;         // the same size as USBSerial's
+        BinaryGcodeDecoder decoder;
+        AckWindow window;
+        bool binary{false};
+        size_t taken{0};            // lines taken out of rxbuf
+        std::deque<chunk_t> to_board, to_host;
+        uint64_t to_board_free_us{0}, to_host_free_us{0};   // when each link has sent what it has been given
+
+        // the host
+        enum { SENDING, BINARY_ASKED, BINARY_SENT, WINDOW_OFF_ASKED } phase{SENDING};
+        size_t next{0};             // line to send
+        size_t sent{0};             // lines of text sent, including the binary commands
+        size_t oks{0};
+        size_t acked{0};            // lines done, from the last ack
+        size_t limit{0};            // lines the last ack allows to be sent
+        bool started{false};        // the first ack has come
+        uint32_t acks{0};
+        uint32_t binary_records{0}; // in the ok binary replies
+        uint32_t binary_refused{0}; // because the window was on
+        uint64_t last_done_ns{0};
+        uint64_t waiting_since_us{0};   // for a reply with nothing left for the board to do
+        std::string error;
+};
@@ -0,0 +1,8 @@
+// Host replacement for mbed's DirHandle.h, the host's own directory functions with the d_isdir the board's
+// dirent has
+#pragma once
+
+#include <dirent.h>
+#include <sys/stat.h>
+
+#define d_isdir d_type == DT_DIR
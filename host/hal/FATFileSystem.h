@@ -0,0 +1,5 @@
+// Host replacement for FATFileSystem.h, files are the host's own
+#pragma once
+
+#include <stdio.h>
+#include <sys/stat.h>
@@ -0,0 +1,85 @@
+/*
+      This file is part of Smoothie (http://smoothieware.org/). The motion control part is heavily based on Grbl (https://github.com/simen/grbl).
+      Smoothie is free software: you can redistribute it and/or modify it under the terms of the GNU General Public License as published by the Free Software Foundation, either version 3 of the License, or (at your option) any later version.
+      Smoothie is distributed in the hope that it will be useful, but WITHOUT ANY WARRANTY; without even the implied warranty of MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the GNU General Public License for more details.
+      You should have received a copy of the GNU General Public License along with Smoothie. If not, see <http://www.gnu.org/licenses/>.
+*/
+
+// Host replacement for src/libs/gpio.cpp, pins map onto the fake GPIO ports, pin functions are not modeled
+
+#include "gpio.h"
+#include "libs/LPC17xx/sLPC17xx.h"
+
+static LPC_GPIO_TypeDef *gpio_port(uint8_t port)
+{
+    return &host_gpio[port];
+}
+
+GPIO::GPIO(PinName pin) {
+    this->port = (pin >> 5) & 7;
+    this->pin = pin & 0x1F;
+
+    setup();
+}
+
+GPIO::GPIO(uint8_t port, uint8_t pin) {
+    GPIO::port = port;
+    GPIO::pin = pin;
+
+    setup();
+}
+
+GPIO::GPIO(uint8_t port, uint8_t pin, uint8_t direction) {
+    GPIO::port = port;
+    GPIO::pin = pin;
+
+    setup();
+
+    set_direction(direction);
+}
+
+void GPIO::setup() {
+}
+
+void GPIO::set_direction(uint8_t direction) {
+    if(direction)
+        gpio_port(port)->FIODIR |= 1UL << pin;
+    else
+        gpio_port(port)->FIODIR &= ~(1UL << pin);
+}
+
+void GPIO::output() {
+    set_direction(1);
+}
+
+void GPIO::input() {
+    set_direction(0);
+}
+
+void GPIO::write(uint8_t value) {
+    output();
+    if (value)
+        set();
+    else
+        clear();
+}
+
+void GPIO::set() {
+    gpio_port(port)->FIOSET = 1UL << pin;
+}
+
+void GPIO::clear() {
+    gpio_port(port)->FIOCLR = 1UL << pin;
+}
+
+uint8_t GPIO::get() {
+    return (gpio_port(port)->FIOPIN & (1UL << pin)) ? 255 : 0;
+}
+
+int GPIO::operator=(int value) {
+    if (value)
+        set();
+    else
+        clear();
+    return value;
+}
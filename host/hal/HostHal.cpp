@@ -0,0 +1,412 @@
+/*
+      This file is part of Smoothie (http://smoothieware.org/). The motion control part is heavily based on Grbl (https://github.com/simen/grbl).
+      Smoothie is free software: you can redistribute it and/or modify it under the terms of the GNU General Public License as published by the Free Software Foundation, either version 3 of the License, or (at your option) any later version.
+      Smoothie is distributed in the hope that it will be useful, but WITHOUT ANY WARRANTY; without even the implied warranty of MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the GNU General Public License for more details.
+      You should have received a copy of the GNU General Public License along with Smoothie. If not, see <http://www.gnu.org/licenses/>.
+*/
+
+#include "HostHal.h"
+#include "libs/LPC17xx/sLPC17xx.h"
+#include "us_ticker_api.h"
+#include "wait_api.h"
+#include "mri.h"
+#include "MRI_Hooks.h"
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <bitset>
+#include <deque>
+#include <new>
+
+LPC_GPIO_TypeDef host_gpio[5];
+LPC_TIM_TypeDef host_tim[4];
+LPC_SC_TypeDef host_sc;
+LPC_WDT_TypeDef host_wdt;
+LPC_PINCON_TypeDef host_pincon;
+LPC_SSP_TypeDef host_ssp[2];
+LPC_GPDMA_TypeDef host_gpdma;
+LPC_GPDMACH_TypeDef host_gpdmach[8];
+DWT_Type host_dwt;
+CoreDebug_Type host_core_debug;
+
+uint32_t SystemCoreClock= HOST_CORE_CLOCK;
+
+// the interrupt handlers are the real ones from StepTicker.cpp
+extern "C" void TIMER0_IRQHandler(void);
+extern "C" void TIMER1_IRQHandler(void);
+
+static uint64_t now; // virtual time in timer counts
+static std::bitset<64> irq_enabled;
+static host_gpio_edge_fnc_t gpio_edge_fnc;
+static host_isr_fnc_t isr_fnc;
+
+// SSP receive FIFOs, the device on each bus, and the core clocks not yet added to the clock
+static std::deque<uint8_t> ssp_rx[2];
+static host_ssp_fnc_t ssp_fnc[2];
+static uint32_t spare_cycles;
+
+// state of the two timers that drive the step ticker
+static struct {
+    uint64_t start;     // when TC was last 0
+    uint64_t due;
+    bool armed;
+} timers[2];
+
+uint64_t host_clock_counts()
+{
+    return now;
+}
+
+static void gpio_changed(LPC_GPIO_TypeDef *port, uint32_t old_value)
+{
+    uint32_t changed= old_value ^ port->FIOPIN.value;
+    if(changed == 0 || !gpio_edge_fnc) return;
+
+    uint8_t n= port - host_gpio;
+    for (uint8_t pin = 0; pin < 32; ++pin) {
+        if(changed & (1<<pin)) gpio_edge_fnc(n, pin, (port->FIOPIN.value >> pin) & 1);
+    }
+}
+
+static void gpio_set_write(HostReg *reg, uint32_t v)
+{
+    LPC_GPIO_TypeDef *port= static_cast<LPC_GPIO_TypeDef*>(reg->context);
+    uint32_t old= port->FIOPIN.value;
+    port->FIOPIN.value |= (v & ~port->FIOMASK.value);
+    gpio_changed(port, old);
+}
+
+static void gpio_clr_write(HostReg *reg, uint32_t v)
+{
+    LPC_GPIO_TypeDef *port= static_cast<LPC_GPIO_TypeDef*>(reg->context);
+    uint32_t old= port->FIOPIN.value;
+    port->FIOPIN.value &= ~(v & ~port->FIOMASK.value);
+    gpio_changed(port, old);
+}
+
+static void gpio_pin_write(HostReg *reg, uint32_t v)
+{
+    LPC_GPIO_TypeDef *port= static_cast<LPC_GPIO_TypeDef*>(reg->context);
+    uint32_t old= port->FIOPIN.value;
+    port->FIOPIN.value= (old & port->FIOMASK.value) | (v & ~port->FIOMASK.value);
+    gpio_changed(port, old);
+}
+
+// writing 1 to TCR (after a reset with 3) starts the timer counting from 0 towards MR0
+static void tim_tcr_write(HostReg *reg, uint32_t v)
+{
+    reg->value= v;
+    int n= (LPC_TIM_TypeDef*)reg->context - host_tim;
+    if(v & 2) {
+        host_tim[n].TC.value= 0;
+        timers[n].armed= false;
+
+    }else if(v & 1) {
+        timers[n].start= now;
+        timers[n].due= now + host_tim[n].MR0.value;
+        timers[n].armed= true;
+
+    }else{
+        timers[n].armed= false;
+    }
+}
+
+// changing the match register of a running timer moves the next match, if the count is already past it the timer
+// has to wrap all the way round first, as on the real thing
+static void tim_mr0_write(HostReg *reg, uint32_t v)
+{
+    reg->value= v;
+    int n= (LPC_TIM_TypeDef*)reg->context - host_tim;
+    if(!timers[n].armed) return;
+    // a match that has already happened is still pending, and the count started again from it
+    if(timers[n].due <= now) return;
+    timers[n].due= timers[n].start + v;
+    if(timers[n].due <= now) timers[n].due += 0x100000000ULL;
+}
+
+// the count of a running timer, reading it takes one count of time. TIMER0 resets on its match even while the
+// interrupt for the match before is still running
+static uint32_t tim_tc_read(const HostReg *reg)
+{
+    int n= (LPC_TIM_TypeDef*)reg->context - host_tim;
+    if(!timers[n].armed) return reg->value;
+    uint64_t t= now++;
+    if(n == 0 && t >= timers[0].due) return t - timers[0].due;
+    return t - timers[n].start;
+}
+
+// the DWT cycle counter follows the virtual clock, value holds the offset from it
+static uint32_t cyccnt_read(const HostReg *reg)
+{
+    return reg->value + (uint32_t)(now * (HOST_CORE_CLOCK / HOST_TIMER_CLOCK));
+}
+
+static void cyccnt_write(HostReg *reg, uint32_t v)
+{
+    reg->value= v - (uint32_t)(now * (HOST_CORE_CLOCK / HOST_TIMER_CLOCK));
+}
+
+static void tim_tc_write(HostReg *reg, uint32_t v)
+{
+    reg->value= v;
+    int n= (LPC_TIM_TypeDef*)reg->context - host_tim;
+    if(!timers[n].armed) return;
+    timers[n].start= now - v;
+    timers[n].due= timers[n].start + host_tim[n].MR0.value;
+    if(timers[n].due <= now) timers[n].due += 0x100000000ULL;
+}
+
+// the SSP clock is PCLK / (CPSR * (SCR + 1)), with PCLK at the core clock as mbed sets it up
+static uint8_t ssp_exchange(int n, uint8_t out)
+{
+    uint8_t in= ssp_fnc[n] ? ssp_fnc[n](out) : 0xFF;
+    uint32_t cpsr= host_ssp[n].CPSR.value ? host_ssp[n].CPSR.value : 2;
+    host_clock_advance_cycles(8 * cpsr * (((host_ssp[n].CR0.value >> 8) & 0xFF) + 1));
+    return in;
+}
+
+static void ssp_push_rx(int n, uint8_t in)
+{
+    // the FIFO is 8 deep, the oldest byte is lost when it overruns
+    if(ssp_rx[n].size() >= 8) ssp_rx[n].pop_front();
+    ssp_rx[n].push_back(in);
+}
+
+// GPDMA peripheral numbers, SSP0 Tx is 0 and Rx 1, SSP1 Tx is 2 and Rx 3
+static LPC_GPDMACH_TypeDef *find_dma_channel(uint32_t type, uint32_t peripheral)
+{
+    if(!(host_gpdma.DMACConfig.value & 1)) return nullptr;
+    for (int i = 0; i < 8; ++i) {
+        uint32_t config= host_gpdmach[i].DMACCConfig.value;
+        if(!(config & 1) || ((config >> 11) & 7) != type) continue;
+        if((type == 1 ? (config >> 6) : (config >> 1)) % 32 == peripheral) return &host_gpdmach[i];
+    }
+    return nullptr;
+}
+
+static void dma_channel_done(LPC_GPDMACH_TypeDef *ch)
+{
+    int i= ch - host_gpdmach;
+    ch->DMACCConfig.value &= ~1;
+    host_gpdma.DMACEnbldChns.value &= ~(1 << i);
+    host_gpdma.DMACRawIntTCStat.value |= 1 << i;
+}
+
+// once the SSP asks for transmit data an enabled memory to SSP channel runs to the end, each byte clocked back
+// goes to the SSP to memory channel if there is one, otherwise into the receive FIFO
+static void run_ssp_dma(int n)
+{
+    if(!(host_ssp[n].DMACR.value & 2)) return;
+    LPC_GPDMACH_TypeDef *tx= find_dma_channel(1, n * 2);
+    if(tx == nullptr) return;
+
+    uint32_t count= tx->DMACCControl.value & 0xFFF;
+    const uint8_t *src= (const uint8_t*)tx->DMACCSrcAddr.value;
+    for (uint32_t i = 0; i < count; ++i) {
+        uint8_t in= ssp_exchange(n, *src);
+        if(tx->DMACCControl.value & (1UL << 26)) ++src;
+
+        LPC_GPDMACH_TypeDef *rx= (host_ssp[n].DMACR.value & 1) ? find_dma_channel(2, n * 2 + 1) : nullptr;
+        if(rx == nullptr) {
+            ssp_push_rx(n, in);
+            continue;
+        }
+        *(uint8_t*)rx->DMACCDestAddr.value= in;
+        if(rx->DMACCControl.value & (1UL << 27)) rx->DMACCDestAddr.value++;
+        rx->DMACCControl.value= (rx->DMACCControl.value & ~0xFFF) | ((rx->DMACCControl.value & 0xFFF) - 1);
+        if((rx->DMACCControl.value & 0xFFF) == 0) dma_channel_done(rx);
+    }
+    tx->DMACCControl.value &= ~0xFFF;
+    dma_channel_done(tx);
+}
+
+static void ssp_dr_write(HostReg *reg, uint32_t v)
+{
+    int n= (LPC_SSP_TypeDef*)reg->context - host_ssp;
+    ssp_push_rx(n, ssp_exchange(n, v));
+}
+
+static uint32_t ssp_dr_read(const HostReg *reg)
+{
+    int n= (LPC_SSP_TypeDef*)reg->context - host_ssp;
+    if(ssp_rx[n].empty()) return 0;
+    uint8_t in= ssp_rx[n].front();
+    ssp_rx[n].pop_front();
+    return in;
+}
+
+// transmit FIFO empty and not full, receive FIFO not empty if there is anything in it, never busy
+static uint32_t ssp_sr_read(const HostReg *reg)
+{
+    int n= (LPC_SSP_TypeDef*)reg->context - host_ssp;
+    return 3 | (ssp_rx[n].empty() ? 0 : 4);
+}
+
+static void ssp_dmacr_write(HostReg *reg, uint32_t v)
+{
+    reg->value= v;
+    run_ssp_dma((LPC_SSP_TypeDef*)reg->context - host_ssp);
+}
+
+static void dma_config_write(HostReg *reg, uint32_t v)
+{
+    reg->value= v;
+    if(!(v & 1)) return;
+    int i= (LPC_GPDMACH_TypeDef*)reg->context - host_gpdmach;
+    host_gpdma.DMACEnbldChns.value |= 1 << i;
+    if(((v >> 11) & 7) == 1 && ((v >> 6) & 0x1F) <= 2) run_ssp_dma(((v >> 6) & 0x1F) / 2);
+}
+
+void host_ssp_attach(int n, host_ssp_fnc_t fnc)
+{
+    ssp_fnc[n]= fnc;
+}
+
+void host_clock_advance_cycles(uint32_t core_cycles)
+{
+    spare_cycles += core_cycles;
+    host_clock_advance_counts(spare_cycles / (HOST_CORE_CLOCK / HOST_TIMER_CLOCK));
+    spare_cycles %= HOST_CORE_CLOCK / HOST_TIMER_CLOCK;
+}
+
+void host_hal_reset()
+{
+    now= 0;
+    irq_enabled.reset();
+    timers[0].armed= timers[1].armed= false;
+
+    for (int i = 0; i < 5; ++i) {
+        new (&host_gpio[i]) LPC_GPIO_TypeDef();
+        host_gpio[i].FIOSET.on_write= gpio_set_write;
+        host_gpio[i].FIOCLR.on_write= gpio_clr_write;
+        host_gpio[i].FIOPIN.on_write= gpio_pin_write;
+        host_gpio[i].FIOSET.context= host_gpio[i].FIOCLR.context= host_gpio[i].FIOPIN.context= &host_gpio[i];
+    }
+
+    for (int i = 0; i < 2; ++i) {
+        new (&host_ssp[i]) LPC_SSP_TypeDef();
+        ssp_rx[i].clear();
+        host_ssp[i].DR.on_write= ssp_dr_write;
+        host_ssp[i].DR.on_read= ssp_dr_read;
+        host_ssp[i].SR.on_read= ssp_sr_read;
+        host_ssp[i].DMACR.on_write= ssp_dmacr_write;
+        host_ssp[i].DR.context= host_ssp[i].SR.context= host_ssp[i].DMACR.context= &host_ssp[i];
+    }
+
+    new (&host_gpdma) LPC_GPDMA_TypeDef();
+    for (int i = 0; i < 8; ++i) {
+        new (&host_gpdmach[i]) LPC_GPDMACH_TypeDef();
+        host_gpdmach[i].DMACCConfig.on_write= dma_config_write;
+        host_gpdmach[i].DMACCConfig.context= &host_gpdmach[i];
+    }
+    spare_cycles= 0;
+
+    new (&host_dwt) DWT_Type();
+    host_dwt.CYCCNT.on_read= cyccnt_read;
+    host_dwt.CYCCNT.on_write= cyccnt_write;
+
+    for (int i = 0; i < 4; ++i) {
+        new (&host_tim[i]) LPC_TIM_TypeDef();
+        if(i < 2) {
+            host_tim[i].TCR.on_write= tim_tcr_write;
+            host_tim[i].MR0.on_write= tim_mr0_write;
+            host_tim[i].TC.on_write= tim_tc_write;
+            host_tim[i].TC.on_read= tim_tc_read;
+            host_tim[i].TCR.context= host_tim[i].MR0.context= host_tim[i].TC.context= &host_tim[i];
+        }
+    }
+}
+
+static bool run_next_timer(uint64_t until)
+{
+    // TIMER1 (unstep) has the higher priority so it wins a tie
+    int n= -1;
+    for (int i = 1; i >= 0; --i) {
+        if(!timers[i].armed || !irq_enabled[TIMER0_IRQn + i]) continue;
+        if(timers[i].due > until) continue;
+        if(n < 0 || timers[i].due < timers[n].due) n= i;
+    }
+    if(n < 0) return false;
+
+    // if the last interrupt ran past this one's match it runs as soon as that one ends
+    uint64_t match= timers[n].due;
+    if(now < match) now= match;
+    if(n == 0) {
+        // TIMER0 resets on match (MCR=3) and keeps running
+        timers[0].start= match;
+        timers[0].due= match + (host_tim[0].MR0.value ? host_tim[0].MR0.value : 1);
+    }else{
+        // TIMER1 stops on match (MCR=5)
+        timers[1].armed= false;
+        host_tim[1].TCR.value= 0;
+    }
+
+    if(isr_fnc) isr_fnc(TIMER0_IRQn + n, true);
+    if(n == 0) TIMER0_IRQHandler(); else TIMER1_IRQHandler();
+    if(isr_fnc) isr_fnc(TIMER0_IRQn + n, false);
+    return true;
+}
+
+void host_clock_advance_counts(uint64_t counts)
+{
+    uint64_t until= now + counts;
+    while(run_next_timer(until)) ;
+    // an interrupt that busy waited may have run past until
+    if(now < until) now= until;
+}
+
+void host_gpio_attach(host_gpio_edge_fnc_t fnc)
+{
+    gpio_edge_fnc= fnc;
+}
+
+void host_isr_attach(host_isr_fnc_t fnc)
+{
+    isr_fnc= fnc;
+}
+
+void NVIC_EnableIRQ(IRQn_Type irq)
+{
+    if(irq >= 0) irq_enabled.set(irq);
+}
+
+void NVIC_DisableIRQ(IRQn_Type irq)
+{
+    if(irq >= 0) irq_enabled.reset(irq);
+}
+
+void NVIC_SystemReset(void)
+{
+    fprintf(stderr, "NVIC_SystemReset called\n");
+    exit(1);
+}
+
+extern "C" uint32_t us_ticker_read(void)
+{
+    return now / (HOST_TIMER_CLOCK / 1000000);
+}
+
+extern "C" void wait(float s)
+{
+    host_clock_advance_counts(s * HOST_TIMER_CLOCK);
+}
+
+extern "C" void wait_ms(int ms)
+{
+    host_clock_advance_us(ms * 1000);
+}
+
+extern "C" void wait_us(int us)
+{
+    host_clock_advance_us(us);
+}
+
+extern "C" void __debugbreak(void)
+{
+    fprintf(stderr, "__debugbreak() called at %1.6f s\n", host_clock_seconds());
+    abort();
+}
+
+extern "C" void set_high_on_debug(int port, int pin) {}
+extern "C" void set_low_on_debug(int port, int pin) {}
@@ -0,0 +1,71 @@
+/*
+      This file is part of Smoothie (http://smoothieware.org/). The motion control part is heavily based on Grbl (https://github.com/simen/grbl).
+      Smoothie is free software: you can redistribute it and/or modify it under the terms of the GNU General Public License as published by the Free Software Foundation, either version 3 of the License, or (at your option) any later version.
+      Smoothie is distributed in the hope that it will be useful, but WITHOUT ANY WARRANTY; without even the implied warranty of MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the GNU General Public License for more details.
+      You should have received a copy of the GNU General Public License along with Smoothie. If not, see <http://www.gnu.org/licenses/>.
+*/
+
+/*
+ * Fake LPC17xx HAL for the host simulator.
+ *
+ * Peripheral registers are plain memory, except the ones the motion code uses to talk to the hardware:
+ * GPIO set/clear/pin writes are reported as edges, and writing TCR on TIMER0/TIMER1 arms the virtual timers.
+ * Nothing runs on its own, time only moves forward when host_clock_advance() is called, and any timer
+ * interrupts that fall due are run in order from inside that call. This makes every run deterministic.
+ * The one exception is reading the TIMER0 count, each read moves the clock on by one count so code that
+ * busy waits on it sees time pass.
+ */
+
+#pragma once
+
+#include <stdint.h>
+#include <functional>
+
+// the LPC1768 timers count at SystemCoreClock/4, that is the resolution of the virtual clock
+#define HOST_CORE_CLOCK 100000000UL
+#define HOST_TIMER_CLOCK (HOST_CORE_CLOCK/4)
+
+// a memory mapped register, reads and writes can optionally be trapped
+struct HostReg {
+    uint32_t value{0};
+    void (*on_write)(HostReg *reg, uint32_t v){nullptr};
+    uint32_t (*on_read)(const HostReg *reg){nullptr};
+    void *context{nullptr};
+
+    operator uint32_t() const { return on_read ? on_read(this) : value; }
+    HostReg& operator= (uint32_t v) { if(on_write) on_write(this, v); else value= v; return *this; }
+    HostReg& operator= (const HostReg& r) { return *this= r.value; }
+    HostReg& operator|= (uint32_t v) { return *this= value | v; }
+    HostReg& operator&= (uint32_t v) { return *this= value & v; }
+};
+
+// virtual clock in timer counts (40ns at 100MHz)
+uint64_t host_clock_counts();
+inline uint64_t host_clock_ns() { return host_clock_counts() * (1000000000ULL / HOST_TIMER_CLOCK); }
+inline double host_clock_seconds() { return (double)host_clock_counts() / HOST_TIMER_CLOCK; }
+
+// move the virtual clock forward, running any timer interrupts that become due
+void host_clock_advance_counts(uint64_t counts);
+inline void host_clock_advance_us(uint32_t us) { host_clock_advance_counts((uint64_t)us * (HOST_TIMER_CLOCK / 1000000)); }
+
+// reset the clock and all peripherals to their power on state
+void host_hal_reset();
+
+// called for every change of level on a GPIO pin
+using host_gpio_edge_fnc_t = std::function<void(uint8_t port, uint8_t pin, bool level)>;
+void host_gpio_attach(host_gpio_edge_fnc_t fnc);
+
+// called on entry and exit of each timer interrupt handler, used to measure ISR cost
+using host_isr_fnc_t = std::function<void(int irq, bool enter)>;
+void host_isr_attach(host_isr_fnc_t fnc);
+
+// the device on SSP n, it is given each byte sent and returns the byte clocked back at the same time, with
+// nothing attached the bus reads 0xFF. Each byte moves the clock on by 8 SSP clocks, the GPDMA moves bytes back
+// to back and an mbed SPI::write() takes HOST_SPI_WRITE_CYCLES of CPU time on top.
+using host_ssp_fnc_t = std::function<uint8_t(uint8_t out)>;
+void host_ssp_attach(int n, host_ssp_fnc_t fnc);
+
+// an estimate of the core clocks one SPI::write() spends besides waiting for the byte: the call, the FIFO polls
+// and the loop around it
+#define HOST_SPI_WRITE_CYCLES 32
+void host_clock_advance_cycles(uint32_t core_cycles);
@@ -0,0 +1,72 @@
+/*
+      This file is part of Smoothie (http://smoothieware.org/). The motion control part is heavily based on Grbl (https://github.com/simen/grbl).
+      Smoothie is free software: you can redistribute it and/or modify it under the terms of the GNU General Public License as published by the Free Software Foundation, either version 3 of the License, or (at your option) any later version.
+      Smoothie is distributed in the hope that it will be useful, but WITHOUT ANY WARRANTY; without even the implied warranty of MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the GNU General Public License for more details.
+      You should have received a copy of the GNU General Public License along with Smoothie. If not, see <http://www.gnu.org/licenses/>.
+*/
+
+// Host replacement for src/libs/Pin.cpp, pins map onto the fake GPIO ports, pin modes and pwm/interrupts are not modeled
+
+#include "Pin.h"
+#include "utils.h"
+
+Pin::Pin(){
+    this->inverting= false;
+    this->valid= false;
+    this->pin= 32;
+    this->port= nullptr;
+}
+
+// Make a new pin object from a string, same syntax as the firmware
+Pin* Pin::from_string(std::string value){
+    if(value == "nc") {
+        this->valid= false;
+        return this;
+    }
+
+    LPC_GPIO_TypeDef* gpios[5] ={LPC_GPIO0,LPC_GPIO1,LPC_GPIO2,LPC_GPIO3,LPC_GPIO4};
+
+    const char* cs = value.c_str();
+    char* cn = NULL;
+    valid= true;
+
+    this->port_number = strtol(cs, &cn, 10);
+    if ((cn > cs) && (port_number <= 4)){
+        this->port = gpios[(unsigned int) this->port_number];
+        if (*cn == '.'){
+            cs = ++cn;
+            this->pin = strtol(cs, &cn, 10);
+            if ((cn > cs) && (pin < 32)){
+                this->port->FIOMASK &= ~(1 << this->pin);
+                for (;*cn;cn++) {
+                    switch(*cn) {
+                        case '!':
+                            this->inverting = true;
+                            break;
+                        case 'o': case '^': case 'v': case '-': case '@':
+                            break;
+                        default:
+                            if (!is_whitespace(*cn))
+                                return this;
+                    }
+                }
+                return this;
+            }
+        }
+    }
+
+    valid= false;
+    port_number = 0;
+    port = gpios[0];
+    pin = 32;
+    inverting = false;
+    return this;
+}
+
+Pin* Pin::as_open_drain() { return this; }
+Pin* Pin::as_repeater() { return this; }
+Pin* Pin::pull_up() { return this; }
+Pin* Pin::pull_down() { return this; }
+Pin* Pin::pull_none() { return this; }
+mbed::PwmOut* Pin::hardware_pwm() { return nullptr; }
+mbed::InterruptIn* Pin::interrupt_pin() { return nullptr; }
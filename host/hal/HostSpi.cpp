@@ -0,0 +1,73 @@
+/*
+      This file is part of Smoothie (http://smoothieware.org/). The motion control part is heavily based on Grbl (https://github.com/simen/grbl).
+      Smoothie is free software: you can redistribute it and/or modify it under the terms of the GNU General Public License as published by the Free Software Foundation, either version 3 of the License, or (at your option) any later version.
+      Smoothie is distributed in the hope that it will be useful, but WITHOUT ANY WARRANTY; without even the implied warranty of MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the GNU General Public License for more details.
+      You should have received a copy of the GNU General Public License along with Smoothie. If not, see <http://www.gnu.org/licenses/>.
+*/
+
+// Host replacement for mbed's SPI and its LPC1768 spi_api.c, the clock is set up the same way so the fake SSP
+// takes as long per byte as the real one
+
+#include "SPI.h"
+#include "HostHal.h"
+
+#include <math.h>
+
+namespace mbed {
+
+SPI *SPI::_owner = nullptr;
+
+SPI::SPI(PinName mosi, PinName miso, PinName sclk)
+{
+    // P0.15 and P1.20 are SCK0, everything else is taken to be SSP1
+    _spi.spi = (sclk == P0_15 || sclk == P1_20) ? LPC_SSP0 : LPC_SSP1;
+    _bits = 8;
+    _mode = 0;
+    _hz = 1000000;
+    _owner = nullptr;
+    aquire();
+}
+
+void SPI::format(int bits, int mode)
+{
+    _bits = bits;
+    _mode = mode;
+    _owner = nullptr;
+    aquire();
+}
+
+void SPI::frequency(int hz)
+{
+    _hz = hz;
+    _owner = nullptr;
+    aquire();
+}
+
+void SPI::aquire()
+{
+    if(_owner == this) return;
+
+    _spi.spi->CR0 = (_bits - 1) | ((_mode & 2) ? 1 << 6 : 0) | ((_mode & 1) ? 1 << 7 : 0);
+    // same search as spi_frequency(), PCLK is the core clock
+    for (int prescaler = 2; prescaler <= 254; prescaler += 2) {
+        int prescale_hz = SystemCoreClock / prescaler;
+        int divider = floor(((float)prescale_hz / (float)_hz) + 0.5);
+        if (divider < 256) {
+            _spi.spi->CPSR = prescaler;
+            _spi.spi->CR0 = (_spi.spi->CR0 & 0xFF) | ((divider - 1) << 8);
+            break;
+        }
+    }
+    _spi.spi->CR1 = 1 << 1;
+    _owner = this;
+}
+
+int SPI::write(int value)
+{
+    aquire();
+    host_clock_advance_cycles(HOST_SPI_WRITE_CYCLES);
+    _spi.spi->DR = value;
+    return _spi.spi->DR;
+}
+
+} // namespace mbed
@@ -0,0 +1,8 @@
+// Host replacement for the mbed pin names, only the pins referenced by the compiled sources
+#pragma once
+
+typedef enum {
+    P0_0 = 0, P0_6 = 6, P0_7, P0_8, P0_9, P0_15 = 15, P0_16, P0_17, P0_18, P1_18 = 50, P1_19, P1_20, P1_21, P4_28 = 156,
+    USBTX = 2, USBRX = 3,
+    NC = (int)0xFFFFFFFF
+} PinName;
@@ -0,0 +1,34 @@
+// Host replacement for mbed's SPI class, it drives the fake SSP registers, see host/hal/HostHal.h
+#pragma once
+
+#include "libs/LPC17xx/sLPC17xx.h"
+#include "PinNames.h"
+
+struct spi_s {
+    LPC_SSP_TypeDef *spi;
+};
+typedef struct spi_s spi_t;
+
+namespace mbed {
+
+class SPI {
+
+public:
+    SPI(PinName mosi, PinName miso, PinName sclk);
+    virtual ~SPI() {};
+
+    void format(int bits, int mode = 0);
+    void frequency(int hz = 1000000);
+    virtual int write(int value);
+
+protected:
+    spi_t _spi;
+
+    void aquire(void);
+    static SPI *_owner;
+    int _bits;
+    int _mode;
+    int _hz;
+};
+
+} // namespace mbed
@@ -0,0 +1,3 @@
+// Host replacement for mbed Timer.h
+#pragma once
+#include "us_ticker_api.h"
@@ -0,0 +1,4 @@
+// host stand in for the CMSIS header, see HostHal.h
+#pragma once
+
+#include "libs/LPC17xx/sLPC17xx.h"
@@ -0,0 +1,3 @@
+// newlib provides fastmath.h, glibc does not
+#pragma once
+#include <math.h>
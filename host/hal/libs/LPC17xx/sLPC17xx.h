@@ -0,0 +1,230 @@
+/*
+      This file is part of Smoothie (http://smoothieware.org/). The motion control part is heavily based on Grbl (https://github.com/simen/grbl).
+      Smoothie is free software: you can redistribute it and/or modify it under the terms of the GNU General Public License as published by the Free Software Foundation, either version 3 of the License, or (at your option) any later version.
+      Smoothie is distributed in the hope that it will be useful, but WITHOUT ANY WARRANTY; without even the implied warranty of MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the GNU General Public License for more details.
+      You should have received a copy of the GNU General Public License along with Smoothie. If not, see <http://www.gnu.org/licenses/>.
+*/
+
+// Host replacement for src/libs/LPC17xx/sLPC17xx.h, only the peripherals used by the motion pipeline are modeled
+
+#ifndef __LPC17xx_H__
+#define __LPC17xx_H__
+
+#include <stdint.h>
+#include "HostHal.h"
+
+typedef enum IRQn
+{
+  NonMaskableInt_IRQn           = -14,
+  MemoryManagement_IRQn         = -12,
+  BusFault_IRQn                 = -11,
+  UsageFault_IRQn               = -10,
+  SVCall_IRQn                   = -5,
+  DebugMonitor_IRQn             = -4,
+  PendSV_IRQn                   = -2,
+  SysTick_IRQn                  = -1,
+  WDT_IRQn                      = 0,
+  TIMER0_IRQn                   = 1,
+  TIMER1_IRQn                   = 2,
+  TIMER2_IRQn                   = 3,
+  TIMER3_IRQn                   = 4,
+  UART0_IRQn                    = 5,
+  UART1_IRQn                    = 6,
+  UART2_IRQn                    = 7,
+  UART3_IRQn                    = 8,
+  PWM1_IRQn                     = 9,
+  I2C0_IRQn                     = 10,
+  I2C1_IRQn                     = 11,
+  I2C2_IRQn                     = 12,
+  SPI_IRQn                      = 13,
+  SSP0_IRQn                     = 14,
+  SSP1_IRQn                     = 15,
+  PLL0_IRQn                     = 16,
+  RTC_IRQn                      = 17,
+  EINT0_IRQn                    = 18,
+  EINT1_IRQn                    = 19,
+  EINT2_IRQn                    = 20,
+  EINT3_IRQn                    = 21,
+  ADC_IRQn                      = 22,
+  BOD_IRQn                      = 23,
+  USB_IRQn                      = 24,
+  CAN_IRQn                      = 25,
+  DMA_IRQn                      = 26,
+  I2S_IRQn                      = 27,
+  ENET_IRQn                     = 28,
+  RIT_IRQn                      = 29,
+  MCPWM_IRQn                    = 30,
+  QEI_IRQn                      = 31,
+  PLL1_IRQn                     = 32,
+} IRQn_Type;
+
+typedef struct
+{
+  HostReg FIODIR;
+  HostReg FIOMASK;
+  HostReg FIOPIN;
+  HostReg FIOSET;
+  HostReg FIOCLR;
+} LPC_GPIO_TypeDef;
+
+typedef struct
+{
+  HostReg IR;
+  HostReg TCR;
+  HostReg TC;
+  HostReg PR;
+  HostReg PC;
+  HostReg MCR;
+  HostReg MR0;
+  HostReg MR1;
+  HostReg MR2;
+  HostReg MR3;
+  HostReg CCR;
+  HostReg CR0;
+  HostReg CR1;
+  HostReg EMR;
+  HostReg CTCR;
+} LPC_TIM_TypeDef;
+
+typedef struct
+{
+  HostReg PCONP;
+  HostReg PCLKSEL0;
+  HostReg PCLKSEL1;
+} LPC_SC_TypeDef;
+
+typedef struct
+{
+  HostReg WDMOD;
+  HostReg WDTC;
+  HostReg WDFEED;
+  HostReg WDTV;
+  HostReg WDCLKSEL;
+} LPC_WDT_TypeDef;
+
+typedef struct
+{
+  HostReg PINSEL[11];
+  HostReg PINMODE0, PINMODE1, PINMODE2, PINMODE3, PINMODE4, PINMODE5, PINMODE6, PINMODE7, PINMODE8, PINMODE9;
+  HostReg PINMODE_OD0, PINMODE_OD1, PINMODE_OD2, PINMODE_OD3, PINMODE_OD4;
+} LPC_PINCON_TypeDef;
+
+typedef struct
+{
+  HostReg CR0;
+  HostReg CR1;
+  HostReg DR;
+  HostReg SR;
+  HostReg CPSR;
+  HostReg IMSC;
+  HostReg RIS;
+  HostReg MIS;
+  HostReg ICR;
+  HostReg DMACR;
+} LPC_SSP_TypeDef;
+
+// a DMA address register, wide enough for a host pointer
+struct HostAddrReg {
+  uintptr_t value{0};
+  operator uintptr_t() const { return value; }
+  HostAddrReg& operator= (uintptr_t v) { value= v; return *this; }
+};
+
+typedef struct
+{
+  HostReg DMACIntStat;
+  HostReg DMACIntTCStat;
+  HostReg DMACIntTCClear;
+  HostReg DMACIntErrStat;
+  HostReg DMACIntErrClr;
+  HostReg DMACRawIntTCStat;
+  HostReg DMACRawIntErrStat;
+  HostReg DMACEnbldChns;
+  HostReg DMACSoftBReq;
+  HostReg DMACSoftSReq;
+  HostReg DMACSoftLBReq;
+  HostReg DMACSoftLSReq;
+  HostReg DMACConfig;
+  HostReg DMACSync;
+} LPC_GPDMA_TypeDef;
+
+// writing DMACCConfig with the enable bit set runs the whole transfer there and then
+typedef struct
+{
+  HostAddrReg DMACCSrcAddr;
+  HostAddrReg DMACCDestAddr;
+  HostReg DMACCLLI;
+  HostReg DMACCControl;
+  HostReg DMACCConfig;
+} LPC_GPDMACH_TypeDef;
+
+// core debug registers, only the cycle counter is modeled, it counts core clocks of the virtual clock
+typedef struct
+{
+  HostReg CTRL;
+  HostReg CYCCNT;
+} DWT_Type;
+
+typedef struct
+{
+  HostReg DHCSR;
+  HostReg DCRSR;
+  HostReg DCRDR;
+  HostReg DEMCR;
+} CoreDebug_Type;
+
+#define DWT_CTRL_CYCCNTENA_Msk      (1UL << 0)
+#define CoreDebug_DEMCR_TRCENA_Msk  (1UL << 24)
+
+extern LPC_GPIO_TypeDef host_gpio[5];
+extern LPC_TIM_TypeDef host_tim[4];
+extern LPC_SC_TypeDef host_sc;
+extern LPC_WDT_TypeDef host_wdt;
+extern LPC_PINCON_TypeDef host_pincon;
+extern LPC_SSP_TypeDef host_ssp[2];
+extern LPC_GPDMA_TypeDef host_gpdma;
+extern LPC_GPDMACH_TypeDef host_gpdmach[8];
+extern DWT_Type host_dwt;
+extern CoreDebug_Type host_core_debug;
+
+#define LPC_GPIO0   (&host_gpio[0])
+#define LPC_GPIO1   (&host_gpio[1])
+#define LPC_GPIO2   (&host_gpio[2])
+#define LPC_GPIO3   (&host_gpio[3])
+#define LPC_GPIO4   (&host_gpio[4])
+#define LPC_TIM0    (&host_tim[0])
+#define LPC_TIM1    (&host_tim[1])
+#define LPC_TIM2    (&host_tim[2])
+#define LPC_TIM3    (&host_tim[3])
+#define LPC_SC      (&host_sc)
+#define LPC_WDT     (&host_wdt)
+#define LPC_PINCON  (&host_pincon)
+#define LPC_SSP0    (&host_ssp[0])
+#define LPC_SSP1    (&host_ssp[1])
+#define LPC_GPDMA   (&host_gpdma)
+#define LPC_GPDMACH0 (&host_gpdmach[0])
+#define LPC_GPDMACH1 (&host_gpdmach[1])
+#define LPC_GPDMACH2 (&host_gpdmach[2])
+#define LPC_GPDMACH3 (&host_gpdmach[3])
+#define LPC_GPDMACH4 (&host_gpdmach[4])
+#define LPC_GPDMACH5 (&host_gpdmach[5])
+#define LPC_GPDMACH6 (&host_gpdmach[6])
+#define LPC_GPDMACH7 (&host_gpdmach[7])
+#define DWT         (&host_dwt)
+#define CoreDebug   (&host_core_debug)
+
+extern uint32_t SystemCoreClock;
+
+// NVIC, only enable/disable has any effect on the simulation
+void NVIC_EnableIRQ(IRQn_Type irq);
+void NVIC_DisableIRQ(IRQn_Type irq);
+inline void NVIC_SetPriorityGrouping(uint32_t) {}
+inline void NVIC_SetPriority(IRQn_Type, uint32_t) {}
+inline uint32_t NVIC_GetPriority(IRQn_Type) { return 0; }
+inline void NVIC_SetPendingIRQ(IRQn_Type) {}
+void NVIC_SystemReset(void);
+
+inline void __disable_irq(void) {}
+inline void __enable_irq(void) {}
+
+#endif
@@ -0,0 +1,16 @@
+// Host replacement for the parts of mbed.h used by the motion pipeline, see host/hal/HostHal.h
+#pragma once
+
+#include "libs/LPC17xx/sLPC17xx.h"
+#include "us_ticker_api.h"
+#include "wait_api.h"
+#include "PinNames.h"
+#include "SPI.h"
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <math.h>
+
+// like mbed.h
+using namespace std;
@@ -0,0 +1,10 @@
+// Host replacement for the MRI debug monitor, a breakpoint aborts the simulation
+#pragma once
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+void __debugbreak(void);
+#ifdef __cplusplus
+}
+#endif
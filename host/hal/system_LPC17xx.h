@@ -0,0 +1,3 @@
+// Host replacement for the CMSIS device header, see host/hal/HostHal.h
+#pragma once
+#include "libs/LPC17xx/sLPC17xx.h"
@@ -0,0 +1,12 @@
+// Host replacement for the mbed us ticker, reads the virtual clock
+#pragma once
+
+#include <stdint.h>
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+uint32_t us_ticker_read(void);
+#ifdef __cplusplus
+}
+#endif
@@ -0,0 +1,12 @@
+// Host replacement for mbed wait_api.h, waiting advances the virtual clock
+#pragma once
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+void wait(float s);
+void wait_ms(int ms);
+void wait_us(int us);
+#ifdef __cplusplus
+}
+#endif
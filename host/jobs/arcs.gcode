@@ -0,0 +1,27 @@
+G21
+G90
+G0 X10 Y10 F6000
+G2 X30 Y10 I10 J0 F2400
+G3 X10 Y10 I-10 J0
+G2 X10 Y10 I5 J5
+G2 X30 Y10 I10 J0 F2400
+G3 X10 Y10 I-10 J0
+G2 X10 Y10 I5 J5
+G2 X30 Y10 I10 J0 F2400
+G3 X10 Y10 I-10 J0
+G2 X10 Y10 I5 J5
+G2 X30 Y10 I10 J0 F2400
+G3 X10 Y10 I-10 J0
+G2 X10 Y10 I5 J5
+G2 X30 Y10 I10 J0 F2400
+G3 X10 Y10 I-10 J0
+G2 X10 Y10 I5 J5
+G2 X30 Y10 I10 J0 F2400
+G3 X10 Y10 I-10 J0
+G2 X10 Y10 I5 J5
+G1 X20 Y20 Z2 F600
+G91
+G1 X-5 Y-5
+G1 X5 Y5
+G90
+G0 X0 Y0 Z0
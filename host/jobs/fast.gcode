@@ -0,0 +1,44 @@
+G21
+G90
+G0 X0 Y0 F30000
+G1 X200 Y0 F30000
+G1 X0 Y2 F30000
+G1 X200 Y5 F30000
+G1 X0 Y7 F30000
+G1 X200 Y10 F30000
+G1 X0 Y12 F30000
+G1 X200 Y15 F30000
+G1 X0 Y17 F30000
+G1 X200 Y20 F30000
+G1 X0 Y22 F30000
+G1 X200 Y25 F30000
+G1 X0 Y27 F30000
+G1 X200 Y30 F30000
+G1 X0 Y32 F30000
+G1 X200 Y35 F30000
+G1 X0 Y37 F30000
+G1 X200 Y40 F30000
+G1 X0 Y42 F30000
+G1 X200 Y45 F30000
+G1 X0 Y47 F30000
+G1 X200 Y50 F30000
+G1 X0 Y52 F30000
+G1 X200 Y55 F30000
+G1 X0 Y57 F30000
+G1 X200 Y60 F30000
+G1 X0 Y62 F30000
+G1 X200 Y65 F30000
+G1 X0 Y67 F30000
+G1 X200 Y70 F30000
+G1 X0 Y72 F30000
+G1 X200 Y75 F30000
+G1 X0 Y77 F30000
+G1 X200 Y80 F30000
+G1 X0 Y82 F30000
+G1 X200 Y85 F30000
+G1 X0 Y87 F30000
+G1 X200 Y90 F30000
+G1 X0 Y92 F30000
+G1 X200 Y95 F30000
+G1 X0 Y97 F30000
+G0 X0 Y0
@@ -0,0 +1,3669 @@
+G21
+G90
+G0 X5 Y5 F6000
+M3
+G1 X5.050 Y5.000 S0.20 F3000
+G1 X5.100 Y5.000 S0.20 F3000
+G1 X5.150 Y5.000 S0.20 F3000
+G1 X5.200 Y5.000 S0.20 F3000
+G1 X5.250 Y5.000 S0.20 F3000
+G1 X5.300 Y5.000 S0.20 F3000
+G1 X5.350 Y5.000 S0.20 F3000
+G1 X5.400 Y5.000 S0.20 F3000
+G1 X5.450 Y5.000 S0.20 F3000
+G1 X5.500 Y5.000 S0.20 F3000
+G1 X5.550 Y5.000 S0.20 F3000
+G1 X5.600 Y5.000 S0.20 F3000
+G1 X5.650 Y5.000 S0.20 F3000
+G1 X5.700 Y5.000 S0.20 F3000
+G1 X5.750 Y5.000 S0.20 F3000
+G1 X5.800 Y5.000 S0.20 F3000
+G1 X5.850 Y5.000 S0.20 F3000
+G1 X5.900 Y5.000 S0.20 F3000
+G1 X5.950 Y5.000 S0.20 F3000
+G1 X6.000 Y5.000 S0.20 F3000
+G1 X6.050 Y5.000 S0.20 F3000
+G1 X6.100 Y5.000 S0.20 F3000
+G1 X6.150 Y5.000 S0.20 F3000
+G1 X6.200 Y5.000 S0.20 F3000
+G1 X6.250 Y5.000 S0.20 F3000
+G1 X6.300 Y5.000 S0.20 F3000
+G1 X6.350 Y5.000 S0.20 F3000
+G1 X6.400 Y5.000 S0.20 F3000
+G1 X6.450 Y5.000 S0.20 F3000
+G1 X6.500 Y5.000 S0.20 F3000
+G1 X6.550 Y5.000 S0.20 F3000
+G1 X6.600 Y5.000 S0.20 F3000
+G1 X6.650 Y5.000 S0.20 F3000
+G1 X6.700 Y5.000 S0.20 F3000
+G1 X6.750 Y5.000 S0.20 F3000
+G1 X6.800 Y5.000 S0.20 F3000
+G1 X6.850 Y5.000 S0.20 F3000
+G1 X6.900 Y5.000 S0.20 F3000
+G1 X6.950 Y5.000 S0.20 F3000
+G1 X7.000 Y5.000 S0.20 F3000
+G1 X7.050 Y5.000 S0.30 F3000
+G1 X7.100 Y5.000 S0.30 F3000
+G1 X7.150 Y5.000 S0.30 F3000
+G1 X7.200 Y5.000 S0.30 F3000
+G1 X7.250 Y5.000 S0.30 F3000
+G1 X7.300 Y5.000 S0.30 F3000
+G1 X7.350 Y5.000 S0.30 F3000
+G1 X7.400 Y5.000 S0.30 F3000
+G1 X7.450 Y5.000 S0.30 F3000
+G1 X7.500 Y5.000 S0.30 F3000
+G1 X7.550 Y5.000 S0.30 F3000
+G1 X7.600 Y5.000 S0.30 F3000
+G1 X7.650 Y5.000 S0.30 F3000
+G1 X7.700 Y5.000 S0.30 F3000
+G1 X7.750 Y5.000 S0.30 F3000
+G1 X7.800 Y5.000 S0.30 F3000
+G1 X7.850 Y5.000 S0.30 F3000
+G1 X7.900 Y5.000 S0.30 F3000
+G1 X7.950 Y5.000 S0.30 F3000
+G1 X8.000 Y5.000 S0.30 F3000
+G1 X8.050 Y5.000 S0.30 F3000
+G1 X8.100 Y5.000 S0.30 F3000
+G1 X8.150 Y5.000 S0.30 F3000
+G1 X8.200 Y5.000 S0.30 F3000
+G1 X8.250 Y5.000 S0.30 F3000
+G1 X8.300 Y5.000 S0.30 F3000
+G1 X8.350 Y5.000 S0.30 F3000
+G1 X8.400 Y5.000 S0.30 F3000
+G1 X8.450 Y5.000 S0.30 F3000
+G1 X8.500 Y5.000 S0.30 F3000
+G1 X8.550 Y5.000 S0.30 F3000
+G1 X8.600 Y5.000 S0.30 F3000
+G1 X8.650 Y5.000 S0.30 F3000
+G1 X8.700 Y5.000 S0.30 F3000
+G1 X8.750 Y5.000 S0.30 F3000
+G1 X8.800 Y5.000 S0.30 F3000
+G1 X8.850 Y5.000 S0.30 F3000
+G1 X8.900 Y5.000 S0.30 F3000
+G1 X8.950 Y5.000 S0.30 F3000
+G1 X9.000 Y5.000 S0.30 F3000
+G1 X9.050 Y5.000 S0.40 F3000
+G1 X9.100 Y5.000 S0.40 F3000
+G1 X9.150 Y5.000 S0.40 F3000
+G1 X9.200 Y5.000 S0.40 F3000
+G1 X9.250 Y5.000 S0.40 F3000
+G1 X9.300 Y5.000 S0.40 F3000
+G1 X9.350 Y5.000 S0.40 F3000
+G1 X9.400 Y5.000 S0.40 F3000
+G1 X9.450 Y5.000 S0.40 F3000
+G1 X9.500 Y5.000 S0.40 F3000
+G1 X9.550 Y5.000 S0.40 F3000
+G1 X9.600 Y5.000 S0.40 F3000
+G1 X9.650 Y5.000 S0.40 F3000
+G1 X9.700 Y5.000 S0.40 F3000
+G1 X9.750 Y5.000 S0.40 F3000
+G1 X9.800 Y5.000 S0.40 F3000
+G1 X9.850 Y5.000 S0.40 F3000
+G1 X9.900 Y5.000 S0.40 F3000
+G1 X9.950 Y5.000 S0.40 F3000
+G1 X10.000 Y5.000 S0.40 F3000
+G1 X10.050 Y5.000 S0.40 F3000
+G1 X10.100 Y5.000 S0.40 F3000
+G1 X10.150 Y5.000 S0.40 F3000
+G1 X10.200 Y5.000 S0.40 F3000
+G1 X10.250 Y5.000 S0.40 F3000
+G1 X10.300 Y5.000 S0.40 F3000
+G1 X10.350 Y5.000 S0.40 F3000
+G1 X10.400 Y5.000 S0.40 F3000
+G1 X10.450 Y5.000 S0.40 F3000
+G1 X10.500 Y5.000 S0.40 F3000
+G1 X10.550 Y5.000 S0.40 F3000
+G1 X10.600 Y5.000 S0.40 F3000
+G1 X10.650 Y5.000 S0.40 F3000
+G1 X10.700 Y5.000 S0.40 F3000
+G1 X10.750 Y5.000 S0.40 F3000
+G1 X10.800 Y5.000 S0.40 F3000
+G1 X10.850 Y5.000 S0.40 F3000
+G1 X10.900 Y5.000 S0.40 F3000
+G1 X10.950 Y5.000 S0.40 F3000
+G1 X11.000 Y5.000 S0.40 F3000
+G1 X11.050 Y5.000 S0.20 F3000
+G1 X11.100 Y5.000 S0.20 F3000
+G1 X11.150 Y5.000 S0.20 F3000
+G1 X11.200 Y5.000 S0.20 F3000
+G1 X11.250 Y5.000 S0.20 F3000
+G1 X11.300 Y5.000 S0.20 F3000
+G1 X11.350 Y5.000 S0.20 F3000
+G1 X11.400 Y5.000 S0.20 F3000
+G1 X11.450 Y5.000 S0.20 F3000
+G1 X11.500 Y5.000 S0.20 F3000
+G1 X11.550 Y5.000 S0.20 F3000
+G1 X11.600 Y5.000 S0.20 F3000
+G1 X11.650 Y5.000 S0.20 F3000
+G1 X11.700 Y5.000 S0.20 F3000
+G1 X11.750 Y5.000 S0.20 F3000
+G1 X11.800 Y5.000 S0.20 F3000
+G1 X11.850 Y5.000 S0.20 F3000
+G1 X11.900 Y5.000 S0.20 F3000
+G1 X11.950 Y5.000 S0.20 F3000
+G1 X12.000 Y5.000 S0.20 F3000
+G1 X12.050 Y5.000 S0.20 F3000
+G1 X12.100 Y5.000 S0.20 F3000
+G1 X12.150 Y5.000 S0.20 F3000
+G1 X12.200 Y5.000 S0.20 F3000
+G1 X12.250 Y5.000 S0.20 F3000
+G1 X12.300 Y5.000 S0.20 F3000
+G1 X12.350 Y5.000 S0.20 F3000
+G1 X12.400 Y5.000 S0.20 F3000
+G1 X12.450 Y5.000 S0.20 F3000
+G1 X12.500 Y5.000 S0.20 F3000
+G1 X12.550 Y5.000 S0.20 F3000
+G1 X12.600 Y5.000 S0.20 F3000
+G1 X12.650 Y5.000 S0.20 F3000
+G1 X12.700 Y5.000 S0.20 F3000
+G1 X12.750 Y5.000 S0.20 F3000
+G1 X12.800 Y5.000 S0.20 F3000
+G1 X12.850 Y5.000 S0.20 F3000
+G1 X12.900 Y5.000 S0.20 F3000
+G1 X12.950 Y5.000 S0.20 F3000
+G1 X13.000 Y5.000 S0.20 F3000
+G1 X13.050 Y5.000 S0.30 F3000
+G1 X13.100 Y5.000 S0.30 F3000
+G1 X13.150 Y5.000 S0.30 F3000
+G1 X13.200 Y5.000 S0.30 F3000
+G1 X13.250 Y5.000 S0.30 F3000
+G1 X13.300 Y5.000 S0.30 F3000
+G1 X13.350 Y5.000 S0.30 F3000
+G1 X13.400 Y5.000 S0.30 F3000
+G1 X13.450 Y5.000 S0.30 F3000
+G1 X13.500 Y5.000 S0.30 F3000
+G1 X13.550 Y5.000 S0.30 F3000
+G1 X13.600 Y5.000 S0.30 F3000
+G1 X13.650 Y5.000 S0.30 F3000
+G1 X13.700 Y5.000 S0.30 F3000
+G1 X13.750 Y5.000 S0.30 F3000
+G1 X13.800 Y5.000 S0.30 F3000
+G1 X13.850 Y5.000 S0.30 F3000
+G1 X13.900 Y5.000 S0.30 F3000
+G1 X13.950 Y5.000 S0.30 F3000
+G1 X14.000 Y5.000 S0.30 F3000
+G1 X14.050 Y5.000 S0.30 F3000
+G1 X14.100 Y5.000 S0.30 F3000
+G1 X14.150 Y5.000 S0.30 F3000
+G1 X14.200 Y5.000 S0.30 F3000
+G1 X14.250 Y5.000 S0.30 F3000
+G1 X14.300 Y5.000 S0.30 F3000
+G1 X14.350 Y5.000 S0.30 F3000
+G1 X14.400 Y5.000 S0.30 F3000
+G1 X14.450 Y5.000 S0.30 F3000
+G1 X14.500 Y5.000 S0.30 F3000
+G1 X14.550 Y5.000 S0.30 F3000
+G1 X14.600 Y5.000 S0.30 F3000
+G1 X14.650 Y5.000 S0.30 F3000
+G1 X14.700 Y5.000 S0.30 F3000
+G1 X14.750 Y5.000 S0.30 F3000
+G1 X14.800 Y5.000 S0.30 F3000
+G1 X14.850 Y5.000 S0.30 F3000
+G1 X14.900 Y5.000 S0.30 F3000
+G1 X14.950 Y5.000 S0.30 F3000
+G1 X15.000 Y5.000 S0.30 F3000
+G1 X15.050 Y5.000 S0.40 F3000
+G1 X15.100 Y5.000 S0.40 F3000
+G1 X15.150 Y5.000 S0.40 F3000
+G1 X15.200 Y5.000 S0.40 F3000
+G1 X15.250 Y5.000 S0.40 F3000
+G1 X15.300 Y5.000 S0.40 F3000
+G1 X15.350 Y5.000 S0.40 F3000
+G1 X15.400 Y5.000 S0.40 F3000
+G1 X15.450 Y5.000 S0.40 F3000
+G1 X15.500 Y5.000 S0.40 F3000
+G1 X15.550 Y5.000 S0.40 F3000
+G1 X15.600 Y5.000 S0.40 F3000
+G1 X15.650 Y5.000 S0.40 F3000
+G1 X15.700 Y5.000 S0.40 F3000
+G1 X15.750 Y5.000 S0.40 F3000
+G1 X15.800 Y5.000 S0.40 F3000
+G1 X15.850 Y5.000 S0.40 F3000
+G1 X15.900 Y5.000 S0.40 F3000
+G1 X15.950 Y5.000 S0.40 F3000
+G1 X16.000 Y5.000 S0.40 F3000
+G1 X16.050 Y5.000 S0.40 F3000
+G1 X16.100 Y5.000 S0.40 F3000
+G1 X16.150 Y5.000 S0.40 F3000
+G1 X16.200 Y5.000 S0.40 F3000
+G1 X16.250 Y5.000 S0.40 F3000
+G1 X16.300 Y5.000 S0.40 F3000
+G1 X16.350 Y5.000 S0.40 F3000
+G1 X16.400 Y5.000 S0.40 F3000
+G1 X16.450 Y5.000 S0.40 F3000
+G1 X16.500 Y5.000 S0.40 F3000
+G1 X16.550 Y5.000 S0.40 F3000
+G1 X16.600 Y5.000 S0.40 F3000
+G1 X16.650 Y5.000 S0.40 F3000
+G1 X16.700 Y5.000 S0.40 F3000
+G1 X16.750 Y5.000 S0.40 F3000
+G1 X16.800 Y5.000 S0.40 F3000
+G1 X16.850 Y5.000 S0.40 F3000
+G1 X16.900 Y5.000 S0.40 F3000
+G1 X16.950 Y5.000 S0.40 F3000
+G1 X17.000 Y5.000 S0.40 F3000
+G1 X17.050 Y5.000 S0.20 F3000
+G1 X17.100 Y5.000 S0.20 F3000
+G1 X17.150 Y5.000 S0.20 F3000
+G1 X17.200 Y5.000 S0.20 F3000
+G1 X17.250 Y5.000 S0.20 F3000
+G1 X17.300 Y5.000 S0.20 F3000
+G1 X17.350 Y5.000 S0.20 F3000
+G1 X17.400 Y5.000 S0.20 F3000
+G1 X17.450 Y5.000 S0.20 F3000
+G1 X17.500 Y5.000 S0.20 F3000
+G1 X17.550 Y5.000 S0.20 F3000
+G1 X17.600 Y5.000 S0.20 F3000
+G1 X17.650 Y5.000 S0.20 F3000
+G1 X17.700 Y5.000 S0.20 F3000
+G1 X17.750 Y5.000 S0.20 F3000
+G1 X17.800 Y5.000 S0.20 F3000
+G1 X17.850 Y5.000 S0.20 F3000
+G1 X17.900 Y5.000 S0.20 F3000
+G1 X17.950 Y5.000 S0.20 F3000
+G1 X18.000 Y5.000 S0.20 F3000
+G1 X18.050 Y5.000 S0.20 F3000
+G1 X18.100 Y5.000 S0.20 F3000
+G1 X18.150 Y5.000 S0.20 F3000
+G1 X18.200 Y5.000 S0.20 F3000
+G1 X18.250 Y5.000 S0.20 F3000
+G1 X18.300 Y5.000 S0.20 F3000
+G1 X18.350 Y5.000 S0.20 F3000
+G1 X18.400 Y5.000 S0.20 F3000
+G1 X18.450 Y5.000 S0.20 F3000
+G1 X18.500 Y5.000 S0.20 F3000
+G1 X18.550 Y5.000 S0.20 F3000
+G1 X18.600 Y5.000 S0.20 F3000
+G1 X18.650 Y5.000 S0.20 F3000
+G1 X18.700 Y5.000 S0.20 F3000
+G1 X18.750 Y5.000 S0.20 F3000
+G1 X18.800 Y5.000 S0.20 F3000
+G1 X18.850 Y5.000 S0.20 F3000
+G1 X18.900 Y5.000 S0.20 F3000
+G1 X18.950 Y5.000 S0.20 F3000
+G1 X19.000 Y5.000 S0.20 F3000
+G1 X19.050 Y5.000 S0.30 F3000
+G1 X19.100 Y5.000 S0.30 F3000
+G1 X19.150 Y5.000 S0.30 F3000
+G1 X19.200 Y5.000 S0.30 F3000
+G1 X19.250 Y5.000 S0.30 F3000
+G1 X19.300 Y5.000 S0.30 F3000
+G1 X19.350 Y5.000 S0.30 F3000
+G1 X19.400 Y5.000 S0.30 F3000
+G1 X19.450 Y5.000 S0.30 F3000
+G1 X19.500 Y5.000 S0.30 F3000
+G1 X19.550 Y5.000 S0.30 F3000
+G1 X19.600 Y5.000 S0.30 F3000
+G1 X19.650 Y5.000 S0.30 F3000
+G1 X19.700 Y5.000 S0.30 F3000
+G1 X19.750 Y5.000 S0.30 F3000
+G1 X19.800 Y5.000 S0.30 F3000
+G1 X19.850 Y5.000 S0.30 F3000
+G1 X19.900 Y5.000 S0.30 F3000
+G1 X19.950 Y5.000 S0.30 F3000
+G1 X20.000 Y5.000 S0.30 F3000
+G1 X20.050 Y5.000 S0.30 F3000
+G1 X20.100 Y5.000 S0.30 F3000
+G1 X20.150 Y5.000 S0.30 F3000
+G1 X20.200 Y5.000 S0.30 F3000
+G1 X20.250 Y5.000 S0.30 F3000
+G1 X20.300 Y5.000 S0.30 F3000
+G1 X20.350 Y5.000 S0.30 F3000
+G1 X20.400 Y5.000 S0.30 F3000
+G1 X20.450 Y5.000 S0.30 F3000
+G1 X20.500 Y5.000 S0.30 F3000
+G1 X20.550 Y5.000 S0.30 F3000
+G1 X20.600 Y5.000 S0.30 F3000
+G1 X20.650 Y5.000 S0.30 F3000
+G1 X20.700 Y5.000 S0.30 F3000
+G1 X20.750 Y5.000 S0.30 F3000
+G1 X20.800 Y5.000 S0.30 F3000
+G1 X20.850 Y5.000 S0.30 F3000
+G1 X20.900 Y5.000 S0.30 F3000
+G1 X20.950 Y5.000 S0.30 F3000
+G1 X21.000 Y5.000 S0.30 F3000
+G1 X21.050 Y5.000 S0.40 F3000
+G1 X21.100 Y5.000 S0.40 F3000
+G1 X21.150 Y5.000 S0.40 F3000
+G1 X21.200 Y5.000 S0.40 F3000
+G1 X21.250 Y5.000 S0.40 F3000
+G1 X21.300 Y5.000 S0.40 F3000
+G1 X21.350 Y5.000 S0.40 F3000
+G1 X21.400 Y5.000 S0.40 F3000
+G1 X21.450 Y5.000 S0.40 F3000
+G1 X21.500 Y5.000 S0.40 F3000
+G1 X21.550 Y5.000 S0.40 F3000
+G1 X21.600 Y5.000 S0.40 F3000
+G1 X21.650 Y5.000 S0.40 F3000
+G1 X21.700 Y5.000 S0.40 F3000
+G1 X21.750 Y5.000 S0.40 F3000
+G1 X21.800 Y5.000 S0.40 F3000
+G1 X21.850 Y5.000 S0.40 F3000
+G1 X21.900 Y5.000 S0.40 F3000
+G1 X21.950 Y5.000 S0.40 F3000
+G1 X22.000 Y5.000 S0.40 F3000
+G1 X22.050 Y5.000 S0.40 F3000
+G1 X22.100 Y5.000 S0.40 F3000
+G1 X22.150 Y5.000 S0.40 F3000
+G1 X22.200 Y5.000 S0.40 F3000
+G1 X22.250 Y5.000 S0.40 F3000
+G1 X22.300 Y5.000 S0.40 F3000
+G1 X22.350 Y5.000 S0.40 F3000
+G1 X22.400 Y5.000 S0.40 F3000
+G1 X22.450 Y5.000 S0.40 F3000
+G1 X22.500 Y5.000 S0.40 F3000
+G1 X22.550 Y5.000 S0.40 F3000
+G1 X22.600 Y5.000 S0.40 F3000
+G1 X22.650 Y5.000 S0.40 F3000
+G1 X22.700 Y5.000 S0.40 F3000
+G1 X22.750 Y5.000 S0.40 F3000
+G1 X22.800 Y5.000 S0.40 F3000
+G1 X22.850 Y5.000 S0.40 F3000
+G1 X22.900 Y5.000 S0.40 F3000
+G1 X22.950 Y5.000 S0.40 F3000
+G1 X23.000 Y5.000 S0.40 F3000
+G1 X23.050 Y5.000 S0.20 F3000
+G1 X23.100 Y5.000 S0.20 F3000
+G1 X23.150 Y5.000 S0.20 F3000
+G1 X23.200 Y5.000 S0.20 F3000
+G1 X23.250 Y5.000 S0.20 F3000
+G1 X23.300 Y5.000 S0.20 F3000
+G1 X23.350 Y5.000 S0.20 F3000
+G1 X23.400 Y5.000 S0.20 F3000
+G1 X23.450 Y5.000 S0.20 F3000
+G1 X23.500 Y5.000 S0.20 F3000
+G1 X23.550 Y5.000 S0.20 F3000
+G1 X23.600 Y5.000 S0.20 F3000
+G1 X23.650 Y5.000 S0.20 F3000
+G1 X23.700 Y5.000 S0.20 F3000
+G1 X23.750 Y5.000 S0.20 F3000
+G1 X23.800 Y5.000 S0.20 F3000
+G1 X23.850 Y5.000 S0.20 F3000
+G1 X23.900 Y5.000 S0.20 F3000
+G1 X23.950 Y5.000 S0.20 F3000
+G1 X24.000 Y5.000 S0.20 F3000
+G1 X24.050 Y5.000 S0.20 F3000
+G1 X24.100 Y5.000 S0.20 F3000
+G1 X24.150 Y5.000 S0.20 F3000
+G1 X24.200 Y5.000 S0.20 F3000
+G1 X24.250 Y5.000 S0.20 F3000
+G1 X24.300 Y5.000 S0.20 F3000
+G1 X24.350 Y5.000 S0.20 F3000
+G1 X24.400 Y5.000 S0.20 F3000
+G1 X24.450 Y5.000 S0.20 F3000
+G1 X24.500 Y5.000 S0.20 F3000
+G1 X24.550 Y5.000 S0.20 F3000
+G1 X24.600 Y5.000 S0.20 F3000
+G1 X24.650 Y5.000 S0.20 F3000
+G1 X24.700 Y5.000 S0.20 F3000
+G1 X24.750 Y5.000 S0.20 F3000
+G1 X24.800 Y5.000 S0.20 F3000
+G1 X24.850 Y5.000 S0.20 F3000
+G1 X24.900 Y5.000 S0.20 F3000
+G1 X24.950 Y5.000 S0.20 F3000
+G1 X25.000 Y5.000 S0.20 F3000
+G1 Y5.500 S0
+G1 X24.950 Y5.500 S0.20 F3000
+G1 X24.900 Y5.500 S0.20 F3000
+G1 X24.850 Y5.500 S0.20 F3000
+G1 X24.800 Y5.500 S0.20 F3000
+G1 X24.750 Y5.500 S0.20 F3000
+G1 X24.700 Y5.500 S0.20 F3000
+G1 X24.650 Y5.500 S0.20 F3000
+G1 X24.600 Y5.500 S0.20 F3000
+G1 X24.550 Y5.500 S0.20 F3000
+G1 X24.500 Y5.500 S0.20 F3000
+G1 X24.450 Y5.500 S0.20 F3000
+G1 X24.400 Y5.500 S0.20 F3000
+G1 X24.350 Y5.500 S0.20 F3000
+G1 X24.300 Y5.500 S0.20 F3000
+G1 X24.250 Y5.500 S0.20 F3000
+G1 X24.200 Y5.500 S0.20 F3000
+G1 X24.150 Y5.500 S0.20 F3000
+G1 X24.100 Y5.500 S0.20 F3000
+G1 X24.050 Y5.500 S0.20 F3000
+G1 X24.000 Y5.500 S0.20 F3000
+G1 X23.950 Y5.500 S0.20 F3000
+G1 X23.900 Y5.500 S0.20 F3000
+G1 X23.850 Y5.500 S0.20 F3000
+G1 X23.800 Y5.500 S0.20 F3000
+G1 X23.750 Y5.500 S0.20 F3000
+G1 X23.700 Y5.500 S0.20 F3000
+G1 X23.650 Y5.500 S0.20 F3000
+G1 X23.600 Y5.500 S0.20 F3000
+G1 X23.550 Y5.500 S0.20 F3000
+G1 X23.500 Y5.500 S0.20 F3000
+G1 X23.450 Y5.500 S0.20 F3000
+G1 X23.400 Y5.500 S0.20 F3000
+G1 X23.350 Y5.500 S0.20 F3000
+G1 X23.300 Y5.500 S0.20 F3000
+G1 X23.250 Y5.500 S0.20 F3000
+G1 X23.200 Y5.500 S0.20 F3000
+G1 X23.150 Y5.500 S0.20 F3000
+G1 X23.100 Y5.500 S0.20 F3000
+G1 X23.050 Y5.500 S0.20 F3000
+G1 X23.000 Y5.500 S0.20 F3000
+G1 X22.950 Y5.500 S0.30 F3000
+G1 X22.900 Y5.500 S0.30 F3000
+G1 X22.850 Y5.500 S0.30 F3000
+G1 X22.800 Y5.500 S0.30 F3000
+G1 X22.750 Y5.500 S0.30 F3000
+G1 X22.700 Y5.500 S0.30 F3000
+G1 X22.650 Y5.500 S0.30 F3000
+G1 X22.600 Y5.500 S0.30 F3000
+G1 X22.550 Y5.500 S0.30 F3000
+G1 X22.500 Y5.500 S0.30 F3000
+G1 X22.450 Y5.500 S0.30 F3000
+G1 X22.400 Y5.500 S0.30 F3000
+G1 X22.350 Y5.500 S0.30 F3000
+G1 X22.300 Y5.500 S0.30 F3000
+G1 X22.250 Y5.500 S0.30 F3000
+G1 X22.200 Y5.500 S0.30 F3000
+G1 X22.150 Y5.500 S0.30 F3000
+G1 X22.100 Y5.500 S0.30 F3000
+G1 X22.050 Y5.500 S0.30 F3000
+G1 X22.000 Y5.500 S0.30 F3000
+G1 X21.950 Y5.500 S0.30 F3000
+G1 X21.900 Y5.500 S0.30 F3000
+G1 X21.850 Y5.500 S0.30 F3000
+G1 X21.800 Y5.500 S0.30 F3000
+G1 X21.750 Y5.500 S0.30 F3000
+G1 X21.700 Y5.500 S0.30 F3000
+G1 X21.650 Y5.500 S0.30 F3000
+G1 X21.600 Y5.500 S0.30 F3000
+G1 X21.550 Y5.500 S0.30 F3000
+G1 X21.500 Y5.500 S0.30 F3000
+G1 X21.450 Y5.500 S0.30 F3000
+G1 X21.400 Y5.500 S0.30 F3000
+G1 X21.350 Y5.500 S0.30 F3000
+G1 X21.300 Y5.500 S0.30 F3000
+G1 X21.250 Y5.500 S0.30 F3000
+G1 X21.200 Y5.500 S0.30 F3000
+G1 X21.150 Y5.500 S0.30 F3000
+G1 X21.100 Y5.500 S0.30 F3000
+G1 X21.050 Y5.500 S0.30 F3000
+G1 X21.000 Y5.500 S0.30 F3000
+G1 X20.950 Y5.500 S0.40 F3000
+G1 X20.900 Y5.500 S0.40 F3000
+G1 X20.850 Y5.500 S0.40 F3000
+G1 X20.800 Y5.500 S0.40 F3000
+G1 X20.750 Y5.500 S0.40 F3000
+G1 X20.700 Y5.500 S0.40 F3000
+G1 X20.650 Y5.500 S0.40 F3000
+G1 X20.600 Y5.500 S0.40 F3000
+G1 X20.550 Y5.500 S0.40 F3000
+G1 X20.500 Y5.500 S0.40 F3000
+G1 X20.450 Y5.500 S0.40 F3000
+G1 X20.400 Y5.500 S0.40 F3000
+G1 X20.350 Y5.500 S0.40 F3000
+G1 X20.300 Y5.500 S0.40 F3000
+G1 X20.250 Y5.500 S0.40 F3000
+G1 X20.200 Y5.500 S0.40 F3000
+G1 X20.150 Y5.500 S0.40 F3000
+G1 X20.100 Y5.500 S0.40 F3000
+G1 X20.050 Y5.500 S0.40 F3000
+G1 X20.000 Y5.500 S0.40 F3000
+G1 X19.950 Y5.500 S0.40 F3000
+G1 X19.900 Y5.500 S0.40 F3000
+G1 X19.850 Y5.500 S0.40 F3000
+G1 X19.800 Y5.500 S0.40 F3000
+G1 X19.750 Y5.500 S0.40 F3000
+G1 X19.700 Y5.500 S0.40 F3000
+G1 X19.650 Y5.500 S0.40 F3000
+G1 X19.600 Y5.500 S0.40 F3000
+G1 X19.550 Y5.500 S0.40 F3000
+G1 X19.500 Y5.500 S0.40 F3000
+G1 X19.450 Y5.500 S0.40 F3000
+G1 X19.400 Y5.500 S0.40 F3000
+G1 X19.350 Y5.500 S0.40 F3000
+G1 X19.300 Y5.500 S0.40 F3000
+G1 X19.250 Y5.500 S0.40 F3000
+G1 X19.200 Y5.500 S0.40 F3000
+G1 X19.150 Y5.500 S0.40 F3000
+G1 X19.100 Y5.500 S0.40 F3000
+G1 X19.050 Y5.500 S0.40 F3000
+G1 X19.000 Y5.500 S0.40 F3000
+G1 X18.950 Y5.500 S0.20 F3000
+G1 X18.900 Y5.500 S0.20 F3000
+G1 X18.850 Y5.500 S0.20 F3000
+G1 X18.800 Y5.500 S0.20 F3000
+G1 X18.750 Y5.500 S0.20 F3000
+G1 X18.700 Y5.500 S0.20 F3000
+G1 X18.650 Y5.500 S0.20 F3000
+G1 X18.600 Y5.500 S0.20 F3000
+G1 X18.550 Y5.500 S0.20 F3000
+G1 X18.500 Y5.500 S0.20 F3000
+G1 X18.450 Y5.500 S0.20 F3000
+G1 X18.400 Y5.500 S0.20 F3000
+G1 X18.350 Y5.500 S0.20 F3000
+G1 X18.300 Y5.500 S0.20 F3000
+G1 X18.250 Y5.500 S0.20 F3000
+G1 X18.200 Y5.500 S0.20 F3000
+G1 X18.150 Y5.500 S0.20 F3000
+G1 X18.100 Y5.500 S0.20 F3000
+G1 X18.050 Y5.500 S0.20 F3000
+G1 X18.000 Y5.500 S0.20 F3000
+G1 X17.950 Y5.500 S0.20 F3000
+G1 X17.900 Y5.500 S0.20 F3000
+G1 X17.850 Y5.500 S0.20 F3000
+G1 X17.800 Y5.500 S0.20 F3000
+G1 X17.750 Y5.500 S0.20 F3000
+G1 X17.700 Y5.500 S0.20 F3000
+G1 X17.650 Y5.500 S0.20 F3000
+G1 X17.600 Y5.500 S0.20 F3000
+G1 X17.550 Y5.500 S0.20 F3000
+G1 X17.500 Y5.500 S0.20 F3000
+G1 X17.450 Y5.500 S0.20 F3000
+G1 X17.400 Y5.500 S0.20 F3000
+G1 X17.350 Y5.500 S0.20 F3000
+G1 X17.300 Y5.500 S0.20 F3000
+G1 X17.250 Y5.500 S0.20 F3000
+G1 X17.200 Y5.500 S0.20 F3000
+G1 X17.150 Y5.500 S0.20 F3000
+G1 X17.100 Y5.500 S0.20 F3000
+G1 X17.050 Y5.500 S0.20 F3000
+G1 X17.000 Y5.500 S0.20 F3000
+G1 X16.950 Y5.500 S0.30 F3000
+G1 X16.900 Y5.500 S0.30 F3000
+G1 X16.850 Y5.500 S0.30 F3000
+G1 X16.800 Y5.500 S0.30 F3000
+G1 X16.750 Y5.500 S0.30 F3000
+G1 X16.700 Y5.500 S0.30 F3000
+G1 X16.650 Y5.500 S0.30 F3000
+G1 X16.600 Y5.500 S0.30 F3000
+G1 X16.550 Y5.500 S0.30 F3000
+G1 X16.500 Y5.500 S0.30 F3000
+G1 X16.450 Y5.500 S0.30 F3000
+G1 X16.400 Y5.500 S0.30 F3000
+G1 X16.350 Y5.500 S0.30 F3000
+G1 X16.300 Y5.500 S0.30 F3000
+G1 X16.250 Y5.500 S0.30 F3000
+G1 X16.200 Y5.500 S0.30 F3000
+G1 X16.150 Y5.500 S0.30 F3000
+G1 X16.100 Y5.500 S0.30 F3000
+G1 X16.050 Y5.500 S0.30 F3000
+G1 X16.000 Y5.500 S0.30 F3000
+G1 X15.950 Y5.500 S0.30 F3000
+G1 X15.900 Y5.500 S0.30 F3000
+G1 X15.850 Y5.500 S0.30 F3000
+G1 X15.800 Y5.500 S0.30 F3000
+G1 X15.750 Y5.500 S0.30 F3000
+G1 X15.700 Y5.500 S0.30 F3000
+G1 X15.650 Y5.500 S0.30 F3000
+G1 X15.600 Y5.500 S0.30 F3000
+G1 X15.550 Y5.500 S0.30 F3000
+G1 X15.500 Y5.500 S0.30 F3000
+G1 X15.450 Y5.500 S0.30 F3000
+G1 X15.400 Y5.500 S0.30 F3000
+G1 X15.350 Y5.500 S0.30 F3000
+G1 X15.300 Y5.500 S0.30 F3000
+G1 X15.250 Y5.500 S0.30 F3000
+G1 X15.200 Y5.500 S0.30 F3000
+G1 X15.150 Y5.500 S0.30 F3000
+G1 X15.100 Y5.500 S0.30 F3000
+G1 X15.050 Y5.500 S0.30 F3000
+G1 X15.000 Y5.500 S0.30 F3000
+G1 X14.950 Y5.500 S0.40 F3000
+G1 X14.900 Y5.500 S0.40 F3000
+G1 X14.850 Y5.500 S0.40 F3000
+G1 X14.800 Y5.500 S0.40 F3000
+G1 X14.750 Y5.500 S0.40 F3000
+G1 X14.700 Y5.500 S0.40 F3000
+G1 X14.650 Y5.500 S0.40 F3000
+G1 X14.600 Y5.500 S0.40 F3000
+G1 X14.550 Y5.500 S0.40 F3000
+G1 X14.500 Y5.500 S0.40 F3000
+G1 X14.450 Y5.500 S0.40 F3000
+G1 X14.400 Y5.500 S0.40 F3000
+G1 X14.350 Y5.500 S0.40 F3000
+G1 X14.300 Y5.500 S0.40 F3000
+G1 X14.250 Y5.500 S0.40 F3000
+G1 X14.200 Y5.500 S0.40 F3000
+G1 X14.150 Y5.500 S0.40 F3000
+G1 X14.100 Y5.500 S0.40 F3000
+G1 X14.050 Y5.500 S0.40 F3000
+G1 X14.000 Y5.500 S0.40 F3000
+G1 X13.950 Y5.500 S0.40 F3000
+G1 X13.900 Y5.500 S0.40 F3000
+G1 X13.850 Y5.500 S0.40 F3000
+G1 X13.800 Y5.500 S0.40 F3000
+G1 X13.750 Y5.500 S0.40 F3000
+G1 X13.700 Y5.500 S0.40 F3000
+G1 X13.650 Y5.500 S0.40 F3000
+G1 X13.600 Y5.500 S0.40 F3000
+G1 X13.550 Y5.500 S0.40 F3000
+G1 X13.500 Y5.500 S0.40 F3000
+G1 X13.450 Y5.500 S0.40 F3000
+G1 X13.400 Y5.500 S0.40 F3000
+G1 X13.350 Y5.500 S0.40 F3000
+G1 X13.300 Y5.500 S0.40 F3000
+G1 X13.250 Y5.500 S0.40 F3000
+G1 X13.200 Y5.500 S0.40 F3000
+G1 X13.150 Y5.500 S0.40 F3000
+G1 X13.100 Y5.500 S0.40 F3000
+G1 X13.050 Y5.500 S0.40 F3000
+G1 X13.000 Y5.500 S0.40 F3000
+G1 X12.950 Y5.500 S0.20 F3000
+G1 X12.900 Y5.500 S0.20 F3000
+G1 X12.850 Y5.500 S0.20 F3000
+G1 X12.800 Y5.500 S0.20 F3000
+G1 X12.750 Y5.500 S0.20 F3000
+G1 X12.700 Y5.500 S0.20 F3000
+G1 X12.650 Y5.500 S0.20 F3000
+G1 X12.600 Y5.500 S0.20 F3000
+G1 X12.550 Y5.500 S0.20 F3000
+G1 X12.500 Y5.500 S0.20 F3000
+G1 X12.450 Y5.500 S0.20 F3000
+G1 X12.400 Y5.500 S0.20 F3000
+G1 X12.350 Y5.500 S0.20 F3000
+G1 X12.300 Y5.500 S0.20 F3000
+G1 X12.250 Y5.500 S0.20 F3000
+G1 X12.200 Y5.500 S0.20 F3000
+G1 X12.150 Y5.500 S0.20 F3000
+G1 X12.100 Y5.500 S0.20 F3000
+G1 X12.050 Y5.500 S0.20 F3000
+G1 X12.000 Y5.500 S0.20 F3000
+G1 X11.950 Y5.500 S0.20 F3000
+G1 X11.900 Y5.500 S0.20 F3000
+G1 X11.850 Y5.500 S0.20 F3000
+G1 X11.800 Y5.500 S0.20 F3000
+G1 X11.750 Y5.500 S0.20 F3000
+G1 X11.700 Y5.500 S0.20 F3000
+G1 X11.650 Y5.500 S0.20 F3000
+G1 X11.600 Y5.500 S0.20 F3000
+G1 X11.550 Y5.500 S0.20 F3000
+G1 X11.500 Y5.500 S0.20 F3000
+G1 X11.450 Y5.500 S0.20 F3000
+G1 X11.400 Y5.500 S0.20 F3000
+G1 X11.350 Y5.500 S0.20 F3000
+G1 X11.300 Y5.500 S0.20 F3000
+G1 X11.250 Y5.500 S0.20 F3000
+G1 X11.200 Y5.500 S0.20 F3000
+G1 X11.150 Y5.500 S0.20 F3000
+G1 X11.100 Y5.500 S0.20 F3000
+G1 X11.050 Y5.500 S0.20 F3000
+G1 X11.000 Y5.500 S0.20 F3000
+G1 X10.950 Y5.500 S0.30 F3000
+G1 X10.900 Y5.500 S0.30 F3000
+G1 X10.850 Y5.500 S0.30 F3000
+G1 X10.800 Y5.500 S0.30 F3000
+G1 X10.750 Y5.500 S0.30 F3000
+G1 X10.700 Y5.500 S0.30 F3000
+G1 X10.650 Y5.500 S0.30 F3000
+G1 X10.600 Y5.500 S0.30 F3000
+G1 X10.550 Y5.500 S0.30 F3000
+G1 X10.500 Y5.500 S0.30 F3000
+G1 X10.450 Y5.500 S0.30 F3000
+G1 X10.400 Y5.500 S0.30 F3000
+G1 X10.350 Y5.500 S0.30 F3000
+G1 X10.300 Y5.500 S0.30 F3000
+G1 X10.250 Y5.500 S0.30 F3000
+G1 X10.200 Y5.500 S0.30 F3000
+G1 X10.150 Y5.500 S0.30 F3000
+G1 X10.100 Y5.500 S0.30 F3000
+G1 X10.050 Y5.500 S0.30 F3000
+G1 X10.000 Y5.500 S0.30 F3000
+G1 X9.950 Y5.500 S0.30 F3000
+G1 X9.900 Y5.500 S0.30 F3000
+G1 X9.850 Y5.500 S0.30 F3000
+G1 X9.800 Y5.500 S0.30 F3000
+G1 X9.750 Y5.500 S0.30 F3000
+G1 X9.700 Y5.500 S0.30 F3000
+G1 X9.650 Y5.500 S0.30 F3000
+G1 X9.600 Y5.500 S0.30 F3000
+G1 X9.550 Y5.500 S0.30 F3000
+G1 X9.500 Y5.500 S0.30 F3000
+G1 X9.450 Y5.500 S0.30 F3000
+G1 X9.400 Y5.500 S0.30 F3000
+G1 X9.350 Y5.500 S0.30 F3000
+G1 X9.300 Y5.500 S0.30 F3000
+G1 X9.250 Y5.500 S0.30 F3000
+G1 X9.200 Y5.500 S0.30 F3000
+G1 X9.150 Y5.500 S0.30 F3000
+G1 X9.100 Y5.500 S0.30 F3000
+G1 X9.050 Y5.500 S0.30 F3000
+G1 X9.000 Y5.500 S0.30 F3000
+G1 X8.950 Y5.500 S0.40 F3000
+G1 X8.900 Y5.500 S0.40 F3000
+G1 X8.850 Y5.500 S0.40 F3000
+G1 X8.800 Y5.500 S0.40 F3000
+G1 X8.750 Y5.500 S0.40 F3000
+G1 X8.700 Y5.500 S0.40 F3000
+G1 X8.650 Y5.500 S0.40 F3000
+G1 X8.600 Y5.500 S0.40 F3000
+G1 X8.550 Y5.500 S0.40 F3000
+G1 X8.500 Y5.500 S0.40 F3000
+G1 X8.450 Y5.500 S0.40 F3000
+G1 X8.400 Y5.500 S0.40 F3000
+G1 X8.350 Y5.500 S0.40 F3000
+G1 X8.300 Y5.500 S0.40 F3000
+G1 X8.250 Y5.500 S0.40 F3000
+G1 X8.200 Y5.500 S0.40 F3000
+G1 X8.150 Y5.500 S0.40 F3000
+G1 X8.100 Y5.500 S0.40 F3000
+G1 X8.050 Y5.500 S0.40 F3000
+G1 X8.000 Y5.500 S0.40 F3000
+G1 X7.950 Y5.500 S0.40 F3000
+G1 X7.900 Y5.500 S0.40 F3000
+G1 X7.850 Y5.500 S0.40 F3000
+G1 X7.800 Y5.500 S0.40 F3000
+G1 X7.750 Y5.500 S0.40 F3000
+G1 X7.700 Y5.500 S0.40 F3000
+G1 X7.650 Y5.500 S0.40 F3000
+G1 X7.600 Y5.500 S0.40 F3000
+G1 X7.550 Y5.500 S0.40 F3000
+G1 X7.500 Y5.500 S0.40 F3000
+G1 X7.450 Y5.500 S0.40 F3000
+G1 X7.400 Y5.500 S0.40 F3000
+G1 X7.350 Y5.500 S0.40 F3000
+G1 X7.300 Y5.500 S0.40 F3000
+G1 X7.250 Y5.500 S0.40 F3000
+G1 X7.200 Y5.500 S0.40 F3000
+G1 X7.150 Y5.500 S0.40 F3000
+G1 X7.100 Y5.500 S0.40 F3000
+G1 X7.050 Y5.500 S0.40 F3000
+G1 X7.000 Y5.500 S0.40 F3000
+G1 X6.950 Y5.500 S0.20 F3000
+G1 X6.900 Y5.500 S0.20 F3000
+G1 X6.850 Y5.500 S0.20 F3000
+G1 X6.800 Y5.500 S0.20 F3000
+G1 X6.750 Y5.500 S0.20 F3000
+G1 X6.700 Y5.500 S0.20 F3000
+G1 X6.650 Y5.500 S0.20 F3000
+G1 X6.600 Y5.500 S0.20 F3000
+G1 X6.550 Y5.500 S0.20 F3000
+G1 X6.500 Y5.500 S0.20 F3000
+G1 X6.450 Y5.500 S0.20 F3000
+G1 X6.400 Y5.500 S0.20 F3000
+G1 X6.350 Y5.500 S0.20 F3000
+G1 X6.300 Y5.500 S0.20 F3000
+G1 X6.250 Y5.500 S0.20 F3000
+G1 X6.200 Y5.500 S0.20 F3000
+G1 X6.150 Y5.500 S0.20 F3000
+G1 X6.100 Y5.500 S0.20 F3000
+G1 X6.050 Y5.500 S0.20 F3000
+G1 X6.000 Y5.500 S0.20 F3000
+G1 X5.950 Y5.500 S0.20 F3000
+G1 X5.900 Y5.500 S0.20 F3000
+G1 X5.850 Y5.500 S0.20 F3000
+G1 X5.800 Y5.500 S0.20 F3000
+G1 X5.750 Y5.500 S0.20 F3000
+G1 X5.700 Y5.500 S0.20 F3000
+G1 X5.650 Y5.500 S0.20 F3000
+G1 X5.600 Y5.500 S0.20 F3000
+G1 X5.550 Y5.500 S0.20 F3000
+G1 X5.500 Y5.500 S0.20 F3000
+G1 X5.450 Y5.500 S0.20 F3000
+G1 X5.400 Y5.500 S0.20 F3000
+G1 X5.350 Y5.500 S0.20 F3000
+G1 X5.300 Y5.500 S0.20 F3000
+G1 X5.250 Y5.500 S0.20 F3000
+G1 X5.200 Y5.500 S0.20 F3000
+G1 X5.150 Y5.500 S0.20 F3000
+G1 X5.100 Y5.500 S0.20 F3000
+G1 X5.050 Y5.500 S0.20 F3000
+G1 X5.000 Y5.500 S0.20 F3000
+G1 Y6.000 S0
+G1 X5.050 Y6.000 S0.20 F3000
+G1 X5.100 Y6.000 S0.20 F3000
+G1 X5.150 Y6.000 S0.20 F3000
+G1 X5.200 Y6.000 S0.20 F3000
+G1 X5.250 Y6.000 S0.20 F3000
+G1 X5.300 Y6.000 S0.20 F3000
+G1 X5.350 Y6.000 S0.20 F3000
+G1 X5.400 Y6.000 S0.20 F3000
+G1 X5.450 Y6.000 S0.20 F3000
+G1 X5.500 Y6.000 S0.20 F3000
+G1 X5.550 Y6.000 S0.20 F3000
+G1 X5.600 Y6.000 S0.20 F3000
+G1 X5.650 Y6.000 S0.20 F3000
+G1 X5.700 Y6.000 S0.20 F3000
+G1 X5.750 Y6.000 S0.20 F3000
+G1 X5.800 Y6.000 S0.20 F3000
+G1 X5.850 Y6.000 S0.20 F3000
+G1 X5.900 Y6.000 S0.20 F3000
+G1 X5.950 Y6.000 S0.20 F3000
+G1 X6.000 Y6.000 S0.20 F3000
+G1 X6.050 Y6.000 S0.20 F3000
+G1 X6.100 Y6.000 S0.20 F3000
+G1 X6.150 Y6.000 S0.20 F3000
+G1 X6.200 Y6.000 S0.20 F3000
+G1 X6.250 Y6.000 S0.20 F3000
+G1 X6.300 Y6.000 S0.20 F3000
+G1 X6.350 Y6.000 S0.20 F3000
+G1 X6.400 Y6.000 S0.20 F3000
+G1 X6.450 Y6.000 S0.20 F3000
+G1 X6.500 Y6.000 S0.20 F3000
+G1 X6.550 Y6.000 S0.20 F3000
+G1 X6.600 Y6.000 S0.20 F3000
+G1 X6.650 Y6.000 S0.20 F3000
+G1 X6.700 Y6.000 S0.20 F3000
+G1 X6.750 Y6.000 S0.20 F3000
+G1 X6.800 Y6.000 S0.20 F3000
+G1 X6.850 Y6.000 S0.20 F3000
+G1 X6.900 Y6.000 S0.20 F3000
+G1 X6.950 Y6.000 S0.20 F3000
+G1 X7.000 Y6.000 S0.20 F3000
+G1 X7.050 Y6.000 S0.30 F3000
+G1 X7.100 Y6.000 S0.30 F3000
+G1 X7.150 Y6.000 S0.30 F3000
+G1 X7.200 Y6.000 S0.30 F3000
+G1 X7.250 Y6.000 S0.30 F3000
+G1 X7.300 Y6.000 S0.30 F3000
+G1 X7.350 Y6.000 S0.30 F3000
+G1 X7.400 Y6.000 S0.30 F3000
+G1 X7.450 Y6.000 S0.30 F3000
+G1 X7.500 Y6.000 S0.30 F3000
+G1 X7.550 Y6.000 S0.30 F3000
+G1 X7.600 Y6.000 S0.30 F3000
+G1 X7.650 Y6.000 S0.30 F3000
+G1 X7.700 Y6.000 S0.30 F3000
+G1 X7.750 Y6.000 S0.30 F3000
+G1 X7.800 Y6.000 S0.30 F3000
+G1 X7.850 Y6.000 S0.30 F3000
+G1 X7.900 Y6.000 S0.30 F3000
+G1 X7.950 Y6.000 S0.30 F3000
+G1 X8.000 Y6.000 S0.30 F3000
+G1 X8.050 Y6.000 S0.30 F3000
+G1 X8.100 Y6.000 S0.30 F3000
+G1 X8.150 Y6.000 S0.30 F3000
+G1 X8.200 Y6.000 S0.30 F3000
+G1 X8.250 Y6.000 S0.30 F3000
+G1 X8.300 Y6.000 S0.30 F3000
+G1 X8.350 Y6.000 S0.30 F3000
+G1 X8.400 Y6.000 S0.30 F3000
+G1 X8.450 Y6.000 S0.30 F3000
+G1 X8.500 Y6.000 S0.30 F3000
+G1 X8.550 Y6.000 S0.30 F3000
+G1 X8.600 Y6.000 S0.30 F3000
+G1 X8.650 Y6.000 S0.30 F3000
+G1 X8.700 Y6.000 S0.30 F3000
+G1 X8.750 Y6.000 S0.30 F3000
+G1 X8.800 Y6.000 S0.30 F3000
+G1 X8.850 Y6.000 S0.30 F3000
+G1 X8.900 Y6.000 S0.30 F3000
+G1 X8.950 Y6.000 S0.30 F3000
+G1 X9.000 Y6.000 S0.30 F3000
+G1 X9.050 Y6.000 S0.40 F3000
+G1 X9.100 Y6.000 S0.40 F3000
+G1 X9.150 Y6.000 S0.40 F3000
+G1 X9.200 Y6.000 S0.40 F3000
+G1 X9.250 Y6.000 S0.40 F3000
+G1 X9.300 Y6.000 S0.40 F3000
+G1 X9.350 Y6.000 S0.40 F3000
+G1 X9.400 Y6.000 S0.40 F3000
+G1 X9.450 Y6.000 S0.40 F3000
+G1 X9.500 Y6.000 S0.40 F3000
+G1 X9.550 Y6.000 S0.40 F3000
+G1 X9.600 Y6.000 S0.40 F3000
+G1 X9.650 Y6.000 S0.40 F3000
+G1 X9.700 Y6.000 S0.40 F3000
+G1 X9.750 Y6.000 S0.40 F3000
+G1 X9.800 Y6.000 S0.40 F3000
+G1 X9.850 Y6.000 S0.40 F3000
+G1 X9.900 Y6.000 S0.40 F3000
+G1 X9.950 Y6.000 S0.40 F3000
+G1 X10.000 Y6.000 S0.40 F3000
+G1 X10.050 Y6.000 S0.40 F3000
+G1 X10.100 Y6.000 S0.40 F3000
+G1 X10.150 Y6.000 S0.40 F3000
+G1 X10.200 Y6.000 S0.40 F3000
+G1 X10.250 Y6.000 S0.40 F3000
+G1 X10.300 Y6.000 S0.40 F3000
+G1 X10.350 Y6.000 S0.40 F3000
+G1 X10.400 Y6.000 S0.40 F3000
+G1 X10.450 Y6.000 S0.40 F3000
+G1 X10.500 Y6.000 S0.40 F3000
+G1 X10.550 Y6.000 S0.40 F3000
+G1 X10.600 Y6.000 S0.40 F3000
+G1 X10.650 Y6.000 S0.40 F3000
+G1 X10.700 Y6.000 S0.40 F3000
+G1 X10.750 Y6.000 S0.40 F3000
+G1 X10.800 Y6.000 S0.40 F3000
+G1 X10.850 Y6.000 S0.40 F3000
+G1 X10.900 Y6.000 S0.40 F3000
+G1 X10.950 Y6.000 S0.40 F3000
+G1 X11.000 Y6.000 S0.40 F3000
+G1 X11.050 Y6.000 S0.20 F3000
+G1 X11.100 Y6.000 S0.20 F3000
+G1 X11.150 Y6.000 S0.20 F3000
+G1 X11.200 Y6.000 S0.20 F3000
+G1 X11.250 Y6.000 S0.20 F3000
+G1 X11.300 Y6.000 S0.20 F3000
+G1 X11.350 Y6.000 S0.20 F3000
+G1 X11.400 Y6.000 S0.20 F3000
+G1 X11.450 Y6.000 S0.20 F3000
+G1 X11.500 Y6.000 S0.20 F3000
+G1 X11.550 Y6.000 S0.20 F3000
+G1 X11.600 Y6.000 S0.20 F3000
+G1 X11.650 Y6.000 S0.20 F3000
+G1 X11.700 Y6.000 S0.20 F3000
+G1 X11.750 Y6.000 S0.20 F3000
+G1 X11.800 Y6.000 S0.20 F3000
+G1 X11.850 Y6.000 S0.20 F3000
+G1 X11.900 Y6.000 S0.20 F3000
+G1 X11.950 Y6.000 S0.20 F3000
+G1 X12.000 Y6.000 S0.20 F3000
+G1 X12.050 Y6.000 S0.20 F3000
+G1 X12.100 Y6.000 S0.20 F3000
+G1 X12.150 Y6.000 S0.20 F3000
+G1 X12.200 Y6.000 S0.20 F3000
+G1 X12.250 Y6.000 S0.20 F3000
+G1 X12.300 Y6.000 S0.20 F3000
+G1 X12.350 Y6.000 S0.20 F3000
+G1 X12.400 Y6.000 S0.20 F3000
+G1 X12.450 Y6.000 S0.20 F3000
+G1 X12.500 Y6.000 S0.20 F3000
+G1 X12.550 Y6.000 S0.20 F3000
+G1 X12.600 Y6.000 S0.20 F3000
+G1 X12.650 Y6.000 S0.20 F3000
+G1 X12.700 Y6.000 S0.20 F3000
+G1 X12.750 Y6.000 S0.20 F3000
+G1 X12.800 Y6.000 S0.20 F3000
+G1 X12.850 Y6.000 S0.20 F3000
+G1 X12.900 Y6.000 S0.20 F3000
+G1 X12.950 Y6.000 S0.20 F3000
+G1 X13.000 Y6.000 S0.20 F3000
+G1 X13.050 Y6.000 S0.30 F3000
+G1 X13.100 Y6.000 S0.30 F3000
+G1 X13.150 Y6.000 S0.30 F3000
+G1 X13.200 Y6.000 S0.30 F3000
+G1 X13.250 Y6.000 S0.30 F3000
+G1 X13.300 Y6.000 S0.30 F3000
+G1 X13.350 Y6.000 S0.30 F3000
+G1 X13.400 Y6.000 S0.30 F3000
+G1 X13.450 Y6.000 S0.30 F3000
+G1 X13.500 Y6.000 S0.30 F3000
+G1 X13.550 Y6.000 S0.30 F3000
+G1 X13.600 Y6.000 S0.30 F3000
+G1 X13.650 Y6.000 S0.30 F3000
+G1 X13.700 Y6.000 S0.30 F3000
+G1 X13.750 Y6.000 S0.30 F3000
+G1 X13.800 Y6.000 S0.30 F3000
+G1 X13.850 Y6.000 S0.30 F3000
+G1 X13.900 Y6.000 S0.30 F3000
+G1 X13.950 Y6.000 S0.30 F3000
+G1 X14.000 Y6.000 S0.30 F3000
+G1 X14.050 Y6.000 S0.30 F3000
+G1 X14.100 Y6.000 S0.30 F3000
+G1 X14.150 Y6.000 S0.30 F3000
+G1 X14.200 Y6.000 S0.30 F3000
+G1 X14.250 Y6.000 S0.30 F3000
+G1 X14.300 Y6.000 S0.30 F3000
+G1 X14.350 Y6.000 S0.30 F3000
+G1 X14.400 Y6.000 S0.30 F3000
+G1 X14.450 Y6.000 S0.30 F3000
+G1 X14.500 Y6.000 S0.30 F3000
+G1 X14.550 Y6.000 S0.30 F3000
+G1 X14.600 Y6.000 S0.30 F3000
+G1 X14.650 Y6.000 S0.30 F3000
+G1 X14.700 Y6.000 S0.30 F3000
+G1 X14.750 Y6.000 S0.30 F3000
+G1 X14.800 Y6.000 S0.30 F3000
+G1 X14.850 Y6.000 S0.30 F3000
+G1 X14.900 Y6.000 S0.30 F3000
+G1 X14.950 Y6.000 S0.30 F3000
+G1 X15.000 Y6.000 S0.30 F3000
+G1 X15.050 Y6.000 S0.40 F3000
+G1 X15.100 Y6.000 S0.40 F3000
+G1 X15.150 Y6.000 S0.40 F3000
+G1 X15.200 Y6.000 S0.40 F3000
+G1 X15.250 Y6.000 S0.40 F3000
+G1 X15.300 Y6.000 S0.40 F3000
+G1 X15.350 Y6.000 S0.40 F3000
+G1 X15.400 Y6.000 S0.40 F3000
+G1 X15.450 Y6.000 S0.40 F3000
+G1 X15.500 Y6.000 S0.40 F3000
+G1 X15.550 Y6.000 S0.40 F3000
+G1 X15.600 Y6.000 S0.40 F3000
+G1 X15.650 Y6.000 S0.40 F3000
+G1 X15.700 Y6.000 S0.40 F3000
+G1 X15.750 Y6.000 S0.40 F3000
+G1 X15.800 Y6.000 S0.40 F3000
+G1 X15.850 Y6.000 S0.40 F3000
+G1 X15.900 Y6.000 S0.40 F3000
+G1 X15.950 Y6.000 S0.40 F3000
+G1 X16.000 Y6.000 S0.40 F3000
+G1 X16.050 Y6.000 S0.40 F3000
+G1 X16.100 Y6.000 S0.40 F3000
+G1 X16.150 Y6.000 S0.40 F3000
+G1 X16.200 Y6.000 S0.40 F3000
+G1 X16.250 Y6.000 S0.40 F3000
+G1 X16.300 Y6.000 S0.40 F3000
+G1 X16.350 Y6.000 S0.40 F3000
+G1 X16.400 Y6.000 S0.40 F3000
+G1 X16.450 Y6.000 S0.40 F3000
+G1 X16.500 Y6.000 S0.40 F3000
+G1 X16.550 Y6.000 S0.40 F3000
+G1 X16.600 Y6.000 S0.40 F3000
+G1 X16.650 Y6.000 S0.40 F3000
+G1 X16.700 Y6.000 S0.40 F3000
+G1 X16.750 Y6.000 S0.40 F3000
+G1 X16.800 Y6.000 S0.40 F3000
+G1 X16.850 Y6.000 S0.40 F3000
+G1 X16.900 Y6.000 S0.40 F3000
+G1 X16.950 Y6.000 S0.40 F3000
+G1 X17.000 Y6.000 S0.40 F3000
+G1 X17.050 Y6.000 S0.20 F3000
+G1 X17.100 Y6.000 S0.20 F3000
+G1 X17.150 Y6.000 S0.20 F3000
+G1 X17.200 Y6.000 S0.20 F3000
+G1 X17.250 Y6.000 S0.20 F3000
+G1 X17.300 Y6.000 S0.20 F3000
+G1 X17.350 Y6.000 S0.20 F3000
+G1 X17.400 Y6.000 S0.20 F3000
+G1 X17.450 Y6.000 S0.20 F3000
+G1 X17.500 Y6.000 S0.20 F3000
+G1 X17.550 Y6.000 S0.20 F3000
+G1 X17.600 Y6.000 S0.20 F3000
+G1 X17.650 Y6.000 S0.20 F3000
+G1 X17.700 Y6.000 S0.20 F3000
+G1 X17.750 Y6.000 S0.20 F3000
+G1 X17.800 Y6.000 S0.20 F3000
+G1 X17.850 Y6.000 S0.20 F3000
+G1 X17.900 Y6.000 S0.20 F3000
+G1 X17.950 Y6.000 S0.20 F3000
+G1 X18.000 Y6.000 S0.20 F3000
+G1 X18.050 Y6.000 S0.20 F3000
+G1 X18.100 Y6.000 S0.20 F3000
+G1 X18.150 Y6.000 S0.20 F3000
+G1 X18.200 Y6.000 S0.20 F3000
+G1 X18.250 Y6.000 S0.20 F3000
+G1 X18.300 Y6.000 S0.20 F3000
+G1 X18.350 Y6.000 S0.20 F3000
+G1 X18.400 Y6.000 S0.20 F3000
+G1 X18.450 Y6.000 S0.20 F3000
+G1 X18.500 Y6.000 S0.20 F3000
+G1 X18.550 Y6.000 S0.20 F3000
+G1 X18.600 Y6.000 S0.20 F3000
+G1 X18.650 Y6.000 S0.20 F3000
+G1 X18.700 Y6.000 S0.20 F3000
+G1 X18.750 Y6.000 S0.20 F3000
+G1 X18.800 Y6.000 S0.20 F3000
+G1 X18.850 Y6.000 S0.20 F3000
+G1 X18.900 Y6.000 S0.20 F3000
+G1 X18.950 Y6.000 S0.20 F3000
+G1 X19.000 Y6.000 S0.20 F3000
+G1 X19.050 Y6.000 S0.30 F3000
+G1 X19.100 Y6.000 S0.30 F3000
+G1 X19.150 Y6.000 S0.30 F3000
+G1 X19.200 Y6.000 S0.30 F3000
+G1 X19.250 Y6.000 S0.30 F3000
+G1 X19.300 Y6.000 S0.30 F3000
+G1 X19.350 Y6.000 S0.30 F3000
+G1 X19.400 Y6.000 S0.30 F3000
+G1 X19.450 Y6.000 S0.30 F3000
+G1 X19.500 Y6.000 S0.30 F3000
+G1 X19.550 Y6.000 S0.30 F3000
+G1 X19.600 Y6.000 S0.30 F3000
+G1 X19.650 Y6.000 S0.30 F3000
+G1 X19.700 Y6.000 S0.30 F3000
+G1 X19.750 Y6.000 S0.30 F3000
+G1 X19.800 Y6.000 S0.30 F3000
+G1 X19.850 Y6.000 S0.30 F3000
+G1 X19.900 Y6.000 S0.30 F3000
+G1 X19.950 Y6.000 S0.30 F3000
+G1 X20.000 Y6.000 S0.30 F3000
+G1 X20.050 Y6.000 S0.30 F3000
+G1 X20.100 Y6.000 S0.30 F3000
+G1 X20.150 Y6.000 S0.30 F3000
+G1 X20.200 Y6.000 S0.30 F3000
+G1 X20.250 Y6.000 S0.30 F3000
+G1 X20.300 Y6.000 S0.30 F3000
+G1 X20.350 Y6.000 S0.30 F3000
+G1 X20.400 Y6.000 S0.30 F3000
+G1 X20.450 Y6.000 S0.30 F3000
+G1 X20.500 Y6.000 S0.30 F3000
+G1 X20.550 Y6.000 S0.30 F3000
+G1 X20.600 Y6.000 S0.30 F3000
+G1 X20.650 Y6.000 S0.30 F3000
+G1 X20.700 Y6.000 S0.30 F3000
+G1 X20.750 Y6.000 S0.30 F3000
+G1 X20.800 Y6.000 S0.30 F3000
+G1 X20.850 Y6.000 S0.30 F3000
+G1 X20.900 Y6.000 S0.30 F3000
+G1 X20.950 Y6.000 S0.30 F3000
+G1 X21.000 Y6.000 S0.30 F3000
+G1 X21.050 Y6.000 S0.40 F3000
+G1 X21.100 Y6.000 S0.40 F3000
+G1 X21.150 Y6.000 S0.40 F3000
+G1 X21.200 Y6.000 S0.40 F3000
+G1 X21.250 Y6.000 S0.40 F3000
+G1 X21.300 Y6.000 S0.40 F3000
+G1 X21.350 Y6.000 S0.40 F3000
+G1 X21.400 Y6.000 S0.40 F3000
+G1 X21.450 Y6.000 S0.40 F3000
+G1 X21.500 Y6.000 S0.40 F3000
+G1 X21.550 Y6.000 S0.40 F3000
+G1 X21.600 Y6.000 S0.40 F3000
+G1 X21.650 Y6.000 S0.40 F3000
+G1 X21.700 Y6.000 S0.40 F3000
+G1 X21.750 Y6.000 S0.40 F3000
+G1 X21.800 Y6.000 S0.40 F3000
+G1 X21.850 Y6.000 S0.40 F3000
+G1 X21.900 Y6.000 S0.40 F3000
+G1 X21.950 Y6.000 S0.40 F3000
+G1 X22.000 Y6.000 S0.40 F3000
+G1 X22.050 Y6.000 S0.40 F3000
+G1 X22.100 Y6.000 S0.40 F3000
+G1 X22.150 Y6.000 S0.40 F3000
+G1 X22.200 Y6.000 S0.40 F3000
+G1 X22.250 Y6.000 S0.40 F3000
+G1 X22.300 Y6.000 S0.40 F3000
+G1 X22.350 Y6.000 S0.40 F3000
+G1 X22.400 Y6.000 S0.40 F3000
+G1 X22.450 Y6.000 S0.40 F3000
+G1 X22.500 Y6.000 S0.40 F3000
+G1 X22.550 Y6.000 S0.40 F3000
+G1 X22.600 Y6.000 S0.40 F3000
+G1 X22.650 Y6.000 S0.40 F3000
+G1 X22.700 Y6.000 S0.40 F3000
+G1 X22.750 Y6.000 S0.40 F3000
+G1 X22.800 Y6.000 S0.40 F3000
+G1 X22.850 Y6.000 S0.40 F3000
+G1 X22.900 Y6.000 S0.40 F3000
+G1 X22.950 Y6.000 S0.40 F3000
+G1 X23.000 Y6.000 S0.40 F3000
+G1 X23.050 Y6.000 S0.20 F3000
+G1 X23.100 Y6.000 S0.20 F3000
+G1 X23.150 Y6.000 S0.20 F3000
+G1 X23.200 Y6.000 S0.20 F3000
+G1 X23.250 Y6.000 S0.20 F3000
+G1 X23.300 Y6.000 S0.20 F3000
+G1 X23.350 Y6.000 S0.20 F3000
+G1 X23.400 Y6.000 S0.20 F3000
+G1 X23.450 Y6.000 S0.20 F3000
+G1 X23.500 Y6.000 S0.20 F3000
+G1 X23.550 Y6.000 S0.20 F3000
+G1 X23.600 Y6.000 S0.20 F3000
+G1 X23.650 Y6.000 S0.20 F3000
+G1 X23.700 Y6.000 S0.20 F3000
+G1 X23.750 Y6.000 S0.20 F3000
+G1 X23.800 Y6.000 S0.20 F3000
+G1 X23.850 Y6.000 S0.20 F3000
+G1 X23.900 Y6.000 S0.20 F3000
+G1 X23.950 Y6.000 S0.20 F3000
+G1 X24.000 Y6.000 S0.20 F3000
+G1 X24.050 Y6.000 S0.20 F3000
+G1 X24.100 Y6.000 S0.20 F3000
+G1 X24.150 Y6.000 S0.20 F3000
+G1 X24.200 Y6.000 S0.20 F3000
+G1 X24.250 Y6.000 S0.20 F3000
+G1 X24.300 Y6.000 S0.20 F3000
+G1 X24.350 Y6.000 S0.20 F3000
+G1 X24.400 Y6.000 S0.20 F3000
+G1 X24.450 Y6.000 S0.20 F3000
+G1 X24.500 Y6.000 S0.20 F3000
+G1 X24.550 Y6.000 S0.20 F3000
+G1 X24.600 Y6.000 S0.20 F3000
+G1 X24.650 Y6.000 S0.20 F3000
+G1 X24.700 Y6.000 S0.20 F3000
+G1 X24.750 Y6.000 S0.20 F3000
+G1 X24.800 Y6.000 S0.20 F3000
+G1 X24.850 Y6.000 S0.20 F3000
+G1 X24.900 Y6.000 S0.20 F3000
+G1 X24.950 Y6.000 S0.20 F3000
+G1 X25.000 Y6.000 S0.20 F3000
+G1 Y6.500 S0
+G1 X24.950 Y6.500 S0.20 F3000
+G1 X24.900 Y6.500 S0.20 F3000
+G1 X24.850 Y6.500 S0.20 F3000
+G1 X24.800 Y6.500 S0.20 F3000
+G1 X24.750 Y6.500 S0.20 F3000
+G1 X24.700 Y6.500 S0.20 F3000
+G1 X24.650 Y6.500 S0.20 F3000
+G1 X24.600 Y6.500 S0.20 F3000
+G1 X24.550 Y6.500 S0.20 F3000
+G1 X24.500 Y6.500 S0.20 F3000
+G1 X24.450 Y6.500 S0.20 F3000
+G1 X24.400 Y6.500 S0.20 F3000
+G1 X24.350 Y6.500 S0.20 F3000
+G1 X24.300 Y6.500 S0.20 F3000
+G1 X24.250 Y6.500 S0.20 F3000
+G1 X24.200 Y6.500 S0.20 F3000
+G1 X24.150 Y6.500 S0.20 F3000
+G1 X24.100 Y6.500 S0.20 F3000
+G1 X24.050 Y6.500 S0.20 F3000
+G1 X24.000 Y6.500 S0.20 F3000
+G1 X23.950 Y6.500 S0.20 F3000
+G1 X23.900 Y6.500 S0.20 F3000
+G1 X23.850 Y6.500 S0.20 F3000
+G1 X23.800 Y6.500 S0.20 F3000
+G1 X23.750 Y6.500 S0.20 F3000
+G1 X23.700 Y6.500 S0.20 F3000
+G1 X23.650 Y6.500 S0.20 F3000
+G1 X23.600 Y6.500 S0.20 F3000
+G1 X23.550 Y6.500 S0.20 F3000
+G1 X23.500 Y6.500 S0.20 F3000
+G1 X23.450 Y6.500 S0.20 F3000
+G1 X23.400 Y6.500 S0.20 F3000
+G1 X23.350 Y6.500 S0.20 F3000
+G1 X23.300 Y6.500 S0.20 F3000
+G1 X23.250 Y6.500 S0.20 F3000
+G1 X23.200 Y6.500 S0.20 F3000
+G1 X23.150 Y6.500 S0.20 F3000
+G1 X23.100 Y6.500 S0.20 F3000
+G1 X23.050 Y6.500 S0.20 F3000
+G1 X23.000 Y6.500 S0.20 F3000
+G1 X22.950 Y6.500 S0.30 F3000
+G1 X22.900 Y6.500 S0.30 F3000
+G1 X22.850 Y6.500 S0.30 F3000
+G1 X22.800 Y6.500 S0.30 F3000
+G1 X22.750 Y6.500 S0.30 F3000
+G1 X22.700 Y6.500 S0.30 F3000
+G1 X22.650 Y6.500 S0.30 F3000
+G1 X22.600 Y6.500 S0.30 F3000
+G1 X22.550 Y6.500 S0.30 F3000
+G1 X22.500 Y6.500 S0.30 F3000
+G1 X22.450 Y6.500 S0.30 F3000
+G1 X22.400 Y6.500 S0.30 F3000
+G1 X22.350 Y6.500 S0.30 F3000
+G1 X22.300 Y6.500 S0.30 F3000
+G1 X22.250 Y6.500 S0.30 F3000
+G1 X22.200 Y6.500 S0.30 F3000
+G1 X22.150 Y6.500 S0.30 F3000
+G1 X22.100 Y6.500 S0.30 F3000
+G1 X22.050 Y6.500 S0.30 F3000
+G1 X22.000 Y6.500 S0.30 F3000
+G1 X21.950 Y6.500 S0.30 F3000
+G1 X21.900 Y6.500 S0.30 F3000
+G1 X21.850 Y6.500 S0.30 F3000
+G1 X21.800 Y6.500 S0.30 F3000
+G1 X21.750 Y6.500 S0.30 F3000
+G1 X21.700 Y6.500 S0.30 F3000
+G1 X21.650 Y6.500 S0.30 F3000
+G1 X21.600 Y6.500 S0.30 F3000
+G1 X21.550 Y6.500 S0.30 F3000
+G1 X21.500 Y6.500 S0.30 F3000
+G1 X21.450 Y6.500 S0.30 F3000
+G1 X21.400 Y6.500 S0.30 F3000
+G1 X21.350 Y6.500 S0.30 F3000
+G1 X21.300 Y6.500 S0.30 F3000
+G1 X21.250 Y6.500 S0.30 F3000
+G1 X21.200 Y6.500 S0.30 F3000
+G1 X21.150 Y6.500 S0.30 F3000
+G1 X21.100 Y6.500 S0.30 F3000
+G1 X21.050 Y6.500 S0.30 F3000
+G1 X21.000 Y6.500 S0.30 F3000
+G1 X20.950 Y6.500 S0.40 F3000
+G1 X20.900 Y6.500 S0.40 F3000
+G1 X20.850 Y6.500 S0.40 F3000
+G1 X20.800 Y6.500 S0.40 F3000
+G1 X20.750 Y6.500 S0.40 F3000
+G1 X20.700 Y6.500 S0.40 F3000
+G1 X20.650 Y6.500 S0.40 F3000
+G1 X20.600 Y6.500 S0.40 F3000
+G1 X20.550 Y6.500 S0.40 F3000
+G1 X20.500 Y6.500 S0.40 F3000
+G1 X20.450 Y6.500 S0.40 F3000
+G1 X20.400 Y6.500 S0.40 F3000
+G1 X20.350 Y6.500 S0.40 F3000
+G1 X20.300 Y6.500 S0.40 F3000
+G1 X20.250 Y6.500 S0.40 F3000
+G1 X20.200 Y6.500 S0.40 F3000
+G1 X20.150 Y6.500 S0.40 F3000
+G1 X20.100 Y6.500 S0.40 F3000
+G1 X20.050 Y6.500 S0.40 F3000
+G1 X20.000 Y6.500 S0.40 F3000
+G1 X19.950 Y6.500 S0.40 F3000
+G1 X19.900 Y6.500 S0.40 F3000
+G1 X19.850 Y6.500 S0.40 F3000
+G1 X19.800 Y6.500 S0.40 F3000
+G1 X19.750 Y6.500 S0.40 F3000
+G1 X19.700 Y6.500 S0.40 F3000
+G1 X19.650 Y6.500 S0.40 F3000
+G1 X19.600 Y6.500 S0.40 F3000
+G1 X19.550 Y6.500 S0.40 F3000
+G1 X19.500 Y6.500 S0.40 F3000
+G1 X19.450 Y6.500 S0.40 F3000
+G1 X19.400 Y6.500 S0.40 F3000
+G1 X19.350 Y6.500 S0.40 F3000
+G1 X19.300 Y6.500 S0.40 F3000
+G1 X19.250 Y6.500 S0.40 F3000
+G1 X19.200 Y6.500 S0.40 F3000
+G1 X19.150 Y6.500 S0.40 F3000
+G1 X19.100 Y6.500 S0.40 F3000
+G1 X19.050 Y6.500 S0.40 F3000
+G1 X19.000 Y6.500 S0.40 F3000
+G1 X18.950 Y6.500 S0.20 F3000
+G1 X18.900 Y6.500 S0.20 F3000
+G1 X18.850 Y6.500 S0.20 F3000
+G1 X18.800 Y6.500 S0.20 F3000
+G1 X18.750 Y6.500 S0.20 F3000
+G1 X18.700 Y6.500 S0.20 F3000
+G1 X18.650 Y6.500 S0.20 F3000
+G1 X18.600 Y6.500 S0.20 F3000
+G1 X18.550 Y6.500 S0.20 F3000
+G1 X18.500 Y6.500 S0.20 F3000
+G1 X18.450 Y6.500 S0.20 F3000
+G1 X18.400 Y6.500 S0.20 F3000
+G1 X18.350 Y6.500 S0.20 F3000
+G1 X18.300 Y6.500 S0.20 F3000
+G1 X18.250 Y6.500 S0.20 F3000
+G1 X18.200 Y6.500 S0.20 F3000
+G1 X18.150 Y6.500 S0.20 F3000
+G1 X18.100 Y6.500 S0.20 F3000
+G1 X18.050 Y6.500 S0.20 F3000
+G1 X18.000 Y6.500 S0.20 F3000
+G1 X17.950 Y6.500 S0.20 F3000
+G1 X17.900 Y6.500 S0.20 F3000
+G1 X17.850 Y6.500 S0.20 F3000
+G1 X17.800 Y6.500 S0.20 F3000
+G1 X17.750 Y6.500 S0.20 F3000
+G1 X17.700 Y6.500 S0.20 F3000
+G1 X17.650 Y6.500 S0.20 F3000
+G1 X17.600 Y6.500 S0.20 F3000
+G1 X17.550 Y6.500 S0.20 F3000
+G1 X17.500 Y6.500 S0.20 F3000
+G1 X17.450 Y6.500 S0.20 F3000
+G1 X17.400 Y6.500 S0.20 F3000
+G1 X17.350 Y6.500 S0.20 F3000
+G1 X17.300 Y6.500 S0.20 F3000
+G1 X17.250 Y6.500 S0.20 F3000
+G1 X17.200 Y6.500 S0.20 F3000
+G1 X17.150 Y6.500 S0.20 F3000
+G1 X17.100 Y6.500 S0.20 F3000
+G1 X17.050 Y6.500 S0.20 F3000
+G1 X17.000 Y6.500 S0.20 F3000
+G1 X16.950 Y6.500 S0.30 F3000
+G1 X16.900 Y6.500 S0.30 F3000
+G1 X16.850 Y6.500 S0.30 F3000
+G1 X16.800 Y6.500 S0.30 F3000
+G1 X16.750 Y6.500 S0.30 F3000
+G1 X16.700 Y6.500 S0.30 F3000
+G1 X16.650 Y6.500 S0.30 F3000
+G1 X16.600 Y6.500 S0.30 F3000
+G1 X16.550 Y6.500 S0.30 F3000
+G1 X16.500 Y6.500 S0.30 F3000
+G1 X16.450 Y6.500 S0.30 F3000
+G1 X16.400 Y6.500 S0.30 F3000
+G1 X16.350 Y6.500 S0.30 F3000
+G1 X16.300 Y6.500 S0.30 F3000
+G1 X16.250 Y6.500 S0.30 F3000
+G1 X16.200 Y6.500 S0.30 F3000
+G1 X16.150 Y6.500 S0.30 F3000
+G1 X16.100 Y6.500 S0.30 F3000
+G1 X16.050 Y6.500 S0.30 F3000
+G1 X16.000 Y6.500 S0.30 F3000
+G1 X15.950 Y6.500 S0.30 F3000
+G1 X15.900 Y6.500 S0.30 F3000
+G1 X15.850 Y6.500 S0.30 F3000
+G1 X15.800 Y6.500 S0.30 F3000
+G1 X15.750 Y6.500 S0.30 F3000
+G1 X15.700 Y6.500 S0.30 F3000
+G1 X15.650 Y6.500 S0.30 F3000
+G1 X15.600 Y6.500 S0.30 F3000
+G1 X15.550 Y6.500 S0.30 F3000
+G1 X15.500 Y6.500 S0.30 F3000
+G1 X15.450 Y6.500 S0.30 F3000
+G1 X15.400 Y6.500 S0.30 F3000
+G1 X15.350 Y6.500 S0.30 F3000
+G1 X15.300 Y6.500 S0.30 F3000
+G1 X15.250 Y6.500 S0.30 F3000
+G1 X15.200 Y6.500 S0.30 F3000
+G1 X15.150 Y6.500 S0.30 F3000
+G1 X15.100 Y6.500 S0.30 F3000
+G1 X15.050 Y6.500 S0.30 F3000
+G1 X15.000 Y6.500 S0.30 F3000
+G1 X14.950 Y6.500 S0.40 F3000
+G1 X14.900 Y6.500 S0.40 F3000
+G1 X14.850 Y6.500 S0.40 F3000
+G1 X14.800 Y6.500 S0.40 F3000
+G1 X14.750 Y6.500 S0.40 F3000
+G1 X14.700 Y6.500 S0.40 F3000
+G1 X14.650 Y6.500 S0.40 F3000
+G1 X14.600 Y6.500 S0.40 F3000
+G1 X14.550 Y6.500 S0.40 F3000
+G1 X14.500 Y6.500 S0.40 F3000
+G1 X14.450 Y6.500 S0.40 F3000
+G1 X14.400 Y6.500 S0.40 F3000
+G1 X14.350 Y6.500 S0.40 F3000
+G1 X14.300 Y6.500 S0.40 F3000
+G1 X14.250 Y6.500 S0.40 F3000
+G1 X14.200 Y6.500 S0.40 F3000
+G1 X14.150 Y6.500 S0.40 F3000
+G1 X14.100 Y6.500 S0.40 F3000
+G1 X14.050 Y6.500 S0.40 F3000
+G1 X14.000 Y6.500 S0.40 F3000
+G1 X13.950 Y6.500 S0.40 F3000
+G1 X13.900 Y6.500 S0.40 F3000
+G1 X13.850 Y6.500 S0.40 F3000
+G1 X13.800 Y6.500 S0.40 F3000
+G1 X13.750 Y6.500 S0.40 F3000
+G1 X13.700 Y6.500 S0.40 F3000
+G1 X13.650 Y6.500 S0.40 F3000
+G1 X13.600 Y6.500 S0.40 F3000
+G1 X13.550 Y6.500 S0.40 F3000
+G1 X13.500 Y6.500 S0.40 F3000
+G1 X13.450 Y6.500 S0.40 F3000
+G1 X13.400 Y6.500 S0.40 F3000
+G1 X13.350 Y6.500 S0.40 F3000
+G1 X13.300 Y6.500 S0.40 F3000
+G1 X13.250 Y6.500 S0.40 F3000
+G1 X13.200 Y6.500 S0.40 F3000
+G1 X13.150 Y6.500 S0.40 F3000
+G1 X13.100 Y6.500 S0.40 F3000
+G1 X13.050 Y6.500 S0.40 F3000
+G1 X13.000 Y6.500 S0.40 F3000
+G1 X12.950 Y6.500 S0.20 F3000
+G1 X12.900 Y6.500 S0.20 F3000
+G1 X12.850 Y6.500 S0.20 F3000
+G1 X12.800 Y6.500 S0.20 F3000
+G1 X12.750 Y6.500 S0.20 F3000
+G1 X12.700 Y6.500 S0.20 F3000
+G1 X12.650 Y6.500 S0.20 F3000
+G1 X12.600 Y6.500 S0.20 F3000
+G1 X12.550 Y6.500 S0.20 F3000
+G1 X12.500 Y6.500 S0.20 F3000
+G1 X12.450 Y6.500 S0.20 F3000
+G1 X12.400 Y6.500 S0.20 F3000
+G1 X12.350 Y6.500 S0.20 F3000
+G1 X12.300 Y6.500 S0.20 F3000
+G1 X12.250 Y6.500 S0.20 F3000
+G1 X12.200 Y6.500 S0.20 F3000
+G1 X12.150 Y6.500 S0.20 F3000
+G1 X12.100 Y6.500 S0.20 F3000
+G1 X12.050 Y6.500 S0.20 F3000
+G1 X12.000 Y6.500 S0.20 F3000
+G1 X11.950 Y6.500 S0.20 F3000
+G1 X11.900 Y6.500 S0.20 F3000
+G1 X11.850 Y6.500 S0.20 F3000
+G1 X11.800 Y6.500 S0.20 F3000
+G1 X11.750 Y6.500 S0.20 F3000
+G1 X11.700 Y6.500 S0.20 F3000
+G1 X11.650 Y6.500 S0.20 F3000
+G1 X11.600 Y6.500 S0.20 F3000
+G1 X11.550 Y6.500 S0.20 F3000
+G1 X11.500 Y6.500 S0.20 F3000
+G1 X11.450 Y6.500 S0.20 F3000
+G1 X11.400 Y6.500 S0.20 F3000
+G1 X11.350 Y6.500 S0.20 F3000
+G1 X11.300 Y6.500 S0.20 F3000
+G1 X11.250 Y6.500 S0.20 F3000
+G1 X11.200 Y6.500 S0.20 F3000
+G1 X11.150 Y6.500 S0.20 F3000
+G1 X11.100 Y6.500 S0.20 F3000
+G1 X11.050 Y6.500 S0.20 F3000
+G1 X11.000 Y6.500 S0.20 F3000
+G1 X10.950 Y6.500 S0.30 F3000
+G1 X10.900 Y6.500 S0.30 F3000
+G1 X10.850 Y6.500 S0.30 F3000
+G1 X10.800 Y6.500 S0.30 F3000
+G1 X10.750 Y6.500 S0.30 F3000
+G1 X10.700 Y6.500 S0.30 F3000
+G1 X10.650 Y6.500 S0.30 F3000
+G1 X10.600 Y6.500 S0.30 F3000
+G1 X10.550 Y6.500 S0.30 F3000
+G1 X10.500 Y6.500 S0.30 F3000
+G1 X10.450 Y6.500 S0.30 F3000
+G1 X10.400 Y6.500 S0.30 F3000
+G1 X10.350 Y6.500 S0.30 F3000
+G1 X10.300 Y6.500 S0.30 F3000
+G1 X10.250 Y6.500 S0.30 F3000
+G1 X10.200 Y6.500 S0.30 F3000
+G1 X10.150 Y6.500 S0.30 F3000
+G1 X10.100 Y6.500 S0.30 F3000
+G1 X10.050 Y6.500 S0.30 F3000
+G1 X10.000 Y6.500 S0.30 F3000
+G1 X9.950 Y6.500 S0.30 F3000
+G1 X9.900 Y6.500 S0.30 F3000
+G1 X9.850 Y6.500 S0.30 F3000
+G1 X9.800 Y6.500 S0.30 F3000
+G1 X9.750 Y6.500 S0.30 F3000
+G1 X9.700 Y6.500 S0.30 F3000
+G1 X9.650 Y6.500 S0.30 F3000
+G1 X9.600 Y6.500 S0.30 F3000
+G1 X9.550 Y6.500 S0.30 F3000
+G1 X9.500 Y6.500 S0.30 F3000
+G1 X9.450 Y6.500 S0.30 F3000
+G1 X9.400 Y6.500 S0.30 F3000
+G1 X9.350 Y6.500 S0.30 F3000
+G1 X9.300 Y6.500 S0.30 F3000
+G1 X9.250 Y6.500 S0.30 F3000
+G1 X9.200 Y6.500 S0.30 F3000
+G1 X9.150 Y6.500 S0.30 F3000
+G1 X9.100 Y6.500 S0.30 F3000
+G1 X9.050 Y6.500 S0.30 F3000
+G1 X9.000 Y6.500 S0.30 F3000
+G1 X8.950 Y6.500 S0.40 F3000
+G1 X8.900 Y6.500 S0.40 F3000
+G1 X8.850 Y6.500 S0.40 F3000
+G1 X8.800 Y6.500 S0.40 F3000
+G1 X8.750 Y6.500 S0.40 F3000
+G1 X8.700 Y6.500 S0.40 F3000
+G1 X8.650 Y6.500 S0.40 F3000
+G1 X8.600 Y6.500 S0.40 F3000
+G1 X8.550 Y6.500 S0.40 F3000
+G1 X8.500 Y6.500 S0.40 F3000
+G1 X8.450 Y6.500 S0.40 F3000
+G1 X8.400 Y6.500 S0.40 F3000
+G1 X8.350 Y6.500 S0.40 F3000
+G1 X8.300 Y6.500 S0.40 F3000
+G1 X8.250 Y6.500 S0.40 F3000
+G1 X8.200 Y6.500 S0.40 F3000
+G1 X8.150 Y6.500 S0.40 F3000
+G1 X8.100 Y6.500 S0.40 F3000
+G1 X8.050 Y6.500 S0.40 F3000
+G1 X8.000 Y6.500 S0.40 F3000
+G1 X7.950 Y6.500 S0.40 F3000
+G1 X7.900 Y6.500 S0.40 F3000
+G1 X7.850 Y6.500 S0.40 F3000
+G1 X7.800 Y6.500 S0.40 F3000
+G1 X7.750 Y6.500 S0.40 F3000
+G1 X7.700 Y6.500 S0.40 F3000
+G1 X7.650 Y6.500 S0.40 F3000
+G1 X7.600 Y6.500 S0.40 F3000
+G1 X7.550 Y6.500 S0.40 F3000
+G1 X7.500 Y6.500 S0.40 F3000
+G1 X7.450 Y6.500 S0.40 F3000
+G1 X7.400 Y6.500 S0.40 F3000
+G1 X7.350 Y6.500 S0.40 F3000
+G1 X7.300 Y6.500 S0.40 F3000
+G1 X7.250 Y6.500 S0.40 F3000
+G1 X7.200 Y6.500 S0.40 F3000
+G1 X7.150 Y6.500 S0.40 F3000
+G1 X7.100 Y6.500 S0.40 F3000
+G1 X7.050 Y6.500 S0.40 F3000
+G1 X7.000 Y6.500 S0.40 F3000
+G1 X6.950 Y6.500 S0.20 F3000
+G1 X6.900 Y6.500 S0.20 F3000
+G1 X6.850 Y6.500 S0.20 F3000
+G1 X6.800 Y6.500 S0.20 F3000
+G1 X6.750 Y6.500 S0.20 F3000
+G1 X6.700 Y6.500 S0.20 F3000
+G1 X6.650 Y6.500 S0.20 F3000
+G1 X6.600 Y6.500 S0.20 F3000
+G1 X6.550 Y6.500 S0.20 F3000
+G1 X6.500 Y6.500 S0.20 F3000
+G1 X6.450 Y6.500 S0.20 F3000
+G1 X6.400 Y6.500 S0.20 F3000
+G1 X6.350 Y6.500 S0.20 F3000
+G1 X6.300 Y6.500 S0.20 F3000
+G1 X6.250 Y6.500 S0.20 F3000
+G1 X6.200 Y6.500 S0.20 F3000
+G1 X6.150 Y6.500 S0.20 F3000
+G1 X6.100 Y6.500 S0.20 F3000
+G1 X6.050 Y6.500 S0.20 F3000
+G1 X6.000 Y6.500 S0.20 F3000
+G1 X5.950 Y6.500 S0.20 F3000
+G1 X5.900 Y6.500 S0.20 F3000
+G1 X5.850 Y6.500 S0.20 F3000
+G1 X5.800 Y6.500 S0.20 F3000
+G1 X5.750 Y6.500 S0.20 F3000
+G1 X5.700 Y6.500 S0.20 F3000
+G1 X5.650 Y6.500 S0.20 F3000
+G1 X5.600 Y6.500 S0.20 F3000
+G1 X5.550 Y6.500 S0.20 F3000
+G1 X5.500 Y6.500 S0.20 F3000
+G1 X5.450 Y6.500 S0.20 F3000
+G1 X5.400 Y6.500 S0.20 F3000
+G1 X5.350 Y6.500 S0.20 F3000
+G1 X5.300 Y6.500 S0.20 F3000
+G1 X5.250 Y6.500 S0.20 F3000
+G1 X5.200 Y6.500 S0.20 F3000
+G1 X5.150 Y6.500 S0.20 F3000
+G1 X5.100 Y6.500 S0.20 F3000
+G1 X5.050 Y6.500 S0.20 F3000
+G1 X5.000 Y6.500 S0.20 F3000
+G1 Y7.000 S0
+G1 X5.050 Y7.000 S0.20 F3000
+G1 X5.100 Y7.000 S0.20 F3000
+G1 X5.150 Y7.000 S0.20 F3000
+G1 X5.200 Y7.000 S0.20 F3000
+G1 X5.250 Y7.000 S0.20 F3000
+G1 X5.300 Y7.000 S0.20 F3000
+G1 X5.350 Y7.000 S0.20 F3000
+G1 X5.400 Y7.000 S0.20 F3000
+G1 X5.450 Y7.000 S0.20 F3000
+G1 X5.500 Y7.000 S0.20 F3000
+G1 X5.550 Y7.000 S0.20 F3000
+G1 X5.600 Y7.000 S0.20 F3000
+G1 X5.650 Y7.000 S0.20 F3000
+G1 X5.700 Y7.000 S0.20 F3000
+G1 X5.750 Y7.000 S0.20 F3000
+G1 X5.800 Y7.000 S0.20 F3000
+G1 X5.850 Y7.000 S0.20 F3000
+G1 X5.900 Y7.000 S0.20 F3000
+G1 X5.950 Y7.000 S0.20 F3000
+G1 X6.000 Y7.000 S0.20 F3000
+G1 X6.050 Y7.000 S0.20 F3000
+G1 X6.100 Y7.000 S0.20 F3000
+G1 X6.150 Y7.000 S0.20 F3000
+G1 X6.200 Y7.000 S0.20 F3000
+G1 X6.250 Y7.000 S0.20 F3000
+G1 X6.300 Y7.000 S0.20 F3000
+G1 X6.350 Y7.000 S0.20 F3000
+G1 X6.400 Y7.000 S0.20 F3000
+G1 X6.450 Y7.000 S0.20 F3000
+G1 X6.500 Y7.000 S0.20 F3000
+G1 X6.550 Y7.000 S0.20 F3000
+G1 X6.600 Y7.000 S0.20 F3000
+G1 X6.650 Y7.000 S0.20 F3000
+G1 X6.700 Y7.000 S0.20 F3000
+G1 X6.750 Y7.000 S0.20 F3000
+G1 X6.800 Y7.000 S0.20 F3000
+G1 X6.850 Y7.000 S0.20 F3000
+G1 X6.900 Y7.000 S0.20 F3000
+G1 X6.950 Y7.000 S0.20 F3000
+G1 X7.000 Y7.000 S0.20 F3000
+G1 X7.050 Y7.000 S0.30 F3000
+G1 X7.100 Y7.000 S0.30 F3000
+G1 X7.150 Y7.000 S0.30 F3000
+G1 X7.200 Y7.000 S0.30 F3000
+G1 X7.250 Y7.000 S0.30 F3000
+G1 X7.300 Y7.000 S0.30 F3000
+G1 X7.350 Y7.000 S0.30 F3000
+G1 X7.400 Y7.000 S0.30 F3000
+G1 X7.450 Y7.000 S0.30 F3000
+G1 X7.500 Y7.000 S0.30 F3000
+G1 X7.550 Y7.000 S0.30 F3000
+G1 X7.600 Y7.000 S0.30 F3000
+G1 X7.650 Y7.000 S0.30 F3000
+G1 X7.700 Y7.000 S0.30 F3000
+G1 X7.750 Y7.000 S0.30 F3000
+G1 X7.800 Y7.000 S0.30 F3000
+G1 X7.850 Y7.000 S0.30 F3000
+G1 X7.900 Y7.000 S0.30 F3000
+G1 X7.950 Y7.000 S0.30 F3000
+G1 X8.000 Y7.000 S0.30 F3000
+G1 X8.050 Y7.000 S0.30 F3000
+G1 X8.100 Y7.000 S0.30 F3000
+G1 X8.150 Y7.000 S0.30 F3000
+G1 X8.200 Y7.000 S0.30 F3000
+G1 X8.250 Y7.000 S0.30 F3000
+G1 X8.300 Y7.000 S0.30 F3000
+G1 X8.350 Y7.000 S0.30 F3000
+G1 X8.400 Y7.000 S0.30 F3000
+G1 X8.450 Y7.000 S0.30 F3000
+G1 X8.500 Y7.000 S0.30 F3000
+G1 X8.550 Y7.000 S0.30 F3000
+G1 X8.600 Y7.000 S0.30 F3000
+G1 X8.650 Y7.000 S0.30 F3000
+G1 X8.700 Y7.000 S0.30 F3000
+G1 X8.750 Y7.000 S0.30 F3000
+G1 X8.800 Y7.000 S0.30 F3000
+G1 X8.850 Y7.000 S0.30 F3000
+G1 X8.900 Y7.000 S0.30 F3000
+G1 X8.950 Y7.000 S0.30 F3000
+G1 X9.000 Y7.000 S0.30 F3000
+G1 X9.050 Y7.000 S0.40 F3000
+G1 X9.100 Y7.000 S0.40 F3000
+G1 X9.150 Y7.000 S0.40 F3000
+G1 X9.200 Y7.000 S0.40 F3000
+G1 X9.250 Y7.000 S0.40 F3000
+G1 X9.300 Y7.000 S0.40 F3000
+G1 X9.350 Y7.000 S0.40 F3000
+G1 X9.400 Y7.000 S0.40 F3000
+G1 X9.450 Y7.000 S0.40 F3000
+G1 X9.500 Y7.000 S0.40 F3000
+G1 X9.550 Y7.000 S0.40 F3000
+G1 X9.600 Y7.000 S0.40 F3000
+G1 X9.650 Y7.000 S0.40 F3000
+G1 X9.700 Y7.000 S0.40 F3000
+G1 X9.750 Y7.000 S0.40 F3000
+G1 X9.800 Y7.000 S0.40 F3000
+G1 X9.850 Y7.000 S0.40 F3000
+G1 X9.900 Y7.000 S0.40 F3000
+G1 X9.950 Y7.000 S0.40 F3000
+G1 X10.000 Y7.000 S0.40 F3000
+G1 X10.050 Y7.000 S0.40 F3000
+G1 X10.100 Y7.000 S0.40 F3000
+G1 X10.150 Y7.000 S0.40 F3000
+G1 X10.200 Y7.000 S0.40 F3000
+G1 X10.250 Y7.000 S0.40 F3000
+G1 X10.300 Y7.000 S0.40 F3000
+G1 X10.350 Y7.000 S0.40 F3000
+G1 X10.400 Y7.000 S0.40 F3000
+G1 X10.450 Y7.000 S0.40 F3000
+G1 X10.500 Y7.000 S0.40 F3000
+G1 X10.550 Y7.000 S0.40 F3000
+G1 X10.600 Y7.000 S0.40 F3000
+G1 X10.650 Y7.000 S0.40 F3000
+G1 X10.700 Y7.000 S0.40 F3000
+G1 X10.750 Y7.000 S0.40 F3000
+G1 X10.800 Y7.000 S0.40 F3000
+G1 X10.850 Y7.000 S0.40 F3000
+G1 X10.900 Y7.000 S0.40 F3000
+G1 X10.950 Y7.000 S0.40 F3000
+G1 X11.000 Y7.000 S0.40 F3000
+G1 X11.050 Y7.000 S0.20 F3000
+G1 X11.100 Y7.000 S0.20 F3000
+G1 X11.150 Y7.000 S0.20 F3000
+G1 X11.200 Y7.000 S0.20 F3000
+G1 X11.250 Y7.000 S0.20 F3000
+G1 X11.300 Y7.000 S0.20 F3000
+G1 X11.350 Y7.000 S0.20 F3000
+G1 X11.400 Y7.000 S0.20 F3000
+G1 X11.450 Y7.000 S0.20 F3000
+G1 X11.500 Y7.000 S0.20 F3000
+G1 X11.550 Y7.000 S0.20 F3000
+G1 X11.600 Y7.000 S0.20 F3000
+G1 X11.650 Y7.000 S0.20 F3000
+G1 X11.700 Y7.000 S0.20 F3000
+G1 X11.750 Y7.000 S0.20 F3000
+G1 X11.800 Y7.000 S0.20 F3000
+G1 X11.850 Y7.000 S0.20 F3000
+G1 X11.900 Y7.000 S0.20 F3000
+G1 X11.950 Y7.000 S0.20 F3000
+G1 X12.000 Y7.000 S0.20 F3000
+G1 X12.050 Y7.000 S0.20 F3000
+G1 X12.100 Y7.000 S0.20 F3000
+G1 X12.150 Y7.000 S0.20 F3000
+G1 X12.200 Y7.000 S0.20 F3000
+G1 X12.250 Y7.000 S0.20 F3000
+G1 X12.300 Y7.000 S0.20 F3000
+G1 X12.350 Y7.000 S0.20 F3000
+G1 X12.400 Y7.000 S0.20 F3000
+G1 X12.450 Y7.000 S0.20 F3000
+G1 X12.500 Y7.000 S0.20 F3000
+G1 X12.550 Y7.000 S0.20 F3000
+G1 X12.600 Y7.000 S0.20 F3000
+G1 X12.650 Y7.000 S0.20 F3000
+G1 X12.700 Y7.000 S0.20 F3000
+G1 X12.750 Y7.000 S0.20 F3000
+G1 X12.800 Y7.000 S0.20 F3000
+G1 X12.850 Y7.000 S0.20 F3000
+G1 X12.900 Y7.000 S0.20 F3000
+G1 X12.950 Y7.000 S0.20 F3000
+G1 X13.000 Y7.000 S0.20 F3000
+G1 X13.050 Y7.000 S0.30 F3000
+G1 X13.100 Y7.000 S0.30 F3000
+G1 X13.150 Y7.000 S0.30 F3000
+G1 X13.200 Y7.000 S0.30 F3000
+G1 X13.250 Y7.000 S0.30 F3000
+G1 X13.300 Y7.000 S0.30 F3000
+G1 X13.350 Y7.000 S0.30 F3000
+G1 X13.400 Y7.000 S0.30 F3000
+G1 X13.450 Y7.000 S0.30 F3000
+G1 X13.500 Y7.000 S0.30 F3000
+G1 X13.550 Y7.000 S0.30 F3000
+G1 X13.600 Y7.000 S0.30 F3000
+G1 X13.650 Y7.000 S0.30 F3000
+G1 X13.700 Y7.000 S0.30 F3000
+G1 X13.750 Y7.000 S0.30 F3000
+G1 X13.800 Y7.000 S0.30 F3000
+G1 X13.850 Y7.000 S0.30 F3000
+G1 X13.900 Y7.000 S0.30 F3000
+G1 X13.950 Y7.000 S0.30 F3000
+G1 X14.000 Y7.000 S0.30 F3000
+G1 X14.050 Y7.000 S0.30 F3000
+G1 X14.100 Y7.000 S0.30 F3000
+G1 X14.150 Y7.000 S0.30 F3000
+G1 X14.200 Y7.000 S0.30 F3000
+G1 X14.250 Y7.000 S0.30 F3000
+G1 X14.300 Y7.000 S0.30 F3000
+G1 X14.350 Y7.000 S0.30 F3000
+G1 X14.400 Y7.000 S0.30 F3000
+G1 X14.450 Y7.000 S0.30 F3000
+G1 X14.500 Y7.000 S0.30 F3000
+G1 X14.550 Y7.000 S0.30 F3000
+G1 X14.600 Y7.000 S0.30 F3000
+G1 X14.650 Y7.000 S0.30 F3000
+G1 X14.700 Y7.000 S0.30 F3000
+G1 X14.750 Y7.000 S0.30 F3000
+G1 X14.800 Y7.000 S0.30 F3000
+G1 X14.850 Y7.000 S0.30 F3000
+G1 X14.900 Y7.000 S0.30 F3000
+G1 X14.950 Y7.000 S0.30 F3000
+G1 X15.000 Y7.000 S0.30 F3000
+G1 X15.050 Y7.000 S0.40 F3000
+G1 X15.100 Y7.000 S0.40 F3000
+G1 X15.150 Y7.000 S0.40 F3000
+G1 X15.200 Y7.000 S0.40 F3000
+G1 X15.250 Y7.000 S0.40 F3000
+G1 X15.300 Y7.000 S0.40 F3000
+G1 X15.350 Y7.000 S0.40 F3000
+G1 X15.400 Y7.000 S0.40 F3000
+G1 X15.450 Y7.000 S0.40 F3000
+G1 X15.500 Y7.000 S0.40 F3000
+G1 X15.550 Y7.000 S0.40 F3000
+G1 X15.600 Y7.000 S0.40 F3000
+G1 X15.650 Y7.000 S0.40 F3000
+G1 X15.700 Y7.000 S0.40 F3000
+G1 X15.750 Y7.000 S0.40 F3000
+G1 X15.800 Y7.000 S0.40 F3000
+G1 X15.850 Y7.000 S0.40 F3000
+G1 X15.900 Y7.000 S0.40 F3000
+G1 X15.950 Y7.000 S0.40 F3000
+G1 X16.000 Y7.000 S0.40 F3000
+G1 X16.050 Y7.000 S0.40 F3000
+G1 X16.100 Y7.000 S0.40 F3000
+G1 X16.150 Y7.000 S0.40 F3000
+G1 X16.200 Y7.000 S0.40 F3000
+G1 X16.250 Y7.000 S0.40 F3000
+G1 X16.300 Y7.000 S0.40 F3000
+G1 X16.350 Y7.000 S0.40 F3000
+G1 X16.400 Y7.000 S0.40 F3000
+G1 X16.450 Y7.000 S0.40 F3000
+G1 X16.500 Y7.000 S0.40 F3000
+G1 X16.550 Y7.000 S0.40 F3000
+G1 X16.600 Y7.000 S0.40 F3000
+G1 X16.650 Y7.000 S0.40 F3000
+G1 X16.700 Y7.000 S0.40 F3000
+G1 X16.750 Y7.000 S0.40 F3000
+G1 X16.800 Y7.000 S0.40 F3000
+G1 X16.850 Y7.000 S0.40 F3000
+G1 X16.900 Y7.000 S0.40 F3000
+G1 X16.950 Y7.000 S0.40 F3000
+G1 X17.000 Y7.000 S0.40 F3000
+G1 X17.050 Y7.000 S0.20 F3000
+G1 X17.100 Y7.000 S0.20 F3000
+G1 X17.150 Y7.000 S0.20 F3000
+G1 X17.200 Y7.000 S0.20 F3000
+G1 X17.250 Y7.000 S0.20 F3000
+G1 X17.300 Y7.000 S0.20 F3000
+G1 X17.350 Y7.000 S0.20 F3000
+G1 X17.400 Y7.000 S0.20 F3000
+G1 X17.450 Y7.000 S0.20 F3000
+G1 X17.500 Y7.000 S0.20 F3000
+G1 X17.550 Y7.000 S0.20 F3000
+G1 X17.600 Y7.000 S0.20 F3000
+G1 X17.650 Y7.000 S0.20 F3000
+G1 X17.700 Y7.000 S0.20 F3000
+G1 X17.750 Y7.000 S0.20 F3000
+G1 X17.800 Y7.000 S0.20 F3000
+G1 X17.850 Y7.000 S0.20 F3000
+G1 X17.900 Y7.000 S0.20 F3000
+G1 X17.950 Y7.000 S0.20 F3000
+G1 X18.000 Y7.000 S0.20 F3000
+G1 X18.050 Y7.000 S0.20 F3000
+G1 X18.100 Y7.000 S0.20 F3000
+G1 X18.150 Y7.000 S0.20 F3000
+G1 X18.200 Y7.000 S0.20 F3000
+G1 X18.250 Y7.000 S0.20 F3000
+G1 X18.300 Y7.000 S0.20 F3000
+G1 X18.350 Y7.000 S0.20 F3000
+G1 X18.400 Y7.000 S0.20 F3000
+G1 X18.450 Y7.000 S0.20 F3000
+G1 X18.500 Y7.000 S0.20 F3000
+G1 X18.550 Y7.000 S0.20 F3000
+G1 X18.600 Y7.000 S0.20 F3000
+G1 X18.650 Y7.000 S0.20 F3000
+G1 X18.700 Y7.000 S0.20 F3000
+G1 X18.750 Y7.000 S0.20 F3000
+G1 X18.800 Y7.000 S0.20 F3000
+G1 X18.850 Y7.000 S0.20 F3000
+G1 X18.900 Y7.000 S0.20 F3000
+G1 X18.950 Y7.000 S0.20 F3000
+G1 X19.000 Y7.000 S0.20 F3000
+G1 X19.050 Y7.000 S0.30 F3000
+G1 X19.100 Y7.000 S0.30 F3000
+G1 X19.150 Y7.000 S0.30 F3000
+G1 X19.200 Y7.000 S0.30 F3000
+G1 X19.250 Y7.000 S0.30 F3000
+G1 X19.300 Y7.000 S0.30 F3000
+G1 X19.350 Y7.000 S0.30 F3000
+G1 X19.400 Y7.000 S0.30 F3000
+G1 X19.450 Y7.000 S0.30 F3000
+G1 X19.500 Y7.000 S0.30 F3000
+G1 X19.550 Y7.000 S0.30 F3000
+G1 X19.600 Y7.000 S0.30 F3000
+G1 X19.650 Y7.000 S0.30 F3000
+G1 X19.700 Y7.000 S0.30 F3000
+G1 X19.750 Y7.000 S0.30 F3000
+G1 X19.800 Y7.000 S0.30 F3000
+G1 X19.850 Y7.000 S0.30 F3000
+G1 X19.900 Y7.000 S0.30 F3000
+G1 X19.950 Y7.000 S0.30 F3000
+G1 X20.000 Y7.000 S0.30 F3000
+G1 X20.050 Y7.000 S0.30 F3000
+G1 X20.100 Y7.000 S0.30 F3000
+G1 X20.150 Y7.000 S0.30 F3000
+G1 X20.200 Y7.000 S0.30 F3000
+G1 X20.250 Y7.000 S0.30 F3000
+G1 X20.300 Y7.000 S0.30 F3000
+G1 X20.350 Y7.000 S0.30 F3000
+G1 X20.400 Y7.000 S0.30 F3000
+G1 X20.450 Y7.000 S0.30 F3000
+G1 X20.500 Y7.000 S0.30 F3000
+G1 X20.550 Y7.000 S0.30 F3000
+G1 X20.600 Y7.000 S0.30 F3000
+G1 X20.650 Y7.000 S0.30 F3000
+G1 X20.700 Y7.000 S0.30 F3000
+G1 X20.750 Y7.000 S0.30 F3000
+G1 X20.800 Y7.000 S0.30 F3000
+G1 X20.850 Y7.000 S0.30 F3000
+G1 X20.900 Y7.000 S0.30 F3000
+G1 X20.950 Y7.000 S0.30 F3000
+G1 X21.000 Y7.000 S0.30 F3000
+G1 X21.050 Y7.000 S0.40 F3000
+G1 X21.100 Y7.000 S0.40 F3000
+G1 X21.150 Y7.000 S0.40 F3000
+G1 X21.200 Y7.000 S0.40 F3000
+G1 X21.250 Y7.000 S0.40 F3000
+G1 X21.300 Y7.000 S0.40 F3000
+G1 X21.350 Y7.000 S0.40 F3000
+G1 X21.400 Y7.000 S0.40 F3000
+G1 X21.450 Y7.000 S0.40 F3000
+G1 X21.500 Y7.000 S0.40 F3000
+G1 X21.550 Y7.000 S0.40 F3000
+G1 X21.600 Y7.000 S0.40 F3000
+G1 X21.650 Y7.000 S0.40 F3000
+G1 X21.700 Y7.000 S0.40 F3000
+G1 X21.750 Y7.000 S0.40 F3000
+G1 X21.800 Y7.000 S0.40 F3000
+G1 X21.850 Y7.000 S0.40 F3000
+G1 X21.900 Y7.000 S0.40 F3000
+G1 X21.950 Y7.000 S0.40 F3000
+G1 X22.000 Y7.000 S0.40 F3000
+G1 X22.050 Y7.000 S0.40 F3000
+G1 X22.100 Y7.000 S0.40 F3000
+G1 X22.150 Y7.000 S0.40 F3000
+G1 X22.200 Y7.000 S0.40 F3000
+G1 X22.250 Y7.000 S0.40 F3000
+G1 X22.300 Y7.000 S0.40 F3000
+G1 X22.350 Y7.000 S0.40 F3000
+G1 X22.400 Y7.000 S0.40 F3000
+G1 X22.450 Y7.000 S0.40 F3000
+G1 X22.500 Y7.000 S0.40 F3000
+G1 X22.550 Y7.000 S0.40 F3000
+G1 X22.600 Y7.000 S0.40 F3000
+G1 X22.650 Y7.000 S0.40 F3000
+G1 X22.700 Y7.000 S0.40 F3000
+G1 X22.750 Y7.000 S0.40 F3000
+G1 X22.800 Y7.000 S0.40 F3000
+G1 X22.850 Y7.000 S0.40 F3000
+G1 X22.900 Y7.000 S0.40 F3000
+G1 X22.950 Y7.000 S0.40 F3000
+G1 X23.000 Y7.000 S0.40 F3000
+G1 X23.050 Y7.000 S0.20 F3000
+G1 X23.100 Y7.000 S0.20 F3000
+G1 X23.150 Y7.000 S0.20 F3000
+G1 X23.200 Y7.000 S0.20 F3000
+G1 X23.250 Y7.000 S0.20 F3000
+G1 X23.300 Y7.000 S0.20 F3000
+G1 X23.350 Y7.000 S0.20 F3000
+G1 X23.400 Y7.000 S0.20 F3000
+G1 X23.450 Y7.000 S0.20 F3000
+G1 X23.500 Y7.000 S0.20 F3000
+G1 X23.550 Y7.000 S0.20 F3000
+G1 X23.600 Y7.000 S0.20 F3000
+G1 X23.650 Y7.000 S0.20 F3000
+G1 X23.700 Y7.000 S0.20 F3000
+G1 X23.750 Y7.000 S0.20 F3000
+G1 X23.800 Y7.000 S0.20 F3000
+G1 X23.850 Y7.000 S0.20 F3000
+G1 X23.900 Y7.000 S0.20 F3000
+G1 X23.950 Y7.000 S0.20 F3000
+G1 X24.000 Y7.000 S0.20 F3000
+G1 X24.050 Y7.000 S0.20 F3000
+G1 X24.100 Y7.000 S0.20 F3000
+G1 X24.150 Y7.000 S0.20 F3000
+G1 X24.200 Y7.000 S0.20 F3000
+G1 X24.250 Y7.000 S0.20 F3000
+G1 X24.300 Y7.000 S0.20 F3000
+G1 X24.350 Y7.000 S0.20 F3000
+G1 X24.400 Y7.000 S0.20 F3000
+G1 X24.450 Y7.000 S0.20 F3000
+G1 X24.500 Y7.000 S0.20 F3000
+G1 X24.550 Y7.000 S0.20 F3000
+G1 X24.600 Y7.000 S0.20 F3000
+G1 X24.650 Y7.000 S0.20 F3000
+G1 X24.700 Y7.000 S0.20 F3000
+G1 X24.750 Y7.000 S0.20 F3000
+G1 X24.800 Y7.000 S0.20 F3000
+G1 X24.850 Y7.000 S0.20 F3000
+G1 X24.900 Y7.000 S0.20 F3000
+G1 X24.950 Y7.000 S0.20 F3000
+G1 X25.000 Y7.000 S0.20 F3000
+G1 Y7.500 S0
+G1 X24.950 Y7.500 S0.20 F3000
+G1 X24.900 Y7.500 S0.20 F3000
+G1 X24.850 Y7.500 S0.20 F3000
+G1 X24.800 Y7.500 S0.20 F3000
+G1 X24.750 Y7.500 S0.20 F3000
+G1 X24.700 Y7.500 S0.20 F3000
+G1 X24.650 Y7.500 S0.20 F3000
+G1 X24.600 Y7.500 S0.20 F3000
+G1 X24.550 Y7.500 S0.20 F3000
+G1 X24.500 Y7.500 S0.20 F3000
+G1 X24.450 Y7.500 S0.20 F3000
+G1 X24.400 Y7.500 S0.20 F3000
+G1 X24.350 Y7.500 S0.20 F3000
+G1 X24.300 Y7.500 S0.20 F3000
+G1 X24.250 Y7.500 S0.20 F3000
+G1 X24.200 Y7.500 S0.20 F3000
+G1 X24.150 Y7.500 S0.20 F3000
+G1 X24.100 Y7.500 S0.20 F3000
+G1 X24.050 Y7.500 S0.20 F3000
+G1 X24.000 Y7.500 S0.20 F3000
+G1 X23.950 Y7.500 S0.20 F3000
+G1 X23.900 Y7.500 S0.20 F3000
+G1 X23.850 Y7.500 S0.20 F3000
+G1 X23.800 Y7.500 S0.20 F3000
+G1 X23.750 Y7.500 S0.20 F3000
+G1 X23.700 Y7.500 S0.20 F3000
+G1 X23.650 Y7.500 S0.20 F3000
+G1 X23.600 Y7.500 S0.20 F3000
+G1 X23.550 Y7.500 S0.20 F3000
+G1 X23.500 Y7.500 S0.20 F3000
+G1 X23.450 Y7.500 S0.20 F3000
+G1 X23.400 Y7.500 S0.20 F3000
+G1 X23.350 Y7.500 S0.20 F3000
+G1 X23.300 Y7.500 S0.20 F3000
+G1 X23.250 Y7.500 S0.20 F3000
+G1 X23.200 Y7.500 S0.20 F3000
+G1 X23.150 Y7.500 S0.20 F3000
+G1 X23.100 Y7.500 S0.20 F3000
+G1 X23.050 Y7.500 S0.20 F3000
+G1 X23.000 Y7.500 S0.20 F3000
+G1 X22.950 Y7.500 S0.30 F3000
+G1 X22.900 Y7.500 S0.30 F3000
+G1 X22.850 Y7.500 S0.30 F3000
+G1 X22.800 Y7.500 S0.30 F3000
+G1 X22.750 Y7.500 S0.30 F3000
+G1 X22.700 Y7.500 S0.30 F3000
+G1 X22.650 Y7.500 S0.30 F3000
+G1 X22.600 Y7.500 S0.30 F3000
+G1 X22.550 Y7.500 S0.30 F3000
+G1 X22.500 Y7.500 S0.30 F3000
+G1 X22.450 Y7.500 S0.30 F3000
+G1 X22.400 Y7.500 S0.30 F3000
+G1 X22.350 Y7.500 S0.30 F3000
+G1 X22.300 Y7.500 S0.30 F3000
+G1 X22.250 Y7.500 S0.30 F3000
+G1 X22.200 Y7.500 S0.30 F3000
+G1 X22.150 Y7.500 S0.30 F3000
+G1 X22.100 Y7.500 S0.30 F3000
+G1 X22.050 Y7.500 S0.30 F3000
+G1 X22.000 Y7.500 S0.30 F3000
+G1 X21.950 Y7.500 S0.30 F3000
+G1 X21.900 Y7.500 S0.30 F3000
+G1 X21.850 Y7.500 S0.30 F3000
+G1 X21.800 Y7.500 S0.30 F3000
+G1 X21.750 Y7.500 S0.30 F3000
+G1 X21.700 Y7.500 S0.30 F3000
+G1 X21.650 Y7.500 S0.30 F3000
+G1 X21.600 Y7.500 S0.30 F3000
+G1 X21.550 Y7.500 S0.30 F3000
+G1 X21.500 Y7.500 S0.30 F3000
+G1 X21.450 Y7.500 S0.30 F3000
+G1 X21.400 Y7.500 S0.30 F3000
+G1 X21.350 Y7.500 S0.30 F3000
+G1 X21.300 Y7.500 S0.30 F3000
+G1 X21.250 Y7.500 S0.30 F3000
+G1 X21.200 Y7.500 S0.30 F3000
+G1 X21.150 Y7.500 S0.30 F3000
+G1 X21.100 Y7.500 S0.30 F3000
+G1 X21.050 Y7.500 S0.30 F3000
+G1 X21.000 Y7.500 S0.30 F3000
+G1 X20.950 Y7.500 S0.40 F3000
+G1 X20.900 Y7.500 S0.40 F3000
+G1 X20.850 Y7.500 S0.40 F3000
+G1 X20.800 Y7.500 S0.40 F3000
+G1 X20.750 Y7.500 S0.40 F3000
+G1 X20.700 Y7.500 S0.40 F3000
+G1 X20.650 Y7.500 S0.40 F3000
+G1 X20.600 Y7.500 S0.40 F3000
+G1 X20.550 Y7.500 S0.40 F3000
+G1 X20.500 Y7.500 S0.40 F3000
+G1 X20.450 Y7.500 S0.40 F3000
+G1 X20.400 Y7.500 S0.40 F3000
+G1 X20.350 Y7.500 S0.40 F3000
+G1 X20.300 Y7.500 S0.40 F3000
+G1 X20.250 Y7.500 S0.40 F3000
+G1 X20.200 Y7.500 S0.40 F3000
+G1 X20.150 Y7.500 S0.40 F3000
+G1 X20.100 Y7.500 S0.40 F3000
+G1 X20.050 Y7.500 S0.40 F3000
+G1 X20.000 Y7.500 S0.40 F3000
+G1 X19.950 Y7.500 S0.40 F3000
+G1 X19.900 Y7.500 S0.40 F3000
+G1 X19.850 Y7.500 S0.40 F3000
+G1 X19.800 Y7.500 S0.40 F3000
+G1 X19.750 Y7.500 S0.40 F3000
+G1 X19.700 Y7.500 S0.40 F3000
+G1 X19.650 Y7.500 S0.40 F3000
+G1 X19.600 Y7.500 S0.40 F3000
+G1 X19.550 Y7.500 S0.40 F3000
+G1 X19.500 Y7.500 S0.40 F3000
+G1 X19.450 Y7.500 S0.40 F3000
+G1 X19.400 Y7.500 S0.40 F3000
+G1 X19.350 Y7.500 S0.40 F3000
+G1 X19.300 Y7.500 S0.40 F3000
+G1 X19.250 Y7.500 S0.40 F3000
+G1 X19.200 Y7.500 S0.40 F3000
+G1 X19.150 Y7.500 S0.40 F3000
+G1 X19.100 Y7.500 S0.40 F3000
+G1 X19.050 Y7.500 S0.40 F3000
+G1 X19.000 Y7.500 S0.40 F3000
+G1 X18.950 Y7.500 S0.20 F3000
+G1 X18.900 Y7.500 S0.20 F3000
+G1 X18.850 Y7.500 S0.20 F3000
+G1 X18.800 Y7.500 S0.20 F3000
+G1 X18.750 Y7.500 S0.20 F3000
+G1 X18.700 Y7.500 S0.20 F3000
+G1 X18.650 Y7.500 S0.20 F3000
+G1 X18.600 Y7.500 S0.20 F3000
+G1 X18.550 Y7.500 S0.20 F3000
+G1 X18.500 Y7.500 S0.20 F3000
+G1 X18.450 Y7.500 S0.20 F3000
+G1 X18.400 Y7.500 S0.20 F3000
+G1 X18.350 Y7.500 S0.20 F3000
+G1 X18.300 Y7.500 S0.20 F3000
+G1 X18.250 Y7.500 S0.20 F3000
+G1 X18.200 Y7.500 S0.20 F3000
+G1 X18.150 Y7.500 S0.20 F3000
+G1 X18.100 Y7.500 S0.20 F3000
+G1 X18.050 Y7.500 S0.20 F3000
+G1 X18.000 Y7.500 S0.20 F3000
+G1 X17.950 Y7.500 S0.20 F3000
+G1 X17.900 Y7.500 S0.20 F3000
+G1 X17.850 Y7.500 S0.20 F3000
+G1 X17.800 Y7.500 S0.20 F3000
+G1 X17.750 Y7.500 S0.20 F3000
+G1 X17.700 Y7.500 S0.20 F3000
+G1 X17.650 Y7.500 S0.20 F3000
+G1 X17.600 Y7.500 S0.20 F3000
+G1 X17.550 Y7.500 S0.20 F3000
+G1 X17.500 Y7.500 S0.20 F3000
+G1 X17.450 Y7.500 S0.20 F3000
+G1 X17.400 Y7.500 S0.20 F3000
+G1 X17.350 Y7.500 S0.20 F3000
+G1 X17.300 Y7.500 S0.20 F3000
+G1 X17.250 Y7.500 S0.20 F3000
+G1 X17.200 Y7.500 S0.20 F3000
+G1 X17.150 Y7.500 S0.20 F3000
+G1 X17.100 Y7.500 S0.20 F3000
+G1 X17.050 Y7.500 S0.20 F3000
+G1 X17.000 Y7.500 S0.20 F3000
+G1 X16.950 Y7.500 S0.30 F3000
+G1 X16.900 Y7.500 S0.30 F3000
+G1 X16.850 Y7.500 S0.30 F3000
+G1 X16.800 Y7.500 S0.30 F3000
+G1 X16.750 Y7.500 S0.30 F3000
+G1 X16.700 Y7.500 S0.30 F3000
+G1 X16.650 Y7.500 S0.30 F3000
+G1 X16.600 Y7.500 S0.30 F3000
+G1 X16.550 Y7.500 S0.30 F3000
+G1 X16.500 Y7.500 S0.30 F3000
+G1 X16.450 Y7.500 S0.30 F3000
+G1 X16.400 Y7.500 S0.30 F3000
+G1 X16.350 Y7.500 S0.30 F3000
+G1 X16.300 Y7.500 S0.30 F3000
+G1 X16.250 Y7.500 S0.30 F3000
+G1 X16.200 Y7.500 S0.30 F3000
+G1 X16.150 Y7.500 S0.30 F3000
+G1 X16.100 Y7.500 S0.30 F3000
+G1 X16.050 Y7.500 S0.30 F3000
+G1 X16.000 Y7.500 S0.30 F3000
+G1 X15.950 Y7.500 S0.30 F3000
+G1 X15.900 Y7.500 S0.30 F3000
+G1 X15.850 Y7.500 S0.30 F3000
+G1 X15.800 Y7.500 S0.30 F3000
+G1 X15.750 Y7.500 S0.30 F3000
+G1 X15.700 Y7.500 S0.30 F3000
+G1 X15.650 Y7.500 S0.30 F3000
+G1 X15.600 Y7.500 S0.30 F3000
+G1 X15.550 Y7.500 S0.30 F3000
+G1 X15.500 Y7.500 S0.30 F3000
+G1 X15.450 Y7.500 S0.30 F3000
+G1 X15.400 Y7.500 S0.30 F3000
+G1 X15.350 Y7.500 S0.30 F3000
+G1 X15.300 Y7.500 S0.30 F3000
+G1 X15.250 Y7.500 S0.30 F3000
+G1 X15.200 Y7.500 S0.30 F3000
+G1 X15.150 Y7.500 S0.30 F3000
+G1 X15.100 Y7.500 S0.30 F3000
+G1 X15.050 Y7.500 S0.30 F3000
+G1 X15.000 Y7.500 S0.30 F3000
+G1 X14.950 Y7.500 S0.40 F3000
+G1 X14.900 Y7.500 S0.40 F3000
+G1 X14.850 Y7.500 S0.40 F3000
+G1 X14.800 Y7.500 S0.40 F3000
+G1 X14.750 Y7.500 S0.40 F3000
+G1 X14.700 Y7.500 S0.40 F3000
+G1 X14.650 Y7.500 S0.40 F3000
+G1 X14.600 Y7.500 S0.40 F3000
+G1 X14.550 Y7.500 S0.40 F3000
+G1 X14.500 Y7.500 S0.40 F3000
+G1 X14.450 Y7.500 S0.40 F3000
+G1 X14.400 Y7.500 S0.40 F3000
+G1 X14.350 Y7.500 S0.40 F3000
+G1 X14.300 Y7.500 S0.40 F3000
+G1 X14.250 Y7.500 S0.40 F3000
+G1 X14.200 Y7.500 S0.40 F3000
+G1 X14.150 Y7.500 S0.40 F3000
+G1 X14.100 Y7.500 S0.40 F3000
+G1 X14.050 Y7.500 S0.40 F3000
+G1 X14.000 Y7.500 S0.40 F3000
+G1 X13.950 Y7.500 S0.40 F3000
+G1 X13.900 Y7.500 S0.40 F3000
+G1 X13.850 Y7.500 S0.40 F3000
+G1 X13.800 Y7.500 S0.40 F3000
+G1 X13.750 Y7.500 S0.40 F3000
+G1 X13.700 Y7.500 S0.40 F3000
+G1 X13.650 Y7.500 S0.40 F3000
+G1 X13.600 Y7.500 S0.40 F3000
+G1 X13.550 Y7.500 S0.40 F3000
+G1 X13.500 Y7.500 S0.40 F3000
+G1 X13.450 Y7.500 S0.40 F3000
+G1 X13.400 Y7.500 S0.40 F3000
+G1 X13.350 Y7.500 S0.40 F3000
+G1 X13.300 Y7.500 S0.40 F3000
+G1 X13.250 Y7.500 S0.40 F3000
+G1 X13.200 Y7.500 S0.40 F3000
+G1 X13.150 Y7.500 S0.40 F3000
+G1 X13.100 Y7.500 S0.40 F3000
+G1 X13.050 Y7.500 S0.40 F3000
+G1 X13.000 Y7.500 S0.40 F3000
+G1 X12.950 Y7.500 S0.20 F3000
+G1 X12.900 Y7.500 S0.20 F3000
+G1 X12.850 Y7.500 S0.20 F3000
+G1 X12.800 Y7.500 S0.20 F3000
+G1 X12.750 Y7.500 S0.20 F3000
+G1 X12.700 Y7.500 S0.20 F3000
+G1 X12.650 Y7.500 S0.20 F3000
+G1 X12.600 Y7.500 S0.20 F3000
+G1 X12.550 Y7.500 S0.20 F3000
+G1 X12.500 Y7.500 S0.20 F3000
+G1 X12.450 Y7.500 S0.20 F3000
+G1 X12.400 Y7.500 S0.20 F3000
+G1 X12.350 Y7.500 S0.20 F3000
+G1 X12.300 Y7.500 S0.20 F3000
+G1 X12.250 Y7.500 S0.20 F3000
+G1 X12.200 Y7.500 S0.20 F3000
+G1 X12.150 Y7.500 S0.20 F3000
+G1 X12.100 Y7.500 S0.20 F3000
+G1 X12.050 Y7.500 S0.20 F3000
+G1 X12.000 Y7.500 S0.20 F3000
+G1 X11.950 Y7.500 S0.20 F3000
+G1 X11.900 Y7.500 S0.20 F3000
+G1 X11.850 Y7.500 S0.20 F3000
+G1 X11.800 Y7.500 S0.20 F3000
+G1 X11.750 Y7.500 S0.20 F3000
+G1 X11.700 Y7.500 S0.20 F3000
+G1 X11.650 Y7.500 S0.20 F3000
+G1 X11.600 Y7.500 S0.20 F3000
+G1 X11.550 Y7.500 S0.20 F3000
+G1 X11.500 Y7.500 S0.20 F3000
+G1 X11.450 Y7.500 S0.20 F3000
+G1 X11.400 Y7.500 S0.20 F3000
+G1 X11.350 Y7.500 S0.20 F3000
+G1 X11.300 Y7.500 S0.20 F3000
+G1 X11.250 Y7.500 S0.20 F3000
+G1 X11.200 Y7.500 S0.20 F3000
+G1 X11.150 Y7.500 S0.20 F3000
+G1 X11.100 Y7.500 S0.20 F3000
+G1 X11.050 Y7.500 S0.20 F3000
+G1 X11.000 Y7.500 S0.20 F3000
+G1 X10.950 Y7.500 S0.30 F3000
+G1 X10.900 Y7.500 S0.30 F3000
+G1 X10.850 Y7.500 S0.30 F3000
+G1 X10.800 Y7.500 S0.30 F3000
+G1 X10.750 Y7.500 S0.30 F3000
+G1 X10.700 Y7.500 S0.30 F3000
+G1 X10.650 Y7.500 S0.30 F3000
+G1 X10.600 Y7.500 S0.30 F3000
+G1 X10.550 Y7.500 S0.30 F3000
+G1 X10.500 Y7.500 S0.30 F3000
+G1 X10.450 Y7.500 S0.30 F3000
+G1 X10.400 Y7.500 S0.30 F3000
+G1 X10.350 Y7.500 S0.30 F3000
+G1 X10.300 Y7.500 S0.30 F3000
+G1 X10.250 Y7.500 S0.30 F3000
+G1 X10.200 Y7.500 S0.30 F3000
+G1 X10.150 Y7.500 S0.30 F3000
+G1 X10.100 Y7.500 S0.30 F3000
+G1 X10.050 Y7.500 S0.30 F3000
+G1 X10.000 Y7.500 S0.30 F3000
+G1 X9.950 Y7.500 S0.30 F3000
+G1 X9.900 Y7.500 S0.30 F3000
+G1 X9.850 Y7.500 S0.30 F3000
+G1 X9.800 Y7.500 S0.30 F3000
+G1 X9.750 Y7.500 S0.30 F3000
+G1 X9.700 Y7.500 S0.30 F3000
+G1 X9.650 Y7.500 S0.30 F3000
+G1 X9.600 Y7.500 S0.30 F3000
+G1 X9.550 Y7.500 S0.30 F3000
+G1 X9.500 Y7.500 S0.30 F3000
+G1 X9.450 Y7.500 S0.30 F3000
+G1 X9.400 Y7.500 S0.30 F3000
+G1 X9.350 Y7.500 S0.30 F3000
+G1 X9.300 Y7.500 S0.30 F3000
+G1 X9.250 Y7.500 S0.30 F3000
+G1 X9.200 Y7.500 S0.30 F3000
+G1 X9.150 Y7.500 S0.30 F3000
+G1 X9.100 Y7.500 S0.30 F3000
+G1 X9.050 Y7.500 S0.30 F3000
+G1 X9.000 Y7.500 S0.30 F3000
+G1 X8.950 Y7.500 S0.40 F3000
+G1 X8.900 Y7.500 S0.40 F3000
+G1 X8.850 Y7.500 S0.40 F3000
+G1 X8.800 Y7.500 S0.40 F3000
+G1 X8.750 Y7.500 S0.40 F3000
+G1 X8.700 Y7.500 S0.40 F3000
+G1 X8.650 Y7.500 S0.40 F3000
+G1 X8.600 Y7.500 S0.40 F3000
+G1 X8.550 Y7.500 S0.40 F3000
+G1 X8.500 Y7.500 S0.40 F3000
+G1 X8.450 Y7.500 S0.40 F3000
+G1 X8.400 Y7.500 S0.40 F3000
+G1 X8.350 Y7.500 S0.40 F3000
+G1 X8.300 Y7.500 S0.40 F3000
+G1 X8.250 Y7.500 S0.40 F3000
+G1 X8.200 Y7.500 S0.40 F3000
+G1 X8.150 Y7.500 S0.40 F3000
+G1 X8.100 Y7.500 S0.40 F3000
+G1 X8.050 Y7.500 S0.40 F3000
+G1 X8.000 Y7.500 S0.40 F3000
+G1 X7.950 Y7.500 S0.40 F3000
+G1 X7.900 Y7.500 S0.40 F3000
+G1 X7.850 Y7.500 S0.40 F3000
+G1 X7.800 Y7.500 S0.40 F3000
+G1 X7.750 Y7.500 S0.40 F3000
+G1 X7.700 Y7.500 S0.40 F3000
+G1 X7.650 Y7.500 S0.40 F3000
+G1 X7.600 Y7.500 S0.40 F3000
+G1 X7.550 Y7.500 S0.40 F3000
+G1 X7.500 Y7.500 S0.40 F3000
+G1 X7.450 Y7.500 S0.40 F3000
+G1 X7.400 Y7.500 S0.40 F3000
+G1 X7.350 Y7.500 S0.40 F3000
+G1 X7.300 Y7.500 S0.40 F3000
+G1 X7.250 Y7.500 S0.40 F3000
+G1 X7.200 Y7.500 S0.40 F3000
+G1 X7.150 Y7.500 S0.40 F3000
+G1 X7.100 Y7.500 S0.40 F3000
+G1 X7.050 Y7.500 S0.40 F3000
+G1 X7.000 Y7.500 S0.40 F3000
+G1 X6.950 Y7.500 S0.20 F3000
+G1 X6.900 Y7.500 S0.20 F3000
+G1 X6.850 Y7.500 S0.20 F3000
+G1 X6.800 Y7.500 S0.20 F3000
+G1 X6.750 Y7.500 S0.20 F3000
+G1 X6.700 Y7.500 S0.20 F3000
+G1 X6.650 Y7.500 S0.20 F3000
+G1 X6.600 Y7.500 S0.20 F3000
+G1 X6.550 Y7.500 S0.20 F3000
+G1 X6.500 Y7.500 S0.20 F3000
+G1 X6.450 Y7.500 S0.20 F3000
+G1 X6.400 Y7.500 S0.20 F3000
+G1 X6.350 Y7.500 S0.20 F3000
+G1 X6.300 Y7.500 S0.20 F3000
+G1 X6.250 Y7.500 S0.20 F3000
+G1 X6.200 Y7.500 S0.20 F3000
+G1 X6.150 Y7.500 S0.20 F3000
+G1 X6.100 Y7.500 S0.20 F3000
+G1 X6.050 Y7.500 S0.20 F3000
+G1 X6.000 Y7.500 S0.20 F3000
+G1 X5.950 Y7.500 S0.20 F3000
+G1 X5.900 Y7.500 S0.20 F3000
+G1 X5.850 Y7.500 S0.20 F3000
+G1 X5.800 Y7.500 S0.20 F3000
+G1 X5.750 Y7.500 S0.20 F3000
+G1 X5.700 Y7.500 S0.20 F3000
+G1 X5.650 Y7.500 S0.20 F3000
+G1 X5.600 Y7.500 S0.20 F3000
+G1 X5.550 Y7.500 S0.20 F3000
+G1 X5.500 Y7.500 S0.20 F3000
+G1 X5.450 Y7.500 S0.20 F3000
+G1 X5.400 Y7.500 S0.20 F3000
+G1 X5.350 Y7.500 S0.20 F3000
+G1 X5.300 Y7.500 S0.20 F3000
+G1 X5.250 Y7.500 S0.20 F3000
+G1 X5.200 Y7.500 S0.20 F3000
+G1 X5.150 Y7.500 S0.20 F3000
+G1 X5.100 Y7.500 S0.20 F3000
+G1 X5.050 Y7.500 S0.20 F3000
+G1 X5.000 Y7.500 S0.20 F3000
+G1 Y8.000 S0
+G1 X20.0000 Y25.0000 S0.5 F2400
+G1 X19.9999 Y25.0500 S0.5 F2400
+G1 X19.9995 Y25.1000 S0.5 F2400
+G1 X19.9989 Y25.1501 S0.5 F2400
+G1 X19.9980 Y25.2001 S0.5 F2400
+G1 X19.9969 Y25.2501 S0.5 F2400
+G1 X19.9955 Y25.3001 S0.5 F2400
+G1 X19.9939 Y25.3501 S0.5 F2400
+G1 X19.9920 Y25.4001 S0.5 F2400
+G1 X19.9899 Y25.4501 S0.5 F2400
+G1 X19.9875 Y25.5000 S0.5 F2400
+G1 X19.9849 Y25.5500 S0.5 F2400
+G1 X19.9820 Y25.5999 S0.5 F2400
+G1 X19.9789 Y25.6499 S0.5 F2400
+G1 X19.9755 Y25.6998 S0.5 F2400
+G1 X19.9719 Y25.7497 S0.5 F2400
+G1 X19.9680 Y25.7996 S0.5 F2400
+G1 X19.9639 Y25.8494 S0.5 F2400
+G1 X19.9595 Y25.8992 S0.5 F2400
+G1 X19.9549 Y25.9491 S0.5 F2400
+G1 X19.9500 Y25.9988 S0.5 F2400
+G1 X19.9449 Y26.0486 S0.5 F2400
+G1 X19.9395 Y26.0983 S0.5 F2400
+G1 X19.9339 Y26.1480 S0.5 F2400
+G1 X19.9280 Y26.1977 S0.5 F2400
+G1 X19.9219 Y26.2474 S0.5 F2400
+G1 X19.9155 Y26.2970 S0.5 F2400
+G1 X19.9089 Y26.3466 S0.5 F2400
+G1 X19.9021 Y26.3961 S0.5 F2400
+G1 X19.8950 Y26.4457 S0.5 F2400
+G1 X19.8876 Y26.4951 S0.5 F2400
+G1 X19.8800 Y26.5446 S0.5 F2400
+G1 X19.8721 Y26.5940 S0.5 F2400
+G1 X19.8640 Y26.6433 S0.5 F2400
+G1 X19.8557 Y26.6927 S0.5 F2400
+G1 X19.8471 Y26.7420 S0.5 F2400
+G1 X19.8383 Y26.7912 S0.5 F2400
+G1 X19.8292 Y26.8404 S0.5 F2400
+G1 X19.8199 Y26.8895 S0.5 F2400
+G1 X19.8103 Y26.9386 S0.5 F2400
+G1 X19.8005 Y26.9877 S0.5 F2400
+G1 X19.7904 Y27.0367 S0.5 F2400
+G1 X19.7801 Y27.0856 S0.5 F2400
+G1 X19.7695 Y27.1345 S0.5 F2400
+G1 X19.7587 Y27.1834 S0.5 F2400
+G1 X19.7477 Y27.2322 S0.5 F2400
+G1 X19.7364 Y27.2809 S0.5 F2400
+G1 X19.7249 Y27.3296 S0.5 F2400
+G1 X19.7131 Y27.3782 S0.5 F2400
+G1 X19.7011 Y27.4268 S0.5 F2400
+G1 X19.6888 Y27.4753 S0.5 F2400
+G1 X19.6763 Y27.5237 S0.5 F2400
+G1 X19.6636 Y27.5721 S0.5 F2400
+G1 X19.6506 Y27.6204 S0.5 F2400
+G1 X19.6373 Y27.6686 S0.5 F2400
+G1 X19.6239 Y27.7168 S0.5 F2400
+G1 X19.6102 Y27.7649 S0.5 F2400
+G1 X19.5962 Y27.8130 S0.5 F2400
+G1 X19.5820 Y27.8609 S0.5 F2400
+G1 X19.5676 Y27.9088 S0.5 F2400
+G1 X19.5529 Y27.9567 S0.5 F2400
+G1 X19.5380 Y28.0044 S0.5 F2400
+G1 X19.5229 Y28.0521 S0.5 F2400
+G1 X19.5075 Y28.0997 S0.5 F2400
+G1 X19.4918 Y28.1472 S0.5 F2400
+G1 X19.4760 Y28.1946 S0.5 F2400
+G1 X19.4599 Y28.2420 S0.5 F2400
+G1 X19.4435 Y28.2893 S0.5 F2400
+G1 X19.4270 Y28.3365 S0.5 F2400
+G1 X19.4102 Y28.3836 S0.5 F2400
+G1 X19.3931 Y28.4306 S0.5 F2400
+G1 X19.3758 Y28.4776 S0.5 F2400
+G1 X19.3583 Y28.5245 S0.5 F2400
+G1 X19.3406 Y28.5712 S0.5 F2400
+G1 X19.3226 Y28.6179 S0.5 F2400
+G1 X19.3044 Y28.6645 S0.5 F2400
+G1 X19.2859 Y28.7110 S0.5 F2400
+G1 X19.2673 Y28.7574 S0.5 F2400
+G1 X19.2483 Y28.8037 S0.5 F2400
+G1 X19.2292 Y28.8499 S0.5 F2400
+G1 X19.2098 Y28.8961 S0.5 F2400
+G1 X19.1902 Y28.9421 S0.5 F2400
+G1 X19.1704 Y28.9880 S0.5 F2400
+G1 X19.1503 Y29.0338 S0.5 F2400
+G1 X19.1300 Y29.0795 S0.5 F2400
+G1 X19.1095 Y29.1252 S0.5 F2400
+G1 X19.0887 Y29.1707 S0.5 F2400
+G1 X19.0678 Y29.2161 S0.5 F2400
+G1 X19.0466 Y29.2614 S0.5 F2400
+G1 X19.0251 Y29.3066 S0.5 F2400
+G1 X19.0035 Y29.3517 S0.5 F2400
+G1 X18.9816 Y29.3967 S0.5 F2400
+G1 X18.9595 Y29.4416 S0.5 F2400
+G1 X18.9372 Y29.4863 S0.5 F2400
+G1 X18.9146 Y29.5310 S0.5 F2400
+G1 X18.8918 Y29.5755 S0.5 F2400
+G1 X18.8688 Y29.6200 S0.5 F2400
+G1 X18.8456 Y29.6643 S0.5 F2400
+G1 X18.8222 Y29.7085 S0.5 F2400
+G1 X18.7985 Y29.7525 S0.5 F2400
+G1 X18.7746 Y29.7965 S0.5 F2400
+G1 X18.7505 Y29.8403 S0.5 F2400
+G1 X18.7262 Y29.8840 S0.5 F2400
+G1 X18.7016 Y29.9276 S0.5 F2400
+G1 X18.6769 Y29.9711 S0.5 F2400
+G1 X18.6519 Y30.0144 S0.5 F2400
+G1 X18.6267 Y30.0577 S0.5 F2400
+G1 X18.6013 Y30.1007 S0.5 F2400
+G1 X18.5757 Y30.1437 S0.5 F2400
+G1 X18.5498 Y30.1865 S0.5 F2400
+G1 X18.5238 Y30.2293 S0.5 F2400
+G1 X18.4975 Y30.2718 S0.5 F2400
+G1 X18.4710 Y30.3143 S0.5 F2400
+G1 X18.4444 Y30.3566 S0.5 F2400
+G1 X18.4174 Y30.3988 S0.5 F2400
+G1 X18.3903 Y30.4408 S0.5 F2400
+G1 X18.3630 Y30.4827 S0.5 F2400
+G1 X18.3355 Y30.5245 S0.5 F2400
+G1 X18.3077 Y30.5661 S0.5 F2400
+G1 X18.2798 Y30.6076 S0.5 F2400
+G1 X18.2516 Y30.6489 S0.5 F2400
+G1 X18.2233 Y30.6901 S0.5 F2400
+G1 X18.1947 Y30.7312 S0.5 F2400
+G1 X18.1659 Y30.7721 S0.5 F2400
+G1 X18.1370 Y30.8129 S0.5 F2400
+G1 X18.1078 Y30.8535 S0.5 F2400
+G1 X18.0784 Y30.8940 S0.5 F2400
+G1 X18.0488 Y30.9344 S0.5 F2400
+G1 X18.0190 Y30.9746 S0.5 F2400
+G1 X17.9890 Y31.0146 S0.5 F2400
+G1 X17.9588 Y31.0545 S0.5 F2400
+G1 X17.9285 Y31.0942 S0.5 F2400
+G1 X17.8979 Y31.1338 S0.5 F2400
+G1 X17.8671 Y31.1732 S0.5 F2400
+G1 X17.8361 Y31.2125 S0.5 F2400
+G1 X17.8049 Y31.2516 S0.5 F2400
+G1 X17.7736 Y31.2906 S0.5 F2400
+G1 X17.7420 Y31.3294 S0.5 F2400
+G1 X17.7102 Y31.3681 S0.5 F2400
+G1 X17.6783 Y31.4066 S0.5 F2400
+G1 X17.6461 Y31.4449 S0.5 F2400
+G1 X17.6138 Y31.4831 S0.5 F2400
+G1 X17.5813 Y31.5211 S0.5 F2400
+G1 X17.5486 Y31.5589 S0.5 F2400
+G1 X17.5156 Y31.5966 S0.5 F2400
+G1 X17.4826 Y31.6341 S0.5 F2400
+G1 X17.4493 Y31.6715 S0.5 F2400
+G1 X17.4158 Y31.7086 S0.5 F2400
+G1 X17.3822 Y31.7457 S0.5 F2400
+G1 X17.3483 Y31.7825 S0.5 F2400
+G1 X17.3143 Y31.8192 S0.5 F2400
+G1 X17.2801 Y31.8557 S0.5 F2400
+G1 X17.2457 Y31.8920 S0.5 F2400
+G1 X17.2111 Y31.9282 S0.5 F2400
+G1 X17.1764 Y31.9642 S0.5 F2400
+G1 X17.1415 Y32.0000 S0.5 F2400
+G1 X17.1064 Y32.0356 S0.5 F2400
+G1 X17.0711 Y32.0711 S0.5 F2400
+G1 X17.0356 Y32.1064 S0.5 F2400
+G1 X17.0000 Y32.1415 S0.5 F2400
+G1 X16.9642 Y32.1764 S0.5 F2400
+G1 X16.9282 Y32.2111 S0.5 F2400
+G1 X16.8920 Y32.2457 S0.5 F2400
+G1 X16.8557 Y32.2801 S0.5 F2400
+G1 X16.8192 Y32.3143 S0.5 F2400
+G1 X16.7825 Y32.3483 S0.5 F2400
+G1 X16.7457 Y32.3822 S0.5 F2400
+G1 X16.7086 Y32.4158 S0.5 F2400
+G1 X16.6715 Y32.4493 S0.5 F2400
+G1 X16.6341 Y32.4826 S0.5 F2400
+G1 X16.5966 Y32.5156 S0.5 F2400
+G1 X16.5589 Y32.5486 S0.5 F2400
+G1 X16.5211 Y32.5813 S0.5 F2400
+G1 X16.4831 Y32.6138 S0.5 F2400
+G1 X16.4449 Y32.6461 S0.5 F2400
+G1 X16.4066 Y32.6783 S0.5 F2400
+G1 X16.3681 Y32.7102 S0.5 F2400
+G1 X16.3294 Y32.7420 S0.5 F2400
+G1 X16.2906 Y32.7736 S0.5 F2400
+G1 X16.2516 Y32.8049 S0.5 F2400
+G1 X16.2125 Y32.8361 S0.5 F2400
+G1 X16.1732 Y32.8671 S0.5 F2400
+G1 X16.1338 Y32.8979 S0.5 F2400
+G1 X16.0942 Y32.9285 S0.5 F2400
+G1 X16.0545 Y32.9588 S0.5 F2400
+G1 X16.0146 Y32.9890 S0.5 F2400
+G1 X15.9746 Y33.0190 S0.5 F2400
+G1 X15.9344 Y33.0488 S0.5 F2400
+G1 X15.8940 Y33.0784 S0.5 F2400
+G1 X15.8535 Y33.1078 S0.5 F2400
+G1 X15.8129 Y33.1370 S0.5 F2400
+G1 X15.7721 Y33.1659 S0.5 F2400
+G1 X15.7312 Y33.1947 S0.5 F2400
+G1 X15.6901 Y33.2233 S0.5 F2400
+G1 X15.6489 Y33.2516 S0.5 F2400
+G1 X15.6076 Y33.2798 S0.5 F2400
+G1 X15.5661 Y33.3077 S0.5 F2400
+G1 X15.5245 Y33.3355 S0.5 F2400
+G1 X15.4827 Y33.3630 S0.5 F2400
+G1 X15.4408 Y33.3903 S0.5 F2400
+G1 X15.3988 Y33.4174 S0.5 F2400
+G1 X15.3566 Y33.4444 S0.5 F2400
+G1 X15.3143 Y33.4710 S0.5 F2400
+G1 X15.2718 Y33.4975 S0.5 F2400
+G1 X15.2293 Y33.5238 S0.5 F2400
+G1 X15.1865 Y33.5498 S0.5 F2400
+G1 X15.1437 Y33.5757 S0.5 F2400
+G1 X15.1007 Y33.6013 S0.5 F2400
+G1 X15.0577 Y33.6267 S0.5 F2400
+G1 X15.0144 Y33.6519 S0.5 F2400
+G1 X14.9711 Y33.6769 S0.5 F2400
+G1 X14.9276 Y33.7016 S0.5 F2400
+G1 X14.8840 Y33.7262 S0.5 F2400
+G1 X14.8403 Y33.7505 S0.5 F2400
+G1 X14.7965 Y33.7746 S0.5 F2400
+G1 X14.7525 Y33.7985 S0.5 F2400
+G1 X14.7085 Y33.8222 S0.5 F2400
+G1 X14.6643 Y33.8456 S0.5 F2400
+G1 X14.6200 Y33.8688 S0.5 F2400
+G1 X14.5755 Y33.8918 S0.5 F2400
+G1 X14.5310 Y33.9146 S0.5 F2400
+G1 X14.4863 Y33.9372 S0.5 F2400
+G1 X14.4416 Y33.9595 S0.5 F2400
+G1 X14.3967 Y33.9816 S0.5 F2400
+G1 X14.3517 Y34.0035 S0.5 F2400
+G1 X14.3066 Y34.0251 S0.5 F2400
+G1 X14.2614 Y34.0466 S0.5 F2400
+G1 X14.2161 Y34.0678 S0.5 F2400
+G1 X14.1707 Y34.0887 S0.5 F2400
+G1 X14.1252 Y34.1095 S0.5 F2400
+G1 X14.0795 Y34.1300 S0.5 F2400
+G1 X14.0338 Y34.1503 S0.5 F2400
+G1 X13.9880 Y34.1704 S0.5 F2400
+G1 X13.9421 Y34.1902 S0.5 F2400
+G1 X13.8961 Y34.2098 S0.5 F2400
+G1 X13.8499 Y34.2292 S0.5 F2400
+G1 X13.8037 Y34.2483 S0.5 F2400
+G1 X13.7574 Y34.2673 S0.5 F2400
+G1 X13.7110 Y34.2859 S0.5 F2400
+G1 X13.6645 Y34.3044 S0.5 F2400
+G1 X13.6179 Y34.3226 S0.5 F2400
+G1 X13.5712 Y34.3406 S0.5 F2400
+G1 X13.5245 Y34.3583 S0.5 F2400
+G1 X13.4776 Y34.3758 S0.5 F2400
+G1 X13.4306 Y34.3931 S0.5 F2400
+G1 X13.3836 Y34.4102 S0.5 F2400
+G1 X13.3365 Y34.4270 S0.5 F2400
+G1 X13.2893 Y34.4435 S0.5 F2400
+G1 X13.2420 Y34.4599 S0.5 F2400
+G1 X13.1946 Y34.4760 S0.5 F2400
+G1 X13.1472 Y34.4918 S0.5 F2400
+G1 X13.0997 Y34.5075 S0.5 F2400
+G1 X13.0521 Y34.5229 S0.5 F2400
+G1 X13.0044 Y34.5380 S0.5 F2400
+G1 X12.9567 Y34.5529 S0.5 F2400
+G1 X12.9088 Y34.5676 S0.5 F2400
+G1 X12.8609 Y34.5820 S0.5 F2400
+G1 X12.8130 Y34.5962 S0.5 F2400
+G1 X12.7649 Y34.6102 S0.5 F2400
+G1 X12.7168 Y34.6239 S0.5 F2400
+G1 X12.6686 Y34.6373 S0.5 F2400
+G1 X12.6204 Y34.6506 S0.5 F2400
+G1 X12.5721 Y34.6636 S0.5 F2400
+G1 X12.5237 Y34.6763 S0.5 F2400
+G1 X12.4753 Y34.6888 S0.5 F2400
+G1 X12.4268 Y34.7011 S0.5 F2400
+G1 X12.3782 Y34.7131 S0.5 F2400
+G1 X12.3296 Y34.7249 S0.5 F2400
+G1 X12.2809 Y34.7364 S0.5 F2400
+G1 X12.2322 Y34.7477 S0.5 F2400
+G1 X12.1834 Y34.7587 S0.5 F2400
+G1 X12.1345 Y34.7695 S0.5 F2400
+G1 X12.0856 Y34.7801 S0.5 F2400
+G1 X12.0367 Y34.7904 S0.5 F2400
+G1 X11.9877 Y34.8005 S0.5 F2400
+G1 X11.9386 Y34.8103 S0.5 F2400
+G1 X11.8895 Y34.8199 S0.5 F2400
+G1 X11.8404 Y34.8292 S0.5 F2400
+G1 X11.7912 Y34.8383 S0.5 F2400
+G1 X11.7420 Y34.8471 S0.5 F2400
+G1 X11.6927 Y34.8557 S0.5 F2400
+G1 X11.6433 Y34.8640 S0.5 F2400
+G1 X11.5940 Y34.8721 S0.5 F2400
+G1 X11.5446 Y34.8800 S0.5 F2400
+G1 X11.4951 Y34.8876 S0.5 F2400
+G1 X11.4457 Y34.8950 S0.5 F2400
+G1 X11.3961 Y34.9021 S0.5 F2400
+G1 X11.3466 Y34.9089 S0.5 F2400
+G1 X11.2970 Y34.9155 S0.5 F2400
+G1 X11.2474 Y34.9219 S0.5 F2400
+G1 X11.1977 Y34.9280 S0.5 F2400
+G1 X11.1480 Y34.9339 S0.5 F2400
+G1 X11.0983 Y34.9395 S0.5 F2400
+G1 X11.0486 Y34.9449 S0.5 F2400
+G1 X10.9988 Y34.9500 S0.5 F2400
+G1 X10.9491 Y34.9549 S0.5 F2400
+G1 X10.8992 Y34.9595 S0.5 F2400
+G1 X10.8494 Y34.9639 S0.5 F2400
+G1 X10.7996 Y34.9680 S0.5 F2400
+G1 X10.7497 Y34.9719 S0.5 F2400
+G1 X10.6998 Y34.9755 S0.5 F2400
+G1 X10.6499 Y34.9789 S0.5 F2400
+G1 X10.5999 Y34.9820 S0.5 F2400
+G1 X10.5500 Y34.9849 S0.5 F2400
+G1 X10.5000 Y34.9875 S0.5 F2400
+G1 X10.4501 Y34.9899 S0.5 F2400
+G1 X10.4001 Y34.9920 S0.5 F2400
+G1 X10.3501 Y34.9939 S0.5 F2400
+G1 X10.3001 Y34.9955 S0.5 F2400
+G1 X10.2501 Y34.9969 S0.5 F2400
+G1 X10.2001 Y34.9980 S0.5 F2400
+G1 X10.1501 Y34.9989 S0.5 F2400
+G1 X10.1000 Y34.9995 S0.5 F2400
+G1 X10.0500 Y34.9999 S0.5 F2400
+G1 X10.0000 Y35.0000 S0.5 F2400
+G1 X9.9500 Y34.9999 S0.5 F2400
+G1 X9.9000 Y34.9995 S0.5 F2400
+G1 X9.8499 Y34.9989 S0.5 F2400
+G1 X9.7999 Y34.9980 S0.5 F2400
+G1 X9.7499 Y34.9969 S0.5 F2400
+G1 X9.6999 Y34.9955 S0.5 F2400
+G1 X9.6499 Y34.9939 S0.5 F2400
+G1 X9.5999 Y34.9920 S0.5 F2400
+G1 X9.5499 Y34.9899 S0.5 F2400
+G1 X9.5000 Y34.9875 S0.5 F2400
+G1 X9.4500 Y34.9849 S0.5 F2400
+G1 X9.4001 Y34.9820 S0.5 F2400
+G1 X9.3501 Y34.9789 S0.5 F2400
+G1 X9.3002 Y34.9755 S0.5 F2400
+G1 X9.2503 Y34.9719 S0.5 F2400
+G1 X9.2004 Y34.9680 S0.5 F2400
+G1 X9.1506 Y34.9639 S0.5 F2400
+G1 X9.1008 Y34.9595 S0.5 F2400
+G1 X9.0509 Y34.9549 S0.5 F2400
+G1 X9.0012 Y34.9500 S0.5 F2400
+G1 X8.9514 Y34.9449 S0.5 F2400
+G1 X8.9017 Y34.9395 S0.5 F2400
+G1 X8.8520 Y34.9339 S0.5 F2400
+G1 X8.8023 Y34.9280 S0.5 F2400
+G1 X8.7526 Y34.9219 S0.5 F2400
+G1 X8.7030 Y34.9155 S0.5 F2400
+G1 X8.6534 Y34.9089 S0.5 F2400
+G1 X8.6039 Y34.9021 S0.5 F2400
+G1 X8.5543 Y34.8950 S0.5 F2400
+G1 X8.5049 Y34.8876 S0.5 F2400
+G1 X8.4554 Y34.8800 S0.5 F2400
+G1 X8.4060 Y34.8721 S0.5 F2400
+G1 X8.3567 Y34.8640 S0.5 F2400
+G1 X8.3073 Y34.8557 S0.5 F2400
+G1 X8.2580 Y34.8471 S0.5 F2400
+G1 X8.2088 Y34.8383 S0.5 F2400
+G1 X8.1596 Y34.8292 S0.5 F2400
+G1 X8.1105 Y34.8199 S0.5 F2400
+G1 X8.0614 Y34.8103 S0.5 F2400
+G1 X8.0123 Y34.8005 S0.5 F2400
+G1 X7.9633 Y34.7904 S0.5 F2400
+G1 X7.9144 Y34.7801 S0.5 F2400
+G1 X7.8655 Y34.7695 S0.5 F2400
+G1 X7.8166 Y34.7587 S0.5 F2400
+G1 X7.7678 Y34.7477 S0.5 F2400
+G1 X7.7191 Y34.7364 S0.5 F2400
+G1 X7.6704 Y34.7249 S0.5 F2400
+G1 X7.6218 Y34.7131 S0.5 F2400
+G1 X7.5732 Y34.7011 S0.5 F2400
+G1 X7.5247 Y34.6888 S0.5 F2400
+G1 X7.4763 Y34.6763 S0.5 F2400
+G1 X7.4279 Y34.6636 S0.5 F2400
+G1 X7.3796 Y34.6506 S0.5 F2400
+G1 X7.3314 Y34.6373 S0.5 F2400
+G1 X7.2832 Y34.6239 S0.5 F2400
+G1 X7.2351 Y34.6102 S0.5 F2400
+G1 X7.1870 Y34.5962 S0.5 F2400
+G1 X7.1391 Y34.5820 S0.5 F2400
+G1 X7.0912 Y34.5676 S0.5 F2400
+G1 X7.0433 Y34.5529 S0.5 F2400
+G1 X6.9956 Y34.5380 S0.5 F2400
+G1 X6.9479 Y34.5229 S0.5 F2400
+G1 X6.9003 Y34.5075 S0.5 F2400
+G1 X6.8528 Y34.4918 S0.5 F2400
+G1 X6.8054 Y34.4760 S0.5 F2400
+G1 X6.7580 Y34.4599 S0.5 F2400
+G1 X6.7107 Y34.4435 S0.5 F2400
+G1 X6.6635 Y34.4270 S0.5 F2400
+G1 X6.6164 Y34.4102 S0.5 F2400
+G1 X6.5694 Y34.3931 S0.5 F2400
+G1 X6.5224 Y34.3758 S0.5 F2400
+G1 X6.4755 Y34.3583 S0.5 F2400
+G1 X6.4288 Y34.3406 S0.5 F2400
+G1 X6.3821 Y34.3226 S0.5 F2400
+G1 X6.3355 Y34.3044 S0.5 F2400
+G1 X6.2890 Y34.2859 S0.5 F2400
+G1 X6.2426 Y34.2673 S0.5 F2400
+G1 X6.1963 Y34.2483 S0.5 F2400
+G1 X6.1501 Y34.2292 S0.5 F2400
+G1 X6.1039 Y34.2098 S0.5 F2400
+G1 X6.0579 Y34.1902 S0.5 F2400
+G1 X6.0120 Y34.1704 S0.5 F2400
+G1 X5.9662 Y34.1503 S0.5 F2400
+G1 X5.9205 Y34.1300 S0.5 F2400
+G1 X5.8748 Y34.1095 S0.5 F2400
+G1 X5.8293 Y34.0887 S0.5 F2400
+G1 X5.7839 Y34.0678 S0.5 F2400
+G1 X5.7386 Y34.0466 S0.5 F2400
+G1 X5.6934 Y34.0251 S0.5 F2400
+G1 X5.6483 Y34.0035 S0.5 F2400
+G1 X5.6033 Y33.9816 S0.5 F2400
+G1 X5.5584 Y33.9595 S0.5 F2400
+G1 X5.5137 Y33.9372 S0.5 F2400
+G1 X5.4690 Y33.9146 S0.5 F2400
+G1 X5.4245 Y33.8918 S0.5 F2400
+G1 X5.3800 Y33.8688 S0.5 F2400
+G1 X5.3357 Y33.8456 S0.5 F2400
+G1 X5.2915 Y33.8222 S0.5 F2400
+G1 X5.2475 Y33.7985 S0.5 F2400
+G1 X5.2035 Y33.7746 S0.5 F2400
+G1 X5.1597 Y33.7505 S0.5 F2400
+G1 X5.1160 Y33.7262 S0.5 F2400
+G1 X5.0724 Y33.7016 S0.5 F2400
+G1 X5.0289 Y33.6769 S0.5 F2400
+G1 X4.9856 Y33.6519 S0.5 F2400
+G1 X4.9423 Y33.6267 S0.5 F2400
+G1 X4.8993 Y33.6013 S0.5 F2400
+G1 X4.8563 Y33.5757 S0.5 F2400
+G1 X4.8135 Y33.5498 S0.5 F2400
+G1 X4.7707 Y33.5238 S0.5 F2400
+G1 X4.7282 Y33.4975 S0.5 F2400
+G1 X4.6857 Y33.4710 S0.5 F2400
+G1 X4.6434 Y33.4444 S0.5 F2400
+G1 X4.6012 Y33.4174 S0.5 F2400
+G1 X4.5592 Y33.3903 S0.5 F2400
+G1 X4.5173 Y33.3630 S0.5 F2400
+G1 X4.4755 Y33.3355 S0.5 F2400
+G1 X4.4339 Y33.3077 S0.5 F2400
+G1 X4.3924 Y33.2798 S0.5 F2400
+G1 X4.3511 Y33.2516 S0.5 F2400
+G1 X4.3099 Y33.2233 S0.5 F2400
+G1 X4.2688 Y33.1947 S0.5 F2400
+G1 X4.2279 Y33.1659 S0.5 F2400
+G1 X4.1871 Y33.1370 S0.5 F2400
+G1 X4.1465 Y33.1078 S0.5 F2400
+G1 X4.1060 Y33.0784 S0.5 F2400
+G1 X4.0656 Y33.0488 S0.5 F2400
+G1 X4.0254 Y33.0190 S0.5 F2400
+G1 X3.9854 Y32.9890 S0.5 F2400
+G1 X3.9455 Y32.9588 S0.5 F2400
+G1 X3.9058 Y32.9285 S0.5 F2400
+G1 X3.8662 Y32.8979 S0.5 F2400
+G1 X3.8268 Y32.8671 S0.5 F2400
+G1 X3.7875 Y32.8361 S0.5 F2400
+G1 X3.7484 Y32.8049 S0.5 F2400
+G1 X3.7094 Y32.7736 S0.5 F2400
+G1 X3.6706 Y32.7420 S0.5 F2400
+G1 X3.6319 Y32.7102 S0.5 F2400
+G1 X3.5934 Y32.6783 S0.5 F2400
+G1 X3.5551 Y32.6461 S0.5 F2400
+G1 X3.5169 Y32.6138 S0.5 F2400
+G1 X3.4789 Y32.5813 S0.5 F2400
+G1 X3.4411 Y32.5486 S0.5 F2400
+G1 X3.4034 Y32.5156 S0.5 F2400
+G1 X3.3659 Y32.4826 S0.5 F2400
+G1 X3.3285 Y32.4493 S0.5 F2400
+G1 X3.2914 Y32.4158 S0.5 F2400
+G1 X3.2543 Y32.3822 S0.5 F2400
+G1 X3.2175 Y32.3483 S0.5 F2400
+G1 X3.1808 Y32.3143 S0.5 F2400
+G1 X3.1443 Y32.2801 S0.5 F2400
+G1 X3.1080 Y32.2457 S0.5 F2400
+G1 X3.0718 Y32.2111 S0.5 F2400
+G1 X3.0358 Y32.1764 S0.5 F2400
+G1 X3.0000 Y32.1415 S0.5 F2400
+G1 X2.9644 Y32.1064 S0.5 F2400
+G1 X2.9289 Y32.0711 S0.5 F2400
+G1 X2.8936 Y32.0356 S0.5 F2400
+G1 X2.8585 Y32.0000 S0.5 F2400
+G1 X2.8236 Y31.9642 S0.5 F2400
+G1 X2.7889 Y31.9282 S0.5 F2400
+G1 X2.7543 Y31.8920 S0.5 F2400
+G1 X2.7199 Y31.8557 S0.5 F2400
+G1 X2.6857 Y31.8192 S0.5 F2400
+G1 X2.6517 Y31.7825 S0.5 F2400
+G1 X2.6178 Y31.7457 S0.5 F2400
+G1 X2.5842 Y31.7086 S0.5 F2400
+G1 X2.5507 Y31.6715 S0.5 F2400
+G1 X2.5174 Y31.6341 S0.5 F2400
+G1 X2.4844 Y31.5966 S0.5 F2400
+G1 X2.4514 Y31.5589 S0.5 F2400
+G1 X2.4187 Y31.5211 S0.5 F2400
+G1 X2.3862 Y31.4831 S0.5 F2400
+G1 X2.3539 Y31.4449 S0.5 F2400
+G1 X2.3217 Y31.4066 S0.5 F2400
+G1 X2.2898 Y31.3681 S0.5 F2400
+G1 X2.2580 Y31.3294 S0.5 F2400
+G1 X2.2264 Y31.2906 S0.5 F2400
+G1 X2.1951 Y31.2516 S0.5 F2400
+G1 X2.1639 Y31.2125 S0.5 F2400
+G1 X2.1329 Y31.1732 S0.5 F2400
+G1 X2.1021 Y31.1338 S0.5 F2400
+G1 X2.0715 Y31.0942 S0.5 F2400
+G1 X2.0412 Y31.0545 S0.5 F2400
+G1 X2.0110 Y31.0146 S0.5 F2400
+G1 X1.9810 Y30.9746 S0.5 F2400
+G1 X1.9512 Y30.9344 S0.5 F2400
+G1 X1.9216 Y30.8940 S0.5 F2400
+G1 X1.8922 Y30.8535 S0.5 F2400
+G1 X1.8630 Y30.8129 S0.5 F2400
+G1 X1.8341 Y30.7721 S0.5 F2400
+G1 X1.8053 Y30.7312 S0.5 F2400
+G1 X1.7767 Y30.6901 S0.5 F2400
+G1 X1.7484 Y30.6489 S0.5 F2400
+G1 X1.7202 Y30.6076 S0.5 F2400
+G1 X1.6923 Y30.5661 S0.5 F2400
+G1 X1.6645 Y30.5245 S0.5 F2400
+G1 X1.6370 Y30.4827 S0.5 F2400
+G1 X1.6097 Y30.4408 S0.5 F2400
+G1 X1.5826 Y30.3988 S0.5 F2400
+G1 X1.5556 Y30.3566 S0.5 F2400
+G1 X1.5290 Y30.3143 S0.5 F2400
+G1 X1.5025 Y30.2718 S0.5 F2400
+G1 X1.4762 Y30.2293 S0.5 F2400
+G1 X1.4502 Y30.1865 S0.5 F2400
+G1 X1.4243 Y30.1437 S0.5 F2400
+G1 X1.3987 Y30.1007 S0.5 F2400
+G1 X1.3733 Y30.0577 S0.5 F2400
+G1 X1.3481 Y30.0144 S0.5 F2400
+G1 X1.3231 Y29.9711 S0.5 F2400
+G1 X1.2984 Y29.9276 S0.5 F2400
+G1 X1.2738 Y29.8840 S0.5 F2400
+G1 X1.2495 Y29.8403 S0.5 F2400
+G1 X1.2254 Y29.7965 S0.5 F2400
+G1 X1.2015 Y29.7525 S0.5 F2400
+G1 X1.1778 Y29.7085 S0.5 F2400
+G1 X1.1544 Y29.6643 S0.5 F2400
+G1 X1.1312 Y29.6200 S0.5 F2400
+G1 X1.1082 Y29.5755 S0.5 F2400
+G1 X1.0854 Y29.5310 S0.5 F2400
+G1 X1.0628 Y29.4863 S0.5 F2400
+G1 X1.0405 Y29.4416 S0.5 F2400
+G1 X1.0184 Y29.3967 S0.5 F2400
+G1 X0.9965 Y29.3517 S0.5 F2400
+G1 X0.9749 Y29.3066 S0.5 F2400
+G1 X0.9534 Y29.2614 S0.5 F2400
+G1 X0.9322 Y29.2161 S0.5 F2400
+G1 X0.9113 Y29.1707 S0.5 F2400
+G1 X0.8905 Y29.1252 S0.5 F2400
+G1 X0.8700 Y29.0795 S0.5 F2400
+G1 X0.8497 Y29.0338 S0.5 F2400
+G1 X0.8296 Y28.9880 S0.5 F2400
+G1 X0.8098 Y28.9421 S0.5 F2400
+G1 X0.7902 Y28.8961 S0.5 F2400
+G1 X0.7708 Y28.8499 S0.5 F2400
+G1 X0.7517 Y28.8037 S0.5 F2400
+G1 X0.7327 Y28.7574 S0.5 F2400
+G1 X0.7141 Y28.7110 S0.5 F2400
+G1 X0.6956 Y28.6645 S0.5 F2400
+G1 X0.6774 Y28.6179 S0.5 F2400
+G1 X0.6594 Y28.5712 S0.5 F2400
+G1 X0.6417 Y28.5245 S0.5 F2400
+G1 X0.6242 Y28.4776 S0.5 F2400
+G1 X0.6069 Y28.4306 S0.5 F2400
+G1 X0.5898 Y28.3836 S0.5 F2400
+G1 X0.5730 Y28.3365 S0.5 F2400
+G1 X0.5565 Y28.2893 S0.5 F2400
+G1 X0.5401 Y28.2420 S0.5 F2400
+G1 X0.5240 Y28.1946 S0.5 F2400
+G1 X0.5082 Y28.1472 S0.5 F2400
+G1 X0.4925 Y28.0997 S0.5 F2400
+G1 X0.4771 Y28.0521 S0.5 F2400
+G1 X0.4620 Y28.0044 S0.5 F2400
+G1 X0.4471 Y27.9567 S0.5 F2400
+G1 X0.4324 Y27.9088 S0.5 F2400
+G1 X0.4180 Y27.8609 S0.5 F2400
+G1 X0.4038 Y27.8130 S0.5 F2400
+G1 X0.3898 Y27.7649 S0.5 F2400
+G1 X0.3761 Y27.7168 S0.5 F2400
+G1 X0.3627 Y27.6686 S0.5 F2400
+G1 X0.3494 Y27.6204 S0.5 F2400
+G1 X0.3364 Y27.5721 S0.5 F2400
+G1 X0.3237 Y27.5237 S0.5 F2400
+G1 X0.3112 Y27.4753 S0.5 F2400
+G1 X0.2989 Y27.4268 S0.5 F2400
+G1 X0.2869 Y27.3782 S0.5 F2400
+G1 X0.2751 Y27.3296 S0.5 F2400
+G1 X0.2636 Y27.2809 S0.5 F2400
+G1 X0.2523 Y27.2322 S0.5 F2400
+G1 X0.2413 Y27.1834 S0.5 F2400
+G1 X0.2305 Y27.1345 S0.5 F2400
+G1 X0.2199 Y27.0856 S0.5 F2400
+G1 X0.2096 Y27.0367 S0.5 F2400
+G1 X0.1995 Y26.9877 S0.5 F2400
+G1 X0.1897 Y26.9386 S0.5 F2400
+G1 X0.1801 Y26.8895 S0.5 F2400
+G1 X0.1708 Y26.8404 S0.5 F2400
+G1 X0.1617 Y26.7912 S0.5 F2400
+G1 X0.1529 Y26.7420 S0.5 F2400
+G1 X0.1443 Y26.6927 S0.5 F2400
+G1 X0.1360 Y26.6433 S0.5 F2400
+G1 X0.1279 Y26.5940 S0.5 F2400
+G1 X0.1200 Y26.5446 S0.5 F2400
+G1 X0.1124 Y26.4951 S0.5 F2400
+G1 X0.1050 Y26.4457 S0.5 F2400
+G1 X0.0979 Y26.3961 S0.5 F2400
+G1 X0.0911 Y26.3466 S0.5 F2400
+G1 X0.0845 Y26.2970 S0.5 F2400
+G1 X0.0781 Y26.2474 S0.5 F2400
+G1 X0.0720 Y26.1977 S0.5 F2400
+G1 X0.0661 Y26.1480 S0.5 F2400
+G1 X0.0605 Y26.0983 S0.5 F2400
+G1 X0.0551 Y26.0486 S0.5 F2400
+G1 X0.0500 Y25.9988 S0.5 F2400
+G1 X0.0451 Y25.9491 S0.5 F2400
+G1 X0.0405 Y25.8992 S0.5 F2400
+G1 X0.0361 Y25.8494 S0.5 F2400
+G1 X0.0320 Y25.7996 S0.5 F2400
+G1 X0.0281 Y25.7497 S0.5 F2400
+G1 X0.0245 Y25.6998 S0.5 F2400
+G1 X0.0211 Y25.6499 S0.5 F2400
+G1 X0.0180 Y25.5999 S0.5 F2400
+G1 X0.0151 Y25.5500 S0.5 F2400
+G1 X0.0125 Y25.5000 S0.5 F2400
+G1 X0.0101 Y25.4501 S0.5 F2400
+G1 X0.0080 Y25.4001 S0.5 F2400
+G1 X0.0061 Y25.3501 S0.5 F2400
+G1 X0.0045 Y25.3001 S0.5 F2400
+G1 X0.0031 Y25.2501 S0.5 F2400
+G1 X0.0020 Y25.2001 S0.5 F2400
+G1 X0.0011 Y25.1501 S0.5 F2400
+G1 X0.0005 Y25.1000 S0.5 F2400
+G1 X0.0001 Y25.0500 S0.5 F2400
+G1 X0.0000 Y25.0000 S0.5 F2400
+G1 X0.0001 Y24.9500 S0.5 F2400
+G1 X0.0005 Y24.9000 S0.5 F2400
+G1 X0.0011 Y24.8499 S0.5 F2400
+G1 X0.0020 Y24.7999 S0.5 F2400
+G1 X0.0031 Y24.7499 S0.5 F2400
+G1 X0.0045 Y24.6999 S0.5 F2400
+G1 X0.0061 Y24.6499 S0.5 F2400
+G1 X0.0080 Y24.5999 S0.5 F2400
+G1 X0.0101 Y24.5499 S0.5 F2400
+G1 X0.0125 Y24.5000 S0.5 F2400
+G1 X0.0151 Y24.4500 S0.5 F2400
+G1 X0.0180 Y24.4001 S0.5 F2400
+G1 X0.0211 Y24.3501 S0.5 F2400
+G1 X0.0245 Y24.3002 S0.5 F2400
+G1 X0.0281 Y24.2503 S0.5 F2400
+G1 X0.0320 Y24.2004 S0.5 F2400
+G1 X0.0361 Y24.1506 S0.5 F2400
+G1 X0.0405 Y24.1008 S0.5 F2400
+G1 X0.0451 Y24.0509 S0.5 F2400
+G1 X0.0500 Y24.0012 S0.5 F2400
+G1 X0.0551 Y23.9514 S0.5 F2400
+G1 X0.0605 Y23.9017 S0.5 F2400
+G1 X0.0661 Y23.8520 S0.5 F2400
+G1 X0.0720 Y23.8023 S0.5 F2400
+G1 X0.0781 Y23.7526 S0.5 F2400
+G1 X0.0845 Y23.7030 S0.5 F2400
+G1 X0.0911 Y23.6534 S0.5 F2400
+G1 X0.0979 Y23.6039 S0.5 F2400
+G1 X0.1050 Y23.5543 S0.5 F2400
+G1 X0.1124 Y23.5049 S0.5 F2400
+G1 X0.1200 Y23.4554 S0.5 F2400
+G1 X0.1279 Y23.4060 S0.5 F2400
+G1 X0.1360 Y23.3567 S0.5 F2400
+G1 X0.1443 Y23.3073 S0.5 F2400
+G1 X0.1529 Y23.2580 S0.5 F2400
+G1 X0.1617 Y23.2088 S0.5 F2400
+G1 X0.1708 Y23.1596 S0.5 F2400
+G1 X0.1801 Y23.1105 S0.5 F2400
+G1 X0.1897 Y23.0614 S0.5 F2400
+G1 X0.1995 Y23.0123 S0.5 F2400
+G1 X0.2096 Y22.9633 S0.5 F2400
+G1 X0.2199 Y22.9144 S0.5 F2400
+G1 X0.2305 Y22.8655 S0.5 F2400
+G1 X0.2413 Y22.8166 S0.5 F2400
+G1 X0.2523 Y22.7678 S0.5 F2400
+G1 X0.2636 Y22.7191 S0.5 F2400
+G1 X0.2751 Y22.6704 S0.5 F2400
+G1 X0.2869 Y22.6218 S0.5 F2400
+G1 X0.2989 Y22.5732 S0.5 F2400
+G1 X0.3112 Y22.5247 S0.5 F2400
+G1 X0.3237 Y22.4763 S0.5 F2400
+G1 X0.3364 Y22.4279 S0.5 F2400
+G1 X0.3494 Y22.3796 S0.5 F2400
+G1 X0.3627 Y22.3314 S0.5 F2400
+G1 X0.3761 Y22.2832 S0.5 F2400
+G1 X0.3898 Y22.2351 S0.5 F2400
+G1 X0.4038 Y22.1870 S0.5 F2400
+G1 X0.4180 Y22.1391 S0.5 F2400
+G1 X0.4324 Y22.0912 S0.5 F2400
+G1 X0.4471 Y22.0433 S0.5 F2400
+G1 X0.4620 Y21.9956 S0.5 F2400
+G1 X0.4771 Y21.9479 S0.5 F2400
+G1 X0.4925 Y21.9003 S0.5 F2400
+G1 X0.5082 Y21.8528 S0.5 F2400
+G1 X0.5240 Y21.8054 S0.5 F2400
+G1 X0.5401 Y21.7580 S0.5 F2400
+G1 X0.5565 Y21.7107 S0.5 F2400
+G1 X0.5730 Y21.6635 S0.5 F2400
+G1 X0.5898 Y21.6164 S0.5 F2400
+G1 X0.6069 Y21.5694 S0.5 F2400
+G1 X0.6242 Y21.5224 S0.5 F2400
+G1 X0.6417 Y21.4755 S0.5 F2400
+G1 X0.6594 Y21.4288 S0.5 F2400
+G1 X0.6774 Y21.3821 S0.5 F2400
+G1 X0.6956 Y21.3355 S0.5 F2400
+G1 X0.7141 Y21.2890 S0.5 F2400
+G1 X0.7327 Y21.2426 S0.5 F2400
+G1 X0.7517 Y21.1963 S0.5 F2400
+G1 X0.7708 Y21.1501 S0.5 F2400
+G1 X0.7902 Y21.1039 S0.5 F2400
+G1 X0.8098 Y21.0579 S0.5 F2400
+G1 X0.8296 Y21.0120 S0.5 F2400
+G1 X0.8497 Y20.9662 S0.5 F2400
+G1 X0.8700 Y20.9205 S0.5 F2400
+G1 X0.8905 Y20.8748 S0.5 F2400
+G1 X0.9113 Y20.8293 S0.5 F2400
+G1 X0.9322 Y20.7839 S0.5 F2400
+G1 X0.9534 Y20.7386 S0.5 F2400
+G1 X0.9749 Y20.6934 S0.5 F2400
+G1 X0.9965 Y20.6483 S0.5 F2400
+G1 X1.0184 Y20.6033 S0.5 F2400
+G1 X1.0405 Y20.5584 S0.5 F2400
+G1 X1.0628 Y20.5137 S0.5 F2400
+G1 X1.0854 Y20.4690 S0.5 F2400
+G1 X1.1082 Y20.4245 S0.5 F2400
+G1 X1.1312 Y20.3800 S0.5 F2400
+G1 X1.1544 Y20.3357 S0.5 F2400
+G1 X1.1778 Y20.2915 S0.5 F2400
+G1 X1.2015 Y20.2475 S0.5 F2400
+G1 X1.2254 Y20.2035 S0.5 F2400
+G1 X1.2495 Y20.1597 S0.5 F2400
+G1 X1.2738 Y20.1160 S0.5 F2400
+G1 X1.2984 Y20.0724 S0.5 F2400
+G1 X1.3231 Y20.0289 S0.5 F2400
+G1 X1.3481 Y19.9856 S0.5 F2400
+G1 X1.3733 Y19.9423 S0.5 F2400
+G1 X1.3987 Y19.8993 S0.5 F2400
+G1 X1.4243 Y19.8563 S0.5 F2400
+G1 X1.4502 Y19.8135 S0.5 F2400
+G1 X1.4762 Y19.7707 S0.5 F2400
+G1 X1.5025 Y19.7282 S0.5 F2400
+G1 X1.5290 Y19.6857 S0.5 F2400
+G1 X1.5556 Y19.6434 S0.5 F2400
+G1 X1.5826 Y19.6012 S0.5 F2400
+G1 X1.6097 Y19.5592 S0.5 F2400
+G1 X1.6370 Y19.5173 S0.5 F2400
+G1 X1.6645 Y19.4755 S0.5 F2400
+G1 X1.6923 Y19.4339 S0.5 F2400
+G1 X1.7202 Y19.3924 S0.5 F2400
+G1 X1.7484 Y19.3511 S0.5 F2400
+G1 X1.7767 Y19.3099 S0.5 F2400
+G1 X1.8053 Y19.2688 S0.5 F2400
+G1 X1.8341 Y19.2279 S0.5 F2400
+G1 X1.8630 Y19.1871 S0.5 F2400
+G1 X1.8922 Y19.1465 S0.5 F2400
+G1 X1.9216 Y19.1060 S0.5 F2400
+G1 X1.9512 Y19.0656 S0.5 F2400
+G1 X1.9810 Y19.0254 S0.5 F2400
+G1 X2.0110 Y18.9854 S0.5 F2400
+G1 X2.0412 Y18.9455 S0.5 F2400
+G1 X2.0715 Y18.9058 S0.5 F2400
+G1 X2.1021 Y18.8662 S0.5 F2400
+G1 X2.1329 Y18.8268 S0.5 F2400
+G1 X2.1639 Y18.7875 S0.5 F2400
+G1 X2.1951 Y18.7484 S0.5 F2400
+G1 X2.2264 Y18.7094 S0.5 F2400
+G1 X2.2580 Y18.6706 S0.5 F2400
+G1 X2.2898 Y18.6319 S0.5 F2400
+G1 X2.3217 Y18.5934 S0.5 F2400
+G1 X2.3539 Y18.5551 S0.5 F2400
+G1 X2.3862 Y18.5169 S0.5 F2400
+G1 X2.4187 Y18.4789 S0.5 F2400
+G1 X2.4514 Y18.4411 S0.5 F2400
+G1 X2.4844 Y18.4034 S0.5 F2400
+G1 X2.5174 Y18.3659 S0.5 F2400
+G1 X2.5507 Y18.3285 S0.5 F2400
+G1 X2.5842 Y18.2914 S0.5 F2400
+G1 X2.6178 Y18.2543 S0.5 F2400
+G1 X2.6517 Y18.2175 S0.5 F2400
+G1 X2.6857 Y18.1808 S0.5 F2400
+G1 X2.7199 Y18.1443 S0.5 F2400
+G1 X2.7543 Y18.1080 S0.5 F2400
+G1 X2.7889 Y18.0718 S0.5 F2400
+G1 X2.8236 Y18.0358 S0.5 F2400
+G1 X2.8585 Y18.0000 S0.5 F2400
+G1 X2.8936 Y17.9644 S0.5 F2400
+G1 X2.9289 Y17.9289 S0.5 F2400
+G1 X2.9644 Y17.8936 S0.5 F2400
+G1 X3.0000 Y17.8585 S0.5 F2400
+G1 X3.0358 Y17.8236 S0.5 F2400
+G1 X3.0718 Y17.7889 S0.5 F2400
+G1 X3.1080 Y17.7543 S0.5 F2400
+G1 X3.1443 Y17.7199 S0.5 F2400
+G1 X3.1808 Y17.6857 S0.5 F2400
+G1 X3.2175 Y17.6517 S0.5 F2400
+G1 X3.2543 Y17.6178 S0.5 F2400
+G1 X3.2914 Y17.5842 S0.5 F2400
+G1 X3.3285 Y17.5507 S0.5 F2400
+G1 X3.3659 Y17.5174 S0.5 F2400
+G1 X3.4034 Y17.4844 S0.5 F2400
+G1 X3.4411 Y17.4514 S0.5 F2400
+G1 X3.4789 Y17.4187 S0.5 F2400
+G1 X3.5169 Y17.3862 S0.5 F2400
+G1 X3.5551 Y17.3539 S0.5 F2400
+G1 X3.5934 Y17.3217 S0.5 F2400
+G1 X3.6319 Y17.2898 S0.5 F2400
+G1 X3.6706 Y17.2580 S0.5 F2400
+G1 X3.7094 Y17.2264 S0.5 F2400
+G1 X3.7484 Y17.1951 S0.5 F2400
+G1 X3.7875 Y17.1639 S0.5 F2400
+G1 X3.8268 Y17.1329 S0.5 F2400
+G1 X3.8662 Y17.1021 S0.5 F2400
+G1 X3.9058 Y17.0715 S0.5 F2400
+G1 X3.9455 Y17.0412 S0.5 F2400
+G1 X3.9854 Y17.0110 S0.5 F2400
+G1 X4.0254 Y16.9810 S0.5 F2400
+G1 X4.0656 Y16.9512 S0.5 F2400
+G1 X4.1060 Y16.9216 S0.5 F2400
+G1 X4.1465 Y16.8922 S0.5 F2400
+G1 X4.1871 Y16.8630 S0.5 F2400
+G1 X4.2279 Y16.8341 S0.5 F2400
+G1 X4.2688 Y16.8053 S0.5 F2400
+G1 X4.3099 Y16.7767 S0.5 F2400
+G1 X4.3511 Y16.7484 S0.5 F2400
+G1 X4.3924 Y16.7202 S0.5 F2400
+G1 X4.4339 Y16.6923 S0.5 F2400
+G1 X4.4755 Y16.6645 S0.5 F2400
+G1 X4.5173 Y16.6370 S0.5 F2400
+G1 X4.5592 Y16.6097 S0.5 F2400
+G1 X4.6012 Y16.5826 S0.5 F2400
+G1 X4.6434 Y16.5556 S0.5 F2400
+G1 X4.6857 Y16.5290 S0.5 F2400
+G1 X4.7282 Y16.5025 S0.5 F2400
+G1 X4.7707 Y16.4762 S0.5 F2400
+G1 X4.8135 Y16.4502 S0.5 F2400
+G1 X4.8563 Y16.4243 S0.5 F2400
+G1 X4.8993 Y16.3987 S0.5 F2400
+G1 X4.9423 Y16.3733 S0.5 F2400
+G1 X4.9856 Y16.3481 S0.5 F2400
+G1 X5.0289 Y16.3231 S0.5 F2400
+G1 X5.0724 Y16.2984 S0.5 F2400
+G1 X5.1160 Y16.2738 S0.5 F2400
+G1 X5.1597 Y16.2495 S0.5 F2400
+G1 X5.2035 Y16.2254 S0.5 F2400
+G1 X5.2475 Y16.2015 S0.5 F2400
+G1 X5.2915 Y16.1778 S0.5 F2400
+G1 X5.3357 Y16.1544 S0.5 F2400
+G1 X5.3800 Y16.1312 S0.5 F2400
+G1 X5.4245 Y16.1082 S0.5 F2400
+G1 X5.4690 Y16.0854 S0.5 F2400
+G1 X5.5137 Y16.0628 S0.5 F2400
+G1 X5.5584 Y16.0405 S0.5 F2400
+G1 X5.6033 Y16.0184 S0.5 F2400
+G1 X5.6483 Y15.9965 S0.5 F2400
+G1 X5.6934 Y15.9749 S0.5 F2400
+G1 X5.7386 Y15.9534 S0.5 F2400
+G1 X5.7839 Y15.9322 S0.5 F2400
+G1 X5.8293 Y15.9113 S0.5 F2400
+G1 X5.8748 Y15.8905 S0.5 F2400
+G1 X5.9205 Y15.8700 S0.5 F2400
+G1 X5.9662 Y15.8497 S0.5 F2400
+G1 X6.0120 Y15.8296 S0.5 F2400
+G1 X6.0579 Y15.8098 S0.5 F2400
+G1 X6.1039 Y15.7902 S0.5 F2400
+G1 X6.1501 Y15.7708 S0.5 F2400
+G1 X6.1963 Y15.7517 S0.5 F2400
+G1 X6.2426 Y15.7327 S0.5 F2400
+G1 X6.2890 Y15.7141 S0.5 F2400
+G1 X6.3355 Y15.6956 S0.5 F2400
+G1 X6.3821 Y15.6774 S0.5 F2400
+G1 X6.4288 Y15.6594 S0.5 F2400
+G1 X6.4755 Y15.6417 S0.5 F2400
+G1 X6.5224 Y15.6242 S0.5 F2400
+G1 X6.5694 Y15.6069 S0.5 F2400
+G1 X6.6164 Y15.5898 S0.5 F2400
+G1 X6.6635 Y15.5730 S0.5 F2400
+G1 X6.7107 Y15.5565 S0.5 F2400
+G1 X6.7580 Y15.5401 S0.5 F2400
+G1 X6.8054 Y15.5240 S0.5 F2400
+G1 X6.8528 Y15.5082 S0.5 F2400
+G1 X6.9003 Y15.4925 S0.5 F2400
+G1 X6.9479 Y15.4771 S0.5 F2400
+G1 X6.9956 Y15.4620 S0.5 F2400
+G1 X7.0433 Y15.4471 S0.5 F2400
+G1 X7.0912 Y15.4324 S0.5 F2400
+G1 X7.1391 Y15.4180 S0.5 F2400
+G1 X7.1870 Y15.4038 S0.5 F2400
+G1 X7.2351 Y15.3898 S0.5 F2400
+G1 X7.2832 Y15.3761 S0.5 F2400
+G1 X7.3314 Y15.3627 S0.5 F2400
+G1 X7.3796 Y15.3494 S0.5 F2400
+G1 X7.4279 Y15.3364 S0.5 F2400
+G1 X7.4763 Y15.3237 S0.5 F2400
+G1 X7.5247 Y15.3112 S0.5 F2400
+G1 X7.5732 Y15.2989 S0.5 F2400
+G1 X7.6218 Y15.2869 S0.5 F2400
+G1 X7.6704 Y15.2751 S0.5 F2400
+G1 X7.7191 Y15.2636 S0.5 F2400
+G1 X7.7678 Y15.2523 S0.5 F2400
+G1 X7.8166 Y15.2413 S0.5 F2400
+G1 X7.8655 Y15.2305 S0.5 F2400
+G1 X7.9144 Y15.2199 S0.5 F2400
+G1 X7.9633 Y15.2096 S0.5 F2400
+G1 X8.0123 Y15.1995 S0.5 F2400
+G1 X8.0614 Y15.1897 S0.5 F2400
+G1 X8.1105 Y15.1801 S0.5 F2400
+G1 X8.1596 Y15.1708 S0.5 F2400
+G1 X8.2088 Y15.1617 S0.5 F2400
+G1 X8.2580 Y15.1529 S0.5 F2400
+G1 X8.3073 Y15.1443 S0.5 F2400
+G1 X8.3567 Y15.1360 S0.5 F2400
+G1 X8.4060 Y15.1279 S0.5 F2400
+G1 X8.4554 Y15.1200 S0.5 F2400
+G1 X8.5049 Y15.1124 S0.5 F2400
+G1 X8.5543 Y15.1050 S0.5 F2400
+G1 X8.6039 Y15.0979 S0.5 F2400
+G1 X8.6534 Y15.0911 S0.5 F2400
+G1 X8.7030 Y15.0845 S0.5 F2400
+G1 X8.7526 Y15.0781 S0.5 F2400
+G1 X8.8023 Y15.0720 S0.5 F2400
+G1 X8.8520 Y15.0661 S0.5 F2400
+G1 X8.9017 Y15.0605 S0.5 F2400
+G1 X8.9514 Y15.0551 S0.5 F2400
+G1 X9.0012 Y15.0500 S0.5 F2400
+G1 X9.0509 Y15.0451 S0.5 F2400
+G1 X9.1008 Y15.0405 S0.5 F2400
+G1 X9.1506 Y15.0361 S0.5 F2400
+G1 X9.2004 Y15.0320 S0.5 F2400
+G1 X9.2503 Y15.0281 S0.5 F2400
+G1 X9.3002 Y15.0245 S0.5 F2400
+G1 X9.3501 Y15.0211 S0.5 F2400
+G1 X9.4001 Y15.0180 S0.5 F2400
+G1 X9.4500 Y15.0151 S0.5 F2400
+G1 X9.5000 Y15.0125 S0.5 F2400
+G1 X9.5499 Y15.0101 S0.5 F2400
+G1 X9.5999 Y15.0080 S0.5 F2400
+G1 X9.6499 Y15.0061 S0.5 F2400
+G1 X9.6999 Y15.0045 S0.5 F2400
+G1 X9.7499 Y15.0031 S0.5 F2400
+G1 X9.7999 Y15.0020 S0.5 F2400
+G1 X9.8499 Y15.0011 S0.5 F2400
+G1 X9.9000 Y15.0005 S0.5 F2400
+G1 X9.9500 Y15.0001 S0.5 F2400
+G1 X10.0000 Y15.0000 S0.5 F2400
+G1 X10.0500 Y15.0001 S0.5 F2400
+G1 X10.1000 Y15.0005 S0.5 F2400
+G1 X10.1501 Y15.0011 S0.5 F2400
+G1 X10.2001 Y15.0020 S0.5 F2400
+G1 X10.2501 Y15.0031 S0.5 F2400
+G1 X10.3001 Y15.0045 S0.5 F2400
+G1 X10.3501 Y15.0061 S0.5 F2400
+G1 X10.4001 Y15.0080 S0.5 F2400
+G1 X10.4501 Y15.0101 S0.5 F2400
+G1 X10.5000 Y15.0125 S0.5 F2400
+G1 X10.5500 Y15.0151 S0.5 F2400
+G1 X10.5999 Y15.0180 S0.5 F2400
+G1 X10.6499 Y15.0211 S0.5 F2400
+G1 X10.6998 Y15.0245 S0.5 F2400
+G1 X10.7497 Y15.0281 S0.5 F2400
+G1 X10.7996 Y15.0320 S0.5 F2400
+G1 X10.8494 Y15.0361 S0.5 F2400
+G1 X10.8992 Y15.0405 S0.5 F2400
+G1 X10.9491 Y15.0451 S0.5 F2400
+G1 X10.9988 Y15.0500 S0.5 F2400
+G1 X11.0486 Y15.0551 S0.5 F2400
+G1 X11.0983 Y15.0605 S0.5 F2400
+G1 X11.1480 Y15.0661 S0.5 F2400
+G1 X11.1977 Y15.0720 S0.5 F2400
+G1 X11.2474 Y15.0781 S0.5 F2400
+G1 X11.2970 Y15.0845 S0.5 F2400
+G1 X11.3466 Y15.0911 S0.5 F2400
+G1 X11.3961 Y15.0979 S0.5 F2400
+G1 X11.4457 Y15.1050 S0.5 F2400
+G1 X11.4951 Y15.1124 S0.5 F2400
+G1 X11.5446 Y15.1200 S0.5 F2400
+G1 X11.5940 Y15.1279 S0.5 F2400
+G1 X11.6433 Y15.1360 S0.5 F2400
+G1 X11.6927 Y15.1443 S0.5 F2400
+G1 X11.7420 Y15.1529 S0.5 F2400
+G1 X11.7912 Y15.1617 S0.5 F2400
+G1 X11.8404 Y15.1708 S0.5 F2400
+G1 X11.8895 Y15.1801 S0.5 F2400
+G1 X11.9386 Y15.1897 S0.5 F2400
+G1 X11.9877 Y15.1995 S0.5 F2400
+G1 X12.0367 Y15.2096 S0.5 F2400
+G1 X12.0856 Y15.2199 S0.5 F2400
+G1 X12.1345 Y15.2305 S0.5 F2400
+G1 X12.1834 Y15.2413 S0.5 F2400
+G1 X12.2322 Y15.2523 S0.5 F2400
+G1 X12.2809 Y15.2636 S0.5 F2400
+G1 X12.3296 Y15.2751 S0.5 F2400
+G1 X12.3782 Y15.2869 S0.5 F2400
+G1 X12.4268 Y15.2989 S0.5 F2400
+G1 X12.4753 Y15.3112 S0.5 F2400
+G1 X12.5237 Y15.3237 S0.5 F2400
+G1 X12.5721 Y15.3364 S0.5 F2400
+G1 X12.6204 Y15.3494 S0.5 F2400
+G1 X12.6686 Y15.3627 S0.5 F2400
+G1 X12.7168 Y15.3761 S0.5 F2400
+G1 X12.7649 Y15.3898 S0.5 F2400
+G1 X12.8130 Y15.4038 S0.5 F2400
+G1 X12.8609 Y15.4180 S0.5 F2400
+G1 X12.9088 Y15.4324 S0.5 F2400
+G1 X12.9567 Y15.4471 S0.5 F2400
+G1 X13.0044 Y15.4620 S0.5 F2400
+G1 X13.0521 Y15.4771 S0.5 F2400
+G1 X13.0997 Y15.4925 S0.5 F2400
+G1 X13.1472 Y15.5082 S0.5 F2400
+G1 X13.1946 Y15.5240 S0.5 F2400
+G1 X13.2420 Y15.5401 S0.5 F2400
+G1 X13.2893 Y15.5565 S0.5 F2400
+G1 X13.3365 Y15.5730 S0.5 F2400
+G1 X13.3836 Y15.5898 S0.5 F2400
+G1 X13.4306 Y15.6069 S0.5 F2400
+G1 X13.4776 Y15.6242 S0.5 F2400
+G1 X13.5245 Y15.6417 S0.5 F2400
+G1 X13.5712 Y15.6594 S0.5 F2400
+G1 X13.6179 Y15.6774 S0.5 F2400
+G1 X13.6645 Y15.6956 S0.5 F2400
+G1 X13.7110 Y15.7141 S0.5 F2400
+G1 X13.7574 Y15.7327 S0.5 F2400
+G1 X13.8037 Y15.7517 S0.5 F2400
+G1 X13.8499 Y15.7708 S0.5 F2400
+G1 X13.8961 Y15.7902 S0.5 F2400
+G1 X13.9421 Y15.8098 S0.5 F2400
+G1 X13.9880 Y15.8296 S0.5 F2400
+G1 X14.0338 Y15.8497 S0.5 F2400
+G1 X14.0795 Y15.8700 S0.5 F2400
+G1 X14.1252 Y15.8905 S0.5 F2400
+G1 X14.1707 Y15.9113 S0.5 F2400
+G1 X14.2161 Y15.9322 S0.5 F2400
+G1 X14.2614 Y15.9534 S0.5 F2400
+G1 X14.3066 Y15.9749 S0.5 F2400
+G1 X14.3517 Y15.9965 S0.5 F2400
+G1 X14.3967 Y16.0184 S0.5 F2400
+G1 X14.4416 Y16.0405 S0.5 F2400
+G1 X14.4863 Y16.0628 S0.5 F2400
+G1 X14.5310 Y16.0854 S0.5 F2400
+G1 X14.5755 Y16.1082 S0.5 F2400
+G1 X14.6200 Y16.1312 S0.5 F2400
+G1 X14.6643 Y16.1544 S0.5 F2400
+G1 X14.7085 Y16.1778 S0.5 F2400
+G1 X14.7525 Y16.2015 S0.5 F2400
+G1 X14.7965 Y16.2254 S0.5 F2400
+G1 X14.8403 Y16.2495 S0.5 F2400
+G1 X14.8840 Y16.2738 S0.5 F2400
+G1 X14.9276 Y16.2984 S0.5 F2400
+G1 X14.9711 Y16.3231 S0.5 F2400
+G1 X15.0144 Y16.3481 S0.5 F2400
+G1 X15.0577 Y16.3733 S0.5 F2400
+G1 X15.1007 Y16.3987 S0.5 F2400
+G1 X15.1437 Y16.4243 S0.5 F2400
+G1 X15.1865 Y16.4502 S0.5 F2400
+G1 X15.2293 Y16.4762 S0.5 F2400
+G1 X15.2718 Y16.5025 S0.5 F2400
+G1 X15.3143 Y16.5290 S0.5 F2400
+G1 X15.3566 Y16.5556 S0.5 F2400
+G1 X15.3988 Y16.5826 S0.5 F2400
+G1 X15.4408 Y16.6097 S0.5 F2400
+G1 X15.4827 Y16.6370 S0.5 F2400
+G1 X15.5245 Y16.6645 S0.5 F2400
+G1 X15.5661 Y16.6923 S0.5 F2400
+G1 X15.6076 Y16.7202 S0.5 F2400
+G1 X15.6489 Y16.7484 S0.5 F2400
+G1 X15.6901 Y16.7767 S0.5 F2400
+G1 X15.7312 Y16.8053 S0.5 F2400
+G1 X15.7721 Y16.8341 S0.5 F2400
+G1 X15.8129 Y16.8630 S0.5 F2400
+G1 X15.8535 Y16.8922 S0.5 F2400
+G1 X15.8940 Y16.9216 S0.5 F2400
+G1 X15.9344 Y16.9512 S0.5 F2400
+G1 X15.9746 Y16.9810 S0.5 F2400
+G1 X16.0146 Y17.0110 S0.5 F2400
+G1 X16.0545 Y17.0412 S0.5 F2400
+G1 X16.0942 Y17.0715 S0.5 F2400
+G1 X16.1338 Y17.1021 S0.5 F2400
+G1 X16.1732 Y17.1329 S0.5 F2400
+G1 X16.2125 Y17.1639 S0.5 F2400
+G1 X16.2516 Y17.1951 S0.5 F2400
+G1 X16.2906 Y17.2264 S0.5 F2400
+G1 X16.3294 Y17.2580 S0.5 F2400
+G1 X16.3681 Y17.2898 S0.5 F2400
+G1 X16.4066 Y17.3217 S0.5 F2400
+G1 X16.4449 Y17.3539 S0.5 F2400
+G1 X16.4831 Y17.3862 S0.5 F2400
+G1 X16.5211 Y17.4187 S0.5 F2400
+G1 X16.5589 Y17.4514 S0.5 F2400
+G1 X16.5966 Y17.4844 S0.5 F2400
+G1 X16.6341 Y17.5174 S0.5 F2400
+G1 X16.6715 Y17.5507 S0.5 F2400
+G1 X16.7086 Y17.5842 S0.5 F2400
+G1 X16.7457 Y17.6178 S0.5 F2400
+G1 X16.7825 Y17.6517 S0.5 F2400
+G1 X16.8192 Y17.6857 S0.5 F2400
+G1 X16.8557 Y17.7199 S0.5 F2400
+G1 X16.8920 Y17.7543 S0.5 F2400
+G1 X16.9282 Y17.7889 S0.5 F2400
+G1 X16.9642 Y17.8236 S0.5 F2400
+G1 X17.0000 Y17.8585 S0.5 F2400
+G1 X17.0356 Y17.8936 S0.5 F2400
+G1 X17.0711 Y17.9289 S0.5 F2400
+G1 X17.1064 Y17.9644 S0.5 F2400
+G1 X17.1415 Y18.0000 S0.5 F2400
+G1 X17.1764 Y18.0358 S0.5 F2400
+G1 X17.2111 Y18.0718 S0.5 F2400
+G1 X17.2457 Y18.1080 S0.5 F2400
+G1 X17.2801 Y18.1443 S0.5 F2400
+G1 X17.3143 Y18.1808 S0.5 F2400
+G1 X17.3483 Y18.2175 S0.5 F2400
+G1 X17.3822 Y18.2543 S0.5 F2400
+G1 X17.4158 Y18.2914 S0.5 F2400
+G1 X17.4493 Y18.3285 S0.5 F2400
+G1 X17.4826 Y18.3659 S0.5 F2400
+G1 X17.5156 Y18.4034 S0.5 F2400
+G1 X17.5486 Y18.4411 S0.5 F2400
+G1 X17.5813 Y18.4789 S0.5 F2400
+G1 X17.6138 Y18.5169 S0.5 F2400
+G1 X17.6461 Y18.5551 S0.5 F2400
+G1 X17.6783 Y18.5934 S0.5 F2400
+G1 X17.7102 Y18.6319 S0.5 F2400
+G1 X17.7420 Y18.6706 S0.5 F2400
+G1 X17.7736 Y18.7094 S0.5 F2400
+G1 X17.8049 Y18.7484 S0.5 F2400
+G1 X17.8361 Y18.7875 S0.5 F2400
+G1 X17.8671 Y18.8268 S0.5 F2400
+G1 X17.8979 Y18.8662 S0.5 F2400
+G1 X17.9285 Y18.9058 S0.5 F2400
+G1 X17.9588 Y18.9455 S0.5 F2400
+G1 X17.9890 Y18.9854 S0.5 F2400
+G1 X18.0190 Y19.0254 S0.5 F2400
+G1 X18.0488 Y19.0656 S0.5 F2400
+G1 X18.0784 Y19.1060 S0.5 F2400
+G1 X18.1078 Y19.1465 S0.5 F2400
+G1 X18.1370 Y19.1871 S0.5 F2400
+G1 X18.1659 Y19.2279 S0.5 F2400
+G1 X18.1947 Y19.2688 S0.5 F2400
+G1 X18.2233 Y19.3099 S0.5 F2400
+G1 X18.2516 Y19.3511 S0.5 F2400
+G1 X18.2798 Y19.3924 S0.5 F2400
+G1 X18.3077 Y19.4339 S0.5 F2400
+G1 X18.3355 Y19.4755 S0.5 F2400
+G1 X18.3630 Y19.5173 S0.5 F2400
+G1 X18.3903 Y19.5592 S0.5 F2400
+G1 X18.4174 Y19.6012 S0.5 F2400
+G1 X18.4444 Y19.6434 S0.5 F2400
+G1 X18.4710 Y19.6857 S0.5 F2400
+G1 X18.4975 Y19.7282 S0.5 F2400
+G1 X18.5238 Y19.7707 S0.5 F2400
+G1 X18.5498 Y19.8135 S0.5 F2400
+G1 X18.5757 Y19.8563 S0.5 F2400
+G1 X18.6013 Y19.8993 S0.5 F2400
+G1 X18.6267 Y19.9423 S0.5 F2400
+G1 X18.6519 Y19.9856 S0.5 F2400
+G1 X18.6769 Y20.0289 S0.5 F2400
+G1 X18.7016 Y20.0724 S0.5 F2400
+G1 X18.7262 Y20.1160 S0.5 F2400
+G1 X18.7505 Y20.1597 S0.5 F2400
+G1 X18.7746 Y20.2035 S0.5 F2400
+G1 X18.7985 Y20.2475 S0.5 F2400
+G1 X18.8222 Y20.2915 S0.5 F2400
+G1 X18.8456 Y20.3357 S0.5 F2400
+G1 X18.8688 Y20.3800 S0.5 F2400
+G1 X18.8918 Y20.4245 S0.5 F2400
+G1 X18.9146 Y20.4690 S0.5 F2400
+G1 X18.9372 Y20.5137 S0.5 F2400
+G1 X18.9595 Y20.5584 S0.5 F2400
+G1 X18.9816 Y20.6033 S0.5 F2400
+G1 X19.0035 Y20.6483 S0.5 F2400
+G1 X19.0251 Y20.6934 S0.5 F2400
+G1 X19.0466 Y20.7386 S0.5 F2400
+G1 X19.0678 Y20.7839 S0.5 F2400
+G1 X19.0887 Y20.8293 S0.5 F2400
+G1 X19.1095 Y20.8748 S0.5 F2400
+G1 X19.1300 Y20.9205 S0.5 F2400
+G1 X19.1503 Y20.9662 S0.5 F2400
+G1 X19.1704 Y21.0120 S0.5 F2400
+G1 X19.1902 Y21.0579 S0.5 F2400
+G1 X19.2098 Y21.1039 S0.5 F2400
+G1 X19.2292 Y21.1501 S0.5 F2400
+G1 X19.2483 Y21.1963 S0.5 F2400
+G1 X19.2673 Y21.2426 S0.5 F2400
+G1 X19.2859 Y21.2890 S0.5 F2400
+G1 X19.3044 Y21.3355 S0.5 F2400
+G1 X19.3226 Y21.3821 S0.5 F2400
+G1 X19.3406 Y21.4288 S0.5 F2400
+G1 X19.3583 Y21.4755 S0.5 F2400
+G1 X19.3758 Y21.5224 S0.5 F2400
+G1 X19.3931 Y21.5694 S0.5 F2400
+G1 X19.4102 Y21.6164 S0.5 F2400
+G1 X19.4270 Y21.6635 S0.5 F2400
+G1 X19.4435 Y21.7107 S0.5 F2400
+G1 X19.4599 Y21.7580 S0.5 F2400
+G1 X19.4760 Y21.8054 S0.5 F2400
+G1 X19.4918 Y21.8528 S0.5 F2400
+G1 X19.5075 Y21.9003 S0.5 F2400
+G1 X19.5229 Y21.9479 S0.5 F2400
+G1 X19.5380 Y21.9956 S0.5 F2400
+G1 X19.5529 Y22.0433 S0.5 F2400
+G1 X19.5676 Y22.0912 S0.5 F2400
+G1 X19.5820 Y22.1391 S0.5 F2400
+G1 X19.5962 Y22.1870 S0.5 F2400
+G1 X19.6102 Y22.2351 S0.5 F2400
+G1 X19.6239 Y22.2832 S0.5 F2400
+G1 X19.6373 Y22.3314 S0.5 F2400
+G1 X19.6506 Y22.3796 S0.5 F2400
+G1 X19.6636 Y22.4279 S0.5 F2400
+G1 X19.6763 Y22.4763 S0.5 F2400
+G1 X19.6888 Y22.5247 S0.5 F2400
+G1 X19.7011 Y22.5732 S0.5 F2400
+G1 X19.7131 Y22.6218 S0.5 F2400
+G1 X19.7249 Y22.6704 S0.5 F2400
+G1 X19.7364 Y22.7191 S0.5 F2400
+G1 X19.7477 Y22.7678 S0.5 F2400
+G1 X19.7587 Y22.8166 S0.5 F2400
+G1 X19.7695 Y22.8655 S0.5 F2400
+G1 X19.7801 Y22.9144 S0.5 F2400
+G1 X19.7904 Y22.9633 S0.5 F2400
+G1 X19.8005 Y23.0123 S0.5 F2400
+G1 X19.8103 Y23.0614 S0.5 F2400
+G1 X19.8199 Y23.1105 S0.5 F2400
+G1 X19.8292 Y23.1596 S0.5 F2400
+G1 X19.8383 Y23.2088 S0.5 F2400
+G1 X19.8471 Y23.2580 S0.5 F2400
+G1 X19.8557 Y23.3073 S0.5 F2400
+G1 X19.8640 Y23.3567 S0.5 F2400
+G1 X19.8721 Y23.4060 S0.5 F2400
+G1 X19.8800 Y23.4554 S0.5 F2400
+G1 X19.8876 Y23.5049 S0.5 F2400
+G1 X19.8950 Y23.5543 S0.5 F2400
+G1 X19.9021 Y23.6039 S0.5 F2400
+G1 X19.9089 Y23.6534 S0.5 F2400
+G1 X19.9155 Y23.7030 S0.5 F2400
+G1 X19.9219 Y23.7526 S0.5 F2400
+G1 X19.9280 Y23.8023 S0.5 F2400
+G1 X19.9339 Y23.8520 S0.5 F2400
+G1 X19.9395 Y23.9017 S0.5 F2400
+G1 X19.9449 Y23.9514 S0.5 F2400
+G1 X19.9500 Y24.0012 S0.5 F2400
+G1 X19.9549 Y24.0509 S0.5 F2400
+G1 X19.9595 Y24.1008 S0.5 F2400
+G1 X19.9639 Y24.1506 S0.5 F2400
+G1 X19.9680 Y24.2004 S0.5 F2400
+G1 X19.9719 Y24.2503 S0.5 F2400
+G1 X19.9755 Y24.3002 S0.5 F2400
+G1 X19.9789 Y24.3501 S0.5 F2400
+G1 X19.9820 Y24.4001 S0.5 F2400
+G1 X19.9849 Y24.4500 S0.5 F2400
+G1 X19.9875 Y24.5000 S0.5 F2400
+G1 X19.9899 Y24.5499 S0.5 F2400
+G1 X19.9920 Y24.5999 S0.5 F2400
+G1 X19.9939 Y24.6499 S0.5 F2400
+G1 X19.9955 Y24.6999 S0.5 F2400
+G1 X19.9969 Y24.7499 S0.5 F2400
+G1 X19.9980 Y24.7999 S0.5 F2400
+G1 X19.9989 Y24.8499 S0.5 F2400
+G1 X19.9995 Y24.9000 S0.5 F2400
+G1 X19.9999 Y24.9500 S0.5 F2400
+G1 X20.0000 Y25.0000 S0.5 F2400
+M5
+G0 X0 Y0
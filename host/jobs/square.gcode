@@ -0,0 +1,382 @@
+G21
+G90
+G0 X0 Y0 Z1 F6000
+G1 Z0 F300
+G1 X20 Y0 F3000
+G1 X20 Y20
+G1 X0 Y20
+G1 X0 Y0
+G1 X25 Y0 F3000
+G1 X25 Y25
+G1 X0 Y25
+G1 X0 Y0
+G1 X30 Y0 F3000
+G1 X30 Y30
+G1 X0 Y30
+G1 X0 Y0
+G1 X35 Y0 F3000
+G1 X35 Y35
+G1 X0 Y35
+G1 X0 Y0
+G1 X29.998 Y30.175 F2400
+G1 X29.994 Y30.349 F2400
+G1 X29.986 Y30.523 F2400
+G1 X29.976 Y30.698 F2400
+G1 X29.962 Y30.872 F2400
+G1 X29.945 Y31.045 F2400
+G1 X29.925 Y31.219 F2400
+G1 X29.903 Y31.392 F2400
+G1 X29.877 Y31.564 F2400
+G1 X29.848 Y31.736 F2400
+G1 X29.816 Y31.908 F2400
+G1 X29.781 Y32.079 F2400
+G1 X29.744 Y32.250 F2400
+G1 X29.703 Y32.419 F2400
+G1 X29.659 Y32.588 F2400
+G1 X29.613 Y32.756 F2400
+G1 X29.563 Y32.924 F2400
+G1 X29.511 Y33.090 F2400
+G1 X29.455 Y33.256 F2400
+G1 X29.397 Y33.420 F2400
+G1 X29.336 Y33.584 F2400
+G1 X29.272 Y33.746 F2400
+G1 X29.205 Y33.907 F2400
+G1 X29.135 Y34.067 F2400
+G1 X29.063 Y34.226 F2400
+G1 X28.988 Y34.384 F2400
+G1 X28.910 Y34.540 F2400
+G1 X28.829 Y34.695 F2400
+G1 X28.746 Y34.848 F2400
+G1 X28.660 Y35.000 F2400
+G1 X28.572 Y35.150 F2400
+G1 X28.480 Y35.299 F2400
+G1 X28.387 Y35.446 F2400
+G1 X28.290 Y35.592 F2400
+G1 X28.192 Y35.736 F2400
+G1 X28.090 Y35.878 F2400
+G1 X27.986 Y36.018 F2400
+G1 X27.880 Y36.157 F2400
+G1 X27.771 Y36.293 F2400
+G1 X27.660 Y36.428 F2400
+G1 X27.547 Y36.561 F2400
+G1 X27.431 Y36.691 F2400
+G1 X27.314 Y36.820 F2400
+G1 X27.193 Y36.947 F2400
+G1 X27.071 Y37.071 F2400
+G1 X26.947 Y37.193 F2400
+G1 X26.820 Y37.314 F2400
+G1 X26.691 Y37.431 F2400
+G1 X26.561 Y37.547 F2400
+G1 X26.428 Y37.660 F2400
+G1 X26.293 Y37.771 F2400
+G1 X26.157 Y37.880 F2400
+G1 X26.018 Y37.986 F2400
+G1 X25.878 Y38.090 F2400
+G1 X25.736 Y38.192 F2400
+G1 X25.592 Y38.290 F2400
+G1 X25.446 Y38.387 F2400
+G1 X25.299 Y38.480 F2400
+G1 X25.150 Y38.572 F2400
+G1 X25.000 Y38.660 F2400
+G1 X24.848 Y38.746 F2400
+G1 X24.695 Y38.829 F2400
+G1 X24.540 Y38.910 F2400
+G1 X24.384 Y38.988 F2400
+G1 X24.226 Y39.063 F2400
+G1 X24.067 Y39.135 F2400
+G1 X23.907 Y39.205 F2400
+G1 X23.746 Y39.272 F2400
+G1 X23.584 Y39.336 F2400
+G1 X23.420 Y39.397 F2400
+G1 X23.256 Y39.455 F2400
+G1 X23.090 Y39.511 F2400
+G1 X22.924 Y39.563 F2400
+G1 X22.756 Y39.613 F2400
+G1 X22.588 Y39.659 F2400
+G1 X22.419 Y39.703 F2400
+G1 X22.250 Y39.744 F2400
+G1 X22.079 Y39.781 F2400
+G1 X21.908 Y39.816 F2400
+G1 X21.736 Y39.848 F2400
+G1 X21.564 Y39.877 F2400
+G1 X21.392 Y39.903 F2400
+G1 X21.219 Y39.925 F2400
+G1 X21.045 Y39.945 F2400
+G1 X20.872 Y39.962 F2400
+G1 X20.698 Y39.976 F2400
+G1 X20.523 Y39.986 F2400
+G1 X20.349 Y39.994 F2400
+G1 X20.175 Y39.998 F2400
+G1 X20.000 Y40.000 F2400
+G1 X19.825 Y39.998 F2400
+G1 X19.651 Y39.994 F2400
+G1 X19.477 Y39.986 F2400
+G1 X19.302 Y39.976 F2400
+G1 X19.128 Y39.962 F2400
+G1 X18.955 Y39.945 F2400
+G1 X18.781 Y39.925 F2400
+G1 X18.608 Y39.903 F2400
+G1 X18.436 Y39.877 F2400
+G1 X18.264 Y39.848 F2400
+G1 X18.092 Y39.816 F2400
+G1 X17.921 Y39.781 F2400
+G1 X17.750 Y39.744 F2400
+G1 X17.581 Y39.703 F2400
+G1 X17.412 Y39.659 F2400
+G1 X17.244 Y39.613 F2400
+G1 X17.076 Y39.563 F2400
+G1 X16.910 Y39.511 F2400
+G1 X16.744 Y39.455 F2400
+G1 X16.580 Y39.397 F2400
+G1 X16.416 Y39.336 F2400
+G1 X16.254 Y39.272 F2400
+G1 X16.093 Y39.205 F2400
+G1 X15.933 Y39.135 F2400
+G1 X15.774 Y39.063 F2400
+G1 X15.616 Y38.988 F2400
+G1 X15.460 Y38.910 F2400
+G1 X15.305 Y38.829 F2400
+G1 X15.152 Y38.746 F2400
+G1 X15.000 Y38.660 F2400
+G1 X14.850 Y38.572 F2400
+G1 X14.701 Y38.480 F2400
+G1 X14.554 Y38.387 F2400
+G1 X14.408 Y38.290 F2400
+G1 X14.264 Y38.192 F2400
+G1 X14.122 Y38.090 F2400
+G1 X13.982 Y37.986 F2400
+G1 X13.843 Y37.880 F2400
+G1 X13.707 Y37.771 F2400
+G1 X13.572 Y37.660 F2400
+G1 X13.439 Y37.547 F2400
+G1 X13.309 Y37.431 F2400
+G1 X13.180 Y37.314 F2400
+G1 X13.053 Y37.193 F2400
+G1 X12.929 Y37.071 F2400
+G1 X12.807 Y36.947 F2400
+G1 X12.686 Y36.820 F2400
+G1 X12.569 Y36.691 F2400
+G1 X12.453 Y36.561 F2400
+G1 X12.340 Y36.428 F2400
+G1 X12.229 Y36.293 F2400
+G1 X12.120 Y36.157 F2400
+G1 X12.014 Y36.018 F2400
+G1 X11.910 Y35.878 F2400
+G1 X11.808 Y35.736 F2400
+G1 X11.710 Y35.592 F2400
+G1 X11.613 Y35.446 F2400
+G1 X11.520 Y35.299 F2400
+G1 X11.428 Y35.150 F2400
+G1 X11.340 Y35.000 F2400
+G1 X11.254 Y34.848 F2400
+G1 X11.171 Y34.695 F2400
+G1 X11.090 Y34.540 F2400
+G1 X11.012 Y34.384 F2400
+G1 X10.937 Y34.226 F2400
+G1 X10.865 Y34.067 F2400
+G1 X10.795 Y33.907 F2400
+G1 X10.728 Y33.746 F2400
+G1 X10.664 Y33.584 F2400
+G1 X10.603 Y33.420 F2400
+G1 X10.545 Y33.256 F2400
+G1 X10.489 Y33.090 F2400
+G1 X10.437 Y32.924 F2400
+G1 X10.387 Y32.756 F2400
+G1 X10.341 Y32.588 F2400
+G1 X10.297 Y32.419 F2400
+G1 X10.256 Y32.250 F2400
+G1 X10.219 Y32.079 F2400
+G1 X10.184 Y31.908 F2400
+G1 X10.152 Y31.736 F2400
+G1 X10.123 Y31.564 F2400
+G1 X10.097 Y31.392 F2400
+G1 X10.075 Y31.219 F2400
+G1 X10.055 Y31.045 F2400
+G1 X10.038 Y30.872 F2400
+G1 X10.024 Y30.698 F2400
+G1 X10.014 Y30.523 F2400
+G1 X10.006 Y30.349 F2400
+G1 X10.002 Y30.175 F2400
+G1 X10.000 Y30.000 F2400
+G1 X10.002 Y29.825 F2400
+G1 X10.006 Y29.651 F2400
+G1 X10.014 Y29.477 F2400
+G1 X10.024 Y29.302 F2400
+G1 X10.038 Y29.128 F2400
+G1 X10.055 Y28.955 F2400
+G1 X10.075 Y28.781 F2400
+G1 X10.097 Y28.608 F2400
+G1 X10.123 Y28.436 F2400
+G1 X10.152 Y28.264 F2400
+G1 X10.184 Y28.092 F2400
+G1 X10.219 Y27.921 F2400
+G1 X10.256 Y27.750 F2400
+G1 X10.297 Y27.581 F2400
+G1 X10.341 Y27.412 F2400
+G1 X10.387 Y27.244 F2400
+G1 X10.437 Y27.076 F2400
+G1 X10.489 Y26.910 F2400
+G1 X10.545 Y26.744 F2400
+G1 X10.603 Y26.580 F2400
+G1 X10.664 Y26.416 F2400
+G1 X10.728 Y26.254 F2400
+G1 X10.795 Y26.093 F2400
+G1 X10.865 Y25.933 F2400
+G1 X10.937 Y25.774 F2400
+G1 X11.012 Y25.616 F2400
+G1 X11.090 Y25.460 F2400
+G1 X11.171 Y25.305 F2400
+G1 X11.254 Y25.152 F2400
+G1 X11.340 Y25.000 F2400
+G1 X11.428 Y24.850 F2400
+G1 X11.520 Y24.701 F2400
+G1 X11.613 Y24.554 F2400
+G1 X11.710 Y24.408 F2400
+G1 X11.808 Y24.264 F2400
+G1 X11.910 Y24.122 F2400
+G1 X12.014 Y23.982 F2400
+G1 X12.120 Y23.843 F2400
+G1 X12.229 Y23.707 F2400
+G1 X12.340 Y23.572 F2400
+G1 X12.453 Y23.439 F2400
+G1 X12.569 Y23.309 F2400
+G1 X12.686 Y23.180 F2400
+G1 X12.807 Y23.053 F2400
+G1 X12.929 Y22.929 F2400
+G1 X13.053 Y22.807 F2400
+G1 X13.180 Y22.686 F2400
+G1 X13.309 Y22.569 F2400
+G1 X13.439 Y22.453 F2400
+G1 X13.572 Y22.340 F2400
+G1 X13.707 Y22.229 F2400
+G1 X13.843 Y22.120 F2400
+G1 X13.982 Y22.014 F2400
+G1 X14.122 Y21.910 F2400
+G1 X14.264 Y21.808 F2400
+G1 X14.408 Y21.710 F2400
+G1 X14.554 Y21.613 F2400
+G1 X14.701 Y21.520 F2400
+G1 X14.850 Y21.428 F2400
+G1 X15.000 Y21.340 F2400
+G1 X15.152 Y21.254 F2400
+G1 X15.305 Y21.171 F2400
+G1 X15.460 Y21.090 F2400
+G1 X15.616 Y21.012 F2400
+G1 X15.774 Y20.937 F2400
+G1 X15.933 Y20.865 F2400
+G1 X16.093 Y20.795 F2400
+G1 X16.254 Y20.728 F2400
+G1 X16.416 Y20.664 F2400
+G1 X16.580 Y20.603 F2400
+G1 X16.744 Y20.545 F2400
+G1 X16.910 Y20.489 F2400
+G1 X17.076 Y20.437 F2400
+G1 X17.244 Y20.387 F2400
+G1 X17.412 Y20.341 F2400
+G1 X17.581 Y20.297 F2400
+G1 X17.750 Y20.256 F2400
+G1 X17.921 Y20.219 F2400
+G1 X18.092 Y20.184 F2400
+G1 X18.264 Y20.152 F2400
+G1 X18.436 Y20.123 F2400
+G1 X18.608 Y20.097 F2400
+G1 X18.781 Y20.075 F2400
+G1 X18.955 Y20.055 F2400
+G1 X19.128 Y20.038 F2400
+G1 X19.302 Y20.024 F2400
+G1 X19.477 Y20.014 F2400
+G1 X19.651 Y20.006 F2400
+G1 X19.825 Y20.002 F2400
+G1 X20.000 Y20.000 F2400
+G1 X20.175 Y20.002 F2400
+G1 X20.349 Y20.006 F2400
+G1 X20.523 Y20.014 F2400
+G1 X20.698 Y20.024 F2400
+G1 X20.872 Y20.038 F2400
+G1 X21.045 Y20.055 F2400
+G1 X21.219 Y20.075 F2400
+G1 X21.392 Y20.097 F2400
+G1 X21.564 Y20.123 F2400
+G1 X21.736 Y20.152 F2400
+G1 X21.908 Y20.184 F2400
+G1 X22.079 Y20.219 F2400
+G1 X22.250 Y20.256 F2400
+G1 X22.419 Y20.297 F2400
+G1 X22.588 Y20.341 F2400
+G1 X22.756 Y20.387 F2400
+G1 X22.924 Y20.437 F2400
+G1 X23.090 Y20.489 F2400
+G1 X23.256 Y20.545 F2400
+G1 X23.420 Y20.603 F2400
+G1 X23.584 Y20.664 F2400
+G1 X23.746 Y20.728 F2400
+G1 X23.907 Y20.795 F2400
+G1 X24.067 Y20.865 F2400
+G1 X24.226 Y20.937 F2400
+G1 X24.384 Y21.012 F2400
+G1 X24.540 Y21.090 F2400
+G1 X24.695 Y21.171 F2400
+G1 X24.848 Y21.254 F2400
+G1 X25.000 Y21.340 F2400
+G1 X25.150 Y21.428 F2400
+G1 X25.299 Y21.520 F2400
+G1 X25.446 Y21.613 F2400
+G1 X25.592 Y21.710 F2400
+G1 X25.736 Y21.808 F2400
+G1 X25.878 Y21.910 F2400
+G1 X26.018 Y22.014 F2400
+G1 X26.157 Y22.120 F2400
+G1 X26.293 Y22.229 F2400
+G1 X26.428 Y22.340 F2400
+G1 X26.561 Y22.453 F2400
+G1 X26.691 Y22.569 F2400
+G1 X26.820 Y22.686 F2400
+G1 X26.947 Y22.807 F2400
+G1 X27.071 Y22.929 F2400
+G1 X27.193 Y23.053 F2400
+G1 X27.314 Y23.180 F2400
+G1 X27.431 Y23.309 F2400
+G1 X27.547 Y23.439 F2400
+G1 X27.660 Y23.572 F2400
+G1 X27.771 Y23.707 F2400
+G1 X27.880 Y23.843 F2400
+G1 X27.986 Y23.982 F2400
+G1 X28.090 Y24.122 F2400
+G1 X28.192 Y24.264 F2400
+G1 X28.290 Y24.408 F2400
+G1 X28.387 Y24.554 F2400
+G1 X28.480 Y24.701 F2400
+G1 X28.572 Y24.850 F2400
+G1 X28.660 Y25.000 F2400
+G1 X28.746 Y25.152 F2400
+G1 X28.829 Y25.305 F2400
+G1 X28.910 Y25.460 F2400
+G1 X28.988 Y25.616 F2400
+G1 X29.063 Y25.774 F2400
+G1 X29.135 Y25.933 F2400
+G1 X29.205 Y26.093 F2400
+G1 X29.272 Y26.254 F2400
+G1 X29.336 Y26.416 F2400
+G1 X29.397 Y26.580 F2400
+G1 X29.455 Y26.744 F2400
+G1 X29.511 Y26.910 F2400
+G1 X29.563 Y27.076 F2400
+G1 X29.613 Y27.244 F2400
+G1 X29.659 Y27.412 F2400
+G1 X29.703 Y27.581 F2400
+G1 X29.744 Y27.750 F2400
+G1 X29.781 Y27.921 F2400
+G1 X29.816 Y28.092 F2400
+G1 X29.848 Y28.264 F2400
+G1 X29.877 Y28.436 F2400
+G1 X29.903 Y28.608 F2400
+G1 X29.925 Y28.781 F2400
+G1 X29.945 Y28.955 F2400
+G1 X29.962 Y29.128 F2400
+G1 X29.976 Y29.302 F2400
+G1 X29.986 Y29.477 F2400
+G1 X29.994 Y29.651 F2400
+G1 X29.998 Y29.825 F2400
+G1 X30.000 Y30.000 F2400
+G1 Z1 F300
+G0 X0 Y0
@@ -0,0 +1,84 @@
+G21
+G90
+G0 X0 Y0 Z1 F6000
+G1 Z0 F300
+G1 X5 Y0 F3000
+G1 X0 Y0
+G1 X5 Y0
+G1 X0 Y0
+G1 X5 Y0
+G1 X0 Y0
+G1 X5 Y0
+G1 X0 Y0
+G1 X5 Y0
+G1 X0 Y0
+G1 X5 Y0
+G1 X0 Y0
+G1 X5 Y0
+G1 X0 Y0
+G1 X5 Y0
+G1 X0 Y0
+G1 X5 Y0
+G1 X0 Y0
+G1 X5 Y0
+G1 X0 Y0
+G1 X5 Y0
+G1 X0 Y0
+G1 X5 Y0
+G1 X0 Y0
+G1 X5 Y0
+G1 X0 Y0
+G1 X5 Y0
+G1 X0 Y0
+G1 X5 Y0
+G1 X0 Y0
+G1 X5 Y0
+G1 X0 Y0
+G1 X5 Y0
+G1 X0 Y0
+G1 X5 Y0
+G1 X0 Y0
+G1 X5 Y0
+G1 X0 Y0
+G1 X5 Y0
+G1 X0 Y0
+G1 X5 Y0
+G1 X0 Y0
+G1 X5 Y0
+G1 X0 Y0
+G1 X5 Y0
+G1 X0 Y0
+G1 X5 Y0
+G1 X0 Y0
+G1 X5 Y0
+G1 X0 Y0
+G1 X5 Y0
+G1 X0 Y0
+G1 X5 Y0
+G1 X0 Y0
+G1 X5 Y0
+G1 X0 Y0
+G1 X5 Y0
+G1 X0 Y0
+G1 X5 Y0
+G1 X0 Y0
+G1 X5 Y0
+G1 X0 Y0
+G1 X5 Y0
+G1 X0 Y0
+G1 X5 Y0
+G1 X0 Y0
+G1 X5 Y0
+G1 X0 Y0
+G1 X5 Y0
+G1 X0 Y0
+G1 X5 Y0
+G1 X0 Y0
+G1 X5 Y0
+G1 X0 Y0
+G1 X5 Y0
+G1 X0 Y0
+G1 X5 Y0
+G1 X0 Y0
+G1 X5 Y0
+G1 X0 Y0
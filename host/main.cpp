@@ -0,0 +1,1026 @@
+/*
+      This file is part of Smoothie (http://smoothieware.org/). The motion control part is heavily based on Grbl (https://github.com/simen/grbl).
+      Smoothie is free software: you can redistribute it and/or modify it under the terms of the GNU General Public License as published by the Free Software Foundation, either version 3 of the License, or (at your option) any later version.
+      Smoothie is distributed in the hope that it will be useful, but WITHOUT ANY WARRANTY; without even the implied warranty of MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the GNU General Public License for more details.
+      You should have received a copy of the GNU General Public License along with Smoothie. If not, see <http://www.gnu.org/licenses/>.
+*/
+
+/**
+smoothie-sim: replays gcode files through the real motion pipeline on a virtual clock
+
+    smoothie-sim -c config [-o "setting value"]... [-t timeline.csv] [-i idle_us] [-l line_us] [-v] file.gcode...
+    smoothie-sim -c config [-o "setting value"]... -a latency_us [-w] [-v] file.gcode...
+    smoothie-sim -b repeat file.gcode...
+    smoothie-sim -e out.smb [-d decimals] [-x] file.gcode...
+    smoothie-sim -c config [-o "setting value"]... -k repeat
+    smoothie-sim -s kbytes
+    smoothie-sim -p kbytes
+    smoothie-sim -h kbytes
+
+Each line is received as if it came from a serial port that delivers a line every line_us, the idle loop
+takes idle_us, and StepTicker::step_tick() runs whenever the virtual TIMER0 fires. Every step and dir edge
+is recorded, at the end the recorded positions are checked against the actuator positions.
+-o adds a setting to the config, overriding the one in the file.
+Files in the binary format (see BinaryGcode.h) are recognised by their header and replayed a record at a time.
+
+With -a the lines are streamed by a host at the other end of a link that takes latency_us each way, which waits
+for the ok of each line before sending the next, or with -w keeps as many lines in flight as the acks of the
+window command allow (see AckWindow.h), and the lines per second the job was streamed at are given. A file in the
+binary format is streamed after the binary command, and the host sends text again at the ok binary reply.
+
+With -b only the gcode parser is timed, each line is parsed repeat times and the usual letters looked up, then
+the same for the lines encoded in the binary format, decoding them and building the Gcode from the records.
+
+With -e the files are converted to one file in the binary format, keeping decimals places (3 by default),
+-x adds a checksum to every record.
+
+With -k the configured delta arm solution is timed with and without delta_fast_kinematics over a grid
+covering its build volume, repeat times, and the two are compared in steps.
+
+With -s the SDCard driver is run against an emulated card on SSP1, kbytes are written and read back
+a sector at a time at the old 2.5MHz clock, and then at the card's clock byte by byte, by DMA, and in runs
+of sectors with the multiple block commands. The rates are on the virtual clock, see README.md.
+
+With -p kbytes are uploaded to the 9P server through a stand in for uIP and read back, with the msize it
+used to agree to and the one it agrees to now, one request at a time and several. The rates are host time.
+
+With -h kbytes are uploaded to the web server through a stand in for uIP and downloaded again on the same
+connection, followed by the other kinds of response it gives, -v shows what the server prints. The rates are
+host time.
+*/
+
+#include "HostHal.h"
+#include "HostKernel.h"
+#include "StepTimeline.h"
+#include "SdCardModel.h"
+#include "Plan9Loopback.h"
+#include "HttpLoopback.h"
+#include "StreamLink.h"
+
+#include "libs/Kernel.h"
+#include "libs/Config.h"
+#include "libs/SerialMessage.h"
+#include "libs/StreamOutput.h"
+#include "libs/StepTicker.h"
+#include "libs/StepperMotor.h"
+#include "modules/robot/Conveyor.h"
+#include "modules/robot/Planner.h"
+#include "modules/robot/Robot.h"
+#include "modules/robot/arm_solutions/LinearDeltaSolution.h"
+#include "modules/robot/arm_solutions/RotaryDeltaSolution.h"
+#include "ActuatorCoordinates.h"
+#include "checksumm.h"
+#include "ConfigValue.h"
+#include "Pin.h"
+#include "utils.h"
+#include "Gcode.h"
+#include "BinaryGcode.h"
+#include "SDCard.h"
+
+#include <algorithm>
+#include <array>
+#include <chrono>
+#include <string>
+#include <vector>
+#include <math.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <fcntl.h>
+#include <unistd.h>
+
+using host_time= std::chrono::steady_clock;
+
+// counts heap allocations while a line is being handled, the firmware should not need any in steady state
+static uint64_t allocations;
+static bool count_allocations;
+
+extern "C" void *__libc_malloc(size_t size);
+extern "C" void *__libc_calloc(size_t n, size_t size);
+extern "C" void *__libc_realloc(void *ptr, size_t size);
+
+extern "C" void *malloc(size_t size)
+{
+    if(count_allocations) ++allocations;
+    return __libc_malloc(size);
+}
+
+extern "C" void *calloc(size_t n, size_t size)
+{
+    if(count_allocations) ++allocations;
+    return __libc_calloc(n, size);
+}
+
+extern "C" void *realloc(void *ptr, size_t size)
+{
+    if(count_allocations) ++allocations;
+    return __libc_realloc(ptr, size);
+}
+
+static uint64_t elapsed_ns(host_time::time_point start)
+{
+    return std::chrono::duration_cast<std::chrono::nanoseconds>(host_time::now() - start).count();
+}
+
+// cpu cycle counter, where there is one
+static inline uint64_t host_cycles()
+{
+#if defined(__x86_64__) || defined(__i386__)
+    return __builtin_ia32_rdtsc();
+#else
+    return 0;
+#endif
+}
+
+// counts the replies, and prints anything that is not a plain ok when verbose
+class SimStreamOutput : public StreamOutput {
+    public:
+        int puts(const char *str)
+        {
+            size_t n= strlen(str);
+            if(strncmp(str, "ok", 2) == 0) {
+                ++oks;
+            } else if(verbose) {
+                fputs(str, stdout);
+            }
+            return n;
+        }
+
+        uint32_t oks{0};
+        bool verbose{false};
+};
+
+// everything sampled from the ISR hook
+static struct {
+    bool feeding;
+    bool started;                   // the first block has been picked up
+    const void *last_block;
+    uint32_t blocks;                // blocks executed
+    bool starved;
+    uint32_t starvations;           // times the step ticker ran out of blocks while there were still lines to send
+    uint64_t starved_counts;        // virtual time spent starved
+    uint64_t starved_since;
+    uint64_t isr_calls;
+    uint64_t isr_ns;                // host time spent in the TIMER0 handler
+    uint64_t isr_max_ns;
+    uint64_t isr_cycles;            // host cycles spent in the TIMER0 handler
+    host_time::time_point isr_start;
+    uint64_t isr_start_cycles;
+} sim;
+
+static void on_isr(int irq, bool enter)
+{
+    if(irq != TIMER0_IRQn) return;
+
+    if(enter) {
+        sim.isr_start= host_time::now();
+        sim.isr_start_cycles= host_cycles();
+        return;
+    }
+
+    sim.isr_cycles += host_cycles() - sim.isr_start_cycles;
+    uint64_t ns= elapsed_ns(sim.isr_start);
+    sim.isr_ns += ns;
+    if(ns > sim.isr_max_ns) sim.isr_max_ns= ns;
+    ++sim.isr_calls;
+
+    const void *block= THEKERNEL->step_ticker->get_current_block();
+    if(block != nullptr && block != sim.last_block) ++sim.blocks;
+    sim.last_block= block;
+
+    bool idle= block == nullptr;
+    if(!idle) {
+        if(sim.starved) sim.starved_counts += host_clock_counts() - sim.starved_since;
+        sim.started= true;
+        sim.starved= false;
+
+    } else if(sim.started && sim.feeding && !sim.starved) {
+        ++sim.starvations;
+        sim.starved= true;
+        sim.starved_since= host_clock_counts();
+    }
+}
+
+static bool read_file(const char *fn, std::string& out)
+{
+    FILE *fp= fopen(fn, "r");
+    if(fp == NULL) return false;
+    char buf[4096];
+    size_t n;
+    while((n= fread(buf, 1, sizeof(buf), fp)) > 0) out.append(buf, n);
+    fclose(fp);
+    return true;
+}
+
+static void add_actuator(StepTimeline& timeline, const char *name)
+{
+    std::string s(name);
+    Pin step, dir;
+    step.from_string(THEKERNEL->config->value(get_checksum(s + "_step_pin"))->by_default("nc")->as_string());
+    dir.from_string(THEKERNEL->config->value(get_checksum(s + "_dir_pin"))->by_default("nc")->as_string());
+    if(!step.connected() || !dir.connected()) return;
+    timeline.add_actuator(name, step, dir);
+}
+
+static void usage(const char *prog)
+{
+    fprintf(stderr, "Usage: %s -c config [-o \"setting value\"]... [-t timeline.csv] [-i idle_us] [-l line_us] [-v] file.gcode...\n", prog);
+    fprintf(stderr, "       %s -c config [-o \"setting value\"]... -a latency_us [-w] [-v] file.gcode...\n", prog);
+    fprintf(stderr, "       %s -b repeat file.gcode...\n", prog);
+    fprintf(stderr, "       %s -e out.smb [-d decimals] [-x] file.gcode...\n", prog);
+    fprintf(stderr, "       %s -c config [-o \"setting value\"]... -k repeat\n", prog);
+    fprintf(stderr, "       %s -s kbytes\n", prog);
+    fprintf(stderr, "       %s -p kbytes\n", prog);
+    fprintf(stderr, "       %s -h kbytes\n", prog);
+    exit(2);
+}
+
+// reads the lines of the files given after the options
+static bool read_lines(int argc, char *argv[], std::vector<std::string>& lines)
+{
+    for(int f= optind; f < argc; f++) {
+        FILE *fp= fopen(argv[f], "r");
+        if(fp == nullptr) {
+            fprintf(stderr, "could not open %s\n", argv[f]);
+            return false;
+        }
+        char buf[256];
+        while(fgets(buf, sizeof(buf), fp) != NULL) {
+            size_t len= strlen(buf);
+            while(len > 0 && (buf[len - 1] == '\n' || buf[len - 1] == '\r')) buf[--len]= '\0';
+            lines.push_back(buf);
+        }
+        fclose(fp);
+    }
+    return true;
+}
+
+// the lines of the files for a streamed job, a file in the binary format is kept whole as one
+static bool read_link_lines(int argc, char *argv[], std::vector<std::string>& lines)
+{
+    for(int f= optind; f < argc; f++) {
+        FILE *fp= fopen(argv[f], "rb");
+        if(fp == nullptr) {
+            fprintf(stderr, "could not open %s\n", argv[f]);
+            return false;
+        }
+        std::string file;
+        char buf[4096];
+        size_t n;
+        while((n= fread(buf, 1, sizeof(buf), fp)) > 0) file.append(buf, n);
+        fclose(fp);
+
+        if(BinaryGcodeDecoder::is_header(file.data(), file.size())) {
+            lines.push_back(file);
+            continue;
+        }
+        for(size_t i= 0; i < file.size(); ) {
+            size_t end= file.find('\n', i);
+            if(end == std::string::npos) end= file.size();
+            std::string line= file.substr(i, end - i);
+            while(!line.empty() && line.back() == '\r') line.pop_back();
+            if(!line.empty()) lines.push_back(line);
+            i= end + 1;
+        }
+    }
+    return true;
+}
+
+// times constructing a Gcode from each line and looking up the letters the motion code uses, and then the same
+// from the binary format
+static int parse_benchmark(int repeat, int argc, char *argv[])
+{
+    std::vector<std::string> all, lines;
+    if(!read_lines(argc, argv, all)) return 2;
+    size_t text_bytes= 0;
+    for(auto& l : all) {
+        if(!l.empty() && (l[0] == 'G' || l[0] == 'M')) {
+            lines.push_back(l);
+            text_bytes += l.size() + 1;
+        }
+    }
+
+    static const char letters[]= "XYZEFIJS";
+    float sum= 0;
+    allocations= 0;
+    count_allocations= true;
+    host_time::time_point start= host_time::now();
+    for(int r= 0; r < repeat; r++) {
+        for(auto& l : lines) {
+            Gcode gc(l, &StreamOutput::NullStream);
+            for(const char *c= letters; *c; c++) {
+                if(gc.has_letter(*c)) sum += gc.get_value(*c);
+            }
+        }
+    }
+    uint64_t ns= elapsed_ns(start);
+    count_allocations= false;
+
+    uint64_t n= (uint64_t)lines.size() * repeat;
+    printf("parsed %llu lines: %1.0f lines/s, %1.2f heap allocations per line (checksum %1.1f)\n", (unsigned long long)n,
+        n * 1e9 / ns, (double)allocations / n, sum);
+
+    // the text records are timed as well, as they are parsed just the same
+    BinaryGcodeEncoder encoder;
+    std::string smb;
+    encoder.header(smb);
+    uint32_t moves= 0;
+    for(auto& l : lines) {
+        if(encoder.encode(l.c_str(), smb) == BinaryGcodeEncoder::MOTION) moves++;
+    }
+    encoder.end(smb);
+
+    float binary_sum= 0;
+    uint64_t records= 0;
+    BinaryGcodeDecoder decoder;
+    allocations= 0;
+    count_allocations= true;
+    start= host_time::now();
+    for(int r= 0; r < repeat; r++) {
+        decoder.reset();
+        for(size_t i= 0, used; i < smb.size(); i += used) {
+            BinaryGcodeDecoder::result_t res= decoder.put(&smb[i], smb.size() - i, used);
+            if(res == BinaryGcodeDecoder::MOTION) {
+                Gcode gc= BinaryGcodeDecoder::make_gcode(decoder.get_record(), &StreamOutput::NullStream);
+                for(const char *c= letters; *c; c++) {
+                    if(gc.has_letter(*c)) binary_sum += gc.get_value(*c);
+                }
+            } else if(res == BinaryGcodeDecoder::TEXT_LINE) {
+                Gcode gc(decoder.get_text(), &StreamOutput::NullStream);
+                for(const char *c= letters; *c; c++) {
+                    if(gc.has_letter(*c)) binary_sum += gc.get_value(*c);
+                }
+            } else if(res == BinaryGcodeDecoder::ERROR) {
+                fprintf(stderr, "binary decode failed: %s\n", decoder.get_error());
+                return 1;
+            }
+        }
+        records += decoder.get_records() - 1;
+    }
+    uint64_t binary_ns= elapsed_ns(start);
+    count_allocations= false;
+
+    printf("binary: %llu records (%u moves per pass): %1.0f records/s, %1.2f heap allocations per record (checksum %1.1f)\n",
+        (unsigned long long)records, moves, records * 1e9 / binary_ns, (double)allocations / records, binary_sum);
+    printf("size: text %u bytes, binary %u bytes (%1.1f%%), %u numbers rounded, %1.1fx the text rate\n", (unsigned)text_bytes,
+        (unsigned)smb.size(), 100.0 * smb.size() / text_bytes, encoder.get_rounded(), (double)ns / binary_ns);
+    return 0;
+}
+
+// converts the files to the binary format
+static int convert(const char *out_fn, int decimals, bool crc, int argc, char *argv[])
+{
+    std::vector<std::string> lines;
+    if(!read_lines(argc, argv, lines)) return 2;
+
+    BinaryGcodeEncoder encoder(decimals, crc);
+    std::string smb;
+    encoder.header(smb);
+    uint32_t counts[4]= {0, 0, 0, 0};
+    for(size_t i= 0; i < lines.size(); i++) {
+        BinaryGcodeEncoder::encoded_t r= encoder.encode(lines[i].c_str(), smb);
+        if(r == BinaryGcodeEncoder::TOO_LONG) fprintf(stderr, "line %u is too long, left out: %s\n", (unsigned)i + 1, lines[i].c_str());
+        counts[r]++;
+    }
+    encoder.end(smb);
+
+    FILE *fp= fopen(out_fn, "wb");
+    if(fp == nullptr || fwrite(smb.data(), 1, smb.size(), fp) != smb.size()) {
+        fprintf(stderr, "could not write %s\n", out_fn);
+        if(fp != nullptr) fclose(fp);
+        return 2;
+    }
+    fclose(fp);
+
+    printf("%s: %u moves, %u text lines, %u skipped, %u too long, %u numbers rounded, %u bytes\n", out_fn,
+        counts[BinaryGcodeEncoder::MOTION], counts[BinaryGcodeEncoder::TEXT], counts[BinaryGcodeEncoder::SKIPPED],
+        counts[BinaryGcodeEncoder::TOO_LONG], encoder.get_rounded(), (unsigned)smb.size());
+    return counts[BinaryGcodeEncoder::TOO_LONG] > 0 ? 1 : 0;
+}
+
+using point_t= std::array<float, 3>;
+
+// calls cartesian_to_actuator() for every point repeat times, returns segments per second
+static double time_kinematics(const BaseSolution& solution, const std::vector<point_t>& points, int repeat)
+{
+    ActuatorCoordinates a;
+    float sum= 0;
+    host_time::time_point start= host_time::now();
+    for(int r= 0; r < repeat; r++) {
+        for(auto& p : points) {
+            solution.cartesian_to_actuator(p.data(), a);
+            sum += a[0];
+        }
+    }
+    uint64_t ns= elapsed_ns(start);
+    if(sum == 1234.5F) printf(" "); // keep the calls from being optimized away
+    return (double)points.size() * repeat * 1e9 / ns;
+}
+
+// compares the float and fast inverse kinematics of the configured delta on a grid over its build volume
+template<class T> static int compare_kinematics(T& slow, T& fast, const char *unit, float radius, float zmin, float zmax, int repeat)
+{
+    slow.set_fast_kinematics(false);
+    fast.set_fast_kinematics(true);
+
+    // 1mm in XY, 10 layers in Z, skipping any point either version can't reach
+    std::vector<point_t> points;
+    for(float z= zmin; z <= zmax; z += (zmax - zmin) / 10) {
+        for(float x= -radius; x <= radius; x += 1.0F) {
+            for(float y= -radius; y <= radius; y += 1.0F) {
+                if(x * x + y * y > radius * radius) continue;
+                point_t p{x, y, z};
+                ActuatorCoordinates a;
+                slow.cartesian_to_actuator(p.data(), a);
+                bool ok= true;
+                for(int i= 0; i < 3; i++) ok= ok && !isnan(a[i]);
+                if(ok && a[0] == 0 && a[1] == 0 && a[2] == 0) ok= false; // rotary delta calculation failed
+                if(ok) points.push_back(p);
+            }
+        }
+    }
+    if(points.empty()) {
+        fprintf(stderr, "no reachable points\n");
+        return 1;
+    }
+
+    float max_error= 0, max_steps= 0;
+    uint32_t moved= 0;
+    for(auto& p : points) {
+        ActuatorCoordinates a, b;
+        slow.cartesian_to_actuator(p.data(), a);
+        fast.cartesian_to_actuator(p.data(), b);
+        bool differs= false;
+        for(int i= 0; i < 3; i++) {
+            float spm= THEROBOT->actuators[i]->get_steps_per_mm();
+            max_error= std::max(max_error, fabsf(a[i] - b[i]));
+            max_steps= std::max(max_steps, fabsf(a[i] - b[i]) * spm);
+            differs= differs || lroundf(a[i] * spm) != lroundf(b[i] * spm);
+        }
+        if(differs) ++moved;
+    }
+
+    double slow_rate= time_kinematics(slow, points, repeat);
+    double fast_rate= time_kinematics(fast, points, repeat);
+    printf("%u points in a %1.0fmm radius from Z%1.0f to Z%1.0f\n", (unsigned)points.size(), radius, zmin, zmax);
+    printf("float: %1.0f segments/s (host)\n", slow_rate);
+    printf("fast: %1.0f segments/s (host), %1.2fx\n", fast_rate, fast_rate / slow_rate);
+    printf("fast vs float: max %1.6f %s, %1.4f steps at %g/%g/%g steps/%s, %u points (%1.3f%%) round to a different step\n",
+        max_error, unit, max_steps, THEROBOT->actuators[0]->get_steps_per_mm(), THEROBOT->actuators[1]->get_steps_per_mm(),
+        THEROBOT->actuators[2]->get_steps_per_mm(), unit, moved, 100.0 * moved / points.size());
+    return 0;
+}
+
+static int kinematics_benchmark(int repeat)
+{
+    int solution= get_checksum(THEKERNEL->config->value(CHECKSUM("arm_solution"))->by_default("cartesian")->as_string());
+    if(solution == CHECKSUM("linear_delta") || solution == CHECKSUM("delta") || solution == CHECKSUM("kossel") || solution == CHECKSUM("rostock")) {
+        LinearDeltaSolution slow(THEKERNEL->config), fast(THEKERNEL->config);
+        float radius= THEKERNEL->config->value(CHECKSUM("arm_radius"))->by_default(124.0F)->as_number();
+        return compare_kinematics(slow, fast, "mm", radius, 0, 300, repeat);
+
+    } else if(solution == CHECKSUM("rotary_delta")) {
+        RotaryDeltaSolution slow(THEKERNEL->config), fast(THEKERNEL->config);
+        return compare_kinematics(slow, fast, "deg", 100, -100, 100, repeat);
+    }
+
+    fprintf(stderr, "-k needs arm_solution linear_delta or rotary_delta\n");
+    return 2;
+}
+
+// writes kbytes to the emulated card and reads them back, with the driver set up each way in turn
+static int sd_benchmark(uint32_t kbytes)
+{
+    static const struct {
+        const char *name;
+        uint32_t max_frequency;
+        bool dma;
+        uint32_t run;
+    } modes[]= {
+        { "2.5MHz, byte loop, 1 sector",   2500000, false, 1 },
+        { "byte loop, 1 sector",          25000000, false, 1 },
+        { "dma, 1 sector",                25000000, true,  1 },
+        { "dma, 8 sectors",               25000000, true,  8 },
+        { "dma, 32 sectors",              25000000, true,  32 },
+    };
+
+    host_hal_reset();
+    uint32_t sectors= kbytes * 2;
+    SdCardModel card(std::max(sectors, 2048U), 0, 6);
+    host_ssp_attach(1, [&card](uint8_t out) { return card.exchange(out); });
+    SDCard sd(P0_9, P0_8, P0_7, P0_6);
+
+    std::vector<char> wbuf(sectors * 512), rbuf(sectors * 512);
+    for(const auto& m : modes) {
+        sd.set_max_frequency(m.max_frequency);
+        sd.set_dma(m.dma);
+        if(sd.disk_initialize() != 0) {
+            fprintf(stderr, "%s: card did not initialize\n", m.name);
+            return 1;
+        }
+
+        for(size_t i= 0; i < wbuf.size(); i++) wbuf[i]= (char)(i * 7 + m.run + m.dma);
+        std::fill(rbuf.begin(), rbuf.end(), 0);
+
+        card.reset_commands();
+        double start= host_clock_seconds();
+        for(uint32_t s= 0; s < sectors; s += m.run) {
+            if(sd.disk_write_blocks(&wbuf[s * 512], s, std::min(m.run, sectors - s)) != 0) {
+                fprintf(stderr, "%s: write failed at sector %lu\n", m.name, (unsigned long)s);
+                return 1;
+            }
+        }
+        double write_s= host_clock_seconds() - start;
+        uint32_t write_commands= card.get_commands();
+
+        card.reset_commands();
+        start= host_clock_seconds();
+        for(uint32_t s= 0; s < sectors; s += m.run) {
+            if(sd.disk_read_blocks(&rbuf[s * 512], s, std::min(m.run, sectors - s)) != 0) {
+                fprintf(stderr, "%s: read failed at sector %lu\n", m.name, (unsigned long)s);
+                return 1;
+            }
+        }
+        double read_s= host_clock_seconds() - start;
+
+        if(rbuf != wbuf) {
+            fprintf(stderr, "%s: data read back does not match\n", m.name);
+            return 1;
+        }
+        printf("sd %-28s %5.2fMHz: write %6.3f MB/s, read %6.3f MB/s, %lu+%lu commands\n", m.name, sd.get_frequency() / 1e6F,
+            kbytes / 1024.0 / write_s, kbytes / 1024.0 / read_s, (unsigned long)write_commands, (unsigned long)card.get_commands());
+    }
+    return 0;
+}
+
+// uploads kbytes to a new directory in /tmp through the 9P server and reads them back
+static int plan9_benchmark(uint32_t kbytes)
+{
+    static const struct {
+        uint32_t msize;
+        int depth;
+    } runs[]= {
+        { 300,   1 },
+        { 65536, 1 },
+        { 65536, 4 },
+        { 300,   16 },
+    };
+
+    char dir[]= "/tmp/smoothie-9p-XXXXXX";
+    if(mkdtemp(dir) == nullptr) {
+        perror(dir);
+        return 1;
+    }
+    std::vector<std::string> path{ "tmp", strrchr(dir, '/') + 1 };
+    std::vector<std::string> file_path(path);
+    file_path.push_back("upload.bin");
+    std::string file= std::string(dir) + "/upload.bin";
+
+    std::string data(kbytes * 1024, 0);
+    for(size_t i= 0; i < data.size(); i++) data[i]= (char)(i * 13 + (i >> 9));
+
+    int result= 0;
+    for(const auto& r : runs) {
+        Plan9Loopback p9;
+        uint32_t msize= p9.version(r.msize);
+        uint32_t iounit;
+        uint64_t length= 0;
+        std::string back, on_disk;
+
+        bool ok= msize > 0 && p9.attach(0) && p9.walk(0, 1, path) && (iounit= p9.create(1, "upload.bin")) > 0;
+        auto start= host_time::now();
+        ok= ok && p9.write(1, data, iounit, r.depth);
+        double write_s= std::chrono::duration<double>(host_time::now() - start).count();
+        ok= ok && p9.stat(1, length) && p9.clunk(1);
+        if(ok && (length != data.size() || !read_file(file.c_str(), on_disk) || on_disk != data)) {
+            fprintf(stderr, "9p msize %lu: the file written is not the data sent\n", (unsigned long)r.msize);
+            result= 1;
+            break;
+        }
+        uint32_t segments_in= p9.get_segments_in();
+        uint32_t segments_out= p9.get_segments_out();
+
+        ok= ok && p9.walk(0, 2, file_path) && (iounit= p9.open(2, 0)) > 0;
+        start= host_time::now();
+        ok= ok && p9.read(2, back, data.size(), iounit, r.depth);
+        double read_s= std::chrono::duration<double>(host_time::now() - start).count();
+        ok= ok && p9.clunk(2);
+
+        // a write sent behind the requests that open the file for it, and one behind a read of what it overwrites
+        std::string first(data, 0, std::min<uint32_t>(iounit, 2000)), second(data, 5000, std::min<uint32_t>(iounit, 300)), before, truncated, overwritten;
+        ok= ok && p9.overwrite(0, 4, file_path, first) && p9.clunk(4);
+        if(ok && (!read_file(file.c_str(), truncated) || truncated != first)) {
+            fprintf(stderr, "9p msize %lu: the file is not what was written behind the truncating open\n", (unsigned long)r.msize);
+            result= 1;
+            break;
+        }
+        ok= ok && p9.walk(0, 5, file_path) && p9.open(5, 2) > 0 && p9.read_write(5, before, first.size(), second) && p9.clunk(5);
+        if(ok && (before != first || !read_file(file.c_str(), overwritten) || overwritten != first.substr(0, first.size() - second.size()) + second)) {
+            fprintf(stderr, "9p msize %lu: a read overtaken by the write behind it\n", (unsigned long)r.msize);
+            result= 1;
+            break;
+        }
+
+        ok= ok && p9.walk(0, 3, file_path) && p9.remove(3);
+        if(!ok) {
+            fprintf(stderr, "9p msize %lu: %s\n", (unsigned long)r.msize, p9.get_error().c_str());
+            result= 1;
+            break;
+        }
+        if(back != data) {
+            fprintf(stderr, "9p msize %lu: the data read back is not the data sent\n", (unsigned long)r.msize);
+            result= 1;
+            break;
+        }
+
+        printf("9p msize %5lu, %d outstanding: upload %7.2f MB/s in %5lu segments, read back %7.2f MB/s in %5lu segments, %lu sent again\n",
+            (unsigned long)msize, r.depth, kbytes / 1024.0 / write_s, (unsigned long)segments_in, kbytes / 1024.0 / read_s,
+            (unsigned long)(p9.get_segments_out() - segments_out), (unsigned long)p9.get_resent());
+    }
+
+    unlink(file.c_str());
+    rmdir(dir);
+    return result;
+}
+
+// uploads kbytes to the web server, with a new directory in /tmp as its sd card, downloads them again and then asks
+// for each of the other kinds of response, all on one kept alive connection until /command closes it
+static int http_benchmark(uint32_t kbytes, bool verbose)
+{
+    char dir[]= "/tmp/smoothie-http-XXXXXX";
+    if(mkdtemp(dir) == nullptr) {
+        perror(dir);
+        return 1;
+    }
+    std::string file= std::string(dir) + "/upload.bin";
+    std::string empty= std::string(dir) + "/empty.txt";
+    FILE *fp= fopen(empty.c_str(), "w");
+    if(fp != nullptr) fclose(fp);
+    HttpLoopback::set_sd_root(dir);
+    HttpLoopback::commands.clear();
+
+    std::string data(kbytes * 1024, 0);
+    for(size_t i= 0; i < data.size(); i++) data[i]= (char)(i * 13 + (i >> 9));
+    std::string commands= "M114\nG4 P10\n";
+
+    const struct {
+        const char *name;
+        std::string request;
+        int status;
+        std::string body;
+        bool keep_alive;
+    } runs[]= {
+        { "upload",         "POST /upload HTTP/1.1\r\nX-Filename: upload.bin\r\nContent-Length: " + std::to_string(data.size()) + "\r\n\r\n" + data, 200, "OK\r\n", true },
+        { "download",       "GET /sd/upload.bin HTTP/1.1\r\n\r\n", 200, data, true },
+        { "ROM page",       "GET / HTTP/1.1\r\n\r\n", 200, HttpLoopback::rom_page("/index.html"), true },
+        { "missing file",   "GET /sd/missing.txt HTTP/1.1\r\n\r\n", 404, HttpLoopback::rom_page("/404.html"), true },
+        { "empty file",     "GET /sd/empty.txt HTTP/1.1\r\n\r\n", 200, "", true },
+        { "cached file",    "GET /sd/upload.bin HTTP/1.1\r\nCache-Control: max-age=0\r\n\r\n", 304, "", true },
+        { "/command_silent", "POST /command_silent HTTP/1.1\r\nContent-Length: " + std::to_string(commands.size()) + "\r\n\r\n" + commands, 200, "", true },
+        { "/command",       "POST /command HTTP/1.1\r\nContent-Length: 5\r\n\r\nM119\n", 200, "ok\n", false },
+    };
+
+    // the server prints what it is doing, only wanted with -v
+    fflush(stdout);
+    int saved_stdout= dup(1);
+    if(!verbose) {
+        int null= open("/dev/null", O_WRONLY);
+        dup2(null, 1);
+        close(null);
+    }
+
+    int result= 0;
+    double upload_s= 0, download_s= 0;
+    uint32_t upload_segments= 0, download_segments= 0;
+    HttpLoopback http;
+    for(const auto& r : runs) {
+        uint32_t segments_in= http.get_segments_in();
+        uint32_t segments_out= http.get_segments_out();
+        int status= 0;
+        std::string body, on_disk;
+
+        auto start= host_time::now();
+        bool ok= http.request(r.request, status, body);
+        double s= std::chrono::duration<double>(host_time::now() - start).count();
+        if(!ok) {
+            fprintf(stderr, "http %s: %s\n", r.name, http.get_error().c_str());
+            result= 1;
+            break;
+        }
+        if(status != r.status || body != r.body) {
+            fprintf(stderr, "http %s: got status %d and %lu bytes, not %d and %lu bytes\n", r.name, status,
+                (unsigned long)body.size(), r.status, (unsigned long)r.body.size());
+            result= 1;
+            break;
+        }
+        if(http.is_keep_alive() != r.keep_alive || http.is_closed() == r.keep_alive) {
+            fprintf(stderr, "http %s: the connection was %s\n", r.name, http.is_closed() ? "closed" : "kept open");
+            result= 1;
+            break;
+        }
+
+        if(&r == &runs[0]) {
+            if(!read_file(file.c_str(), on_disk) || on_disk != data) {
+                fprintf(stderr, "http upload: the file written is not the data sent\n");
+                result= 1;
+                break;
+            }
+            upload_s= s;
+            upload_segments= http.get_segments_in() - segments_in;
+        } else if(&r == &runs[1]) {
+            download_s= s;
+            download_segments= http.get_segments_out() - segments_out;
+        }
+    }
+    if(result == 0 && HttpLoopback::commands != std::vector<std::string>{ "M114", "G4 P10", "M119" }) {
+        fprintf(stderr, "http: the commands queued are not the ones sent\n");
+        result= 1;
+    }
+    fflush(stdout);
+    dup2(saved_stdout, 1);
+    close(saved_stdout);
+
+    if(result == 0) {
+        printf("http upload %7.2f MB/s in %5lu segments, download %7.2f MB/s in %5lu segments, %d requests on one connection, %lu sent again\n",
+            kbytes / 1024.0 / upload_s, (unsigned long)upload_segments, kbytes / 1024.0 / download_s, (unsigned long)download_segments,
+            (int)(sizeof(runs) / sizeof(runs[0])), (unsigned long)http.get_resent());
+    }
+
+    HttpLoopback::set_sd_root(nullptr);
+    unlink(file.c_str());
+    unlink(empty.c_str());
+    rmdir(dir);
+    return result;
+}
+
+int main(int argc, char *argv[])
+{
+    const char *config_fn= nullptr;
+    const char *timeline_fn= nullptr;
+    uint32_t idle_us= 10;
+    uint32_t line_us= 100;
+    bool verbose= false;
+    int repeat= 0;
+    int kinematics_repeat= 0;
+    uint32_t sd_kbytes= 0;
+    uint32_t plan9_kbytes= 0;
+    uint32_t http_kbytes= 0;
+    const char *convert_fn= nullptr;
+    int decimals= 3;
+    bool crc= false;
+    std::string overrides;
+    int link_us= -1;
+    bool windowed= false;
+
+    int c;
+    while((c= getopt(argc, argv, "c:o:t:i:l:vb:k:s:p:h:e:d:xa:w")) != -1) {
+        switch(c) {
+            case 'c': config_fn= optarg; break;
+            case 'o': overrides.append(optarg).append("\n"); break;
+            case 't': timeline_fn= optarg; break;
+            case 'i': idle_us= strtoul(optarg, nullptr, 10); break;
+            case 'l': line_us= strtoul(optarg, nullptr, 10); break;
+            case 'v': verbose= true; break;
+            case 'b': repeat= strtol(optarg, nullptr, 10); break;
+            case 'k': kinematics_repeat= strtol(optarg, nullptr, 10); break;
+            case 's': sd_kbytes= strtoul(optarg, nullptr, 10); break;
+            case 'p': plan9_kbytes= strtoul(optarg, nullptr, 10); break;
+            case 'h': http_kbytes= strtoul(optarg, nullptr, 10); break;
+            case 'e': convert_fn= optarg; break;
+            case 'd': decimals= strtol(optarg, nullptr, 10); break;
+            case 'x': crc= true; break;
+            case 'a': link_us= strtol(optarg, nullptr, 10); break;
+            case 'w': windowed= true; break;
+            default: usage(argv[0]);
+        }
+    }
+    if(repeat > 0 && optind < argc) return parse_benchmark(repeat, argc, argv);
+    if(convert_fn != nullptr) {
+        if(optind >= argc || decimals < 0 || decimals > 6) usage(argv[0]);
+        return convert(convert_fn, decimals, crc, argc, argv);
+    }
+    if(sd_kbytes > 0) return sd_benchmark(sd_kbytes);
+    if(plan9_kbytes > 0) return plan9_benchmark(plan9_kbytes);
+    if(http_kbytes > 0) return http_benchmark(http_kbytes, verbose);
+    if(config_fn == nullptr || (optind >= argc && kinematics_repeat <= 0)) usage(argv[0]);
+
+    std::string config;
+    if(!read_file(config_fn, config)) {
+        fprintf(stderr, "could not read config file %s\n", config_fn);
+        return 2;
+    }
+    // FirmConfigSource expects the config to end in a newline, and the last setting found wins
+    config.append("\n");
+    config.append(overrides);
+
+    host_kernel_setup(config.data(), config.data() + config.size());
+    host_kernel_set_idle_time(idle_us);
+    if(kinematics_repeat > 0) return kinematics_benchmark(kinematics_repeat);
+
+    StepTimeline timeline;
+    add_actuator(timeline, "alpha");
+    add_actuator(timeline, "beta");
+    add_actuator(timeline, "gamma");
+    for(size_t i = 0; i < timeline.get_num_actuators() && i < THEROBOT->actuators.size(); i++) {
+        timeline.set_position(i, THEROBOT->actuators[i]->get_current_step());
+    }
+
+    FILE *timeline_fp= nullptr;
+    if(timeline_fn != nullptr) {
+        timeline_fp= fopen(timeline_fn, "w");
+        if(timeline_fp == nullptr) {
+            fprintf(stderr, "could not open %s\n", timeline_fn);
+            return 2;
+        }
+        timeline.set_dump_file(timeline_fp);
+    }
+
+    host_gpio_attach([&timeline](uint8_t port, uint8_t pin, bool level) { timeline.on_gpio_edge(port, pin, level); });
+    host_isr_attach(on_isr);
+
+    SimStreamOutput stream;
+    stream.verbose= verbose;
+
+    // the lines of a streamed job are sent by the host in StreamLink as it is told it may
+    std::vector<std::string> link_lines;
+    StreamLink *link= nullptr;
+    if(link_us >= 0) {
+        if(!read_link_lines(argc, argv, link_lines)) return 2;
+        link= new StreamLink(link_lines, link_us, windowed);
+        link->verbose= verbose;
+        THEKERNEL->add_module(link);
+    }
+
+    uint32_t lines= 0;
+    uint64_t plan_ns= 0;
+    host_time::time_point run_start= host_time::now();
+
+    // a line of text, or a motion record from a binary file when record is set
+    auto feed= [&](const char *text, const BinaryGcodeRecord *record) -> bool {
+        // time for the line to arrive, a streamed one has already arrived
+        if(link == nullptr) host_clock_advance_us(line_us);
+
+        // the line is copied into the message the way the serial port would have before it is counted
+        struct SerialMessage message;
+        if(record == nullptr) {
+            message.message = text;
+            message.stream = link != nullptr ? static_cast<StreamOutput *>(link) : &stream;
+        }
+
+        // the ISR time spent while the planner waits for room in the queue is not planner time
+        uint64_t isr_ns= sim.isr_ns;
+        // the link's own strings are not the firmware's
+        count_allocations= link == nullptr;
+        host_time::time_point start= host_time::now();
+        if(record != nullptr) {
+            BinaryGcodeDecoder::dispatch(*record, link != nullptr ? static_cast<StreamOutput *>(link) : &stream);
+        } else {
+            THEKERNEL->call_event(ON_CONSOLE_LINE_RECEIVED, &message);
+        }
+        THEKERNEL->call_event(ON_MAIN_LOOP);
+        THEKERNEL->call_event(ON_IDLE);
+        THEKERNEL->count_main_loop();
+        plan_ns += elapsed_ns(start) - (sim.isr_ns - isr_ns);
+        count_allocations= false;
+        ++lines;
+
+        if(THEKERNEL->is_halted()) {
+            fprintf(stderr, "halted at line %u: %s\n", lines, record != nullptr ? "binary record" : text);
+            return false;
+        }
+        return true;
+    };
+
+    sim.feeding= true;
+    if(link != nullptr) {
+        // the main loop takes a line or a record when one has come, otherwise it goes round the idle loop
+        std::string line;
+        while(!link->is_finished()) {
+            if(link->is_binary()) {
+                BinaryGcodeDecoder::result_t r= link->get_record();
+                if(r == BinaryGcodeDecoder::ERROR) {
+                    fprintf(stderr, "binary stream: %s after %u records\n", link->get_decoder().get_error(), link->get_decoder().get_records());
+                    return 1;
+                }
+                if(r == BinaryGcodeDecoder::MOTION && !feed(nullptr, &link->get_decoder().get_record())) return 1;
+                if(r == BinaryGcodeDecoder::TEXT_LINE && !feed(link->get_decoder().get_text(), nullptr)) return 1;
+                if(r == BinaryGcodeDecoder::NEED_MORE) {
+                    THEKERNEL->call_event(ON_MAIN_LOOP);
+                    THEKERNEL->call_event(ON_IDLE);
+                    THEKERNEL->count_main_loop();
+                }
+            } else if(link->get_line(line)) {
+                if(link->command(line)) continue;
+                if(!feed(line.c_str(), nullptr)) return 1;
+                link->line_done();
+            } else {
+                THEKERNEL->call_event(ON_MAIN_LOOP);
+                THEKERNEL->call_event(ON_IDLE);
+                THEKERNEL->count_main_loop();
+            }
+        }
+    }
+    for(int f= optind; link == nullptr && f < argc; f++) {
+        FILE *fp= fopen(argv[f], "r");
+        if(fp == nullptr) {
+            fprintf(stderr, "could not open %s\n", argv[f]);
+            return 2;
+        }
+
+        char buf[256];
+        size_t n= fread(buf, 1, BinaryGcodeDecoder::header_size, fp);
+        if(BinaryGcodeDecoder::is_header(buf, n)) {
+            BinaryGcodeDecoder decoder;
+            BinaryGcodeDecoder::result_t r= decoder.put(buf, n, n);
+            while(r != BinaryGcodeDecoder::ENDED && (n= fread(buf, 1, sizeof(buf), fp)) > 0) {
+                for(size_t i= 0, used; i < n && r != BinaryGcodeDecoder::ENDED; i += used) {
+                    r= decoder.put(&buf[i], n - i, used);
+                    if(r == BinaryGcodeDecoder::ERROR) {
+                        fprintf(stderr, "%s: %s after %u records\n", argv[f], decoder.get_error(), decoder.get_records());
+                        return 1;
+                    }
+                    if(r == BinaryGcodeDecoder::MOTION && !feed(nullptr, &decoder.get_record())) return 1;
+                    if(r == BinaryGcodeDecoder::TEXT_LINE && !feed(decoder.get_text(), nullptr)) return 1;
+                }
+            }
+            fclose(fp);
+            continue;
+        }
+        rewind(fp);
+
+        while(fgets(buf, sizeof(buf), fp) != NULL) {
+            size_t len= strlen(buf);
+            while(len > 0 && (buf[len - 1] == '\n' || buf[len - 1] == '\r')) buf[--len]= '\0';
+            if(len == 0) continue;
+            if(!feed(buf, nullptr)) return 1;
+        }
+        fclose(fp);
+    }
+    sim.feeding= false;
+    if(sim.starved) sim.starved_counts += host_clock_counts() - sim.starved_since;
+
+    THECONVEYOR->wait_for_idle();
+
+    double run_s= elapsed_ns(run_start) / 1e9;
+    double job_s= host_clock_seconds();
+
+    printf("lines: %u, oks: %u, blocks: %u\n", lines, link != nullptr ? link->get_oks() : stream.oks, sim.blocks);
+    if(link != nullptr && !link->get_error().empty()) {
+        fprintf(stderr, "streaming failed: %s\n", link->get_error().c_str());
+        return 1;
+    }
+    if(link != nullptr && link->get_taken() != link->get_sent()) {
+        fprintf(stderr, "streaming failed: the board took %u of the %u lines sent\n", link->get_taken(), link->get_sent());
+        return 1;
+    }
+    if(link != nullptr && link->get_binary_records() > 0) {
+        printf("streamed binary: %u records up to the ok binary reply, refused %u times with the window on\n",
+            link->get_binary_records(), link->get_binary_refused());
+    }
+    if(link != nullptr) {
+        double done_s= link->get_last_done_ns() / 1e9;
+        printf("streamed: %s, %d us each way, %1.0f lines/s, %u acks\n", windowed ? "window" : "ok per line", link_us,
+            done_s > 0 ? lines / done_s : 0.0, link->get_acks());
+    }
+    printf("virtual job time: %1.4f s, host time: %1.4f s (%1.1fx real time)\n", job_s, run_s, job_s / run_s);
+    if(link != nullptr) {
+        printf("planner: %1.0f lines/s (host)\n", plan_ns > 0 ? lines * 1e9 / plan_ns : 0.0);
+    } else {
+        printf("planner: %1.0f lines/s (host), %1.2f heap allocations per line\n", plan_ns > 0 ? lines * 1e9 / plan_ns : 0.0, (double)allocations / lines);
+    }
+    printf("recalculate: %1.2f blocks visited per block appended\n", THEKERNEL->planner->get_blocks_per_append());
+    if(THEROBOT->linear_arm_solution) {
+        printf("arm solution: linear, lines are not segmented\n");
+    } else {
+        uint32_t ik= THEROBOT->get_ik_cache_hits() + THEROBOT->get_ik_cache_misses();
+        printf("arm solution: %u inverse kinematics lookups, %1.1f%% cache hits\n", ik, ik > 0 ? 100.0 * THEROBOT->get_ik_cache_hits() / ik : 0.0);
+    }
+    printf("step ticker: %llu interrupts, avg %1.0f ns %1.0f cycles max %llu ns per interrupt, %1.0f cycles per ms of job (host)\n",
+        (unsigned long long)sim.isr_calls, sim.isr_calls > 0 ? (double)sim.isr_ns / sim.isr_calls : 0.0,
+        sim.isr_calls > 0 ? (double)sim.isr_cycles / sim.isr_calls : 0.0, (unsigned long long)sim.isr_max_ns,
+        job_s > 0 ? sim.isr_cycles / (job_s * 1000) : 0.0);
+    printf("starvation: %u times, %1.4f s\n", sim.starvations, (double)sim.starved_counts / HOST_TIMER_CLOCK);
+    printf("step ticker starvation count: %u times, %1.4f s\n", THEKERNEL->step_ticker->get_starvations(), THEKERNEL->step_ticker->get_starved_seconds());
+    const std::array<uint32_t, 8>& depth= THECONVEYOR->get_depth_histogram();
+    printf("queue depth at block start, in eighths of %u blocks:", (unsigned)THECONVEYOR->get_queue_size());
+    for(uint32_t n : depth) printf(" %u", n);
+    printf("\n");
+    printf("step timeline:\n");
+    timeline.report(stdout);
+
+    if(timeline_fp != nullptr) fclose(timeline_fp);
+
+    // every step the motors counted must show up on the pins, and they must end up where the planner sent them
+    int ret= 0;
+    for(size_t i = 0; i < timeline.get_num_actuators() && i < THEROBOT->actuators.size(); i++) {
+        StepperMotor *m= THEROBOT->actuators[i];
+        int32_t pos= (int32_t)m->get_current_step();
+        if(timeline.get_position(i) != pos || pos != m->get_last_milestone_steps()) {
+            printf("ERROR: %s pins say %d, motor says %d, planned %d\n", timeline.get_name(i), timeline.get_position(i), pos, m->get_last_milestone_steps());
+            ret= 1;
+        }
+    }
+
+    host_kernel_teardown();
+    return ret;
+}
@@ -9,6 +9,7 @@ from __future__ import print_function
 import sys
 import telnetlib
 import argparse
+import time
 
 # Define command line argument interface
 parser = argparse.ArgumentParser(description='Stream g-code file to Smoothie over telnet.')
@@ -18,6 +19,8 @@ parser.add_argument('ipaddr',
         help='Smoothie IP address')
 parser.add_argument('-q','--quiet',action='store_true', default=False,
         help='suppress output text')
+parser.add_argument('-w','--window',action='store_true', default=False,
+        help='send as many lines ahead as the acks from the window command allow, instead of counting each ok')
 args = parser.parse_args()
 
 f = args.gcode_file
@@ -30,21 +33,72 @@ tn = telnetlib.Telnet(args.ipaddr)
 # read startup prompt
 tn.read_until("> ")
 
-okcnt= 0
-linecnt= 0
-for line in f:
-    tn.write(line)
-    linecnt+=1
-    rep= tn.read_eager()
-    okcnt += rep.count("ok")
-    if verbose: print("SND " + str(linecnt) + ": " + line.strip() + " - " + str(okcnt))
-
-print("Waiting for complete...")
-
-while okcnt < linecnt:
-    rep= tn.read_some()
-    okcnt += rep.count("ok")
-    if verbose: print(str(linecnt) + " - " + str(okcnt) )
+start= time.time()
+
+if args.window:
+    # smoothie reports "ack <done> <window>" every so often instead of an ok for each line, and lines may be sent
+    # until done + window have been sent
+    tn.write("window\n")
+    rx= ""
+    done= 0
+    limit= 0
+    started= False
+    linecnt= 0
+
+    def read_acks(blocking):
+        global rx, done, limit, started
+        rx += tn.read_some() if blocking else tn.read_eager()
+        while "\n" in rx:
+            l, rx= rx.split("\n", 1)
+            l= l.strip()
+            if l.startswith("ack "):
+                a= l.split()
+                done= int(a[1])
+                limit= done + int(a[2])
+                started= True
+            elif l.startswith("error") or l.startswith("!!") or l.startswith("HALTED") or l.startswith("ALARM"):
+                print(l)
+                sys.exit(1)
+            elif l and verbose:
+                print("RCV " + l)
+
+    for line in f:
+        line= line.strip()
+        if not line: continue
+        while not started or linecnt >= limit:
+            read_acks(True)
+        tn.write(line + "\n")
+        linecnt+=1
+        if verbose: print("SND " + str(linecnt) + ": " + line + " - " + str(done))
+        read_acks(False)
+
+    print("Waiting for complete...")
+
+    while done < linecnt:
+        read_acks(True)
+        if verbose: print(str(linecnt) + " - " + str(done))
+
+    tn.write("window off\n")
+
+else:
+    okcnt= 0
+    linecnt= 0
+    for line in f:
+        tn.write(line)
+        linecnt+=1
+        rep= tn.read_eager()
+        okcnt += rep.count("ok")
+        if verbose: print("SND " + str(linecnt) + ": " + line.strip() + " - " + str(okcnt))
+
+    print("Waiting for complete...")
+
+    while okcnt < linecnt:
+        rep= tn.read_some()
+        okcnt += rep.count("ok")
+        if verbose: print(str(linecnt) + " - " + str(okcnt) )
+
+elapsed= time.time() - start
+print("Streamed " + str(linecnt) + " lines in " + "%1.1f" % elapsed + " s, " + "%1.0f" % (linecnt / elapsed if elapsed > 0 else 0) + " lines/s")
 
 tn.write("exit\n")
 tn.read_all()
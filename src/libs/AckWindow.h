@@ -0,0 +1,99 @@
+/*
+      This file is part of Smoothie (http://smoothieware.org/). The motion control part is heavily based on Grbl (https://github.com/simen/grbl).
+      Smoothie is free software: you can redistribute it and/or modify it under the terms of the GNU General Public License as published by the Free Software Foundation, either version 3 of the License, or (at your option) any later version.
+      Smoothie is distributed in the hope that it will be useful, but WITHOUT ANY WARRANTY; without even the implied warranty of MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the GNU General Public License for more details.
+      You should have received a copy of the GNU General Public License along with Smoothie. If not, see <http://www.gnu.org/licenses/>.
+*/
+
+#ifndef ACKWINDOW_H
+#define ACKWINDOW_H
+
+#include <stdint.h>
+#include <stdio.h>
+#include <string.h>
+
+// Windowed acknowledgements for a connection that streams lines, started by the window command.
+// Rather than wait for the ok of each line before sending the next, the host is told now and then how many lines
+// are done and how many it may have sent that are not, so the receive buffer stays full instead of the connection
+// sitting idle for a round trip after every line. The report is
+//     ack <done> <window>
+// done counts the lines since the window command, and the host may send lines until it has sent done + window.
+// The window is the lines held, taken and not done or still waiting in the receive buffer, as many more as fit in
+// the room left at the average line length so far, and one more for each waiting line a free block in the queue
+// will take straight away.
+// The bare ok for a line is not sent, anything else is, including an ok followed by a reply.
+// It is only used from the main loop.
+class AckWindow {
+    public:
+        // the longest the host is left without hearing of lines done
+        static const uint32_t REPORT_US= 100000;
+
+        AckWindow() { active= false; }
+
+        void start(uint32_t now_us)
+        {
+            active= true;
+            taken= done= 0;
+            reported_done= reported_window= 0;
+            last_report= now_us;
+            average= 32 << 4;
+        }
+        void stop() { active= false; }
+        bool is_active() const { return active; }
+
+        // the reply the reports stand in for
+        bool is_ok(const char *str) const { return active && (strcmp(str, "ok\r\n") == 0 || strcmp(str, "ok\n") == 0); }
+
+        // a line that took size bytes of the receive buffer has been taken out of it
+        void line_taken(uint32_t size)
+        {
+            taken++;
+            average += ((int32_t)(size << 4) - (int32_t)average) / 8;
+            if(average < 16) average= 16;
+        }
+        // and its command done, where its ok would be sent, the window command's own line was taken before the
+        // counts started so is not counted
+        void line_done() { if(done != taken) done++; }
+
+        uint32_t get_window(uint32_t waiting, uint32_t room, uint32_t blocks) const
+        {
+            // waiting lines that will go straight into free blocks will have made their room by the time more come
+            uint32_t more= (room << 4) / average + (waiting < blocks ? waiting : blocks);
+            return taken - done + waiting + more;
+        }
+
+        // writes the report into buf if one is due and returns its length, otherwise returns 0
+        // waiting is the complete lines in the receive buffer, room the bytes it can still take, blocks the free
+        // blocks in the queue
+        size_t report(uint32_t waiting, uint32_t room, uint32_t blocks, uint32_t now_us, char *buf, size_t size)
+        {
+            if(!active) return 0;
+            uint32_t window= get_window(waiting, room, blocks);
+
+            if(done == reported_done) {
+                // only a host that was allowed nothing needs to hear that the window has opened
+                if(reported_window > 0 || window == 0) return 0;
+            } else if(done - reported_done < (reported_window + 1) / 2 && now_us - last_report < REPORT_US) {
+                // lines done are saved up until half the window has been used, which is at once if the host has sent
+                // all it was allowed, or for a while
+                return 0;
+            }
+
+            reported_done= done;
+            reported_window= window;
+            last_report= now_us;
+            int n= snprintf(buf, size, "ack %lu %lu\n", (unsigned long)done, (unsigned long)window);
+            return (n > 0 && (size_t)n < size) ? n : 0;
+        }
+
+    private:
+        uint32_t taken;
+        uint32_t done;
+        uint32_t reported_done;
+        uint32_t reported_window;
+        uint32_t last_report;
+        uint32_t average;           // bytes per line, in 1/16ths
+        bool active;
+};
+
+#endif
@@ -10,32 +10,86 @@
 #include "libs/Kernel.h"
 #include "libs/Pin.h"
 #include "libs/ADC/adc.h"
-#include "libs/Pin.h"
-#include "libs/Median.h"
+#include "Config.h"
+#include "ConfigValue.h"
+#include "checksumm.h"
+#include "platform_memory.h"
 
 #include <cstring>
-#include <algorithm>
+#include <string>
 
 #include "mbed.h"
 
 // This is an interface to the mbed.org ADC library you can find in libs/ADC/adc.h
 // TODO : Having the same name is confusing, should change that
 
+#define adc_filter_checksum                 CHECKSUM("adc_filter")
+#define adc_filter_window_checksum          CHECKSUM("adc_filter_window")
+
+// The lowest numbered channel has the highest priority, which it needs as a result has to be taken before the next
+// conversion replaces it. SDCard uses channels 6 and 7
+#define ADC_DMA                 LPC_GPDMACH0
+#define ADC_DMA_CHANNEL         0
+// GPDMA peripheral number of the ADC
+#define ADC_DMA_PERIPHERAL      4
+
+// a GPDMA linked list item
+struct dma_lli_t {
+    uint32_t src;
+    uint32_t dest;
+    uint32_t next;
+    uint32_t control;
+};
+
 Adc *Adc::instance;
 
-static void sample_isr(int chan, uint32_t value)
+extern "C" void DMA_IRQHandler(void)
 {
-    Adc::instance->new_sample(chan, value);
+    if(LPC_GPDMA->DMACIntTCStat & (1 << ADC_DMA_CHANNEL)) {
+        LPC_GPDMA->DMACIntTCClear = 1 << ADC_DMA_CHANNEL;
+        Adc::instance->on_dma();
+    }
 }
 
 Adc::Adc()
 {
     instance = this;
-    // ADC sample rate need to be fast enough to be able to read the enabled channels within the thermistor poll time
-    // even though ther maybe 32 samples we only need one new one within the polling time
-    const uint32_t sample_rate= 1000; // 1KHz sample rate
+    memset(totals, 0, sizeof(totals));
+    memset(counts, 0, sizeof(counts));
+
+    // the ADC clock is 64 times this and a conversion takes 65 of them, the enabled channels share the conversions so
+    // with four enabled each is read about 2000 times a second, which is 125 readings a second after oversampling
+    const uint32_t sample_rate= 8000;
     this->adc = new mbed::ADC(sample_rate, 8);
-    this->adc->append(sample_isr);
+
+    // the GPDMA can not get at the local RAM, so the ring and the list that takes it round and round are in AHB RAM
+    ring= (volatile uint32_t *)AHB0.alloc(2 * dma_half * sizeof(uint32_t));
+    dma_lli_t *lli= (dma_lli_t *)AHB0.alloc(2 * sizeof(dma_lli_t));
+    memset((void *)ring, 0, 2 * dma_half * sizeof(uint32_t));
+
+    // a word at a time, increment the destination and interrupt at the end of each half
+    uint32_t control= dma_half | (2 << 18) | (2 << 21) | (1UL << 27) | (1UL << 31);
+    for (int i = 0; i < 2; ++i) {
+        lli[i].src= (uintptr_t)&LPC_ADC->ADGDR;
+        lli[i].dest= (uintptr_t)&ring[i * dma_half];
+        lli[i].next= (uintptr_t)&lli[1 - i];
+        lli[i].control= control;
+    }
+
+    LPC_SC->PCONP |= 1 << 29;   // power up the GPDMA
+    LPC_GPDMA->DMACConfig = 1;  // enable, little endian
+    LPC_GPDMA->DMACIntTCClear = 1 << ADC_DMA_CHANNEL;
+    LPC_GPDMA->DMACIntErrClr = 1 << ADC_DMA_CHANNEL;
+
+    ADC_DMA->DMACCSrcAddr = lli[0].src;
+    ADC_DMA->DMACCDestAddr = lli[0].dest;
+    ADC_DMA->DMACCLLI = lli[0].next;
+    ADC_DMA->DMACCControl = lli[0].control;
+    ADC_DMA->DMACCConfig = 1 | (ADC_DMA_PERIPHERAL << 1) | (2 << 11) | (1 << 15);  // enable, peripheral to memory, interrupt
+
+    // the results come by DMA, so the ADC's own interrupt is not wanted
+    NVIC_DisableIRQ(ADC_IRQn);
+    NVIC_EnableIRQ(DMA_IRQn);
 }
 
 /*
@@ -57,68 +111,88 @@ void Adc::enable_pin(Pin *pin)
 {
     PinName pin_name = this->_pin_to_pinname(pin);
     int channel = adc->_pin_to_channel(pin_name);
-    memset(sample_buffers[channel], 0, sizeof(sample_buffers[0]));
+
+    __disable_irq();
+    totals[channel]= 0;
+    counts[channel]= 0;
+    filters[channel].clear();
+    __enable_irq();
 
     this->adc->burst(1);
     this->adc->setup(pin_name, 1);
-    this->adc->interrupt_state(pin_name, 1);
+    // asks the GPDMA to take each result of the channel, the global one must be off in burst mode
+    LPC_ADC->ADINTEN = (LPC_ADC->ADINTEN | (1 << channel)) & ~0x100;
 }
 
-// Keeps the last 8 values for each channel
-// This is called in an ISR, so sample_buffers needs to be accessed atomically
-void Adc::new_sample(int chan, uint32_t value)
+void Adc::configure_filter(Pin *pin, uint16_t module_checksum, uint16_t name_checksum)
 {
-    // Shuffle down and add new value to the end
-    if(chan < num_channels) {
-        memmove(&sample_buffers[chan][0], &sample_buffers[chan][1], sizeof(sample_buffers[0]) - sizeof(sample_buffers[0][0]));
-        sample_buffers[chan][num_samples - 1] = (value >> 4) & 0xFFF; // the 12 bit ADC reading
+    std::string type= THEKERNEL->config->value(module_checksum, name_checksum, adc_filter_checksum)->by_default("median")->as_string();
+    uint16_t window= THEKERNEL->config->value(module_checksum, name_checksum, adc_filter_window_checksum)->by_default(5)->as_int();
+
+    if(type == "average") {
+        set_filter(pin, SampleFilter::AVERAGE, window);
+    } else if(type == "iir") {
+        set_filter(pin, SampleFilter::IIR, window);
+    } else {
+        set_filter(pin, SampleFilter::MEDIAN, window);
     }
 }
 
-//#define USE_MEDIAN_FILTER
-// Read the filtered value ( burst mode ) on a given pin
-unsigned int Adc::read(Pin *pin)
+void Adc::set_filter(Pin *pin, uint8_t type, uint16_t window)
 {
-    PinName p = this->_pin_to_pinname(pin);
-    int channel = adc->_pin_to_channel(p);
+    int channel = _pin_to_channel(pin);
+    if(channel < 0) return;
 
-    uint16_t median_buffer[num_samples];
-    // needs atomic access TODO maybe be able to use std::atomic here or some lockless mutex
     __disable_irq();
-    memcpy(median_buffer, sample_buffers[channel], sizeof(median_buffer));
+    filters[channel].set(type, window);
     __enable_irq();
+}
 
-#ifdef USE_MEDIAN_FILTER
-    // returns the median value of the last 8 samples
-    return median_buffer[quick_median(median_buffer, num_samples)];
-
-#elif defined(OVERSAMPLE)
-    // Oversample to get 2 extra bits of resolution
-    // weed out top and bottom worst values then oversample the rest
-    // put into a 4 element moving average and return the average of the last 4 oversampled readings
-    static uint16_t ave_buf[num_channels][4] =  { {0} };
-    std::sort(median_buffer, median_buffer + num_samples);
-    uint32_t sum = 0;
-    for (int i = num_samples / 4; i < (num_samples - (num_samples / 4)); ++i) {
-        sum += median_buffer[i];
-    }
-    // this slows down the rate of change a little bit
-    ave_buf[channel][3]= ave_buf[channel][2];
-    ave_buf[channel][2]= ave_buf[channel][1];
-    ave_buf[channel][1]= ave_buf[channel][0];
-    ave_buf[channel][0]= sum >> OVERSAMPLE;
-    return roundf((ave_buf[channel][0]+ave_buf[channel][1]+ave_buf[channel][2]+ave_buf[channel][3])/4.0F);
-
+// Called from the GPDMA interrupt at the end of each half of the ring
+// The results in the half it has just finished are added to the totals for their channels, and each time a channel
+// has enough the oversampled reading goes into its filter
+void Adc::on_dma()
+{
+    // the half the DMA is not writing now is the one that is done
+    int done= (ADC_DMA->DMACCDestAddr - (uintptr_t)ring) < dma_half * sizeof(uint32_t) ? 1 : 0;
+    volatile uint32_t *p= &ring[done * dma_half];
+
+    for (int i = 0; i < dma_half; ++i) {
+        uint32_t r= p[i];
+        if((r & (1UL << 31)) == 0) continue; // not a finished conversion
+        int chan= (r >> 24) & 7;
+        totals[chan] += (r >> 4) & 0xFFF; // the 12 bit ADC reading
+        if(++counts[chan] == num_samples) {
+#ifdef OVERSAMPLE
+            // the sum of 4^n readings has 2n more bits, n of which are more resolution and the rest are dropped
+            filters[chan].add(totals[chan] >> OVERSAMPLE);
 #else
-    // sort the 8 readings and return the average of the middle 4
-    std::sort(median_buffer, median_buffer + num_samples);
-    int sum = 0;
-    for (int i = num_samples / 4; i < (num_samples - (num_samples / 4)); ++i) {
-        sum += median_buffer[i];
+            filters[chan].add(totals[chan]);
+#endif
+            totals[chan]= 0;
+            counts[chan]= 0;
+        }
     }
-    return sum / (num_samples / 2);
+}
 
-#endif
+// Read the filtered value ( burst mode ) on a given pin
+unsigned int Adc::read(Pin *pin)
+{
+    int channel = _pin_to_channel(pin);
+    if(channel < 0) return 0;
+
+    // the filter is updated in the DMA interrupt, and it is only a copy of its result that is wanted
+    __disable_irq();
+    unsigned int v= filters[channel].get();
+    __enable_irq();
+    return v;
+}
+
+int Adc::_pin_to_channel(Pin *pin)
+{
+    PinName p = this->_pin_to_pinname(pin);
+    if(p == NC) return -1;
+    return adc->_pin_to_channel(p);
 }
 
 // Convert a smoothie Pin into a mBed Pin
@@ -11,8 +11,9 @@
 #define ADC_H
 
 #include "PinNames.h" // mbed.h lib
+#include "SampleFilter.h"
 
-#include <cmath>
+#include <stdint.h>
 
 class Pin;
 namespace mbed {
@@ -23,15 +24,23 @@ namespace mbed {
 // 2 bits means the 12bit ADC is 14 bits of resolution
 #define OVERSAMPLE 2
 
+// The ADC converts the enabled channels one after another in burst mode, and the GPDMA copies each result into a
+// ring in AHB RAM, so there is an interrupt for every half of the ring rather than for every conversion.
+// The interrupt adds each result to a total for its channel, 4^OVERSAMPLE of them make one oversampled reading, and
+// that goes into the channel's SampleFilter. read() is then just the filter's result.
 class Adc
 {
 public:
     Adc();
     void enable_pin(Pin *pin);
+    // sets the filter for the pin from <module>.<name>.adc_filter, which is median, average or iir, and
+    // <module>.<name>.adc_filter_window
+    void configure_filter(Pin *pin, uint16_t module_checksum, uint16_t name_checksum);
+    void set_filter(Pin *pin, uint8_t type, uint16_t window);
     unsigned int read(Pin *pin);
 
     static Adc *instance;
-    void new_sample(int chan, uint32_t value);
+    void on_dma();
     // return the maximum ADC value, base is 12bits 4095.
 #ifdef OVERSAMPLE
     int get_max_value() const { return 4095 << OVERSAMPLE;}
@@ -41,17 +50,24 @@ public:
 
 private:
     PinName _pin_to_pinname(Pin *pin);
+    int _pin_to_channel(Pin *pin);
     mbed::ADC *adc;
 
-    static const int num_channels= 6;
+    static const int num_channels= 8;
 #ifdef OVERSAMPLE
-    // we need 4^n sample to oversample and we get double that to filter out spikes
-    static const int num_samples= powf(4, OVERSAMPLE)*2;
+    // 4^n samples give n more bits
+    static const int num_samples= 1 << (2 * OVERSAMPLE);
 #else
-    static const int num_samples= 8;
+    static const int num_samples= 1;
 #endif
-    // buffers storing the last num_samples readings for each channel
-    uint16_t sample_buffers[num_channels][num_samples];
+    // the ring is two halves of this many results
+    static const int dma_half= 32;
+
+    volatile uint32_t *ring;
+    // the results so far towards the next oversampled reading of each channel, and how many
+    uint32_t totals[num_channels];
+    uint8_t counts[num_channels];
+    SampleFilter filters[num_channels];
 };
 
 #endif
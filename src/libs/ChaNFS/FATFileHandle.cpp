@@ -8,6 +8,12 @@
 #include <stdlib.h>
 #include "ff.h"
 #include "FATFileSystem.h"
+#include "platform_memory.h"
+
+// entries in the cluster link map a file starts with, two per fragment of the file plus three, and the most it
+// may have for a badly fragmented file before seeks go back to following the FAT chain
+#define LINK_MAP_SIZE     32
+#define LINK_MAP_MAX_SIZE 512
 
 namespace mbed {
 
@@ -37,6 +43,9 @@ FATFileHandle::FATFileHandle(FIL_t fh) {
 int FATFileHandle::close() {
     FFSDEBUG("close\n");
     int retval = f_close(&_fh);
+#if _USE_FASTSEEK
+    if(_fh.cltbl != NULL) AHB0.dealloc(_fh.cltbl);
+#endif
     delete this;
     return retval;
 }
@@ -67,6 +76,31 @@ int FATFileHandle::isatty() {
     return 0;
 }
         
+// Maps where each run of clusters of the file is, so a seek and every cluster boundary read after it look the
+// cluster up in the map rather than following the FAT chain from the start of the file. Making it follows the
+// chain once. It is kept in AHB0 and freed when the file is closed, if there is no room for it the file is seeked
+// the usual way.
+void FATFileHandle::create_link_map() {
+#if _USE_FASTSEEK
+    DWORD size = LINK_MAP_SIZE;
+    while(true) {
+        DWORD *tbl = (DWORD *)AHB0.alloc(size * sizeof(DWORD));
+        if(tbl == NULL) return;
+        tbl[0] = size;
+        _fh.cltbl = tbl;
+        FRESULT res = f_lseek(&_fh, CREATE_LINKMAP);
+        if(res == FR_OK) return;
+
+        // tbl[0] has the size that is needed
+        DWORD needed = tbl[0];
+        _fh.cltbl = NULL;
+        AHB0.dealloc(tbl);
+        if(res != FR_NOT_ENOUGH_CORE || needed > LINK_MAP_MAX_SIZE) return;
+        size = needed;
+    }
+#endif
+}
+
 off_t FATFileHandle::lseek(off_t position, int whence) {
     FFSDEBUG("lseek(%i,%i)\n",position,whence);
     if(whence == SEEK_END) {
@@ -74,6 +108,12 @@ off_t FATFileHandle::lseek(off_t position, int whence) {
     } else if(whence==SEEK_CUR) {
         position += _fh.fptr;
     }
+#if _USE_FASTSEEK
+    // only files that are read, the map cannot follow a file that grows
+    if(_fh.cltbl == NULL && !(_fh.flag & FA_WRITE) && position != 0 && position != (off_t)_fh.fptr) {
+        create_link_map();
+    }
+#endif
     FRESULT res = f_lseek(&_fh, position);
     if(res) {
         FFSDEBUG("lseek failed (%d, %s)\n", res, FR_ERRORS[res]);
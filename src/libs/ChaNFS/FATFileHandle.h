@@ -24,6 +24,8 @@ public:
 
 protected:
 
+    void create_link_map();
+
     FIL_t _fh;
 
 };
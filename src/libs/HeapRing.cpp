@@ -139,6 +139,15 @@ template<class kind> bool HeapRing<kind>::is_full() const
     return r;
 }
 
+template<class kind> unsigned int HeapRing<kind>::free_count() const
+{
+    if (length == 0)
+        return 0;
+
+    unsigned int h = head_i, t = tail_i;
+    return (t > h) ? t - h - 1 : length - 1 - (h - t);
+}
+
 template<class kind> bool HeapRing<kind>::is_empty() const
 {
     //__disable_irq();
@@ -37,6 +37,8 @@ public:
      */
     bool is_empty(void) const;
     bool is_full(void) const;
+    // items that can be added before it is full
+    unsigned int free_count(void) const;
 
     /*
      * resize
@@ -0,0 +1,126 @@
+/*
+      This file is part of Smoothie (http://smoothieware.org/). The motion control part is heavily based on Grbl (https://github.com/simen/grbl).
+      Smoothie is free software: you can redistribute it and/or modify it under the terms of the GNU General Public License as published by the Free Software Foundation, either version 3 of the License, or (at your option) any later version.
+      Smoothie is distributed in the hope that it will be useful, but WITHOUT ANY WARRANTY; without even the implied warranty of MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the GNU General Public License for more details.
+      You should have received a copy of the GNU General Public License along with Smoothie. If not, see <http://www.gnu.org/licenses/>.
+*/
+
+#ifndef INTERPOLATIONTABLE_H
+#define INTERPOLATIONTABLE_H
+
+#include <stdint.h>
+#include <math.h>
+
+// A smooth function of an integer, eg an ADC reading, as up to max_points points joined by straight lines.
+// build() places the points so that where the function bends sharply they are close together and where it is nearly
+// straight they are far apart. Each line is made about as long as it can be while staying within the tolerance of
+// the function at a quarter, half and three quarters of the way along it. If that takes more than max_points the
+// tolerance is raised by the square of how many too many, as the error of a line grows with the square of its length,
+// and it starts again. Looking a value up is then a binary search and one multiply, instead of whatever the function
+// costs.
+template<int max_points> class InterpolationTable {
+    public:
+        InterpolationTable() { n= 0; tolerance= 0; }
+
+        // f(x) is called a few times for each point, returns false if f is not finite somewhere between x_min and x_max
+        template<typename F> bool build(uint16_t x_min, uint16_t x_max, F f, float tolerance)
+        {
+            n= 0;
+            if(x_max <= x_min) return false;
+
+            for(;;) {
+                uint16_t a= x_min;
+                float fa= f(a);
+                if(!isfinite(fa)) return false;
+                n= 0;
+                add(a, fa);
+                int count= 1;
+
+                while(a < x_max) {
+                    // double the length while it fits, then halve the difference to within a sixteenth
+                    uint32_t good= a + 1, bad= 0;
+                    for(uint32_t len= 2; bad == 0; len *= 2) {
+                        uint32_t b= a + len < x_max ? a + len : x_max;
+                        if(fits(a, fa, b, f(b), f, tolerance)) good= b;
+                        else bad= b;
+                        if(b == x_max) break;
+                    }
+                    while(bad > good + 1 && bad - good > (good - a) / 16) {
+                        uint32_t b= (good + bad) / 2;
+                        if(fits(a, fa, b, f(b), f, tolerance)) good= b;
+                        else bad= b;
+                    }
+
+                    a= good;
+                    fa= f(a);
+                    if(!isfinite(fa)) {
+                        n= 0;
+                        return false;
+                    }
+                    if(count < max_points) add(a, fa);
+                    count++;
+                }
+
+                if(count <= max_points) {
+                    this->tolerance= tolerance;
+                    return true;
+                }
+                float r= (float)count / max_points;
+                tolerance *= r * r * 1.1F;
+            }
+        }
+
+        // x must be between get_min() and get_max()
+        float lookup(uint16_t x) const
+        {
+            // the last point at or below x
+            int lo= 0, hi= n - 1;
+            while(hi - lo > 1) {
+                int mid= (lo + hi) / 2;
+                if(xs[mid] <= x) lo= mid;
+                else hi= mid;
+            }
+            return ys[lo] + (ys[hi] - ys[lo]) * (x - xs[lo]) / (xs[hi] - xs[lo]);
+        }
+
+        // the largest difference from f over the whole table, every step values of x
+        template<typename F> float max_error(F f, uint16_t step= 1) const
+        {
+            float e= 0;
+            if(n < 2) return e;
+            for(uint32_t x= xs[0]; x <= xs[n - 1]; x += step) {
+                float d= fabsf(lookup(x) - f(x));
+                if(d > e) e= d;
+            }
+            return e;
+        }
+
+        bool is_empty() const { return n < 2; }
+        int size() const { return n; }
+        uint16_t get_min() const { return xs[0]; }
+        uint16_t get_max() const { return xs[n - 1]; }
+        // that build() ended up with
+        float get_tolerance() const { return tolerance; }
+
+    private:
+        void add(uint16_t x, float y) { xs[n]= x; ys[n]= y; n++; }
+
+        template<typename F> static bool fits(uint16_t a, float fa, uint16_t b, float fb, F f, float tolerance)
+        {
+            for(int q= 1; q < 4; q++) {
+                uint16_t x= a + (b - a) * q / 4;
+                if(x == a) continue;
+                float y= fa + (fb - fa) * (x - a) / (b - a);
+                float d= fabsf(y - f(x));
+                if(!(d <= tolerance)) return false;
+            }
+            return true;
+        }
+
+        uint16_t xs[max_points];
+        float ys[max_points];
+        float tolerance;
+        uint8_t n;
+};
+
+#endif
@@ -28,6 +28,7 @@
 #include "EndstopsPublicAccess.h"
 #include "Configurator.h"
 #include "SimpleShell.h"
+#include "us_ticker_api.h"
 
 #include "platform_memory.h"
 
@@ -40,6 +41,8 @@
 
 #define base_stepping_frequency_checksum            CHECKSUM("base_stepping_frequency")
 #define microseconds_per_step_pulse_checksum        CHECKSUM("microseconds_per_step_pulse")
+#define step_loops_checksum                         CHECKSUM("step_loops")
+#define step_loops_threshold_checksum               CHECKSUM("step_loops_threshold")
 #define disable_leds_checksum                       CHECKSUM("leds_disable")
 #define grbl_mode_checksum                          CHECKSUM("grbl_mode")
 #define ok_per_line_checksum                        CHECKSUM("ok_per_line")
@@ -126,6 +129,7 @@ Kernel::Kernel(){
 
     // Set other priorities lower than the timers
     NVIC_SetPriority(ADC_IRQn, 5);
+    NVIC_SetPriority(DMA_IRQn, 5);
     NVIC_SetPriority(USB_IRQn, 5);
 
     // If MRI is enabled
@@ -149,6 +153,13 @@ Kernel::Kernel(){
     this->step_ticker->set_frequency( this->base_stepping_frequency );
     this->step_ticker->set_unstep_time( microseconds_per_step_pulse );
 
+    // at step rates above the threshold do several ticks per step ticker interrupt
+    uint8_t step_loops = this->config->value(step_loops_checksum)->by_default(1)->as_number();
+    float step_loops_threshold = this->config->value(step_loops_threshold_checksum)->by_default(this->base_stepping_frequency / 4.0F)->as_number();
+    if(this->step_ticker->set_step_loops( step_loops, step_loops_threshold ) < step_loops) {
+        this->streams->printf("WARNING: step_loops is off, microseconds_per_step_pulse is more than a quarter of a step tick\n");
+    }
+
     // Core modules
     this->add_module( this->conveyor       = new Conveyor()      );
     this->add_module( this->gcode_dispatch = new GcodeDispatch() );
@@ -223,6 +234,20 @@ std::string Kernel::get_query_string()
     return str;
 }
 
+// called once per pass of the main loop, keeps the number of passes in the last whole second
+void Kernel::count_main_loop()
+{
+    ++main_loops;
+    uint32_t now= us_ticker_read();
+    if(now - main_loop_second >= 1000000) {
+        // the first second is partial so is not counted towards the minimum
+        if(main_loop_second != 0 && main_loops < min_main_loops_per_second) min_main_loops_per_second= main_loops;
+        main_loops_per_second= main_loops;
+        main_loops= 0;
+        main_loop_second= now;
+    }
+}
+
 // Add a module to Kernel. We don't actually hold a list of modules we just call its on_module_loaded
 void Kernel::add_module(Module* module){
     module->on_module_loaded();
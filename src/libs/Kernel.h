@@ -13,6 +13,7 @@
 #define THEROBOT THEKERNEL->robot
 
 #include "Module.h"
+#include <stdint.h>
 #include <array>
 #include <vector>
 #include <string>
@@ -56,6 +57,12 @@ class Kernel {
 
         std::string get_query_string();
 
+        // main loop rate, main() calls count_main_loop() once per pass
+        void count_main_loop();
+        uint32_t get_main_loops_per_second() const { return main_loops_per_second; }
+        uint32_t get_min_main_loops_per_second() const { return min_main_loops_per_second; }
+        void reset_main_loop_stats() { min_main_loops_per_second= UINT32_MAX; }
+
         // These modules are available to all other modules
         SerialConsole*    serial;
         StreamOutputPool* streams;
@@ -77,6 +84,10 @@ class Kernel {
     private:
         // When a module asks to be called for a specific event ( a hook ), this is where that request is remembered
         std::array<std::vector<Module*>, NUMBER_OF_DEFINED_EVENTS> hooks;
+        uint32_t main_loops{0};             // passes of the main loop in the current second
+        uint32_t main_loop_second{0};       // us_ticker time the current second started
+        uint32_t main_loops_per_second{0};  // passes in the last whole second
+        uint32_t min_main_loops_per_second{UINT32_MAX};
         struct {
             bool use_leds:1;
             bool halted:1;
@@ -0,0 +1,188 @@
+/*
+      This file is part of Smoothie (http://smoothieware.org/). The motion control part is heavily based on Grbl (https://github.com/simen/grbl).
+      Smoothie is free software: you can redistribute it and/or modify it under the terms of the GNU General Public License as published by the Free Software Foundation, either version 3 of the License, or (at your option) any later version.
+      Smoothie is distributed in the hope that it will be useful, but WITHOUT ANY WARRANTY; without even the implied warranty of MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the GNU General Public License for more details.
+      You should have received a copy of the GNU General Public License along with Smoothie. If not, see <http://www.gnu.org/licenses/>.
+*/
+
+#ifndef LINEBUFFER_H
+#define LINEBUFFER_H
+
+#include <stdint.h>
+#include <string.h>
+#include <string>
+
+// Receive buffer shared by the input streams.
+// A single producer (usually the RX interrupt) puts characters in, and when it sees the end of a line it records where
+// the line ends in a second ring. A single consumer (the main loop) can then tell if there is a line in O(1) and
+// take it out in one go, without scanning for the newline or popping a character at a time.
+// Neither side disables interrupts: the producer only writes head, line_head and the line ends, the consumer only
+// writes tail, line_tail and sets drop_partial.
+// A line that does not fit, or that arrives when the line ring is full, is dropped entirely up to the next end of
+// line rather than being delivered with characters missing.
+// length and lines must be powers of 2.
+template<int length, int lines= 32> class LineBuffer {
+    public:
+        LineBuffer() { head= tail= line_start= 0; line_head= line_tail= 0; discarding= drop_partial= false; }
+
+        // producer side
+
+        // \n, \r, ^D and ^Z end a line, they are kept in the buffer so get() sees them, get_line() removes \n and \r
+        static bool is_eol(char c) { return c == '\n' || c == '\r' || c == 4 || c == 26; }
+
+        // returns false if c was dropped
+        bool put(char c)
+        {
+            if(drop_partial) {
+                // flush() was called, forget the line being received and start afresh
+                head= line_start;
+                discarding= drop_partial= false;
+            }
+
+            if(discarding) {
+                if(is_eol(c)) discarding= false;
+                return false;
+            }
+
+            uint16_t next= (head + 1) & (length - 1);
+            if(next == tail || (is_eol(c) && ((line_head + 1) & (lines - 1)) == line_tail)) {
+                discard_line();
+                if(is_eol(c)) discarding= false;
+                return false;
+            }
+
+            buffer[head]= c;
+            barrier(); // the consumer must not see the character or the line before the data is there
+            head= next;
+            if(is_eol(c)) {
+                ends[line_head]= next;
+                line_start= next;
+                barrier();
+                line_head= (line_head + 1) & (lines - 1);
+            }
+            return true;
+        }
+
+        // puts n characters in one go, none of which may end a line, returns false if they were dropped
+        bool put(const char *s, size_t n)
+        {
+            if(drop_partial) {
+                head= line_start;
+                discarding= drop_partial= false;
+            }
+
+            if(discarding) return false;
+
+            // as put(c) would, drop the whole line if they do not all fit
+            uint16_t h= head;
+            if(n > (size_t)((tail - h - 1) & (length - 1))) {
+                discard_line();
+                return false;
+            }
+
+            size_t first= (h + n > length) ? length - h : n;
+            memcpy(&buffer[h], s, first);
+            memcpy(buffer, s + first, n - first);
+            barrier();
+            head= (h + n) & (length - 1);
+            return true;
+        }
+
+        // removes the last character of the line being received, for backspace
+        void unput() { if(head != line_start) head= (head - 1) & (length - 1); }
+
+        // drops the line being received and everything else up to the next end of line
+        void discard_line() { head= line_start; discarding= true; }
+
+        // characters that can be put before the buffer is full, 0 if there are not many line slots left either
+        int free() const
+        {
+            if(((line_tail - line_head - 1) & (lines - 1)) < 4) return 0;
+            return length - 1 - ((head - tail) & (length - 1));
+        }
+
+        // consumer side
+
+        bool has_line() const { bool b= line_head != line_tail; barrier(); return b; }
+        bool is_empty() const { return head == tail; }
+        // complete lines in the buffer
+        int line_count() const { return (line_head - line_tail) & (lines - 1); }
+        int available() const { return (head - tail) & (length - 1); }
+
+        // takes the next line without its \n or \r, returns its length
+        size_t get_line(std::string& s)
+        {
+            uint16_t end= ends[line_tail];
+            if(end > tail) {
+                s.assign(&buffer[tail], end - tail);
+            } else {
+                s.assign(&buffer[tail], length - tail);
+                s.append(buffer, end);
+            }
+            if(s.back() == '\n' || s.back() == '\r') s.pop_back();
+            pop_line(end);
+            return s.size();
+        }
+
+        // same into a buffer of size bytes, truncating the line if it is longer, and nul terminated
+        size_t get_line(char *buf, size_t size)
+        {
+            uint16_t end= ends[line_tail];
+            size_t n= 0;
+            for (uint16_t i= tail; i != end && n < size - 1; i= (i + 1) & (length - 1)) {
+                buf[n++]= buffer[i];
+            }
+            if(n > 0 && (buf[n - 1] == '\n' || buf[n - 1] == '\r')) --n;
+            buf[n]= '\0';
+            pop_line(end);
+            return n;
+        }
+
+        // takes one character, only from complete lines
+        bool get(char& c)
+        {
+            if(!has_line()) return false;
+            c= buffer[tail];
+            uint16_t next= (tail + 1) & (length - 1);
+            if(next == ends[line_tail]) {
+                pop_line(next);
+            } else {
+                tail= next;
+            }
+            return true;
+        }
+
+        // drops all the complete lines, and has the producer drop the line being received when it next puts
+        void flush()
+        {
+            drop_partial= true;
+            uint16_t lh= line_head;
+            if(lh == line_tail) return;
+            pop_line(ends[(lh - 1) & (lines - 1)], lh);
+        }
+
+    private:
+        // stops the compiler moving buffer accesses past the index updates, a single core needs nothing more
+        static void barrier() { __asm__ volatile("" ::: "memory"); }
+
+        void pop_line(uint16_t end) { pop_line(end, (line_tail + 1) & (lines - 1)); }
+        void pop_line(uint16_t end, uint16_t next_line)
+        {
+            // the data must be read before the producer can see the space is free
+            barrier();
+            tail= end;
+            line_tail= next_line;
+        }
+
+        char buffer[length];
+        uint16_t ends[lines];              // index just past the end of each complete line
+        volatile uint16_t head;            // written by the producer
+        volatile uint16_t tail;            // written by the consumer
+        volatile uint16_t line_head;       // written by the producer
+        volatile uint16_t line_tail;       // written by the consumer
+        uint16_t line_start;               // start of the line being received, producer only
+        bool discarding;                   // producer only
+        volatile bool drop_partial;        // set by the consumer, cleared by the producer
+};
+
+#endif
@@ -1,5 +1,8 @@
 #include "CallbackStream.h"
 #include "Kernel.h"
+#include "CommandQueue.h"
+#include "Conveyor.h"
+#include "us_ticker_api.h"
 #include <stdio.h>
 
 #include "SerialConsole.h"
@@ -23,9 +26,18 @@ int CallbackStream::puts(const char *s)
 {
     if(closed) return 0;
 
-    if(s == NULL) return (*callback)(NULL, user);
+    if(s == NULL) {
+        // with the window on there is no prompt, the report says when the command is done
+        if(window.is_active()) {
+            window.line_done();
+            report_window();
+            return 1;
+        }
+        return (*callback)(NULL, user);
+    }
 
     int len = strlen(s);
+    if(window.is_ok(s)) return len;
     int n;
     do {
         // call this streams result callback
@@ -46,6 +58,27 @@ int CallbackStream::puts(const char *s)
     return len;
 }
 
+// the shell counts a line as taken when it queues it, so the lines held are the ones in the command queue, and the
+// room is what the queue will still take from this connection before telnet holds it back
+bool CallbackStream::start_window(bool on)
+{
+    if(on) {
+        window.start(us_ticker_read());
+    } else {
+        window.stop();
+    }
+    return true;
+}
+
+void CallbackStream::report_window()
+{
+    if(closed) return;
+    char buf[32];
+    if(window.report(0, CommandQueue::getInstance()->get_room(this), THECONVEYOR->get_free_blocks(), us_ticker_read(), buf, sizeof(buf)) > 0) {
+        puts(buf);
+    }
+}
+
 void CallbackStream::mark_closed()
 {
     closed= true;
@@ -5,6 +5,7 @@ typedef int (*cb_t)(const char *, void *);
 
 #ifdef __cplusplus
 #include "libs/StreamOutput.h"
+#include "AckWindow.h"
 
 
 class CallbackStream : public StreamOutput {
@@ -12,6 +13,11 @@ class CallbackStream : public StreamOutput {
         CallbackStream(cb_t cb, void *u);
         virtual ~CallbackStream();
         int puts(const char*);
+        bool start_window(bool on);
+        bool is_window_active() const { return window.is_active(); }
+        // a line of size bytes has been queued, while the window is on
+        void line_taken(uint32_t size) { window.line_taken(size); }
+        void report_window();
         void inc() { use_count++; }
         void dec();
         int get_count() { return use_count; }
@@ -22,6 +28,7 @@ class CallbackStream : public StreamOutput {
         void *user;
         bool closed;
         int use_count;
+        AckWindow window;
 };
 
 #else
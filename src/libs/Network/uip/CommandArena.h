@@ -0,0 +1,147 @@
+/*
+      This file is part of Smoothie (http://smoothieware.org/). The motion control part is heavily based on Grbl (https://github.com/simen/grbl).
+      Smoothie is free software: you can redistribute it and/or modify it under the terms of the GNU General Public License as published by the Free Software Foundation, either version 3 of the License, or (at your option) any later version.
+      Smoothie is distributed in the hope that it will be useful, but WITHOUT ANY WARRANTY; without even the implied warranty of MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the GNU General Public License for more details.
+      You should have received a copy of the GNU General Public License along with Smoothie. If not, see <http://www.gnu.org/licenses/>.
+*/
+
+#ifndef COMMANDARENA_H
+#define COMMANDARENA_H
+
+#include <stddef.h>
+#include <stdint.h>
+#include <string.h>
+
+class StreamOutput;
+
+// Holds queued commands back to back in one ring of bytes that is allocated once, each is a small header and then
+// its bytes, which may wrap from the end of the ring to the start.
+// Every stream with commands in the ring has a slot counting the bytes it uses, and no stream may use more than
+// the quota, so one connection streaming a job cannot fill the ring and shut out the others.
+class CommandArena {
+    public:
+        static const int MAX_STREAMS= 8;
+
+        CommandArena() { buffer= nullptr; size= quota= 0; reset(); }
+
+        // buffer must be size bytes, nullptr detaches it
+        void attach(uint8_t *buffer, uint32_t size, uint32_t quota) { this->buffer= buffer; this->size= size; this->quota= quota; reset(); }
+        void reset()
+        {
+            head= tail= used= 0;
+            entries= 0;
+            for (int i = 0; i < MAX_STREAMS; ++i) slots[i].used= 0;
+        }
+
+        uint8_t *get_buffer() const { return buffer; }
+        int get_entries() const { return entries; }
+        uint32_t get_free() const { return size - used; }
+        uint32_t get_used(StreamOutput *stream) const
+        {
+            int i= find_slot(stream);
+            return i < 0 ? 0 : slots[i].used;
+        }
+
+        // bytes that can still go in from this stream, headers included
+        uint32_t get_room(StreamOutput *stream) const
+        {
+            int i= find_slot(stream);
+            if(i < 0) return 0;
+            uint32_t room= quota - slots[i].used;
+            return (size - used < room) ? size - used : room;
+        }
+
+        // what a command of n bytes takes
+        static uint32_t entry_size(uint32_t n) { return n + sizeof(header_t); }
+
+        // whether n more bytes from this stream would fit
+        bool has_room(StreamOutput *stream, uint32_t n) const
+        {
+            uint32_t need= entry_size(n);
+            if(need > size - used) return false;
+            int i= find_slot(stream);
+            return i >= 0 && slots[i].used + need <= quota;
+        }
+
+        // adds n bytes from the stream, returns false and adds nothing if they do not fit
+        bool put(StreamOutput *stream, uint8_t kind, const void *data, uint16_t n)
+        {
+            if(!has_room(stream, n)) return false;
+            int i= find_slot(stream);
+            header_t h= { n, (uint8_t)i, kind };
+            copy_in(&h, sizeof(h));
+            copy_in(data, n);
+            slots[i].stream= stream;
+            slots[i].used += n + sizeof(h);
+            entries++;
+            return true;
+        }
+
+        // takes out the oldest, data must be as big as the biggest put, returns false if there are none
+        bool get(StreamOutput *&stream, uint8_t& kind, void *data, uint16_t& n)
+        {
+            if(entries == 0) return false;
+            header_t h;
+            copy_out(&h, sizeof(h));
+            copy_out(data, h.size);
+            stream= slots[h.slot].stream;
+            kind= h.kind;
+            n= h.size;
+            slots[h.slot].used -= h.size + sizeof(h);
+            entries--;
+            return true;
+        }
+
+    private:
+        struct header_t {
+            uint16_t size;
+            uint8_t slot;
+            uint8_t kind;
+        };
+
+        // the slot the stream has, or a free one for it, -1 if they are all taken by other streams
+        int find_slot(StreamOutput *stream) const
+        {
+            int free_slot= -1;
+            for (int i = 0; i < MAX_STREAMS; ++i) {
+                if(slots[i].used == 0) {
+                    if(free_slot < 0) free_slot= i;
+                } else if(slots[i].stream == stream) {
+                    return i;
+                }
+            }
+            return free_slot;
+        }
+
+        void copy_in(const void *p, uint32_t n)
+        {
+            uint32_t first= (head + n > size) ? size - head : n;
+            memcpy(&buffer[head], p, first);
+            memcpy(buffer, (const uint8_t *)p + first, n - first);
+            head= (head + n) % size;
+            used += n;
+        }
+
+        void copy_out(void *p, uint32_t n)
+        {
+            uint32_t first= (tail + n > size) ? size - tail : n;
+            memcpy(p, &buffer[tail], first);
+            memcpy((uint8_t *)p + first, buffer, n - first);
+            tail= (tail + n) % size;
+            used -= n;
+        }
+
+        uint8_t *buffer;
+        uint32_t size;
+        uint32_t quota;
+        uint32_t head;      // where the next byte goes
+        uint32_t tail;      // where the next byte is taken from
+        uint32_t used;
+        struct {
+            StreamOutput *stream;
+            uint32_t used;
+        } slots[MAX_STREAMS];
+        uint16_t entries;
+};
+
+#endif
@@ -7,6 +7,8 @@
 #include "Kernel.h"
 #include "libs/SerialMessage.h"
 #include "CallbackStream.h"
+#include "BinaryGcode.h"
+#include "platform_memory.h"
 
 static CommandQueue *command_queue_instance;
 CommandQueue *CommandQueue::instance = NULL;
@@ -16,6 +18,9 @@ CommandQueue::CommandQueue()
 {
     command_queue_instance = this;
     null_stream= &(StreamOutput::NullStream);
+    // in AHB0 so it does not come out of the heap, without it every command goes on the overflow
+    uint8_t *buf= (uint8_t *)AHB0.alloc(ARENA_SIZE);
+    if(buf != NULL) arena.attach(buf, ARENA_SIZE, STREAM_QUOTA);
 }
 
 CommandQueue* CommandQueue::getInstance()
@@ -33,29 +38,116 @@ extern "C" {
 
 int CommandQueue::add(const char *cmd, StreamOutput *pstream)
 {
-    cmd_t c= {strdup(cmd), pstream==NULL?null_stream:pstream};
-    q.push(c);
+    size_t n= strlen(cmd) + 1;
+    if(n > MAX_COMMAND) n= MAX_COMMAND;
+    return push(TEXT, cmd, n, pstream);
+}
+
+// a TCP segment of binary records can hold a few hundred of them, so only the op, the mask and the values that
+// are there are kept
+int CommandQueue::add(const BinaryGcodeRecord& record, StreamOutput *pstream)
+{
+    uint8_t p[2 + 8 * sizeof(float)];
+    int n= 0;
+    p[0]= record.op;
+    p[1]= record.mask;
+    for (int i = 0; i < 8; ++i) {
+        if(record.mask & (1 << i)) memcpy(&p[2 + sizeof(float) * n++], &record.values[i], sizeof(float));
+    }
+    return push(RECORD, p, 2 + n * sizeof(float), pstream);
+}
+
+bool CommandQueue::has_room(StreamOutput *pstream)
+{
+    if(pstream == NULL) pstream= null_stream;
+    return overflow.size() == 0 && arena.has_room(pstream, MAX_COMMAND);
+}
+
+uint32_t CommandQueue::get_room(StreamOutput *pstream)
+{
+    if(pstream == NULL) pstream= null_stream;
+    if(overflow.size() > 0) return 0;
+    uint32_t room= arena.get_room(pstream);
+    uint32_t held= CommandArena::entry_size(MAX_COMMAND);
+    return room > held ? room - held : 0;
+}
+
+int CommandQueue::push(uint8_t kind, const void *data, uint16_t n, StreamOutput *pstream)
+{
+    StreamOutput *s= (pstream == NULL) ? null_stream : pstream;
+
+    // once anything has overflowed the rest follows it until it has gone, to keep them in order
+    if(overflow.size() > 0 || !arena.put(s, kind, data, n)) {
+        uint8_t *p= (uint8_t *)malloc(n);
+        memcpy(p, data, n);
+        cmd_t c= {NULL, NULL, s};
+        if(kind == TEXT) {
+            p[n - 1]= '\0';
+            c.str= (char *)p;
+        } else {
+            c.record= p;
+        }
+        overflow.push(c);
+    }
+
     if(pstream != NULL) {
         // count how many times this is on the queue
-        CallbackStream *s= static_cast<CallbackStream *>(pstream);
-        s->inc();
+        CallbackStream *cs= static_cast<CallbackStream *>(pstream);
+        cs->inc();
     }
-    return q.size();
+    return size();
 }
 
 // pops the next command off the queue and submits it.
 bool CommandQueue::pop()
 {
-    if (q.size() == 0) return false;
+    uint8_t buf[MAX_COMMAND];
+    const uint8_t *data;
+    StreamOutput *pstream;
+    uint8_t kind;
+    cmd_t c= {NULL, NULL, NULL};
+
+    // everything in the arena came before anything on the overflow
+    uint16_t n;
+    if(arena.get(pstream, kind, buf, n)) {
+        // a line cut short at MAX_COMMAND has lost its nul
+        if(kind == TEXT) buf[n - 1]= '\0';
+        data= buf;
+    } else if(overflow.size() > 0) {
+        c= overflow.pop();
+        pstream= c.pstream;
+        kind= (c.record != NULL) ? RECORD : TEXT;
+        data= (c.record != NULL) ? c.record : (const uint8_t *)c.str;
+    } else {
+        return false;
+    }
 
-    cmd_t c= q.pop();
-    char *cmd= c.str;
+    if(kind == RECORD) {
+        BinaryGcodeRecord record;
+        record.op= data[0];
+        record.mask= data[1];
+        for (int i = 0, j = 0; i < 8; ++i) {
+            if(record.mask & (1 << i)) memcpy(&record.values[i], &data[2 + sizeof(float) * j++], sizeof(float));
+        }
+        free(c.record);
+
+        // no prompt for each record, the end record gets the reply the host waits for, with the count telnetd put in it
+        if(record.op == BinaryGcodeDecoder::END) {
+            uint32_t records= 0;
+            if(record.mask & 1) memcpy(&records, &record.values[0], sizeof(records));
+            pstream->printf("ok binary %lu\n", (unsigned long)records);
+        } else {
+            BinaryGcodeDecoder::dispatch(record, pstream);
+        }
+        if(pstream != null_stream) static_cast<CallbackStream *>(pstream)->dec();
+        return true;
+    }
 
     struct SerialMessage message;
-    message.message = cmd;
-    message.stream = c.pstream;
+    message.message = (const char *)data;
+    message.stream = pstream;
 
-    free(cmd);
+    free(c.str);
     THEKERNEL->call_event(ON_CONSOLE_LINE_RECEIVED, &message );
 
     if(message.stream != null_stream) {
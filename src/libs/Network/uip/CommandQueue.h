@@ -4,9 +4,12 @@
 #ifdef __cplusplus
 
 #include "fifo.h"
+#include "CommandArena.h"
 #include <string>
+#include <stdint.h>
 
 class StreamOutput;
+struct BinaryGcodeRecord;
 
 class CommandQueue
 {
@@ -15,12 +18,30 @@ public:
     ~CommandQueue();
     bool pop();
     int add(const char* cmd, StreamOutput *pstream);
-    int size() {return q.size();}
+    int add(const BinaryGcodeRecord& record, StreamOutput *pstream);
+    int size() {return arena.get_entries() + overflow.size();}
+    // true if the next command from this stream is sure to go in the arena, a connection that can hold back what
+    // it receives should do so until it is
+    bool has_room(StreamOutput *pstream);
+    // bytes of commands that can still be queued from this stream before it is held back
+    uint32_t get_room(StreamOutput *pstream);
     static CommandQueue* getInstance();
 
+    // the longest command, a text line from the binary format with its nul
+    static const uint16_t MAX_COMMAND= 258;
+
 private:
-    typedef struct {char* str; StreamOutput *pstream; } cmd_t;
-    Fifo<cmd_t> q;
+    // preallocated, and no stream may have more than three quarters of it
+    static const uint32_t ARENA_SIZE= 4096;
+    static const uint32_t STREAM_QUOTA= ARENA_SIZE * 3 / 4;
+    enum { TEXT, RECORD };
+
+    // either a line, or a binary motion or end record packed by add(), the other is NULL
+    typedef struct {char* str; uint8_t *record; StreamOutput *pstream; } cmd_t;
+    int push(uint8_t kind, const void *data, uint16_t n, StreamOutput *pstream);
+    CommandArena arena;
+    // what did not fit in the arena, in the order it came, only used by connections that cannot hold back
+    Fifo<cmd_t> overflow;
     static CommandQueue *instance;
     StreamOutput *null_stream;
 };
@@ -7,6 +7,7 @@
 #include "Kernel.h"
 #include "Config.h"
 #include "SlowTicker.h"
+#include "Conveyor.h"
 
 #include "Network.h"
 #include "PublicDataRequest.h"
@@ -269,21 +270,6 @@ void Network::on_idle(void *argument)
             }
 #endif
         }
-/*
-        This didn't work actually made it worse,it should have worked though
-        else{
-            // TODO if the command queue is below a certain amount we should poll any stopped connections
-            if(command_q->size() < 4) {
-                for (struct uip_conn *connr = &uip_conns[0]; connr <= &uip_conns[UIP_CONNS - 1]; ++connr) {
-                    if(uip_stopped(connr)){
-                        // Force a poll of this
-                        printf("Force poll of connection\n");
-                        uip_poll_conn(connr);
-                    }
-                }
-            }
-        }
-*/
         /* Call the ARP timer function every 10 seconds. */
         if (timer_expired(&arp_timer)) {
             timer_reset(&arp_timer);
@@ -387,9 +373,27 @@ void Network::init(void)
 
 void Network::on_main_loop(void *argument)
 {
-    // issue commands here if any available
-    while(command_q->pop()) {
-        // keep feeding them until empty
+    // issue commands here while the planner has room for them, rather than blocking in here until it has
+    bool popped= false;
+    while(!THECONVEYOR->is_queue_full() && command_q->pop()) {
+        popped= true;
+    }
+
+    if(popped && ethernet->isUp()) poll_stopped();
+}
+
+// a connection that stopped because the queue was full restarts on a poll, it gets one as soon as commands have
+// been taken rather than at the next periodic poll up to half a second later
+void Network::poll_stopped()
+{
+    for (struct uip_conn *connr = &uip_conns[0]; connr <= &uip_conns[UIP_CONNS - 1]; ++connr) {
+        if(uip_stopped(connr)) {
+            uip_poll_conn(connr);
+            if (uip_len > 0) {
+                uip_arp_out();
+                tapdev_send(uip_buf, uip_len);
+            }
+        }
     }
 }
 
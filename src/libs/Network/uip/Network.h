@@ -34,6 +34,7 @@ public:
 private:
     void init();
     void setup_servers();
+    void poll_stopped();
     uint32_t tick(uint32_t dummy);
     void handlePacket();
 
@@ -15,7 +15,7 @@
 //#define DEBUG_PRINTF(...) printf("9p " __VA_ARGS__)
 #define DEBUG_PRINTF(...)
 
-#define ERROR(...)       do { error(bufout, msize, __LINE__, ##__VA_ARGS__); return 0; } while (0)
+#define ERROR(...)       do { error(bufout, BUFFER_SIZE, __LINE__, ##__VA_ARGS__); return 0; } while (0)
 #define CHECK(cond, ...) do { if (!(cond)) ERROR(__VA_ARGS__); } while (0)
 #define IOUNIT           (msize - sizeof (Message::Twrite))
 #define PACKEDSTRUCT     struct __attribute__ ((packed))
@@ -24,6 +24,15 @@
 namespace {
 
 // See error mapping http://lxr.free-electrons.com/source/net/9p/error.c
+// the names are the errno ones, which the C library may have as macros
+#undef ENOENT
+#undef EIO
+#undef EBADMSG
+#undef EEXIST
+#undef EFAULT
+#undef ENOSYS
+#undef ENOTEMPTY
+#undef ENFILE
 const char ENOENT[]      = "No such file or directory",
            EIO[]         = "Input/output error",
            FID_UNKNOWN[] = "fid unknown or out of range",
@@ -81,7 +90,9 @@ enum {
     MAXWELEM    = 16,
     MAXENTRIES  = 32,
     MAXFIDS     = 32,
-    MAXREQUESTS = 4,
+    MAXREQUESTS = 8,
+    MAXOPENFILES = 2,    // each has a sector buffer
+    MAXIOUNIT   = 8192,  // a multiple of the sector size, so a file written in order is written in whole sectors
 };
 
 // TODO: Maybe this should be moved to utils?
@@ -316,7 +327,7 @@ inline long flen(const std::string& path)
     return max(0l, ftell(fp));
 }
 
-size_t putstat(Stat* stat, char* end, uint8_t type, const std::string& path)
+size_t putstat(Stat* stat, char* end, uint8_t type, const std::string& path, long length = -1)
 {
     char* p = stat->buf + sizeof (Stat);
     if (p > end)
@@ -327,7 +338,7 @@ size_t putstat(Stat* stat, char* end, uint8_t type, const std::string& path)
     stat->qid = Qid(type, path);
     stat->mode = type == QTDIR ? (DMDIR | 0755) : 0644;
     stat->atime = stat->mtime = 1423420000;
-    stat->length = (stat->mode & DMDIR) ? 0 : flen(path);
+    stat->length = (stat->mode & DMDIR) ? 0 : length >= 0 ? length : flen(path);
 
     p = putstr(p, end, path == "/" ? "/" : path.substr(path.rfind('/') + 1).c_str());
     p = putstr(p, end, "smoothie");
@@ -344,7 +355,7 @@ void error(char* bufout, uint32_t msize, int line, const char* text)
 {
     DEBUG_PRINTF("error %s, line %d\n", text, __LINE__);
     Plan9::Message* response = reinterpret_cast<Plan9::Message*>(bufout);
-    response->type = Rerror;
+    response->type = Rerror;   // the tag was set by process()
     response->size = sizeof (Header);
     response->size = putstr(response->buf + sizeof (Header), response->buf + msize, text) - response->buf;
 }
@@ -366,16 +377,27 @@ std::string join_path(const std::string& a, const std::string& b)
 } // anonymous namespace
 
 Plan9::Plan9()
-: msize(INITIAL_MSIZE), queue_bytes(0)
+: msize(BUFFER_SIZE), incoming(nullptr), held(0), write_left(0), read_entry(nullptr)
 {
-    PSOCK_INIT(&sin, bufin + 4, sizeof(bufin) - 4);
-    PSOCK_INIT(&sout, bufout + 4, sizeof(bufout) - 4);
+    PSOCK_INIT(&sin, bufin, sizeof(bufin));
+    PSOCK_INIT(&sout, bufout, sizeof(bufout));
 }
 
 Plan9::~Plan9()
 {
     PSOCK_CLOSE(&sin);
     PSOCK_CLOSE(&sout);
+    while (!queue.empty()) {
+        char* buf = queue.front().message->buf;
+        delete[] buf;
+        queue.pop();
+    }
+    if (incoming) {
+        char* buf = incoming->buf;
+        delete[] buf;
+    }
+    for (auto& e : entries)
+        close_file(&e);
 }
 
 Plan9::Entry Plan9::add_entry(uint32_t fid, uint8_t type, const std::string& path)
@@ -397,7 +419,7 @@ Plan9::Entry Plan9::add_entry(uint32_t fid, uint8_t type, const std::string& pat
 Plan9::Entry Plan9::get_entry(uint32_t fid)
 {
     auto i = fids.find(fid);
-    CHECK(i != fids.end());
+    CHECK(i != fids.end(), FID_UNKNOWN);
     return i->second;
 }
 
@@ -414,13 +436,114 @@ void Plan9::remove_fid(uint32_t fid)
 {
     auto i = fids.find(fid);
     if (i != fids.end()) {
+        Entry entry = i->second;
         fids.erase(i);
-        --i->second->second.refcount;
-        if (i->second->second.refcount == 0)
-            entries.erase(i->second->first);
+        if (--entry->second.refcount == 0) {
+            close_file(entry);
+            entries.erase(entry->first);
+        }
+    }
+}
+
+// Files are kept open from one request to the next, opening a file and seeking to the offset again for every
+// read or write would follow its cluster chain from the start each time.
+FILE* Plan9::open_file(Entry entry, bool write)
+{
+    EntryData& data = entry->second;
+    if (data.fp && (data.writable || !write))
+        return data.fp;
+    close_file(entry);
+
+    int open = 0;
+    for (auto& e : entries) {
+        if (e.second.fp)
+            ++open;
+    }
+    if (open >= MAXOPENFILES) {
+        for (auto& e : entries)
+            close_file(&e);
+    }
+
+    data.fp = fopen(entry->first.c_str(), write ? "r+" : "r");
+    if (!data.fp)
+        return nullptr;
+    // unbuffered, the data goes between the uIP buffer and the FatFs sector buffer without another copy
+    setvbuf(data.fp, nullptr, _IONBF, 0);
+    data.writable = write;
+    fseek(data.fp, 0, SEEK_END);
+    data.length = std::max(0l, ftell(data.fp));
+    data.pos = data.length;
+    return data.fp;
+}
+
+void Plan9::close_file(Entry entry)
+{
+    if (entry->second.fp) {
+        fclose(entry->second.fp);
+        entry->second.fp = nullptr;
     }
 }
 
+// The data of the Twrite being received, as it arrives in the uIP buffer
+void Plan9::write_data(const char* data, uint32_t len)
+{
+    if (write_done < 0)
+        return;
+
+    auto i = fids.find(write_fid);
+    FILE* fp = nullptr;
+    if (i == fids.end() || i->second->second.type == QTDIR || !(fp = open_file(i->second, true))) {
+        write_done = -1;
+        return;
+    }
+
+    EntryData& e = i->second->second;
+    uint32_t offset = write_offset + write_done;
+    if (e.pos != offset && fseek(fp, offset, SEEK_SET)) {
+        write_done = -1;
+        return;
+    }
+    size_t n = fwrite(data, 1, len, fp);
+    e.pos = offset + n;
+    e.length = std::max(e.length, e.pos);
+    write_done = n < len ? -1 : write_done + n;
+}
+
+// Makes the next segment of an Rread, the header and then the data read from the file straight into the uIP
+// buffer. It is called again for the same segment if that has to be sent again.
+unsigned short Plan9::read_data(void* arg)
+{
+    Plan9* self = static_cast<Plan9*>(arg);
+    Message* response = reinterpret_cast<Message*>(self->bufout);
+    char* p = static_cast<char*>(uip_appdata);
+    uint32_t n = std::min<uint32_t>(uip_mss(), response->size - self->sent);
+    uint32_t header = 0;
+
+    if (self->sent < sizeof (response->Rread)) {
+        header = std::min<uint32_t>(n, sizeof (response->Rread) - self->sent);
+        memcpy(p, response->buf + self->sent, header);
+    }
+
+    if (n > header) {
+        EntryData& e = self->read_entry->second;
+        uint32_t offset = self->read_offset + self->sent + header - sizeof (response->Rread);
+        FILE* fp = self->open_file(self->read_entry, false);
+        size_t got = 0;
+        // a file that is also written to must be seeked between a write and a read
+        if (fp && ((e.pos == offset && !e.writable) || !fseek(fp, offset, SEEK_SET)))
+            got = fread(p + header, 1, n - header, fp);
+        e.pos = e.writable ? UINT32_MAX : offset + got;
+        if (got < n - header) {
+            // the header has gone with the length, so the connection is closed rather than send the wrong data
+            memset(p + header + got, 0, n - header - got);
+            self->read_failed = true;
+        }
+    }
+
+    self->generated = n;
+    return n;
+}
+
 void Plan9::init()
 {
     uip_listen(HTONS(564));
@@ -453,6 +576,10 @@ void Plan9::appcall()
 
     instance->receive();
     instance->send();
+
+    // taking requests again once the queue has been worked through, as telnetd does
+    if (uip_poll() && uip_stopped(uip_conn) && instance->queue.size() < MAXREQUESTS / 2 && !instance->held)
+        uip_restart();
 }
 
 int Plan9::receive()
@@ -463,29 +590,74 @@ int Plan9::receive()
     (void)PT_YIELD_FLAG; // avoid warning unused variable
 
     for (;;) {
-        DEBUG_PRINTF("receive thread fids=%d entries=%d queue_size=%d queue_bytes=%lu\n", fids.size(), entries.size(), queue.size(), queue_bytes);
+        DEBUG_PRINTF("receive thread fids=%d entries=%d queue_size=%d\n", fids.size(), entries.size(), queue.size());
+
+        PSOCK_SET_BUFFER(&sin, bufin, sizeof (Header));
+        PSOCK_READBUF_LEN(&sin, sizeof (Header));
+        DEBUG_PRINTF("receive size=%lu type=%u tag=%d\n", request->size, request->type, request->tag);
+
+        if (request->type == Twrite) {
+            PSOCK_SET_BUFFER(&sin, bufin + sizeof (Header), sizeof (request->Twrite) - sizeof (Header));
+            PSOCK_READBUF_LEN(&sin, sizeof (request->Twrite) - sizeof (Header));
+            if (request->size != sizeof (request->Twrite) + request->Twrite.count || request->size > msize) {
+                DEBUG_PRINTF("Bad message received %lu\n", request->size);
+                PSOCK_CLOSE_EXIT(&sin);
+            }
 
-        PSOCK_READBUF_LEN(&sin, 4);
-        memcpy(request, request->buf + 4, 4); // copy size to buffer beginning
+            write_done = 0;
+            if (queue.empty() && !read_entry) {
+                // the data is written as it arrives, only the header is queued for the reply
+                write_fid = request->Twrite.fid;
+                write_offset = request->Twrite.offset;
+                write_left = request->Twrite.count;
+                while (write_left > 0) {
+                    PSOCK_WAIT_DATA(&sin);
+                    {
+                        uint32_t n = std::min<uint32_t>(write_left, PSOCK_GET_LENGTH_OF_REST_OF_BUFFER(&sin));
+                        write_data(reinterpret_cast<const char*>(PSOCK_GET_START_OF_REST_OF_BUFFER(&sin)), n);
+                        PSOCK_CONSUME(&sin, n);
+                        write_left -= n;
+                    }
+                }
 
-        DEBUG_PRINTF("receive size=%lu\n", request->size);
-        if (request->size > msize) {
-            DEBUG_PRINTF("Bad message received %lu\n", request->size);
-            PSOCK_CLOSE_EXIT(&sin);
+                request->size = sizeof (request->Twrite);
+                incoming = reinterpret_cast<Message*>(new char[request->size]);
+                memcpy(incoming->buf, request->buf, request->size);
+            } else {
+                // the requests before it are answered first, so the data waits in the queue with them, and no
+                // more segments are taken until it has been written, see appcall()
+                incoming = reinterpret_cast<Message*>(new char[request->size]);
+                memcpy(incoming->buf, request->buf, sizeof (request->Twrite));
+                if (incoming->size > sizeof (incoming->Twrite)) {
+                    PSOCK_SET_BUFFER(&sin, incoming->buf + sizeof (incoming->Twrite), incoming->Twrite.count);
+                    PSOCK_READBUF_LEN(&sin, incoming->Twrite.count);
+                    held++;
+                    uip_stop();
+                }
+            }
         } else {
-            PSOCK_READBUF_LEN(&sin, request->size - 4);
-            DEBUG_PRINTF("receive size=%lu type=%u tag=%d\n", request->size, request->type, request->tag);
-        }
+            if (request->size < sizeof (Header) || request->size > BUFFER_SIZE) {
+                DEBUG_PRINTF("Bad message received %lu\n", request->size);
+                PSOCK_CLOSE_EXIT(&sin);
+            }
 
-        PSOCK_WAIT_UNTIL(&sin, queue_bytes < MAXREQUESTS * INITIAL_MSIZE);
+            // read straight into where it is queued
+            incoming = reinterpret_cast<Message*>(new char[request->size]);
+            memcpy(incoming->buf, request->buf, sizeof (Header));
+            if (incoming->size > sizeof (Header)) {
+                PSOCK_SET_BUFFER(&sin, incoming->buf + sizeof (Header), incoming->size - sizeof (Header));
+                PSOCK_READBUF_LEN(&sin, incoming->size - sizeof (Header));
+            }
+        }
 
-        Message* copy = reinterpret_cast<Message*>(new char[request->size]);
-        memcpy(copy, request, request->size);
-        queue.push(copy);
-        queue_bytes += copy->size;
+        queue.push({incoming, incoming->type == Twrite ? write_done : 0});
+        DEBUG_PRINTF("store size=%lu type=%u tag=%d queue_size=%d\n", incoming->size, incoming->type, incoming->tag, queue.size());
+        incoming = nullptr;
 
-        // store message
-        DEBUG_PRINTF("store size=%lu type=%u tag=%d queue_size=%d queue_bytes=%lu\n", request->size, request->type, request->tag, queue.size(), queue_bytes);
+        // Whatever else is in this segment is still taken, uIP reuses the buffer once we return, but once enough
+        // requests are waiting no more segments are accepted until they have been answered, see appcall()
+        if (queue.size() >= MAXREQUESTS)
+            uip_stop();
     }
 
     PSOCK_END(&sin);
@@ -499,38 +671,58 @@ int Plan9::send()
     (void)PT_YIELD_FLAG; // avoid warning unused variable
 
     for (;;) {
-        DEBUG_PRINTF("send thread fids=%d entries=%d queue_size=%d queue_bytes=%lu\n", fids.size(), entries.size(), queue.size(), queue_bytes);
+        DEBUG_PRINTF("send thread fids=%d entries=%d queue_size=%d\n", fids.size(), entries.size(), queue.size());
 
         PSOCK_WAIT_UNTIL(&sout, !queue.empty());
 
         {
-            Message* request = queue.front();
+            Request request = queue.front();
             queue.pop();
-            queue_bytes -= request->size;
-            process(request, response);
-            char* buf = request->buf;
+            read_entry = nullptr;
+            if (request.message->type == Twrite && request.message->size > sizeof (request.message->Twrite)) {
+                held--;
+                write_fid = request.message->Twrite.fid;
+                write_offset = request.message->Twrite.offset;
+                write_done = 0;
+                write_data(request.message->buf + sizeof (request.message->Twrite), request.message->Twrite.count);
+                request.written = write_done;
+            }
+            process(request.message, response, request.written);
+            char* buf = request.message->buf;
             delete[] buf;
         }
 
-
         DEBUG_PRINTF("send size=%lu type=%u tag=%d\n", response->size, response->type, response->tag);
-        PSOCK_SEND(&sout, response->buf, response->size);
+        if (read_entry) {
+            // the data of a file comes straight from the file, a segment at a time
+            read_failed = false;
+            for (sent = 0; sent < response->size; sent += generated) {
+                PSOCK_GENERATOR_SEND(&sout, read_data, this);
+                if (read_failed)
+                    PSOCK_CLOSE_EXIT(&sout);
+            }
+            read_entry = nullptr;
+        } else {
+            PSOCK_SEND(&sout, response->buf, response->size);
+        }
     }
 
     PSOCK_END(&sout);
 }
 
 
-bool Plan9::process(Message* request, Message* response)
+bool Plan9::process(Message* request, Message* response, int32_t written)
 {
     Entry entry;
+    response->tag = request->tag;
 
     switch (request->type) {
     case Tversion:
         DEBUG_PRINTF("Tversion\n");
         RESPONSE(Rversion);
-        msize = response->Rversion.msize = min(INITIAL_MSIZE, request->Tversion.msize);
-        response->size = putstr(response->buf + response->size, response->buf + msize, "9P2000") - response->buf;
+        // as large as the client will take, up to MAXIOUNIT of data in a Tread or Twrite, Linux wants at least 4096
+        msize = response->Rversion.msize = std::min<uint32_t>(MAXIOUNIT + sizeof (request->Twrite), request->Tversion.msize);
+        response->size = putstr(response->buf + response->size, response->buf + BUFFER_SIZE, "9P2000") - response->buf;
         break;
 
     case Tattach:
@@ -600,7 +792,9 @@ bool Plan9::process(Message* request, Message* response)
         DEBUG_PRINTF("Tstat fid=%lu %s\n", request->fid, entry->first.c_str());
 
         RESPONSE(Rstat);
-        CHECK((response->Rstat.stat_size = putstat(&response->Rstat.stat, response->buf + msize, entry->second.type, entry->first)) > 0, EFAULT);
+        // a file being written has a length the directory does not have until it is closed
+        CHECK((response->Rstat.stat_size = putstat(&response->Rstat.stat, response->buf + BUFFER_SIZE, entry->second.type, entry->first,
+                                                   entry->second.fp ? long(entry->second.length) : -1)) > 0, EFAULT);
         response->size = sizeof (Header) + 2 + response->Rstat.stat_size;
         break;
 
@@ -616,8 +810,10 @@ bool Plan9::process(Message* request, Message* response)
         CHECK(entry = get_entry(request->fid));
         DEBUG_PRINTF("Topen fid=%lu %s\n", request->fid, entry->first.c_str());
 
-        if (entry->second.type != QTDIR && (request->Topen.mode & OTRUNC))
+        if (entry->second.type != QTDIR && (request->Topen.mode & OTRUNC)) {
+            close_file(entry);
             CHECK(File(entry->first, "w"), EIO);
+        }
 
         RESPONSE(Ropen);
         response->Ropen.qid = entry;
@@ -635,6 +831,7 @@ bool Plan9::process(Message* request, Message* response)
             CHECK(dir, EIO);
 
             char* data = response->buf + sizeof (response->Rread);
+            request->Tread.count = std::min<uint32_t>(request->Tread.count, BUFFER_SIZE - sizeof (response->Rread));
             struct dirent* d;
             while ((d = readdir(dir)) && request->Tread.count > 0) {
                 auto path = join_path(entry->first, d->d_name);
@@ -660,12 +857,15 @@ bool Plan9::process(Message* request, Message* response)
                 }
             }
         } else {
-            File fp(entry->first, "r");
-            CHECK(fp, EIO);
-            CHECK(!fseek(fp, request->Tread.offset, SEEK_SET), EIO);
-            response->Rread.count = fread(response->buf + response->size, 1, request->Tread.count, fp);
-            CHECK(response->Rread.count == request->Tread.count || !ferror(fp), EIO);
+            // only the header goes in the response, send() reads the data as it goes
+            CHECK(open_file(entry, false), EIO);
+            uint32_t length = entry->second.length;
+            response->Rread.count = request->Tread.offset < length ? std::min<uint64_t>(request->Tread.count, length - request->Tread.offset) : 0;
             response->size += response->Rread.count;
+            if (response->Rread.count > 0) {
+                read_entry = entry;
+                read_offset = request->Tread.offset;
+            }
         }
         break;
 
@@ -688,6 +888,7 @@ bool Plan9::process(Message* request, Message* response)
                 CHECK(File(path, "w"), EIO);
             remove_fid(request->fid);
             CHECK(entry = add_entry(request->fid, (perm & DMDIR) ? QTDIR : QTFILE, path));
+            close_file(entry);
             RESPONSE(Rcreate);
             response->Rcreate.qid = entry;
             response->Rcreate.iounit = IOUNIT;
@@ -695,20 +896,13 @@ bool Plan9::process(Message* request, Message* response)
         break;
 
     case Twrite:
-        {
-            DEBUG_PRINTF("Twrite fid=%lu\n", request->fid);
-            CHECK(request->size == sizeof (request->Twrite) + request->Twrite.count &&
-                  request->Twrite.count <= IOUNIT, EBADMSG);
-            CHECK(entry = get_entry(request->fid));
-
-            File fp(entry->first, "r+");
-            CHECK(fp, EIO);
-            CHECK(!fseek(fp, request->Twrite.offset, SEEK_SET), EIO);
-
-            RESPONSE(Rwrite);
-            response->Rwrite.count = fwrite(request->buf + sizeof (request->Twrite), 1, request->Twrite.count, fp);
-            CHECK(response->Rwrite.count == request->Twrite.count || !ferror(fp), EIO);
-        }
+        // the data has already been written, by receive() or by send()
+        DEBUG_PRINTF("Twrite fid=%lu\n", request->fid);
+        CHECK(request->Twrite.count <= IOUNIT, EBADMSG);
+        CHECK(entry = get_entry(request->fid));
+        CHECK(written >= 0, EIO);
+        RESPONSE(Rwrite);
+        response->Rwrite.count = written;
         break;
 
     case Tremove:
@@ -716,6 +910,7 @@ bool Plan9::process(Message* request, Message* response)
             DEBUG_PRINTF("Tremove fid=%lu\n", request->fid);
             CHECK(request->size == sizeof (Header) + 4, EBADMSG);
             CHECK(entry = get_entry(request->fid));
+            close_file(entry);
             auto e = *entry;
             remove_fid(request->fid);
             CHECK(!remove(e.first.c_str()), e.second.type == QTDIR ? ENOTEMPTY : EIO);
@@ -735,6 +930,7 @@ bool Plan9::process(Message* request, Message* response)
             if (len > 0 && entry->first != "/") {
                 std::string newpath = join_path(entry->first.substr(0, entry->first.rfind('/')), std::string(name, len));
                 if (newpath != entry->first) {
+                    close_file(entry);
                     CHECK(!rename(entry->first.c_str(), newpath.c_str()), EIO);
                     uint8_t type = entry->second.type;
                     remove_fid(request->fid);
@@ -23,6 +23,7 @@
 #include <queue>
 #include <string>
 #include <stdint.h>
+#include <stdio.h>
 
 extern "C" {
 #include "psock.h"
@@ -40,10 +41,14 @@ public:
     struct EntryData {
         uint8_t     type;
         int         refcount;
+        FILE*       fp;         // kept open from one read or write to the next, see open_file()
+        bool        writable;
+        uint32_t    pos;        // where fp is, so sequential reads and writes need no seek
+        uint32_t    length;
 
         EntryData() {}
         EntryData(uint8_t t)
-            : type(t), refcount(0) {}
+            : type(t), refcount(0), fp(nullptr), writable(false), pos(0), length(0) {}
     };
 
     typedef std::map<std::string, EntryData> EntryMap;
@@ -52,22 +57,49 @@ public:
     union Message;
 
 private:
+    struct Request {
+        Message* message;
+        int32_t  written;       // the data of a Twrite is written as it arrives, this is how much was, -1 on error,
+                                // unless the message holds the data to be written in its turn
+    };
+
     int receive();
     int send();
-    bool process(Message*, Message*);
+    bool process(Message*, Message*, int32_t);
 
     Entry add_entry(uint32_t, uint8_t, const std::string&);
     Entry get_entry(uint32_t);
     bool add_fid(uint32_t, Entry);
     void remove_fid(uint32_t);
 
-    static const uint32_t INITIAL_MSIZE = 300;
+    FILE* open_file(Entry, bool);
+    void close_file(Entry);
+    void write_data(const char*, uint32_t);
+    static unsigned short read_data(void*);
+
+    // Requests other than Twrite and responses other than the Rread of a file are kept whole, and must fit in
+    // BUFFER_SIZE. The data of Twrite and Rread goes between the uIP buffer and the file as it is sent and
+    // received, so msize can be much larger. A Twrite that arrives behind other requests is kept whole instead,
+    // as they may walk to, truncate or remove its fid, or read what it would overwrite.
+    static const uint32_t BUFFER_SIZE = 512;
     EntryMap             entries;
     FidMap               fids;
     psock                sin, sout;
-    char                 bufin[INITIAL_MSIZE], bufout[INITIAL_MSIZE];
-    std::queue<Message*> queue;
-    uint32_t             msize, queue_bytes;
+    char                 bufin[32], bufout[BUFFER_SIZE];
+    std::queue<Request>  queue;
+    uint32_t             msize;
+    Message*             incoming;      // where a request other than a Twrite written as it arrives is being read to
+    int                  held;          // Twrites in the queue with their data
+
+    // the Twrite being received
+    uint32_t             write_fid, write_offset, write_left;
+    int32_t              write_done;
+
+    // the Rread being sent, sent counts the header as well as the data
+    Entry                read_entry;
+    uint32_t             read_offset, sent;
+    uint16_t             generated;
+    bool                 read_failed;
 };
 
 #endif
@@ -78,6 +78,7 @@ static void help(char *str, Shell *sh)
     sh->output("h           - show network help\n");
     sh->output("help        - show command help\n");
     sh->output("exit, quit  - exit shell\n");
+    sh->output("binary      - the following data is in the binary gcode format up to its end record\n");
 }
 
 /*---------------------------------------------------------------------------*/
@@ -176,6 +177,17 @@ static void ntest(char *str, Shell *sh)
         */
 }
 
+// switches the connection to the binary format, handled here rather than by SimpleShell so the bytes that follow
+// in the same segment are not taken as text
+static void binary(char *str, Shell *sh)
+{
+    if (sh->start_binary()) {
+        sh->output("ok\n");
+    } else {
+        sh->output("error:already in binary mode, or needs window off first\n");
+    }
+}
+
 /*---------------------------------------------------------------------------*/
 
 static void unknown(char *str, Shell *sh)
@@ -183,6 +195,7 @@ static void unknown(char *str, Shell *sh)
     // its some other command, so queue it for mainloop to find
     if (strlen(str) > 0) {
         CommandQueue::getInstance()->add(str, sh->getStream());
+        static_cast<CallbackStream *>(sh->getStream())->line_taken(CommandArena::entry_size(strlen(str) + 1));
     }
 }
 /*---------------------------------------------------------------------------*/
@@ -192,6 +205,7 @@ static const struct ptentry parsetab[] = {
     {"quit", quit},
     {"ntest", ntest},
     {"h", help},
+    {"binary", binary},
 
     /* Default action */
     {0, unknown}
@@ -229,9 +243,17 @@ void Shell::start()
     telnet->output("Smoothie command shell\r\n> ");
 }
 
-int Shell::queue_size()
+// a report is otherwise only sent when a command is done, this sends one if the window has grown since
+void Shell::report_window()
+{
+    if (telnet->can_output() > 0) {
+        static_cast<CallbackStream *>(pstream)->report_window();
+    }
+}
+
+bool Shell::can_queue()
 {
-    return CommandQueue::getInstance()->size();
+    return CommandQueue::getInstance()->has_room(pstream);
 }
 /*---------------------------------------------------------------------------*/
 void Shell::input(char *cmd)
@@ -242,6 +264,13 @@ void Shell::input(char *cmd)
 }
 /*---------------------------------------------------------------------------*/
 
+bool Shell::start_binary()
+{
+    // as on USB, the window counts lines and not records, so the host turns it off first
+    if (static_cast<CallbackStream *>(pstream)->is_window_active()) return false;
+    return telnet->start_binary();
+}
+
 int Shell::output(const char *str)
 {
     return telnet->output(str);
@@ -86,8 +86,11 @@ public:
      */
     void prompt(const char *prompt);
 
-    int queue_size();
+    // whether the command queue has room for another command from this shell
+    bool can_queue();
     int can_output();
+    bool start_binary();
+    void report_window();
     static int command_result(const char *str, void *ti);
     StreamOutput *getStream() { return pstream; }
     void setConsole();
@@ -35,6 +35,9 @@
 #include "uip.h"
 #include "telnetd.h"
 #include "shell.h"
+#include "BinaryGcode.h"
+#include "CommandQueue.h"
+#include "Kernel.h"
 
 #include <string.h>
 #include <stdlib.h>
@@ -197,22 +200,127 @@ void Telnetd::senddata(void)
     uip_send(uip_appdata, buflen);
 }
 
-void Telnetd::get_char(u8_t c)
+// After the binary command the host sends the header and the records, with any 0xFF byte doubled as telnet
+// requires, and waits for the ok binary reply to the end record, or sends ^X, before sending text again.
+// The records are decoded here and queued for the main loop as they come.
+bool Telnetd::start_binary()
 {
-    if (c == ISO_cr) {
+    if (binary) return false;
+    if (decoder == NULL) decoder = new BinaryGcodeDecoder;
+    decoder->reset();
+    binary = true;
+    return true;
+}
+
+void Telnetd::put_binary(u8_t c)
+{
+    // never in the records, they are answered at once rather than queued behind the records before them
+    if (c == BinaryGcodeDecoder::HALT) {
+        halt();
+        return;
+    }
+    if (c == BinaryGcodeDecoder::QUERY) {
+        output(THEKERNEL->get_query_string().c_str());
         return;
     }
 
-    buf[(int)bufptr] = c;
-    if (buf[(int)bufptr] == ISO_nl || bufptr == sizeof(buf) - 1) {
-        if (bufptr > 0) {
-            buf[(int)bufptr] = 0;
+    switch (decoder->put(c)) {
+        case BinaryGcodeDecoder::NEED_MORE:
+            break;
+
+        case BinaryGcodeDecoder::MOTION:
+            CommandQueue::getInstance()->add(decoder->get_record(), shell->getStream());
+            break;
+
+        case BinaryGcodeDecoder::ENDED: {
+            // the end record carries the count of the records before it to the reply
+            BinaryGcodeRecord end = decoder->get_record();
+            uint32_t records = decoder->get_records() - 1;
+            end.mask = 1;
+            memcpy(&end.values[0], &records, sizeof(records));
+            CommandQueue::getInstance()->add(end, shell->getStream());
+            binary = false;
+            break;
         }
-        shell->input(buf);
-        bufptr = 0;
 
+        case BinaryGcodeDecoder::TEXT_LINE:
+            CommandQueue::getInstance()->add(decoder->get_text(), shell->getStream());
+            break;
+
+        case BinaryGcodeDecoder::ERROR:
+            // the rest of the stream cannot be trusted, stop as USB does
+            binary = false;
+            snprintf(buf, sizeof(buf), "Error: binary stream %s after %lu records\n", decoder->get_error(), decoder->get_records());
+            output(buf);
+            THEKERNEL->call_event(ON_HALT, nullptr);
+            break;
+    }
+}
+
+// ^X ends a binary stream and halts, as it does on USB
+void Telnetd::halt()
+{
+    binary = false;
+    THEKERNEL->call_event(ON_HALT, nullptr);
+    if (THEKERNEL->is_grbl_mode()) {
+        output("ALARM:Abort during cycle\n");
     } else {
-        ++bufptr;
+        output("HALTED, M999 or $X to exit HALT state\n");
+    }
+}
+
+// Takes ? and ^X out of what is held back in binary mode while the command queue is full, so they are answered now
+// and not once the records before them have gone. The records before a ^X are dropped, and what follows it is text.
+// Returns how many bytes are left
+uint16_t Telnetd::take_realtime(char *data, uint16_t len)
+{
+    uint16_t n = 0;
+    u8_t s = state;
+    for (uint16_t i = 0; i < len; ++i) {
+        u8_t c = data[i];
+        if (s == STATE_NORMAL && c == BinaryGcodeDecoder::HALT) {
+            halt();
+            if (state != STATE_CLOSE) state = STATE_NORMAL;
+            memmove(data, data + i + 1, len - i - 1);
+            return len - i - 1;
+        }
+        if (s == STATE_NORMAL && c == BinaryGcodeDecoder::QUERY) {
+            output(THEKERNEL->get_query_string().c_str());
+            continue;
+        }
+
+        // follows the telnet commands as receive() does, so a command byte is not taken for either, WILL, WONT, DO
+        // and DONT are all followed by one more
+        if (s == STATE_NORMAL) {
+            s = c == TELNET_IAC ? STATE_IAC : STATE_NORMAL;
+        } else if (s == STATE_IAC) {
+            s = (c == TELNET_WILL || c == TELNET_WONT || c == TELNET_DO || c == TELNET_DONT) ? STATE_WILL : STATE_NORMAL;
+        } else {
+            s = STATE_NORMAL;
+        }
+        data[n++] = c;
+    }
+    return n;
+}
+
+void Telnetd::get_char(u8_t c)
+{
+    if (binary) {
+        put_binary(c);
+        return;
+    }
+
+    if (c == ISO_cr) {
+        return;
+    }
+
+    // each line is handed to the shell as soon as it is complete, which is at \n, ^D or ^Z. A line longer than the
+    // longest command is cut short to fit in buf, and the rest of it is dropped rather than taken as another command.
+    // One too long for rxbuf is dropped entirely
+    rxbuf.put(c);
+    if (rxbuf.has_line()) {
+        rxbuf.get_line(buf, sizeof(buf));
+        shell->input(buf);
     }
 }
 
@@ -229,19 +337,17 @@ void Telnetd::get_char(u8_t c)
 //     }
 // }
 
-void Telnetd::newdata(void)
+// takes bytes until the command queue might not have room for the command they complete, returns how many it took
+uint16_t Telnetd::receive(const char *data, uint16_t len)
 {
-    u16_t len;
+    uint16_t n;
     u8_t c;
-    char *dataptr;
-
-    len = uip_datalen();
-    dataptr = (char *)uip_appdata;
 
-    while (len > 0 && bufptr < sizeof(buf)) {
-        c = *dataptr;
-        ++dataptr;
-        --len;
+    for (n = 0; n < len; ++n) {
+        if (!shell->can_queue()) {
+            break;
+        }
+        c = data[n];
         switch (state) {
             case STATE_IAC:
                 if (c == TELNET_IAC) {
@@ -309,20 +415,63 @@ void Telnetd::newdata(void)
                 break;
         }
     }
+    return n;
+}
 
-    // if the command queue is getting too big we stop TCP
-    if(shell->queue_size() > 20) {
-        DEBUG_PRINTF("Telnet: stopped: %d\n", shell->queue_size());
+void Telnetd::newdata(void)
+{
+    u16_t len = uip_datalen();
+    u16_t n = receive((char *)uip_appdata, len);
+
+    if (n < len) {
+        // the rest waits here for room in the queue, and nothing more is received until it has gone
+        pending_len = len - n;
+        pending_pos = 0;
+        pending = new char[pending_len];
+        memcpy(pending, (char *)uip_appdata + n, pending_len);
+        if (binary) {
+            pending_len = take_realtime(pending, pending_len);
+            if (pending_len == 0) {
+                delete [] pending;
+                pending = NULL;
+            }
+        }
+    }
+
+    // the window closes while the queue is full, so the host holds back the rest of the job
+    if (pending != NULL || !shell->can_queue()) {
+        DEBUG_PRINTF("Telnet: stopped\n");
         uip_stop();
     }
 }
 
+// called on a poll while stopped, gives what was held back to the queue and opens the window again once it has all
+// gone and there is room
+void Telnetd::resume(void)
+{
+    if (pending != NULL) {
+        pending_pos += receive(pending + pending_pos, pending_len - pending_pos);
+        if (pending_pos < pending_len) {
+            return;
+        }
+        delete [] pending;
+        pending = NULL;
+    }
+
+    if (shell->can_queue()) {
+        DEBUG_PRINTF("restarted - %p\n", this);
+        uip_restart();
+    }
+}
+
 void Telnetd::poll()
 {
     if(first_time) {
         first_time= false;
         shell->start();
         senddata();
+    } else {
+        shell->report_window();
     }
 }
 
@@ -334,9 +483,11 @@ Telnetd::Telnetd()
     }
 
     first_time= true;
-    bufptr = 0;
     state = STATE_NORMAL;
     prompt= false;
+    binary= false;
+    decoder= NULL;
+    pending= NULL;
     shell= new Shell(this);
 }
 
@@ -346,6 +497,8 @@ Telnetd::~Telnetd()
     for (int i = 0; i < TELNETD_CONF_NUMLINES; ++i) {
         if (lines[i] != NULL) dealloc_line(lines[i]);
     }
+    delete decoder;
+    delete [] pending;
     delete shell;
 }
 
@@ -395,9 +548,8 @@ void Telnetd::appcall(void)
         instance->senddata();
     }
 
-    if(uip_poll() && uip_stopped(uip_conn) && instance->shell->queue_size() < 5) {
-        DEBUG_PRINTF("restarted %d - %p\n", instance->shell->queue_size(), instance);
-        uip_restart();
+    if(uip_poll() && uip_stopped(uip_conn)) {
+        instance->resume();
     }
 
     if(uip_poll()) {
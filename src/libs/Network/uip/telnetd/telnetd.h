@@ -36,8 +36,10 @@
 #define __TELNETD_H__
 
 #include "stdint.h"
+#include "LineBuffer.h"
 
 class Shell;
+class BinaryGcodeDecoder;
 
 class Telnetd
 {
@@ -52,6 +54,7 @@ public:
     int output(const char *str);
     int can_output();
     void close();
+    bool start_binary();
 
 private:
     static const int TELNETD_CONF_MAXCOMMANDLENGTH= 132;
@@ -61,8 +64,9 @@ private:
 
     // FIXME this needs to be a FIFO
     char *lines[TELNETD_CONF_NUMLINES];
+    // each line is taken out as soon as it is complete, so this only has to be longer than the longest command
+    LineBuffer<256, 4> rxbuf;
     char buf[TELNETD_CONF_MAXCOMMANDLENGTH];
-    char bufptr;
     uint8_t numsent;
     uint8_t state;
     uint16_t rport;
@@ -70,12 +74,22 @@ private:
     bool prompt;
 
     bool first_time;
+    bool binary;                // what is received is in the binary format of BinaryGcode.h
+    BinaryGcodeDecoder *decoder;
+    char *pending;              // the rest of a segment that came when the command queue was full
+    uint16_t pending_len;
+    uint16_t pending_pos;
 
     int sendline(char *line);
     void acked(void);
     void senddata(void);
     void get_char(uint8_t c);
+    void put_binary(uint8_t c);
+    void halt();
+    uint16_t take_realtime(char *data, uint16_t len);
+    uint16_t receive(const char *data, uint16_t len);
     void newdata(void);
+    void resume(void);
     void poll(void);
 
 };
@@ -359,6 +359,19 @@ PT_THREAD(psock_readbuf_len(register struct psock *psock, uint16_t len))
     PT_END(&psock->psockpt);
 }
 /*---------------------------------------------------------------------------*/
+PT_THREAD(psock_wait_data(register struct psock *psock))
+{
+    PT_BEGIN(&psock->psockpt);
+
+    if (psock->readlen == 0) {
+        PT_WAIT_UNTIL(&psock->psockpt, psock_newdata(psock));
+        psock->state = STATE_READ;
+        psock->readptr = (uint8_t *)uip_appdata;
+        psock->readlen = uip_datalen();
+    }
+    PT_END(&psock->psockpt);
+}
+/*---------------------------------------------------------------------------*/
 void
 psock_init(register struct psock *psock, char *buffer, unsigned int buffersize)
 {
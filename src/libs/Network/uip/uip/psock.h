@@ -269,6 +269,29 @@ PT_THREAD(psock_readbuf_len(struct psock *psock,  uint16_t len));
 #define PSOCK_READBUF_LEN(psock, len)                        \
 PT_WAIT_THREAD(&((psock)->pt), psock_readbuf_len(psock, len))
 
+/**
+ * Change the input buffer the PSOCK_READ functions read into, so a message
+ * can be read straight to where it is kept.
+ */
+#define PSOCK_SET_BUFFER(psock, buffer, buffersize) \
+  do { (psock)->bufptr = (buffer); (psock)->bufsize = (buffersize); } while(0)
+
+PT_THREAD(psock_wait_data(struct psock *psock));
+
+/**
+ * Wait until there is unread data, without copying it anywhere.
+ *
+ * The data is then at PSOCK_GET_START_OF_REST_OF_BUFFER() and
+ * PSOCK_GET_LENGTH_OF_REST_OF_BUFFER() long, in the uip_appdata buffer, and
+ * whatever is used of it is taken with PSOCK_CONSUME(). It must all be used
+ * before the next call to the application returns, as uIP reuses the buffer.
+ */
+#define PSOCK_WAIT_DATA(psock) \
+  PT_WAIT_THREAD(&((psock)->pt), psock_wait_data(psock))
+
+#define PSOCK_CONSUME(psock, n) \
+  do { (psock)->readptr += (n); (psock)->readlen -= (n); } while(0)
+
 
 PT_THREAD(psock_readto(struct psock *psock, unsigned char c));
 /**
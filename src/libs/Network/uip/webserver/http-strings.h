@@ -5,6 +5,9 @@ extern const char http_10[9];
 extern const char http_11[9];
 extern const char http_content_length[17];
 extern const char http_cache_control[16];
+extern const char http_connection[13];
+extern const char http_keep_alive[11];
+extern const char http_close[6];
 extern const char http_no_cache[9];
 extern const char http_index_html[12];
 extern const char http_404_html[10];
@@ -13,7 +16,10 @@ extern const char http_header_200[18];
 extern const char http_header_304[116];
 extern const char http_header_404[25];
 extern const char http_header_503[22];
-extern const char http_header_all[69];
+extern const char http_header_all[50];
+extern const char http_connection_close[20];
+extern const char http_connection_keep_alive[25];
+extern const char http_crnl[3];
 extern const char http_content_type_plain[29];
 extern const char http_content_type_html[28];
 extern const char http_content_type_css [27];
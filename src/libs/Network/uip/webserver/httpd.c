@@ -69,6 +69,7 @@
 #include "http-strings.h"
 
 #include <string.h>
+#include <strings.h>
 #include "stdio.h"
 #include "stdlib.h"
 
@@ -140,49 +141,64 @@ static void create_callback_stream(struct httpd_state *s)
     s->pstream = new_callback_stream(command_result, s);
 }
 
-// Used to save files to SDCARD during upload
-static FILE *fd;
-static char *output_filename = NULL;
-static int file_cnt = 0;
-static int open_file(const char *fn)
+// Used to save files to SDCARD during upload, the data is held in the buffer until it is full, so every write
+// but the last is of whole sectors on a sector boundary
+static int open_file(struct httpd_state *s)
 {
-    if (output_filename != NULL) free(output_filename);
-    output_filename = malloc(strlen(fn) + 5);
-    strcpy(output_filename, "/sd/");
-    strcat(output_filename, fn);
-    fd = fopen(output_filename, "w");
-    if (fd == NULL) {
-        free(output_filename);
-        output_filename = NULL;
+    char path[sizeof(s->upload_name) + 4];
+    strcpy(path, "/sd/");
+    strcat(path, s->upload_name);
+
+    s->buffer = malloc(HTTPD_BUFFER_SIZE);
+    if (s->buffer == NULL) {
         return 0;
     }
+    s->buffer_head = 0;
+
+    s->fd = fopen(path, "w");
+    if (s->fd == NULL) {
+        free(s->buffer);
+        s->buffer = NULL;
+        return 0;
+    }
+    // the buffer is already whole sectors, a stdio buffer would only copy them again
+    setvbuf(s->fd, NULL, _IONBF, 0);
     return 1;
 }
 
-static int close_file()
+static int flush_file(struct httpd_state *s)
 {
-    free(output_filename);
-    output_filename = NULL;
-    fclose(fd);
-    return 1;
+    size_t n = s->buffer_head;
+    s->buffer_head = 0;
+    return n == 0 || fwrite(s->buffer, 1, n, s->fd) == n;
 }
 
-static int save_file(uint8_t *buf, unsigned int len)
+static int close_file(struct httpd_state *s)
 {
-    if (fwrite(buf, 1, len, fd) == len) {
-        file_cnt += len;
-        // HACK alert work around bug causing file corruption when writing large amounts of data
-        if (file_cnt >= 400) {
-            file_cnt = 0;
-            fclose(fd);
-            fd = fopen(output_filename, "a");
-        }
-        return 1;
+    int ok = flush_file(s);
+    if (fclose(s->fd) != 0) ok = 0;
+    s->fd = NULL;
+    free(s->buffer);
+    s->buffer = NULL;
+    return ok;
+}
 
-    } else {
-        close_file();
-        return 0;
+static int save_file(struct httpd_state *s, const uint8_t *buf, unsigned int len)
+{
+    while (len > 0) {
+        unsigned int n = HTTPD_BUFFER_SIZE - s->buffer_head;
+        if (n > len) n = len;
+        memcpy(&s->buffer[s->buffer_head], buf, n);
+        s->buffer_head += n;
+        buf += n;
+        len -= n;
+
+        if (s->buffer_head == HTTPD_BUFFER_SIZE && !flush_file(s)) {
+            close_file(s);
+            return 0;
+        }
     }
+    return 1;
 }
 
 static int fs_open(struct httpd_state *s)
@@ -194,11 +210,22 @@ static int fs_open(struct httpd_state *s)
             DEBUG_PRINTF("Failed to open: %s\n", s->filename);
             return 0;
         }
+        // it is read a half of the buffer at a time, straight into the buffer
+        setvbuf(s->fd, NULL, _IONBF, 0);
+        s->out_length = -1;
+        if (fseek(s->fd, 0, SEEK_END) == 0) {
+            s->out_length = ftell(s->fd);
+            fseek(s->fd, 0, SEEK_SET);
+        }
         return 1;
 
     } else {
         s->fd = NULL;
-        return httpd_fs_open(s->filename, &s->file);
+        if (!httpd_fs_open(s->filename, &s->file)) {
+            return 0;
+        }
+        s->out_length = s->file.len;
+        return 1;
     }
 }
 
@@ -241,20 +268,47 @@ static unsigned short generate_part_of_file(void *state)
     return s->len;
 }
 /*---------------------------------------------------------------------------*/
+// keeps both halves of the buffer full, a half is read again as soon as all of it has been sent and acked
+static void read_ahead(struct httpd_state *s)
+{
+    while (!s->end_of_file && s->buffer_head - s->buffer_tail <= HTTPD_BUFFER_SIZE / 2) {
+        size_t n = fread(&s->buffer[s->buffer_head % HTTPD_BUFFER_SIZE], 1, HTTPD_BUFFER_SIZE / 2, s->fd);
+        s->buffer_head += n;
+        if (n < HTTPD_BUFFER_SIZE / 2) s->end_of_file = 1;
+    }
+}
+
+// the start of the file is read before the headers are sent, so it is ready when they are acked
+static int start_sd_file(struct httpd_state *s)
+{
+    s->buffer = malloc(HTTPD_BUFFER_SIZE);
+    if (s->buffer == NULL) {
+        fclose(s->fd);
+        s->fd = NULL;
+        return 0;
+    }
+    s->buffer_head = s->buffer_tail = 0;
+    s->end_of_file = 0;
+    read_ahead(s);
+    return 1;
+}
+
+// only copies from the buffer, which does not change until the segment is acked, so a retransmission is the same
 static unsigned short generate_part_of_sd_file(void *state)
 {
     struct httpd_state *s = (struct httpd_state *)state;
+    uint32_t start = s->buffer_tail % HTTPD_BUFFER_SIZE;
+    uint32_t first;
 
-    int len = fread(uip_appdata, 1, uip_mss(), s->fd);
-    if (len <= 0) {
-        // we need to send something
-        strcpy(uip_appdata, "\r\n");
-        len = 2;
-        s->len = 0;
-    } else {
-        s->len = len;
+    s->len = s->buffer_head - s->buffer_tail;
+    if (s->len > uip_mss()) {
+        s->len = uip_mss();
     }
-    return len;
+    first = HTTPD_BUFFER_SIZE - start;
+    if (first > s->len) first = s->len;
+    memcpy(uip_appdata, &s->buffer[start], first);
+    memcpy((char *)uip_appdata + first, s->buffer, s->len - first);
+    return s->len;
 }
 /*---------------------------------------------------------------------------*/
 static
@@ -276,44 +330,75 @@ static PT_THREAD(send_sd_file(struct httpd_state *s))
 {
     PSOCK_BEGIN(&s->sout);
 
-    do {
+    while (s->buffer_tail < s->buffer_head) {
         PSOCK_GENERATOR_SEND(&s->sout, generate_part_of_sd_file, s);
-    } while (s->len > 0);
+        s->buffer_tail += s->len;
+        read_ahead(s);
+    }
+
+    if ((int)s->buffer_tail != s->out_length) {
+        // the file could not all be read, closing is the only way left to tell the client
+        s->keep_alive = 0;
+    }
 
     fclose(s->fd);
     s->fd = NULL;
+    free(s->buffer);
+    s->buffer = NULL;
 
     PSOCK_END(&s->sout);
 }
 
 /*---------------------------------------------------------------------------*/
-static PT_THREAD(send_headers_3(struct httpd_state *s, const char *statushdr, char send_content_type))
+static const char *content_type(const char *filename)
 {
-    char *ptr;
+    const char *ptr = strrchr(filename, ISO_period);
+    if (ptr == NULL) {
+        return http_content_type_plain; // http_content_type_binary;
+    } else if (strncmp(http_html, ptr, 5) == 0) {
+        return http_content_type_html;
+    } else if (strncmp(http_css, ptr, 4) == 0) {
+        return http_content_type_css;
+    } else if (strncmp(http_png, ptr, 4) == 0) {
+        return http_content_type_png;
+    } else if (strncmp(http_gif, ptr, 4) == 0) {
+        return http_content_type_gif;
+    } else if (strncmp(http_jpg, ptr, 4) == 0) {
+        return http_content_type_jpg;
+    }
+    return http_content_type_plain;
+}
+
+// all the headers go in one segment, at most about 270 bytes which is well inside the MSS
+static unsigned short generate_headers(void *state)
+{
+    struct httpd_state *s = (struct httpd_state *)state;
+    char *ptr = (char *)uip_appdata;
 
+    strcpy(ptr, s->statushdr);
+    strcat(ptr, http_header_all);
+    if (s->send_content_type && s->out_length >= 0) {
+        ptr += strlen(ptr);
+        sprintf(ptr, "%s%d\r\n", http_content_length, s->out_length);
+    }
+    strcat(ptr, s->keep_alive ? http_connection_keep_alive : http_connection_close);
+    strcat(ptr, s->send_content_type ? content_type(s->filename) : http_crnl);
+    return strlen((char *)uip_appdata);
+}
+
+/*---------------------------------------------------------------------------*/
+static PT_THREAD(send_headers_3(struct httpd_state *s, const char *statushdr, char send_content_type))
+{
     PSOCK_BEGIN(&s->sout);
 
-    PSOCK_SEND_STR(&s->sout, statushdr);
-    PSOCK_SEND_STR(&s->sout, http_header_all);
-
-    if (send_content_type) {
-        ptr = strrchr(s->filename, ISO_period);
-        if (ptr == NULL) {
-            PSOCK_SEND_STR(&s->sout, http_content_type_plain); // http_content_type_binary);
-        } else if (strncmp(http_html, ptr, 5) == 0) {
-            PSOCK_SEND_STR(&s->sout, http_content_type_html);
-        } else if (strncmp(http_css, ptr, 4) == 0) {
-            PSOCK_SEND_STR(&s->sout, http_content_type_css);
-        } else if (strncmp(http_png, ptr, 4) == 0) {
-            PSOCK_SEND_STR(&s->sout, http_content_type_png);
-        } else if (strncmp(http_gif, ptr, 4) == 0) {
-            PSOCK_SEND_STR(&s->sout, http_content_type_gif);
-        } else if (strncmp(http_jpg, ptr, 4) == 0) {
-            PSOCK_SEND_STR(&s->sout, http_content_type_jpg);
-        } else {
-            PSOCK_SEND_STR(&s->sout, http_content_type_plain);
-        }
+    s->statushdr = statushdr;
+    s->send_content_type = send_content_type;
+    if (send_content_type && s->out_length < 0) {
+        // without a length only closing the connection ends the body
+        s->keep_alive = 0;
     }
+    PSOCK_GENERATOR_SEND(&s->sout, generate_headers, s);
+
     PSOCK_END(&s->sout);
 }
 static PT_THREAD(send_headers(struct httpd_state *s, const char *statushdr))
@@ -327,26 +412,33 @@ PT_THREAD(handle_output(struct httpd_state *s))
     PT_BEGIN(&s->outputpt);
 
     if (s->method == OPTIONS) {
+        s->out_length = sizeof("OK\r\n") - 1;
         PT_WAIT_THREAD(&s->outputpt, send_headers(s, http_header_preflight));
         PSOCK_SEND_STR(&s->sout, "OK\r\n");
     }
     else if (s->method == POST) {
         if (strcmp(s->filename, "/command") == 0) {
             DEBUG_PRINTF("Executed command post\n");
+            s->out_length = -1;
             PT_WAIT_THREAD(&s->outputpt, send_headers(s, http_header_200));
             // send response as we get it
             PT_WAIT_THREAD(&s->outputpt, send_command_response(s));
 
         } else if (strcmp(s->filename, "/command_silent") == 0) {
             DEBUG_PRINTF("Executed silent command post\n");
+            s->out_length = 0;
             PT_WAIT_THREAD(&s->outputpt, send_headers(s, http_header_200));
 
         } else if (strcmp(s->filename, "/upload") == 0) {
             DEBUG_PRINTF("upload output: %d\n", s->uploadok);
             if (s->uploadok == 0) {
+                // the rest of the body was not read, so the connection has to be closed
+                s->keep_alive = 0;
+                s->out_length = sizeof("FAILED\r\n") - 1;
                 PT_WAIT_THREAD(&s->outputpt, send_headers(s, http_header_503));
                 PSOCK_SEND_STR(&s->sout, "FAILED\r\n");
             } else {
+                s->out_length = sizeof("OK\r\n") - 1;
                 PT_WAIT_THREAD(&s->outputpt, send_headers(s, http_header_200));
                 PSOCK_SEND_STR(&s->sout, "OK\r\n");
             }
@@ -355,6 +447,7 @@ PT_THREAD(handle_output(struct httpd_state *s))
             DEBUG_PRINTF("Unknown POST: %s\n", s->filename);
             httpd_fs_open(http_404_html, &s->file);
             strcpy(s->filename, http_404_html);
+            s->out_length = s->file.len;
             PT_WAIT_THREAD(&s->outputpt, send_headers(s, http_header_404));
             PT_WAIT_THREAD(&s->outputpt, send_file(s));
         }
@@ -365,6 +458,7 @@ PT_THREAD(handle_output(struct httpd_state *s))
             DEBUG_PRINTF("404 file not found\n");
             httpd_fs_open(http_404_html, &s->file);
             strcpy(s->filename, http_404_html);
+            s->out_length = s->file.len;
             PT_WAIT_THREAD(&s->outputpt, send_headers(s, http_header_404));
             PT_WAIT_THREAD(&s->outputpt, send_file(s));
 
@@ -378,6 +472,12 @@ PT_THREAD(handle_output(struct httpd_state *s))
             DEBUG_PRINTF("304 Not Modified\n");
             PT_WAIT_THREAD(&s->outputpt, send_headers_3(s, http_header_304, 0));
 
+        } else if (s->fd != NULL && !start_sd_file(s)) {
+            DEBUG_PRINTF("no memory to send %s\n", s->filename);
+            s->out_length = sizeof("FAILED\r\n") - 1;
+            PT_WAIT_THREAD(&s->outputpt, send_headers(s, http_header_503));
+            PSOCK_SEND_STR(&s->sout, "FAILED\r\n");
+
         } else {
             DEBUG_PRINTF("sending file %s\n", s->filename);
             PT_WAIT_THREAD(&s->outputpt, send_headers(s, http_header_200));
@@ -392,7 +492,14 @@ PT_THREAD(handle_output(struct httpd_state *s))
         }
     }
 
-    PSOCK_CLOSE(&s->sout);
+    if (s->keep_alive) {
+        // the connection stays open for the next request, anything the client sent after this one is dropped
+        PSOCK_INIT(&s->sin, s->inputbuf, sizeof(s->inputbuf) - 1);
+        PSOCK_INIT(&s->sout, s->inputbuf, sizeof(s->inputbuf) - 1);
+        s->state = STATE_WAITING;
+    } else {
+        PSOCK_CLOSE(&s->sout);
+    }
     PT_END(&s->outputpt);
 }
 
@@ -424,7 +531,7 @@ static PT_THREAD(handle_uploaded_data(struct httpd_state *s, uint8_t *buf, int l
     DEBUG_PRINTF("Uploading file: %s, %d\n", s->upload_name, s->content_length);
 
     // The body is the raw data to be stored to the file
-    if (!open_file(s->upload_name)) {
+    if (!open_file(s)) {
         DEBUG_PRINTF("failed to open file\n");
         s->uploadok = 0;
         PT_EXIT(&s->inputpt);
@@ -432,9 +539,10 @@ static PT_THREAD(handle_uploaded_data(struct httpd_state *s, uint8_t *buf, int l
 
     DEBUG_PRINTF("opened file: %s\n", s->upload_name);
 
+    if (len > s->content_length) len = s->content_length;
     if (len > 0) {
         // write the first part of the buffer
-        if (!save_file(buf, len)) {
+        if (!save_file(s, buf, len)) {
             DEBUG_PRINTF("initial write failed\n");
             s->uploadok = 0;
             PT_EXIT(&s->inputpt);
@@ -453,8 +561,9 @@ static PT_THREAD(handle_uploaded_data(struct httpd_state *s, uint8_t *buf, int l
         int readlen = uip_datalen();
         //DEBUG_PRINTF("read %d bytes of data\n", readlen);
 
+        if (readlen > s->content_length) readlen = s->content_length;
         if (readlen > 0) {
-            if (!save_file(readptr, readlen)) {
+            if (!save_file(s, readptr, readlen)) {
                 DEBUG_PRINTF("write failed\n");
                 s->uploadok = 0;
                 PT_EXIT(&s->inputpt);
@@ -463,8 +572,7 @@ static PT_THREAD(handle_uploaded_data(struct httpd_state *s, uint8_t *buf, int l
         }
     }
 
-    close_file();
-    s->uploadok = 1;
+    s->uploadok = close_file(s);
     DEBUG_PRINTF("finished upload\n");
 
     PT_END(&s->inputpt);
@@ -510,6 +618,8 @@ PT_THREAD(handle_input(struct httpd_state *s))
     s->state = STATE_HEADERS;
     s->content_length = 0;
     s->cache_page = 0;
+    s->keep_alive = 0;
+    s->upload_name[0] = 0;
     while (1) {
         if (s->state == STATE_HEADERS) {
             // read the headers of the request
@@ -533,7 +643,20 @@ PT_THREAD(handle_input(struct httpd_state *s))
             } else {
                 DEBUG_PRINTF("reading header: %s\n", s->inputbuf);
                 // handle headers here
-                if (strncmp(s->inputbuf, http_content_length, sizeof(http_content_length) - 1) == 0) {
+                if (strncmp(s->inputbuf, http_11, sizeof(http_11) - 1) == 0) {
+                    // the end of the request line, 1.1 connections are kept open unless asked otherwise
+                    s->keep_alive = 1;
+
+                } else if (strncmp(s->inputbuf, http_connection, sizeof(http_connection) - 1) == 0) {
+                    s->inputbuf[PSOCK_DATALEN(&s->sin) - 2] = 0;
+                    if (strncasecmp(&s->inputbuf[sizeof(http_connection) - 1], http_keep_alive, sizeof(http_keep_alive) - 1) == 0) {
+                        s->keep_alive = 1;
+                    } else if (strncasecmp(&s->inputbuf[sizeof(http_connection) - 1], http_close, sizeof(http_close) - 1) == 0) {
+                        s->keep_alive = 0;
+                    }
+                    DEBUG_PRINTF("keep alive= %d\n", s->keep_alive);
+
+                } else if (strncmp(s->inputbuf, http_content_length, sizeof(http_content_length) - 1) == 0) {
                     s->inputbuf[PSOCK_DATALEN(&s->sin) - 2] = 0;
                     s->content_length = atoi(&s->inputbuf[sizeof(http_content_length) - 1]);
                     DEBUG_PRINTF("Content length= %s, %d\n", &s->inputbuf[sizeof(http_content_length) - 1], s->content_length);
@@ -541,6 +664,7 @@ PT_THREAD(handle_input(struct httpd_state *s))
                 } else if (strncmp(s->inputbuf, "X-Filename: ", 11) == 0) {
                     s->inputbuf[PSOCK_DATALEN(&s->sin) - 2] = 0;
                     strncpy(s->upload_name, &s->inputbuf[12], sizeof(s->upload_name) - 1);
+                    s->upload_name[sizeof(s->upload_name) - 1] = 0;
                     DEBUG_PRINTF("Upload name= %s\n", s->upload_name);
 
                 } else if (strncmp(s->inputbuf, http_cache_control, sizeof(http_cache_control) - 1) == 0) {
@@ -561,6 +685,8 @@ PT_THREAD(handle_input(struct httpd_state *s))
 
             } else { // unknown POST
                 DEBUG_PRINTF("Unknown Post URL: %s\n", s->filename);
+                // the body is not read
+                s->keep_alive = 0;
                 s->state = STATE_OUTPUT;
                 break;
             }
@@ -578,6 +704,10 @@ PT_THREAD(handle_input(struct httpd_state *s))
                     s->command_count++; // count number of command lines we submit
                 }
                 DEBUG_PRINTF("Read body done\n");
+                if (s->content_length != 0) {
+                    // the last of the body was not a whole line
+                    s->keep_alive = 0;
+                }
                 s->state = STATE_OUTPUT;
 
             } else {
@@ -603,9 +733,14 @@ PT_THREAD(handle_input(struct httpd_state *s))
 static void
 handle_connection(struct httpd_state *s)
 {
-    if (s->state != STATE_OUTPUT) {
-        handle_input(s);
+    if (s->state == STATE_OUTPUT) {
+        handle_output(s);
+        // the ack for the end of a response can come with the next request
+        if (s->state != STATE_WAITING || !uip_newdata()) {
+            return;
+        }
     }
+    handle_input(s);
     if (s->state == STATE_OUTPUT) {
         handle_output(s);
     }
@@ -637,6 +772,8 @@ httpd_appcall(void)
         /*    timer_set(&s->timer, CLOCK_SECOND * 100);*/
         s->timer = 0;
         s->fd = NULL;
+        s->buffer = NULL;
+        s->keep_alive = 0;
         s->strbuf = NULL;
         s->fifo = NULL;
         s->pstream = NULL;
@@ -661,7 +798,8 @@ httpd_appcall(void)
 
     if (uip_closed() || uip_aborted() || uip_timedout()) {
         DEBUG_PRINTF("Closing connection: %d\n", HTONS(uip_conn->rport));
-        if (s->fd != NULL) fclose(fd); // clean up
+        if (s->fd != NULL) fclose(s->fd); // clean up
+        if (s->buffer != NULL) free(s->buffer);
         if (s->strbuf != NULL) free(s->strbuf);
         if (s->pstream != NULL) {
             // free these if they were allocated
@@ -60,8 +60,20 @@ struct httpd_state {
   void *pstream;
   void *fifo;
   uint16_t command_count;
+  int out_length;           // Content-Length of the response, -1 when it is not known up front
+  uint8_t keep_alive;       // wait for another request once the response has been sent
+  uint8_t end_of_file;
+  const char *statushdr;
+  char send_content_type;
+  char *buffer;             // HTTPD_BUFFER_SIZE bytes while a file on the sd card is uploaded or sent
+  uint32_t buffer_head;     // bytes put into the buffer
+  uint32_t buffer_tail;     // bytes taken out of it
 };
 
+// Files on the sd card go through a buffer of whole sectors, so FatFs reads and writes them with multiple
+// block transfers straight to and from the buffer. Downloads read it a half at a time, ahead of what is sent.
+#define HTTPD_BUFFER_SIZE 2048
+
 #ifdef __cplusplus
 extern "C" {
 #endif
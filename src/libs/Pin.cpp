@@ -192,6 +192,18 @@ mbed::PwmOut* Pin::hardware_pwm()
     return nullptr;
 }
 
+uint32_t Pin::raise_edge_priority()
+{
+    uint32_t priority= NVIC_GetPriority(EINT3_IRQn);
+    NVIC_SetPriority(EINT3_IRQn, 3);
+    return priority;
+}
+
+void Pin::restore_edge_priority(uint32_t priority)
+{
+    NVIC_SetPriority(EINT3_IRQn, priority);
+}
+
 mbed::InterruptIn* Pin::interrupt_pin()
 {
     if(!this->valid) return nullptr;
@@ -66,6 +66,12 @@ class Pin {
         mbed::PwmOut *hardware_pwm();
 
         mbed::InterruptIn *interrupt_pin();
+        // only pins on ports 0 and 2 can raise an interrupt on an edge
+        bool can_interrupt() const { return this->valid && (this->port_number == 0 || this->port_number == 2); }
+        // every pin edge shares the one interrupt, these raise it to just below the step ticker for a probe or homing
+        // move and then put back the priority the other users of it set
+        static uint32_t raise_edge_priority();
+        static void restore_edge_priority(uint32_t priority);
 
         bool is_inverting() const { return inverting; }
         void set_inverting(bool f) { inverting= f; }
@@ -0,0 +1,138 @@
+/*
+      This file is part of Smoothie (http://smoothieware.org/). The motion control part is heavily based on Grbl (https://github.com/simen/grbl).
+      Smoothie is free software: you can redistribute it and/or modify it under the terms of the GNU General Public License as published by the Free Software Foundation, either version 3 of the License, or (at your option) any later version.
+      Smoothie is distributed in the hope that it will be useful, but WITHOUT ANY WARRANTY; without even the implied warranty of MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the GNU General Public License for more details.
+      You should have received a copy of the GNU General Public License along with Smoothie. If not, see <http://www.gnu.org/licenses/>.
+*/
+
+#ifndef READAHEADBUFFER_H
+#define READAHEADBUFFER_H
+
+#include <stddef.h>
+#include <stdint.h>
+#include <string.h>
+
+// Splits a file into lines from two chunk sized halves of a buffer.
+// The file is read a whole chunk at a time into whichever half has been used up, while the lines in the other
+// half are still being taken out, so the reads start on chunk boundaries and with a chunk that is a multiple of
+// the sector size FatFs reads the sectors straight into the buffer with one multiple block read.
+// The caller does the reading: free_chunk() gives where the next chunk goes, filled() says how much was read,
+// anything short of a chunk is the end of the file.
+// Lines longer than a chunk are always dropped, so chunk should be at least the longest line wanted.
+class ReadAheadBuffer {
+    public:
+        enum line_t { NO_LINE, LINE, LONG_LINE };
+
+        ReadAheadBuffer() { buffer= nullptr; chunk= 0; reset(); }
+
+        // buffer must be 2 * chunk bytes, nullptr detaches it
+        void attach(char *buffer, size_t chunk) { this->buffer= buffer; this->chunk= chunk; reset(); }
+        void reset() { head= tail= 0; end_of_file= discarding= false; }
+
+        char *get_buffer() const { return buffer; }
+        size_t get_chunk_size() const { return chunk; }
+
+        // where the next chunk should be read to, nullptr if neither half is free yet or the file has all been read
+        char *free_chunk() const
+        {
+            if(buffer == nullptr || end_of_file || head - tail > chunk) return nullptr;
+            return &buffer[head % (2 * chunk)];
+        }
+
+        // n bytes were read into free_chunk()
+        void filled(size_t n)
+        {
+            head += n;
+            if(n < chunk) end_of_file= true;
+        }
+
+        // no more lines to take out
+        bool is_finished() const { return end_of_file && tail == head; }
+        size_t available() const { return head - tail; }
+
+        // Takes the next line, including its \n, into line, nul terminated. Returns NO_LINE if more needs to be read
+        // first, or LONG_LINE if it did not fit in size bytes, in which case it is dropped. The last line of the
+        // file need not end in \n. used is set to how many bytes of the file were taken.
+        line_t get_line(char *line, size_t size, size_t& used)
+        {
+            used= 0;
+            if(discarding) {
+                // the rest of a line that was longer than a chunk
+                size_t n= find_eol();
+                if(n == 0) {
+                    used= head - tail;
+                    tail= head;
+                    if(end_of_file) discarding= false;
+                    return NO_LINE;
+                }
+                used= n;
+                tail += n;
+                discarding= false;
+            }
+
+            size_t n= find_eol();
+            if(n == 0) {
+                if(!end_of_file || tail == head) {
+                    if(!end_of_file && head - tail > chunk) {
+                        // nothing more can be read until this line is taken out, so it is longer than a chunk,
+                        // drop what there is and the rest of the line as it comes
+                        used += head - tail;
+                        tail= head;
+                        discarding= true;
+                        return LONG_LINE;
+                    }
+                    return NO_LINE;
+                }
+                n= head - tail;
+            }
+
+            used += n;
+            if(n >= size) {
+                tail += n;
+                return LONG_LINE;
+            }
+
+            size_t start= tail % (2 * chunk);
+            size_t first= (start + n > 2 * chunk) ? 2 * chunk - start : n;
+            memcpy(line, &buffer[start], first);
+            memcpy(line + first, buffer, n - first);
+            line[n]= '\0';
+            tail += n;
+            return LINE;
+        }
+
+        // for a file that is not lines, the bytes that can be taken in one go, and taking them
+        size_t peek(const char *&p) const
+        {
+            size_t start= tail % (2 * chunk);
+            size_t n= head - tail;
+            p= &buffer[start];
+            return (start + n > 2 * chunk) ? 2 * chunk - start : n;
+        }
+        void consume(size_t n) { tail += n; }
+
+    private:
+        // length of the line at tail including its \n, 0 if there is no \n yet
+        size_t find_eol() const
+        {
+            size_t start= tail % (2 * chunk);
+            size_t n= head - tail;
+            size_t first= (start + n > 2 * chunk) ? 2 * chunk - start : n;
+            const char *p= (const char *)memchr(&buffer[start], '\n', first);
+            if(p != nullptr) return p - &buffer[start] + 1;
+            p= (const char *)memchr(buffer, '\n', n - first);
+            if(p != nullptr) return first + (p - buffer) + 1;
+            return 0;
+        }
+
+        char *buffer;
+        size_t chunk;
+        uint32_t head;      // bytes read from the file
+        uint32_t tail;      // bytes taken out as lines
+        struct {
+            bool end_of_file:1;
+            bool discarding:1;
+        };
+};
+
+#endif
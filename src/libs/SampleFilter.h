@@ -0,0 +1,114 @@
+/*
+      This file is part of Smoothie (http://smoothieware.org/). The motion control part is heavily based on Grbl (https://github.com/simen/grbl).
+      Smoothie is free software: you can redistribute it and/or modify it under the terms of the GNU General Public License as published by the Free Software Foundation, either version 3 of the License, or (at your option) any later version.
+      Smoothie is distributed in the hope that it will be useful, but WITHOUT ANY WARRANTY; without even the implied warranty of MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the GNU General Public License for more details.
+      You should have received a copy of the GNU General Public License along with Smoothie. If not, see <http://www.gnu.org/licenses/>.
+*/
+
+#ifndef SAMPLEFILTER_H
+#define SAMPLEFILTER_H
+
+#include <stdint.h>
+#include <string.h>
+
+// Filters a stream of readings, kept up to date as each one is added so that getting the result costs nothing.
+// MEDIAN is the middle of the last window readings, which throws out spikes. The readings are kept sorted as well as
+// in the order they came, so adding one is moving the rest of the window along by one place rather than sorting it.
+// AVERAGE is the mean of the last window readings, from a running total.
+// IIR moves the result a 1/window of the way to each reading, window is rounded down to a power of two so that is a
+// shift, and the result is kept with 8 more bits so the small steps are not lost.
+// Until the window has filled the result is of the readings there are, and 0 before there are any.
+class SampleFilter {
+    public:
+        enum TYPE { MEDIAN, AVERAGE, IIR };
+        static const int MAX_WINDOW= 16;
+
+        SampleFilter() { set(MEDIAN, 5); }
+
+        // window is 1 to MAX_WINDOW for MEDIAN and AVERAGE, and 1 to 2^15 for IIR, this starts again
+        void set(uint8_t type, uint16_t window)
+        {
+            this->type= type;
+            if(window < 1) window= 1;
+            if(type == IIR) {
+                shift= 0;
+                while(shift < 15 && (2 << shift) <= window) shift++;
+                this->window= 1 << shift;
+            } else {
+                this->window= window > MAX_WINDOW ? MAX_WINDOW : window;
+            }
+            clear();
+        }
+
+        void clear()
+        {
+            n= head= 0;
+            sum= 0;
+            result= 0;
+        }
+
+        void add(uint16_t x)
+        {
+            switch(type) {
+                case MEDIAN: {
+                    int i= n;
+                    if(n == window) {
+                        // take the oldest out of the sorted readings, closing the gap
+                        uint16_t old= ring[head];
+                        for(i= 0; sorted[i] != old; i++) ;
+                        for(; i < n - 1; i++) sorted[i]= sorted[i + 1];
+                    } else {
+                        n++;
+                    }
+                    // then move the larger ones up to make a place for the new one
+                    for(; i > 0 && sorted[i - 1] > x; i--) sorted[i]= sorted[i - 1];
+                    sorted[i]= x;
+                    push(x);
+                    result= (n & 1) ? sorted[n / 2] : (sorted[n / 2 - 1] + sorted[n / 2] + 1) / 2;
+                    break;
+                }
+
+                case AVERAGE:
+                    if(n == window) sum -= ring[head];
+                    else n++;
+                    sum += x;
+                    push(x);
+                    result= (sum + n / 2) / n;
+                    break;
+
+                case IIR:
+                    if(n == 0) {
+                        n= 1;
+                        sum= (uint32_t)x << 8;
+                    } else {
+                        sum += (((int32_t)x << 8) - (int32_t)sum) >> shift;
+                    }
+                    result= (sum + 128) >> 8;
+                    break;
+            }
+        }
+
+        uint16_t get() const { return result; }
+        bool is_empty() const { return n == 0; }
+        uint8_t get_type() const { return type; }
+        uint16_t get_window() const { return window; }
+
+    private:
+        void push(uint16_t x)
+        {
+            ring[head]= x;
+            if(++head == window) head= 0;
+        }
+
+        uint16_t ring[MAX_WINDOW];      // the readings in the order they came, head is the oldest once it is full
+        uint16_t sorted[MAX_WINDOW];    // and in order of size, for MEDIAN
+        uint32_t sum;                   // the total for AVERAGE, or the result with 8 more bits for IIR
+        uint16_t window;
+        uint16_t result;
+        uint8_t n;
+        uint8_t head;
+        uint8_t type;
+        uint8_t shift;
+};
+
+#endif
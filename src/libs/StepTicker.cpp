@@ -46,6 +46,8 @@ StepTicker::StepTicker()
     LPC_TIM1->TCR = 0;              // Disable interrupt
 
     // Default start values
+    this->max_step_loops = 1;
+    this->step_loops_threshold = 0;
     this->set_frequency(100000);
     this->set_unstep_time(100);
 
@@ -53,8 +55,14 @@ StepTicker::StepTicker()
     this->num_motors = 0;
 
     this->running = false;
+    this->starving = false;
     this->current_block = nullptr;
 
+    // the DWT cycle counter times the step ticker interrupt
+    CoreDebug->DEMCR |= CoreDebug_DEMCR_TRCENA_Msk;
+    DWT->CYCCNT = 0;
+    DWT->CTRL |= DWT_CTRL_CYCCNTENA_Msk;
+
     #ifdef STEPTICKER_DEBUG_PIN
     // setup debug pin if defined
     stepticker_debug_pin.output();
@@ -78,7 +86,9 @@ void StepTicker::start()
 void StepTicker::set_frequency( float frequency )
 {
     this->frequency = frequency;
+    this->max_starved_ticks = frequency; // one second
     this->period = floorf((SystemCoreClock / 4.0F) / frequency); // SystemCoreClock/4 = Timer increments in a second
+    this->timer_loops = 1;
     LPC_TIM0->MR0 = this->period;
     LPC_TIM0->TCR = 3;  // Reset
     LPC_TIM0->TCR = 1;  // start
@@ -89,10 +99,36 @@ void StepTicker::set_unstep_time( float microseconds )
 {
     uint32_t delay = floorf((SystemCoreClock / 4.0F) * (microseconds / 1000000.0F)); // SystemCoreClock/4 = Timer increments in a second
     LPC_TIM1->MR0 = delay;
+    this->unstep_delay = delay;
 
     // TODO check that the unstep time is less than the step period, if not slow down step ticker
 }
 
+// Above threshold steps/sec a block is run with the timer slowed down by loops and each interrupt doing loops ticks,
+// this allows a higher base frequency without the cost of an interrupt every tick, at the cost of steps being
+// grouped together within an interrupt. A motor that steps again within one interrupt busy waits for its pulse to end
+// and for a pulse width low after it, so step loops are only used if those two take at most half a tick, which leaves
+// the interrupt time for the ticks themselves. Must be called after set_frequency and set_unstep_time, returns the
+// loops that will be used
+uint8_t StepTicker::set_step_loops( uint8_t loops, float threshold )
+{
+    if(loops < 1 || 4 * this->unstep_delay > this->period) loops = 1;
+    this->max_step_loops = loops;
+    this->step_loops_threshold = threshold;
+    return loops;
+}
+
+void StepTicker::reset_stats()
+{
+    __disable_irq();
+    starvations= 0;
+    starved_ticks= 0;
+    isr_count= 0;
+    isr_total_cycles= 0;
+    isr_max_cycles= 0;
+    __enable_irq();
+}
+
 // Reset step pins on any motor that was stepped
 void StepTicker::unstep_tick()
 {
@@ -132,6 +168,71 @@ void StepTicker::handle_finish (void)
 
 // step clock
 void StepTicker::step_tick (void)
+{
+    uint32_t start_cycles= DWT->CYCCNT;
+
+    // the timer was set up for this many ticks per interrupt when the current block started
+    uint8_t loops= timer_loops;
+    earlier_pulses.reset();
+    for (uint8_t i = 0; i < loops; i++) {
+        if(i > 0 && unstep != earlier_pulses) {
+            // pulses were started in the tick before, they are left on unless a motor steps again in this interrupt
+            earlier_pulses= unstep;
+            pulse_start= LPC_TIM0->TC;
+        }
+        tick();
+    }
+
+    // We may have set a pin on in this tick, now we reset the timer to set it off
+    // Note there could be a race here if we run another tick before the unsteps have happened,
+    // right now it takes about 3-4us but if the unstep were near 10uS or greater it would be an issue
+    // also it takes at least 2us to get here so even when set to 1us pulse width it will still be about 3us
+    if( unstep.any()) {
+        LPC_TIM1->TCR = 3;
+        LPC_TIM1->TCR = 1;
+    }
+
+    // switch the timer to the number of ticks per interrupt the block that is now running needs
+    uint8_t block_loops= (running && current_block != nullptr) ? current_block->step_loops : 1;
+    if(block_loops != timer_loops) {
+        timer_loops= block_loops;
+        LPC_TIM0->MR0 = this->period * block_loops;
+        // if the count is already past the new match value the timer would have to wrap all the way round
+        if(LPC_TIM0->TC >= LPC_TIM0->MR0) LPC_TIM0->TC = LPC_TIM0->MR0 - 1;
+    }
+
+    uint32_t cycles= DWT->CYCCNT - start_cycles;
+    isr_total_cycles += cycles;
+    if(cycles > isr_max_cycles) isr_max_cycles= cycles;
+    ++isr_count;
+}
+
+// busy wait until a step pulse width has passed since the count was start, TC goes back to 0 after it reaches MR0,
+// and can only do that once within an interrupt
+void StepTicker::wait_pulse(uint32_t start)
+{
+    uint32_t wrap= LPC_TIM0->MR0 + 1;
+    uint32_t tc;
+    do {
+        tc= LPC_TIM0->TC;
+    } while((tc >= start ? tc - start : tc + wrap - start) < unstep_delay);
+}
+
+// a motor is about to step again in a step loops interrupt, the pulses of the earlier ticks have been on since at
+// least pulse_start so they are ended after a pulse width from that, and then held low for a pulse width
+void StepTicker::end_earlier_pulses()
+{
+    wait_pulse(pulse_start);
+    for (uint8_t m = 0; m < num_motors; m++) {
+        if(earlier_pulses[m]) this->motor[m]->unstep();
+    }
+    unstep &= ~earlier_pulses;
+    earlier_pulses.reset();
+    wait_pulse(LPC_TIM0->TC);
+}
+
+// one tick of the step clock
+void StepTicker::tick()
 {
     //SET_STEPTICKER_DEBUG_PIN(running ? 1 : 0);
 
@@ -139,9 +240,18 @@ void StepTicker::step_tick (void)
     if(!running){
         // check if anything new available
         if(THECONVEYOR->get_next_block(&current_block)) { // returns false if no new block is available
+            if(starving) {
+                // the job carried on after the queue ran dry, so the motors were stopped waiting for the planner
+                if(idle_ticks < max_starved_ticks) {
+                    ++starvations;
+                    starved_ticks += idle_ticks;
+                }
+                starving= false;
+            }
             running= start_next_block(); // returns true if there is at least one motor with steps to issue
             if(!running) return;
         }else{
+            if(starving && idle_ticks < max_starved_ticks) ++idle_ticks;
             return;
         }
     }
@@ -154,26 +264,35 @@ void StepTicker::step_tick (void)
     }
 
     bool still_moving= false;
-    // foreach motor, if it is active see if time to issue a step to that motor
-    for (uint8_t m = 0; m < num_motors; m++) {
-        if(current_block->tick_info[m].steps_to_move == 0) continue; // not active
-
-        current_block->tick_info[m].steps_per_tick += current_block->tick_info[m].acceleration_change;
-
-        if(current_tick == current_block->tick_info[m].next_accel_event) {
-            if(current_tick == current_block->accelerate_until) { // We are done accelerating, deceleration becomes 0 : plateau
-                current_block->tick_info[m].acceleration_change = 0;
-                if(current_block->decelerate_after < current_block->total_move_ticks) {
-                    current_block->tick_info[m].next_accel_event = current_block->decelerate_after;
-                    if(current_tick != current_block->decelerate_after) { // We are plateauing
-                        // steps/sec / tick frequency to get steps per tick
-                        current_block->tick_info[m].steps_per_tick = current_block->tick_info[m].plateau_rate;
+    // foreach motor that still has steps to issue in this block, see if time to issue a step to that motor
+    for (uint8_t i = 0; i < current_block->n_active_motors; ) {
+        uint8_t m= current_block->active_motors[i];
+        if(current_block->s_curve) {
+            // S-curve, the phases were precomputed in Block::prepare() so the jerk only changes a few times per block
+            if(current_tick == current_block->tick_info[m].next_accel_event) {
+                current_block->jerk_phase(m, current_tick);
+            }
+            current_block->jerk_info[m].acceleration += current_block->jerk_info[m].jerk;
+            current_block->tick_info[m].steps_per_tick += (int32_t)(current_block->jerk_info[m].acceleration >> 32); // 2.62 to 2.30
+
+        } else {
+            current_block->tick_info[m].steps_per_tick += current_block->tick_info[m].acceleration_change;
+
+            if(current_tick == current_block->tick_info[m].next_accel_event) {
+                if(current_tick == current_block->accelerate_until) { // We are done accelerating, deceleration becomes 0 : plateau
+                    current_block->tick_info[m].acceleration_change = 0;
+                    if(current_block->decelerate_after < current_block->total_move_ticks) {
+                        current_block->tick_info[m].next_accel_event = current_block->decelerate_after;
+                        if(current_tick != current_block->decelerate_after) { // We are plateauing
+                            // steps/sec / tick frequency to get steps per tick
+                            current_block->tick_info[m].steps_per_tick = current_block->tick_info[m].plateau_rate;
+                        }
                     }
                 }
-            }
 
-            if(current_tick == current_block->decelerate_after) { // We start decelerating
-                current_block->tick_info[m].acceleration_change = current_block->tick_info[m].deceleration_change;
+                if(current_tick == current_block->decelerate_after) { // We start decelerating
+                    current_block->tick_info[m].acceleration_change = current_block->tick_info[m].deceleration_change;
+                }
             }
         }
 
@@ -189,35 +308,29 @@ void StepTicker::step_tick (void)
             current_block->tick_info[m].counter -= STEPTICKER_FPSCALE; // -= 1.0F;
             ++current_block->tick_info[m].step_count;
 
-            // step the motor
+            // step the motor, its pulse from an earlier tick of this interrupt has to be ended first
+            if(earlier_pulses[m]) end_earlier_pulses();
             bool ismoving= motor[m]->step(); // returns false if the moving flag was set to false externally (probes, endstops etc)
             // we stepped so schedule an unstep
             unstep.set(m);
 
             if(!ismoving || current_block->tick_info[m].step_count == current_block->tick_info[m].steps_to_move) {
-                // done
+                // done, take it off the active list, the last one takes its place
                 current_block->tick_info[m].steps_to_move = 0;
                 motor[m]->stop_moving(); // let motor know it is no longer moving
+                current_block->active_motors[i]= current_block->active_motors[--current_block->n_active_motors];
+                continue;
             }
         }
 
         // see if any motors are still moving after this tick
         if(motor[m]->is_moving()) still_moving= true;
+        i++;
     }
 
     // do this after so we start at tick 0
     current_tick++; // count number of ticks
 
-    // We may have set a pin on in this tick, now we reset the timer to set it off
-    // Note there could be a race here if we run another tick before the unsteps have happened,
-    // right now it takes about 3-4us but if the unstep were near 10uS or greater it would be an issue
-    // also it takes at least 2us to get here so even when set to 1us pulse width it will still be about 3us
-    if( unstep.any()) {
-        LPC_TIM1->TCR = 3;
-        LPC_TIM1->TCR = 1;
-    }
-
-
     // see if any motors are still moving
     if(!still_moving) {
         //SET_STEPTICKER_DEBUG_PIN(0);
@@ -235,6 +348,8 @@ void StepTicker::step_tick (void)
         }else{
             current_block= nullptr;
             running= false;
+            starving= true;
+            idle_ticks= 0;
         }
 
         // all moves finished
@@ -251,8 +366,8 @@ bool StepTicker::start_next_block()
 
     bool ok= false;
     // need to prepare each active motor
-    for (uint8_t m = 0; m < num_motors; m++) {
-        if(current_block->tick_info[m].steps_to_move == 0) continue;
+    for (uint8_t i = 0; i < current_block->n_active_motors; i++) {
+        uint8_t m= current_block->active_motors[i];
 
         ok= true; // mark at least one motor is moving
         // set direction bit here
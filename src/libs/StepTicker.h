@@ -26,12 +26,19 @@ class Block;
 #define STEPTICKER_TOFP(x) ((int32_t)roundf((float)(x)*STEPTICKER_FPSCALE))
 #define STEPTICKER_FROMFP(x) ((float)(x)/STEPTICKER_FPSCALE)
 
+// handle 2.62 Fixed point, used for the S-curve acceleration and jerk, the top 32 bits are 2.30
+#define STEPTICKER_JERK_FPSCALE 4611686018427387904.0F // 2^62
+#define STEPTICKER_JERK_TOFP(x) ((int64_t)((float)(x)*STEPTICKER_JERK_FPSCALE))
+
 class StepTicker{
     public:
         StepTicker();
         ~StepTicker();
         void set_frequency( float frequency );
         void set_unstep_time( float microseconds );
+        uint8_t set_step_loops( uint8_t loops, float threshold );
+        // number of ticks each interrupt does for a block with the given primary axis step rate
+        uint8_t get_step_loops( float rate ) const { return rate > step_loops_threshold ? max_step_loops : 1; }
         int register_motor(StepperMotor* motor);
         float get_frequency() const { return frequency; }
         void unstep_tick();
@@ -41,6 +48,16 @@ class StepTicker{
         void handle_finish (void);
         void start();
 
+        // instrumentation read by the stats command, kept by the interrupt
+        uint64_t get_isr_count() const { return isr_count; }
+        uint32_t get_isr_max_cycles() const { return isr_max_cycles; }
+        float get_isr_avg_cycles() const { return isr_count > 0 ? (float)isr_total_cycles / isr_count : 0.0F; }
+        uint32_t get_starvations() const { return starvations; }
+        float get_starved_seconds() const { return starved_ticks / frequency; }
+        void reset_stats();
+        // the queue was emptied on purpose (M400, G4, homing...), running out of blocks before the next one is not starvation
+        void clear_starving() { starving= false; }
+
         // whatever setup the block should register this to know when it is done
         std::function<void()> finished_fnc{nullptr};
 
@@ -50,17 +67,37 @@ class StepTicker{
         static StepTicker *instance;
 
         bool start_next_block();
+        void tick();
+        void wait_pulse(uint32_t start);
+        void end_earlier_pulses();
 
         float frequency;
         uint32_t period;
+        uint32_t unstep_delay;          // step pulse width in timer counts
+        float step_loops_threshold;     // step rate above which step loops are used
+        uint8_t max_step_loops;         // ticks per interrupt above the threshold
+        uint8_t timer_loops;            // ticks per interrupt the timer is currently set up for
         std::array<StepperMotor*, k_max_actuators> motor;
         std::bitset<k_max_actuators> unstep;
+        std::bitset<k_max_actuators> earlier_pulses;    // pulses started in the earlier ticks of this interrupt
+        uint32_t pulse_start;           // TC when the last of those had been started
 
         Block *current_block;
         uint32_t current_tick{0};
 
+        // running out of blocks and getting a new one within this many ticks is counted as starvation,
+        // a longer gap is taken to be the end of one job and the start of another
+        uint32_t max_starved_ticks;
+        uint32_t idle_ticks{0};         // ticks since running out of blocks
+        uint32_t starvations{0};
+        uint64_t starved_ticks{0};
+        uint64_t isr_count{0};
+        uint64_t isr_total_cycles{0};
+        uint32_t isr_max_cycles{0};
+
         struct {
             volatile bool running:1;
+            volatile bool starving:1;   // ran out of blocks after finishing one
             uint8_t num_motors:4;
         };
 };
@@ -17,6 +17,7 @@
 // They are usually associated with a command source, but can also be a NullStreamOutput if we just want to ignore whatever is sent
 
 class NullStreamOutput;
+struct TxStats;
 
 class StreamOutput {
     public:
@@ -27,7 +28,20 @@ class StreamOutput {
         virtual int _putc(int c) { return 1; }
         virtual int _getc(void) { return 0; }
         virtual int puts(const char* str) = 0;
+        // queues str without waiting for room, none of it is sent if it does not all fit, returns false if it was dropped
+        virtual bool puts_nowait(const char* str) { puts(str); return true; }
+        // for a line sent again and again like the status report, if it finds no room it waits in place of the one
+        // before it, so only the latest is sent
+        virtual void puts_latest(const char* str) { puts(str); }
+        // what has been sent and dropped, nullptr if the stream does not count it
+        virtual TxStats *get_tx_stats() { return nullptr; }
         virtual bool ready() { return true; };
+        // switches the input of the stream to the binary format of BinaryGcode.h until its end record,
+        // returns false if the stream cannot do that, or has the window on
+        virtual bool start_binary() { return false; }
+        // switches the replies to the lines received to the windowed acknowledgements of AckWindow.h, or back to an
+        // ok for each line, returns false if the stream cannot do that
+        virtual bool start_window(bool on) { return false; }
 
         static NullStreamOutput NullStream;
 };
@@ -16,6 +16,8 @@ using namespace std;
 
 #include "libs/StreamOutput.h"
 
+// Broadcasts to every stream. Nothing waits for a slow or stuck port here: each stream queues the whole line if
+// it has room for it and otherwise drops it, and counts what it dropped.
 class StreamOutputPool : public StreamOutput {
 
 public:
@@ -24,14 +26,30 @@ public:
 
     int puts(const char* s)
     {
-        int r = 0;
         for(set<StreamOutput*>::iterator i = this->streams.begin(); i != this->streams.end(); i++)
         {
-            int k = (*i)->puts(s);
-            if (k > r)
-                r = k;
+            (*i)->puts_nowait(s);
         }
-        return r;
+        return strlen(s);
+    }
+
+    bool puts_nowait(const char* s)
+    {
+        puts(s);
+        return true;
+    }
+
+    void puts_latest(const char* s)
+    {
+        for(set<StreamOutput*>::iterator i = this->streams.begin(); i != this->streams.end(); i++)
+        {
+            (*i)->puts_latest(s);
+        }
+    }
+
+    const set<StreamOutput*>& get_streams() const
+    {
+        return this->streams;
     }
 
     void append_stream(StreamOutput* stream)
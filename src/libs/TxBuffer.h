@@ -0,0 +1,147 @@
+/*
+      This file is part of Smoothie (http://smoothieware.org/). The motion control part is heavily based on Grbl (https://github.com/simen/grbl).
+      Smoothie is free software: you can redistribute it and/or modify it under the terms of the GNU General Public License as published by the Free Software Foundation, either version 3 of the License, or (at your option) any later version.
+      Smoothie is distributed in the hope that it will be useful, but WITHOUT ANY WARRANTY; without even the implied warranty of MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the GNU General Public License for more details.
+      You should have received a copy of the GNU General Public License along with Smoothie. If not, see <http://www.gnu.org/licenses/>.
+*/
+
+#ifndef TXBUFFER_H
+#define TXBUFFER_H
+
+#include <stdint.h>
+#include <string.h>
+#include <string>
+
+// what a stream has done with the output it was given
+struct TxStats {
+    uint32_t bytes;         // queued to be sent
+    uint32_t dropped;       // lines not sent at all because there was no room for them
+    uint32_t replaced;      // status lines that were still waiting for room when a newer one replaced them
+};
+
+// Transmit buffer of an output stream.
+// A single producer (the main loop) puts whole lines in, and a single consumer (the transmit interrupt) takes bytes
+// out as the hardware can send them, so writing never waits for the port unless the buffer is full.
+// Neither side disables interrupts: the producer only writes head, the consumer only writes tail.
+// A line put with put_latest() that finds no room waits beside the buffer, and a newer one replaces it, so a
+// status report asked for many times while the port is slow is only sent once, and is the latest one.
+// length must be a power of 2.
+template<int length> class TxBuffer {
+    public:
+        TxBuffer() { head= tail= 0; reset_stats(); }
+
+        // producer side
+
+        int free() const { return length - 1 - available(); }
+        bool is_empty() const { return head == tail; }
+
+        // queues as much of the n bytes as fits, returns how many that was
+        size_t write(const char *s, size_t n)
+        {
+            if(n > (size_t)free()) n= free();
+            uint16_t h= head;
+            size_t first= (h + n > length) ? length - h : n;
+            memcpy(&buffer[h], s, first);
+            memcpy(buffer, s + first, n - first);
+            barrier(); // the consumer must not see the bytes before they are there
+            head= (h + n) & (length - 1);
+            stats.bytes += n;
+            return n;
+        }
+
+        // queues all of the n bytes, or counts the line as dropped and queues none of it if they do not fit
+        bool put(const char *s, size_t n)
+        {
+            if(n > (size_t)free()) {
+                stats.dropped++;
+                return false;
+            }
+            write(s, n);
+            return true;
+        }
+
+        // queues the line, or keeps it until put_waiting() finds room for it, in place of any kept before
+        void put_latest(const char *s, size_t n)
+        {
+            if(!latest.empty()) {
+                latest.clear();
+                stats.replaced++;
+            }
+            if(n > length - 1) {
+                stats.dropped++;
+            } else if(n > (size_t)free()) {
+                latest.assign(s, n);
+            } else {
+                write(s, n);
+            }
+        }
+
+        // queues the line put_latest() kept, once there is room for it, returns true if none is left waiting
+        bool put_waiting()
+        {
+            if(latest.empty()) return true;
+            if(latest.size() > (size_t)free()) return false;
+            write(latest.data(), latest.size());
+            latest.clear();
+            return true;
+        }
+
+        TxStats& get_stats() { return stats; }
+        void reset_stats() { stats.bytes= stats.dropped= stats.replaced= 0; }
+
+        // consumer side
+
+        int available() const { return (head - tail) & (length - 1); }
+
+        bool get(char& c)
+        {
+            if(head == tail) return false;
+            c= buffer[tail];
+            barrier(); // the byte must be read before the producer can see the space is free
+            tail= (tail + 1) & (length - 1);
+            return true;
+        }
+
+        // takes up to n bytes out in one go, returns how many
+        size_t get(char *buf, size_t n)
+        {
+            uint16_t t= tail;
+            size_t a= (head - t) & (length - 1);
+            if(n > a) n= a;
+            size_t first= (t + n > length) ? length - t : n;
+            memcpy(buf, &buffer[t], first);
+            memcpy(buf + first, buffer, n - first);
+            barrier();
+            tail= (t + n) & (length - 1);
+            return n;
+        }
+
+        // the bytes from tail that are in one piece, to be sent from where they are and then let go with skip()
+        const char *span(size_t& n) const
+        {
+            uint16_t t= tail, h= head;
+            n= (h >= t) ? h - t : length - t;
+            return &buffer[t];
+        }
+
+        void skip(size_t n)
+        {
+            barrier();
+            tail= (tail + n) & (length - 1);
+        }
+
+        // forgets everything not yet sent, the consumer must not be running
+        void flush() { tail= head; latest.clear(); }
+
+    private:
+        // stops the compiler moving buffer accesses past the index updates, a single core needs nothing more
+        static void barrier() { __asm__ volatile("" ::: "memory"); }
+
+        char buffer[length];
+        volatile uint16_t head;     // written by the producer
+        volatile uint16_t tail;     // written by the consumer
+        std::string latest;         // producer only
+        TxStats stats;              // producer only
+};
+
+#endif
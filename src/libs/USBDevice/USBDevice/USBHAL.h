@@ -61,6 +61,9 @@ public:
 
     uint16_t lastFrame(void);
 
+    // how many packets can be written to an IN endpoint, or read from an OUT one, without waiting
+    uint8_t endpointCanTransfer(uint8_t bEP) { return can_transfer[EP2IDX(bEP)]; }
+
     bool endpointSetInterrupt(uint8_t bEP, bool enabled);
     bool endpointGetInterrupt(uint8_t bEP);
     void endpointTriggerInterrupt(uint8_t bEP);
@@ -64,10 +64,11 @@
  * just always use the Standard Capacity cards with a block size of 512 bytes.
  * This is set with CMD16.
  *
- * You can read and write single blocks (CMD17, CMD25) or multiple blocks
- * (CMD18, CMD25). For simplicity, I'll just use single block accesses. When
- * the card gets a read command, it responds with a response token, and then
- * a data token or an error.
+ * You can read and write single blocks (CMD17, CMD24) or multiple blocks
+ * (CMD18, CMD25). Single blocks are used when FatFs asks for one sector, runs
+ * of sectors use the multiple block commands so the card only has to find the
+ * data once. When the card gets a read command, it responds with a response
+ * token, and then a data token or an error.
  *
  * SPI Command Format
  * ------------------
@@ -115,10 +116,25 @@
  * +------+---------+---------+- -  - -+---------+-----------+----------+
  * | 0xFE | data[0] | data[1] |        | data[n] | crc[15:8] | crc[7:0] |
  * +------+---------+---------+- -  - -+---------+-----------+----------+
+ *
+ * Multiple Block Read and Write
+ * -----------------------------
+ *
+ * After CMD18 the card sends one data block after another, each with its own
+ * 0xFE token, until CMD12 stops it. After CMD25 each block is sent with a 0xFC
+ * token and acknowledged like a single block, a 0xFD token ends the write.
+ * ACMD23 before CMD25 tells the card how many blocks to pre-erase.
+ *
+ * The 512 bytes of a block are moved by the GPDMA, one channel feeding the
+ * SSP transmit FIFO and one emptying the receive FIFO, so the bytes go out
+ * back to back rather than one SPI::write() at a time.
  */
 
 #include <stdio.h>
 #include <stdlib.h>
+#include <string.h>
+#include <stdint.h>
+#include <algorithm>
 
 #include "SDCard.h"
 
@@ -126,12 +142,26 @@ static const uint8_t OXFF = 0xFF;
 
 #define SD_COMMAND_TIMEOUT 5000
 
+// the SD spec allows 25MHz in SPI mode, override with -DSDCARD_MAX_FREQUENCY for boards that cannot take it
+#ifndef SDCARD_MAX_FREQUENCY
+#define SDCARD_MAX_FREQUENCY 25000000
+#endif
+
+// GPDMA channels used for block transfers, the lower numbered channel has priority so it takes the receive side
+#define SDCARD_DMA_RX_CHANNEL   6
+#define SDCARD_DMA_TX_CHANNEL   7
+#define SDCARD_DMA_RX           LPC_GPDMACH6
+#define SDCARD_DMA_TX           LPC_GPDMACH7
+
 SDCard::SDCard(PinName mosi, PinName miso, PinName sclk, PinName cs) :
   _spi(mosi, miso, sclk), _cs(cs) {
     _cs.output();
     _cs = 1;
     busyflag = false;
     _sectors = 0;
+    use_dma = true;
+    max_frequency = SDCARD_MAX_FREQUENCY;
+    frequency = 0;
 }
 
 #define R1_IDLE_STATE           (1 << 0)
@@ -268,7 +298,12 @@ int SDCard::disk_initialize()
         return 1;
     }
 
-    _sectors = _sd_sectors();
+    char csd[16];
+    if(_read_csd(csd) != 0) {
+        busyflag = false;
+        return 1;
+    }
+    _sectors = _sd_sectors(csd);
 
     // Set block length to 512 (CMD16)
     if(_cmd(SDCMD_SET_BLOCKLEN, 512) != 0) {
@@ -277,7 +312,15 @@ int SDCard::disk_initialize()
         return 1;
     }
 
-    _spi.frequency(2500000); // Set to 2.5MHz for data transfer
+    // go as fast as the card says it can, but if it cannot give the CSD back the same at that speed keep
+    // halving it, 2.5MHz is what was always used so it is the lowest we go
+    frequency = _spi_frequency(std::min(_sd_frequency(csd), max_frequency));
+    while(true) {
+        _spi.frequency(frequency);
+        char check[16];
+        if(frequency <= 2500000 || (_read_csd(check) == 0 && memcmp(csd, check, sizeof(check)) == 0)) break;
+        frequency = _spi_frequency(frequency / 2);
+    }
 
     busyflag = false;
 
@@ -291,19 +334,22 @@ int SDCard::disk_write(const char *buffer, uint32_t block_number)
 
     busyflag = true;
 
-    if (cardtype == SDCARD_FAIL)
+    if (cardtype == SDCARD_FAIL) {
+        busyflag = false;
         return -1;
+    }
     // set write address for single block (CMD24)
     if(_cmd(SDCMD_WRITE_BLOCK, BLOCK2ADDR(block_number)) != 0) {
+        busyflag = false;
         return 1;
     }
 
     // send the data block
-    _write(buffer, 512);
+    int r = _write(buffer, 512);
 
     busyflag = false;
 
-    return 0;
+    return r;
 }
 
 int SDCard::disk_read(char *buffer, uint32_t block_number)
@@ -313,19 +359,106 @@ int SDCard::disk_read(char *buffer, uint32_t block_number)
 
     busyflag = true;
 
-    if (cardtype == SDCARD_FAIL)
+    if (cardtype == SDCARD_FAIL) {
+        busyflag = false;
         return -1;
+    }
     // set read address for single block (CMD17)
     if(_cmd(SDCMD_READ_SINGLE_BLOCK, BLOCK2ADDR(block_number)) != 0) {
+        busyflag = false;
         return 1;
     }
 
     // receive the data
-    _read(buffer, 512);
+    int r = _read(buffer, 512);
 
     busyflag = false;
 
-    return 0;
+    return r;
+}
+
+int SDCard::disk_write_blocks(const char *buffer, uint32_t block_number, uint32_t count)
+{
+    if (count == 1)
+        return disk_write(buffer, block_number);
+
+    if (busyflag)
+        return 0;
+
+    busyflag = true;
+
+    if (cardtype == SDCARD_FAIL) {
+        busyflag = false;
+        return -1;
+    }
+
+    // let the card pre-erase the blocks (ACMD23), this is only a hint so the response does not matter
+    _cmd(SDCMD_APP_CMD, 0);
+    _cmd(SD_ACMD_SET_WR_BLK_ERASE_COUNT, count);
+
+    // set write address for multiple blocks (CMD25), this leaves cs low
+    if(_cmdx(SDCMD_WRITE_MULTIPLE_BLOCK, BLOCK2ADDR(block_number)) != 0) {
+        _cs = 1;
+        _spi.write(0xFF);
+        busyflag = false;
+        return 1;
+    }
+
+    int r = 0;
+    for(uint32_t i = 0; i < count && r == 0; i++) {
+        r = _write_data(buffer + i * 512, 512, 0xFC);
+    }
+
+    // stop tran token, then the card is busy until it has written the last block
+    _spi.write(0xFD);
+    _spi.write(0xFF);
+    while(_spi.write(0xFF) == 0);
+
+    _cs = 1;
+    _spi.write(0xFF);
+
+    busyflag = false;
+
+    return r;
+}
+
+int SDCard::disk_read_blocks(char *buffer, uint32_t block_number, uint32_t count)
+{
+    if (count == 1)
+        return disk_read(buffer, block_number);
+
+    if (busyflag)
+        return 0;
+
+    busyflag = true;
+
+    if (cardtype == SDCARD_FAIL) {
+        busyflag = false;
+        return -1;
+    }
+
+    // set read address for multiple blocks (CMD18), this leaves cs low
+    if(_cmdx(SDCMD_READ_MULTIPLE_BLOCK, BLOCK2ADDR(block_number)) != 0) {
+        _cs = 1;
+        _spi.write(0xFF);
+        busyflag = false;
+        return 1;
+    }
+
+    int r = 0;
+    for(uint32_t i = 0; i < count && r == 0; i++) {
+        r = _read_data(buffer + i * 512, 512);
+    }
+
+    if(_stop_transmission() != 0)
+        r = 1;
+
+    _cs = 1;
+    _spi.write(0xFF);
+
+    busyflag = false;
+
+    return r;
 }
 
 int SDCard::disk_status() { return (_sectors > 0)?0:1; }
@@ -336,7 +469,7 @@ int SDCard::disk_sync() {
 uint32_t SDCard::disk_sectors() { return _sectors; }
 uint64_t SDCard::disk_size() { return ((uint64_t) _sectors) << 9; }
 uint32_t SDCard::disk_blocksize() { return (1<<9); }
-bool SDCard::disk_canDMA() { return false; }
+bool SDCard::disk_canDMA() { return use_dma; }
 
 SDCard::CARD_TYPE SDCard::card_type()
 {
@@ -441,7 +574,7 @@ int SDCard::_cmd8() {
         response[0] = _spi.write(0xFF);
         if(!(response[0] & 0x80)) {
                 for(int j=1; j<5; j++) {
-                    response[i] = _spi.write(0xFF);
+                    response[j] = _spi.write(0xFF);
                 }
                 _cs = 1;
                 _spi.write(0xFF);
@@ -456,57 +589,137 @@ int SDCard::_cmd8() {
 int SDCard::_read(char *buffer, int length) {
     _cs = 0;
 
-    // read until start byte (0xFF)
-    while(_spi.write(0xFF) != 0xFE);
-//     uint8_t r;
-//     while((r = _spi.write(0xFF)) != 0xFE)
-//     {
-//         iprintf("0x%02X ", r);
-//         for (volatile uint32_t j = 262144; j; j--);
-//     }
-//
-//     iprintf("Got start byte, reading data\n");
-
-    // read data
-    for(int i=0; i<length; i++) {
-        buffer[i] = _spi.write(0xFF);
-    }
-    _spi.write(0xFF); // checksum
-    _spi.write(0xFF);
+    int r = _read_data(buffer, length);
 
     _cs = 1;
     _spi.write(0xFF);
-    return 0;
+    return r;
 }
 
 int SDCard::_write(const char *buffer, int length) {
     _cs = 0;
 
+    int r = _write_data(buffer, length, 0xFE);
+
+    _cs = 1;
+    _spi.write(0xFF);
+    return r;
+}
+
+// receive one data block, cs must already be low
+int SDCard::_read_data(char *buffer, int length) {
+    // read until start byte (0xFE), an error token (000xxxxx) means the read failed
+    int token;
+    while((token = _spi.write(0xFF)) == 0xFF);
+    if(token != 0xFE)
+        return 1;
+
+    // read data
+    if(length == 512) {
+        _transfer(NULL, buffer, length);
+    } else {
+        for(int i=0; i<length; i++) {
+            buffer[i] = _spi.write(0xFF);
+        }
+    }
+    _spi.write(0xFF); // checksum
+    _spi.write(0xFF);
+    return 0;
+}
+
+// send one data block with the given start token, and wait for the card to write it, cs must already be low
+int SDCard::_write_data(const char *buffer, int length, uint8_t token) {
     // indicate start of block
-    _spi.write(0xFE);
+    _spi.write(token);
 
     // write the data
-    for(int i=0; i<length; i++) {
-        _spi.write(buffer[i]);
-    }
+    _transfer(buffer, NULL, length);
 
     // write the checksum
     _spi.write(0xFF);
     _spi.write(0xFF);
 
     // check the repsonse token
-    if((_spi.write(0xFF) & 0x1F) != 0x05) {
-        _cs = 1;
-        _spi.write(0xFF);
+    if((_spi.write(0xFF) & 0x1F) != 0x05)
         return 1;
-    }
 
     // wait for write to finish
     while(_spi.write(0xFF) == 0);
+    return 0;
+}
 
-    _cs = 1;
+// CMD12 while a multiple block read is running, the card keeps sending data while the command goes out
+int SDCard::_stop_transmission() {
+    _spi.write(0x40 | SDCMD_STOP_TRANSMISSION);
+    _spi.write(0x00);
+    _spi.write(0x00);
+    _spi.write(0x00);
+    _spi.write(0x00);
+    _spi.write(0x95);
+
+    // the byte after the command is a stuff byte, then the R1 response
     _spi.write(0xFF);
-    return 0;
+    int response = -1;
+    for(int i=0; i<SD_COMMAND_TIMEOUT; i++) {
+        response = _spi.write(0xFF);
+        if(!(response & 0x80))
+            break;
+    }
+
+    // R1b, wait while the card is busy
+    while(_spi.write(0xFF) == 0);
+    return response;
+}
+
+// clock length bytes through the SSP, sending out (0xFF if NULL) and keeping what comes back in in (unless NULL)
+void SDCard::_transfer(const char *out, char *in, int length) {
+    if(!use_dma) {
+        for(int i=0; i<length; i++) {
+            int r = _spi.write(out ? out[i] : 0xFF);
+            if(in) in[i] = r;
+        }
+        return;
+    }
+
+    static const uint8_t ff = 0xFF;
+    static uint8_t sink;
+
+    LPC_SSP_TypeDef *ssp = _spi.ssp();
+    // GPDMA peripheral numbers, SSP0 Tx is 0 and Rx 1, SSP1 Tx is 2 and Rx 3
+    uint32_t tx_peripheral = (ssp == LPC_SSP0) ? 0 : 2;
+    uint32_t rx_peripheral = tx_peripheral + 1;
+
+    LPC_SC->PCONP |= 1 << 29;   // power up the GPDMA
+    LPC_GPDMA->DMACConfig = 1;  // enable, little endian
+
+    // anything left in the receive FIFO would end up at the start of the block
+    while(ssp->SR & (1 << 2)) {
+        uint32_t b = ssp->DR;
+        (void)b;
+    }
+
+    LPC_GPDMA->DMACIntTCClear = (1 << SDCARD_DMA_RX_CHANNEL) | (1 << SDCARD_DMA_TX_CHANNEL);
+    LPC_GPDMA->DMACIntErrClr = (1 << SDCARD_DMA_RX_CHANNEL) | (1 << SDCARD_DMA_TX_CHANNEL);
+
+    // byte wide, bursts of 4 which is what the SSP asks for when its FIFO is half full
+    uint32_t control = (length & 0xFFF) | (1 << 12) | (1 << 15);
+
+    SDCARD_DMA_RX->DMACCSrcAddr = (uintptr_t)&ssp->DR;
+    SDCARD_DMA_RX->DMACCDestAddr = (uintptr_t)(in ? (uint8_t*)in : &sink);
+    SDCARD_DMA_RX->DMACCLLI = 0;
+    SDCARD_DMA_RX->DMACCControl = control | (in ? (1UL << 27) : 0);         // increment the destination
+    SDCARD_DMA_RX->DMACCConfig = 1 | (rx_peripheral << 1) | (2 << 11);      // enable, peripheral to memory
+
+    SDCARD_DMA_TX->DMACCSrcAddr = (uintptr_t)(out ? (const uint8_t*)out : &ff);
+    SDCARD_DMA_TX->DMACCDestAddr = (uintptr_t)&ssp->DR;
+    SDCARD_DMA_TX->DMACCLLI = 0;
+    SDCARD_DMA_TX->DMACCControl = control | (out ? (1UL << 26) : 0);        // increment the source
+    SDCARD_DMA_TX->DMACCConfig = 1 | (tx_peripheral << 6) | (1 << 11);      // enable, memory to peripheral
+
+    // start the SSP asking for data, the receive channel finishes last as it gets the last byte shifted in
+    ssp->DMACR = 3;
+    while(LPC_GPDMA->DMACEnbldChns & (1 << SDCARD_DMA_RX_CHANNEL));
+    ssp->DMACR = 0;
 }
 
 static int ext_bits(char *data, int msb, int lsb) {
@@ -522,19 +735,42 @@ static int ext_bits(char *data, int msb, int lsb) {
     return bits;
 }
 
-uint32_t SDCard::_sd_sectors() {
+int SDCard::_read_csd(char *csd) {
 
     // CMD9, Response R2 (R1 byte + 16-byte block read)
     if(_cmdx(SDCMD_SEND_CSD, 0) != 0) {
         fprintf(stderr, "Didn't get a response from the disk\n");
-        return 0;
+        return 1;
     }
 
-    char csd[16];
     if(_read(csd, 16) != 0) {
         fprintf(stderr, "Couldn't read csd response from disk\n");
-        return 0;
+        return 1;
     }
+    return 0;
+}
+
+// the fastest clock the card can take, from TRAN_SPEED in the CSD
+uint32_t SDCard::_sd_frequency(char *csd) {
+    // tran_speed : csd[103:96], bits 2:0 are the unit, 100kbit/s to 100Mbit/s, bits 6:3 the multiplier times 10
+    static const uint8_t multiplier[16] = {0, 10, 12, 13, 15, 20, 25, 30, 35, 40, 45, 50, 55, 60, 70, 80};
+    static const uint32_t unit[4] = {10000, 100000, 1000000, 10000000};
+    int tran_speed = ext_bits(csd, 103, 96);
+    if((tran_speed & 7) > 3)
+        return 25000000;
+    return multiplier[(tran_speed >> 3) & 15] * unit[tran_speed & 7];
+}
+
+// the SSP clock is SystemCoreClock / 2 / n, this is the fastest one that is not over hz
+uint32_t SDCard::_spi_frequency(uint32_t hz) {
+    uint32_t base = SystemCoreClock / 2;
+    if(hz == 0)
+        return base / 255;
+    uint32_t n = (base + hz - 1) / hz;
+    return base / (n < 255 ? n : 255);
+}
+
+uint32_t SDCard::_sd_sectors(char *csd) {
 
     // csd_structure : csd[127:126]
     // c_size        : csd[73:62]
@@ -26,7 +26,6 @@
 #ifndef SDCARD_H
 #define SDCARD_H
 
-#include "spi.h"
 #include "gpio.h"
 
 #include "disk.h"
@@ -72,6 +71,8 @@ public:
     virtual int disk_initialize();
     virtual int disk_write(const char *buffer, uint32_t block_number);
     virtual int disk_read(char *buffer, uint32_t block_number);
+    virtual int disk_write_blocks(const char *buffer, uint32_t block_number, uint32_t count);
+    virtual int disk_read_blocks(char *buffer, uint32_t block_number, uint32_t count);
     virtual int disk_status();
     virtual int disk_sync();
     virtual uint32_t disk_sectors();
@@ -83,7 +84,19 @@ public:
 
     bool busy();
 
+    // the SPI clock is the fastest the card says it can do up to this, applied by the next disk_initialize()
+    void set_max_frequency(uint32_t hz) { max_frequency = hz; }
+    uint32_t get_frequency() const { return frequency; }
+    // blocks are moved by the GPDMA unless this is turned off
+    void set_dma(bool on) { use_dma = on; }
+
 protected:
+    // mbed::SPI that lets us at the SSP it is using, to hand it to the GPDMA
+    class SSPSPI : public mbed::SPI {
+    public:
+        SSPSPI(PinName mosi, PinName miso, PinName sclk) : mbed::SPI(mosi, miso, sclk) {}
+        LPC_SSP_TypeDef *ssp() { aquire(); return _spi.spi; }
+    };
 
     int _cmd(int cmd, uint32_t arg);
     int _cmdx(int cmd, uint32_t arg);
@@ -95,14 +108,24 @@ protected:
 
     int _read(char *buffer, int length);
     int _write(const char *buffer, int length);
-
-    uint32_t _sd_sectors();
+    int _read_data(char *buffer, int length);
+    int _write_data(const char *buffer, int length, uint8_t token);
+    void _transfer(const char *out, char *in, int length);
+    int _stop_transmission();
+
+    int _read_csd(char *csd);
+    uint32_t _sd_sectors(char *csd);
+    uint32_t _sd_frequency(char *csd);
+    uint32_t _spi_frequency(uint32_t hz);
     uint32_t _sectors;
 
-    mbed::SPI _spi;
+    SSPSPI _spi;
     GPIO _cs;
 
     volatile bool busyflag;
+    bool use_dma;
+    uint32_t max_frequency;
+    uint32_t frequency;
 
     CARD_TYPE cardtype;
 };
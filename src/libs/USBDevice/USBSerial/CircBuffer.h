@@ -20,6 +20,7 @@
 #define CIRCBUFFER_H
 
 #include <stdlib.h>
+#include <string.h>
 #include "sLPC17xx.h"
 #include "platform_memory.h"
 
@@ -92,6 +93,67 @@ public:
         read = write;
     }
 
+    // The span and bulk operations below neither overwrite nor disable interrupts, so there must be one producer
+    // and one consumer, as with an endpoint interrupt and the main loop.
+
+    // the free space from write that is in one piece, n is how many, to be filled and then handed over with commit()
+    T *write_span(uint16_t *n) {
+        uint16_t r = read, w = write;
+        *n = (r > w) ? r - w - 1 : size - w - (r == 0 ? 1 : 0);
+        return &buf[w];
+    }
+
+    void commit(uint16_t n) {
+        __asm__ volatile("" ::: "memory"); // the data must be there before the consumer can see it
+        write = (write + n) % size;
+    }
+
+    // the data from read that is in one piece, n is how many, to be used and then let go with consume()
+    T *read_span(uint16_t *n) {
+        uint16_t r = read, w = write;
+        *n = (w >= r) ? w - r : size - r;
+        return &buf[r];
+    }
+
+    void consume(uint16_t n) {
+        __asm__ volatile("" ::: "memory"); // the data must be used before the producer can overwrite it
+        read = (read + n) % size;
+    }
+
+    // queues as many of the n as fit, returns how many that was
+    uint16_t queue(const T *p, uint16_t n) {
+        uint16_t done = 0;
+        while (done < n) {
+            uint16_t l;
+            T *w = write_span(&l);
+            if (l == 0)
+                break;
+            if (l > n - done)
+                l = n - done;
+            memcpy(w, p + done, l * sizeof(T));
+            commit(l);
+            done += l;
+        }
+        return done;
+    }
+
+    // takes up to n out, returns how many
+    uint16_t dequeue(T *p, uint16_t n) {
+        uint16_t done = 0;
+        while (done < n) {
+            uint16_t l;
+            T *r = read_span(&l);
+            if (l == 0)
+                break;
+            if (l > n - done)
+                l = n - done;
+            memcpy(p + done, r, l * sizeof(T));
+            consume(l);
+            done += l;
+        }
+        return done;
+    }
+
 private:
     volatile uint16_t write;
     volatile uint16_t read;
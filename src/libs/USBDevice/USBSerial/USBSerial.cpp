@@ -24,39 +24,62 @@
 #include "libs/Kernel.h"
 #include "libs/SerialMessage.h"
 #include "StreamOutputPool.h"
+#include "BinaryGcode.h"
+#include "Conveyor.h"
+
+#include "us_ticker_api.h"
 
 // extern void setled(int, bool);
 #define setled(a, b) do {} while (0)
 
 #define iprintf(...) do { } while (0)
 
-USBSerial::USBSerial(USB *u): USBCDC(u), rxbuf(256 + 8), txbuf(128 + 8)
+// a host that has taken nothing for this long is not reading, so what does not fit is dropped rather than
+// stopping the main loop until it does
+#define TX_STALL_US 100000
+
+USBSerial::USBSerial(USB *u): USBCDC(u)
 {
     usb = u;
-    nl_in_rx = 0;
     attach = attached = false;
-    flush_to_nl = false;
     halt_flag = false;
     query_flag = false;
     last_char_was_dollar = false;
+    binary = false;
+    binbuf = nullptr;
+    decoder = nullptr;
 }
 
-void USBSerial::ensure_tx_space(int space)
+// waits for the host to take enough to make the space, returns false if it is not taking anything
+bool USBSerial::ensure_tx_space(int space)
 {
+    int last = txbuf.free();
+    uint32_t since = us_ticker_read();
     while (txbuf.free() < space) {
+        if (!attach)
+            return false;
+        if (txbuf.free() != last) {
+            last = txbuf.free();
+            since = us_ticker_read();
+        } else if (us_ticker_read() - since > TX_STALL_US) {
+            return false;
+        }
         usb->endpointSetInterrupt(CDC_BulkIn.bEndpointAddress, true);
         usb->usbisr();
     }
+    return true;
 }
 
-int USBSerial::_putc(int c)
+void USBSerial::start_tx()
 {
-    if (!attached)
-        return 1;
-    ensure_tx_space(1);
-    txbuf.queue(c);
+    if (!txbuf.is_empty())
+        usb->endpointSetInterrupt(CDC_BulkIn.bEndpointAddress, true);
+}
 
-    usb->endpointSetInterrupt(CDC_BulkIn.bEndpointAddress, true);
+int USBSerial::_putc(int c)
+{
+    char s[2] = { (char)c, '\0' };
+    puts(s);
     return 1;
 }
 
@@ -64,57 +87,66 @@ int USBSerial::_getc()
 {
     if (!attached)
         return 0;
-    uint8_t c = 0;
-    setled(4, 1); while (rxbuf.isEmpty()); setled(4, 0);
-    rxbuf.dequeue(&c);
-    if (rxbuf.free() == MAX_PACKET_SIZE_EPBULK) {
-        usb->endpointSetInterrupt(CDC_BulkOut.bEndpointAddress, true);
-        iprintf("rxbuf has room for another packet, interrupt enabled\n");
-    } else if ((rxbuf.free() < MAX_PACKET_SIZE_EPBULK) && (nl_in_rx == 0)) {
-        // handle potential deadlock where a short line, and the beginning of a very long line are bundled in one usb packet
-        rxbuf.flush();
-        flush_to_nl = true;
+    // only characters from complete lines can be read, ^D and ^Z end a line for uploads
+    char c = 0;
+    setled(4, 1); while (!rxbuf.get(c)); setled(4, 0);
+    rx_consumed();
+    return c;
+}
 
+// called after taking data out of rxbuf or binbuf
+void USBSerial::rx_consumed()
+{
+    if ((binary ? binbuf->free() : rxbuf.free()) >= MAX_PACKET_SIZE_EPBULK) {
         usb->endpointSetInterrupt(CDC_BulkOut.bEndpointAddress, true);
         iprintf("rxbuf has room for another packet, interrupt enabled\n");
     }
-    if (nl_in_rx > 0)
-        if (c == '\n' || c == '\r')
-            nl_in_rx--;
-
-    return c;
 }
 
+// Replies to this stream wait for the host to take them, unless it has stopped reading
 int USBSerial::puts(const char *str)
 {
-    if (!attached)
-        return strlen(str);
-    int i = 0;
-    while (*str) {
-        ensure_tx_space(1);
-        txbuf.queue(*str);
-        if ((txbuf.available() % 64) == 0)
-            usb->endpointSetInterrupt(CDC_BulkIn.bEndpointAddress, true);
-        i++;
-        str++;
+    int n = strlen(str);
+    if (!attached || window.is_ok(str))
+        return n;
+    int sent = txbuf.write(str, n);
+    while (sent < n) {
+        // ask for room for a packet at a time, not for the rest of a long reply all at once
+        int want = n - sent < MAX_PACKET_SIZE_EPBULK ? n - sent : MAX_PACKET_SIZE_EPBULK;
+        start_tx();
+        if (!ensure_tx_space(want)) {
+            txbuf.get_stats().dropped++;
+            break;
+        }
+        sent += txbuf.write(str + sent, n - sent);
     }
-    usb->endpointSetInterrupt(CDC_BulkIn.bEndpointAddress, true);
-    return i;
+    start_tx();
+    return n;
+}
+
+bool USBSerial::puts_nowait(const char *str)
+{
+    if (!attached)
+        return true;
+    bool ok = txbuf.put(str, strlen(str));
+    start_tx();
+    return ok;
+}
+
+void USBSerial::puts_latest(const char *str)
+{
+    if (!attached)
+        return;
+    txbuf.put_latest(str, strlen(str));
+    start_tx();
 }
 
 uint16_t USBSerial::writeBlock(const uint8_t * buf, uint16_t size)
 {
     if (!attached)
         return size;
-    if (size > txbuf.free()) {
-        size = txbuf.free();
-    }
-    if (size > 0) {
-        for (uint8_t i = 0; i < size; i++) {
-            txbuf.queue(buf[i]);
-        }
-        usb->endpointSetInterrupt(CDC_BulkIn.bEndpointAddress, true);
-    }
+    size = txbuf.write((const char *)buf, size);
+    start_tx();
     return size;
 }
 
@@ -126,139 +158,194 @@ bool USBSerial::USBEvent_EPIn(uint8_t bEP, uint8_t bEPStatus)
 
 //     static bool needToSendNull = false;
 
-    bool r = true;
-
     if (bEP != CDC_BulkIn.bEndpointAddress)
         return false;
 
     iprintf("USBSerial:EpIn: 0x%02X\n", bEPStatus);
 
-    uint8_t b[MAX_PACKET_SIZE_EPBULK];
-
-    int l = txbuf.available();
-    if (l > 0) {
+    // the endpoint is double buffered, so fill both buffers while there is enough to send, and send straight
+    // from txbuf as the packet is copied into the endpoint before send() returns
+    while (usb->endpointCanTransfer(bEP) > 0) {
+        size_t l;
+        const char *p = txbuf.span(l);
+        if (l == 0)
+            break;
         // Use MAX_PACKET_SIZE_EPBULK-1 below instead of MAX_PACKET_SIZE_EPBULK
         // to work around a problem sending packets that are exactly MAX_PACKET_SIZE_EPBULK
         // bytes in length. The problem is that these packets don't flush properly.
         if (l > MAX_PACKET_SIZE_EPBULK-1)
             l = MAX_PACKET_SIZE_EPBULK-1;
-        int i;
-        for (i = 0; i < l; i++) {
-            txbuf.dequeue(&b[i]);
-        }
-        send(b, l);
-        if (txbuf.available() == 0)
-            r = false;
-    } else {
-        r = false;
+        send((uint8_t *)p, l);
+        txbuf.skip(l);
     }
     iprintf("USBSerial:EpIn Complete\n");
-    return r;
+    return !txbuf.is_empty();
 }
 
-bool USBSerial::USBEvent_EPOut(uint8_t bEP, uint8_t bEPStatus)
+// Bytes received that are acted on rather than just queued: control characters (^X, backspace and the ends of
+// line), DEL, ? and in grbl mode ! and ~. Anything else is plain and is queued a run at a time.
+static inline bool is_special(uint8_t c, bool grbl)
 {
-    /*
-     * Called in ISR context
-     */
+    return c < 0x20 || c == 0x7F || c == '?' || (grbl && (c == '!' || c == '~'));
+}
 
-    bool r = true;
+// The same test on four bytes at once, with the usual bit tricks to find a byte below n or equal to b in a word.
+// These can flag a plain byte next to a special one, never miss a special one.
+#define ONES  0x01010101U
+#define HIGHS 0x80808080U
+static inline uint32_t has_less(uint32_t v, uint8_t n) { return (v - ONES * n) & ~v & HIGHS; }
+static inline uint32_t has_byte(uint32_t v, uint8_t b) { uint32_t x = v ^ (ONES * b); return (x - ONES) & ~x & HIGHS; }
 
-    iprintf("USBSerial:EpOut\n");
-    if (bEP != CDC_BulkOut.bEndpointAddress)
-        return false;
+static inline bool has_special(uint32_t v, bool grbl)
+{
+    uint32_t r = has_less(v, 0x20) | has_byte(v, 0x7F) | has_byte(v, '?');
+    if (grbl)
+        r |= has_byte(v, '!') | has_byte(v, '~');
+    return r != 0;
+}
 
-    if (rxbuf.free() < MAX_PACKET_SIZE_EPBULK) {
-//         usb->endpointSetInterrupt(bEP, false);
-        return false;
+// how many plain bytes there are from p
+static uint32_t plain_run(const uint8_t *p, uint32_t n, bool grbl)
+{
+    uint32_t i = 0;
+    for (; i + 4 <= n; i += 4) {
+        uint32_t v;
+        memcpy(&v, p + i, 4);
+        if (has_special(v, grbl))
+            break;
     }
+    while (i < n && !is_special(p[i], grbl))
+        i++;
+    return i;
+}
 
-    uint8_t c[MAX_PACKET_SIZE_EPBULK];
-    uint32_t size = 64;
+void USBSerial::receive_text(const uint8_t *c, uint32_t size)
+{
+    bool grbl = THEKERNEL->is_grbl_mode();
+    uint32_t i = 0;
+    while (i < size) {
+        uint32_t n = plain_run(&c[i], size - i, grbl);
+        if (n > 0) {
+            // a line too long for the buffer is dropped up to the next newline
+            rxbuf.put((const char *)&c[i], n);
+            last_char_was_dollar = (c[i + n - 1] == '$');
+            i += n;
+            continue;
+        }
 
-    //we read the packet received and put it on the circular buffer
-    readEP(c, &size);
-    iprintf("Read %ld bytes:\n\t", size);
-    for (uint8_t i = 0; i < size; i++) {
+        uint8_t b = c[i++];
 
-        // handle backspace and delete by deleting the last character in the buffer if there is one
-        if(c[i] == 0x08 || c[i] == 0x7F) {
-            if(!rxbuf.isEmpty()) rxbuf.pop();
+        // handle backspace and delete by deleting the last character of the line if there is one
+        if(b == 0x08 || b == 0x7F) {
+            rxbuf.unput();
             continue;
         }
 
-        if(c[i] == 'X' - 'A' + 1) { // ^X
+        if(b == 'X' - 'A' + 1) { // ^X
             //THEKERNEL->set_feed_hold(false); // required to free stuff up
             halt_flag = true;
             continue;
         }
 
-        if(c[i] == '?') { // ?
+        if(b == '?') { // ?
             query_flag = true;
             continue;
         }
 
-        if(THEKERNEL->is_grbl_mode()) {
-            if(c[i] == '!') { // safe pause
+        if(grbl) {
+            if(b == '!') { // safe pause
                 //THEKERNEL->set_feed_hold(true);
                 continue;
             }
 
-            if(c[i] == '~') { // safe resume
+            if(b == '~') { // safe resume
                 //THEKERNEL->set_feed_hold(false);
                 continue;
             }
-            // if(last_char_was_dollar && (c[i] == 'X' || c[i] == 'H')) {
+            // if(last_char_was_dollar && (b == 'X' || b == 'H')) {
             //     // we need to do this otherwise $X/$H won't work if there was a feed hold like when stop is clicked in bCNC
             //     THEKERNEL->set_feed_hold(false);
             // }
         }
 
-        last_char_was_dollar = (c[i] == '$');
-
-        if (flush_to_nl == false)
-            rxbuf.queue(c[i]);
-
-        // if (c[i] >= 32 && c[i] < 128)
-        // {
-        //     iprintf("%c", c[i]);
-        // }
-        // else
-        // {
-        //     iprintf("\\x%02X", c[i]);
-        // }
-
-        if (c[i] == '\n' || c[i] == '\r') {
-            if (flush_to_nl)
-                flush_to_nl = false;
-            else
-                nl_in_rx++;
-        } else if (rxbuf.isFull() && (nl_in_rx == 0)) {
-            // to avoid a deadlock with very long lines, we must dump the buffer
-            // and continue flushing to the next newline
-            rxbuf.flush();
-            flush_to_nl = true;
+        last_char_was_dollar = false;
+
+        // the ends of line, and other control characters which are kept
+        rxbuf.put(b);
+    }
+}
+
+// takes ^X and ? out of a packet in binary mode, returns how many bytes are left
+uint32_t USBSerial::take_realtime(uint8_t *p, uint32_t size)
+{
+    uint32_t n = 0;
+    for (uint32_t i = 0; i < size; i++) {
+        if (p[i] == BinaryGcodeDecoder::HALT) {
+            halt_flag = true;
+        } else if (p[i] == BinaryGcodeDecoder::QUERY) {
+            query_flag = true;
+        } else {
+            p[n++] = p[i];
         }
     }
-    iprintf("\nQueued, %d empty\n", rxbuf.free());
+    return n;
+}
+
+bool USBSerial::USBEvent_EPOut(uint8_t bEP, uint8_t bEPStatus)
+{
+    /*
+     * Called in ISR context
+     */
 
-    if (rxbuf.free() < MAX_PACKET_SIZE_EPBULK) {
-        // if buffer is full, stall endpoint, do not accept more data
-        r = false;
+    iprintf("USBSerial:EpOut\n");
+    if (bEP != CDC_BulkOut.bEndpointAddress)
+        return false;
 
-        if (nl_in_rx == 0) {
-            // we have to check for long line deadlock here too
-            flush_to_nl = true;
-            rxbuf.flush();
+    // the endpoint is double buffered, so take both packets if both have come and there is room for them
+
+    if (binary) {
+        // the format never has ^X or ? in its records, so they are taken out here as they are from text
+        while (binbuf->free() >= MAX_PACKET_SIZE_EPBULK) {
+            uint8_t c[MAX_PACKET_SIZE_EPBULK];
+            uint16_t room;
+            uint8_t *w = binbuf->write_span(&room);
+            uint32_t size = MAX_PACKET_SIZE_EPBULK;
+            // straight into binbuf when the packet cannot wrap around its end
+            if (room >= MAX_PACKET_SIZE_EPBULK) {
+                if (!readEP_NB(w, &size))
+                    break;
+                binbuf->commit(take_realtime(w, size));
+            } else {
+                if (!readEP_NB(c, &size))
+                    break;
+                binbuf->queue(c, take_realtime(c, size));
+            }
+        }
+        return binbuf->free() >= MAX_PACKET_SIZE_EPBULK;
+    }
 
-            // and since our buffer is empty, we can accept more data
-            r = true;
+    while (rxbuf.free() >= MAX_PACKET_SIZE_EPBULK) {
+        // a word array so the packet can be scanned a word at a time
+        uint32_t w[MAX_PACKET_SIZE_EPBULK / 4];
+        uint32_t size = MAX_PACKET_SIZE_EPBULK;
+
+        //we read the packet received and put it on the circular buffer
+        if (!readEP_NB((uint8_t *)w, &size))
+            break;
+        iprintf("Read %ld bytes:\n\t", size);
+        receive_text((const uint8_t *)w, size);
+        iprintf("\nQueued, %d empty\n", rxbuf.free());
+
+        if (rxbuf.free() < MAX_PACKET_SIZE_EPBULK && !rxbuf.has_line()) {
+            // the line being received fills the buffer so it can never be completed, to avoid a deadlock
+            // drop it and everything up to the next newline
+            rxbuf.discard_line();
         }
     }
 
-    usb->readStart(CDC_BulkOut.bEndpointAddress, MAX_PACKET_SIZE_EPBULK);
     iprintf("USBSerial:EpOut Complete\n");
-    return r;
+    // if buffer is full, stall endpoint, do not accept more data
+    return rxbuf.free() >= MAX_PACKET_SIZE_EPBULK;
 }
 
 uint8_t USBSerial::available()
@@ -268,7 +355,95 @@ uint8_t USBSerial::available()
 
 bool USBSerial::ready()
 {
-    return rxbuf.available();
+    return rxbuf.has_line();
+}
+
+// The host sends the binary command, waits for its ok, then sends the header and the records, and waits for the
+// ok binary reply to the end record before sending text again, the text records get an ok each as lines do so a plain
+// ok does not mean the stream has ended. There is no ok for each motion record, USB holds the host off
+// when binbuf is full. ^X and ? work as they do with text, and ^X ends the stream, so a host that aborts it stops
+// sending the records and sends text again. It is refused while the window is on, which would swallow the ok of the
+// binary command and of the text records, the host sends window off first.
+bool USBSerial::start_binary()
+{
+    if (binary || window.is_active())
+        return false;
+    if (binbuf == nullptr) {
+        binbuf = new CircBuffer<uint8_t>(512);
+        decoder = new BinaryGcodeDecoder;
+    }
+    decoder->reset();
+    binbuf->flush();
+    binary = true;
+    return true;
+}
+
+// The host sends window, waits for the first report, then sends while it has sent fewer than done + window lines.
+// A halt or a detach ends it, as the lines flushed from rxbuf would never be done.
+bool USBSerial::start_window(bool on)
+{
+    if (binary)
+        return false;
+    if (on) {
+        window.start(us_ticker_read());
+    } else {
+        window.stop();
+    }
+    return true;
+}
+
+// a packet of room is kept back so ^X and ? still get through while the host keeps rxbuf full
+void USBSerial::report_window()
+{
+    char buf[32];
+    int room = rxbuf.free() - MAX_PACKET_SIZE_EPBULK;
+    if (window.report(rxbuf.line_count(), room > 0 ? room : 0, THECONVEYOR->get_free_blocks(), us_ticker_read(), buf, sizeof(buf)) > 0)
+        puts(buf);
+}
+
+// decodes what has been received in binary mode, as long as there is room in the queue for the moves
+void USBSerial::feed_binary()
+{
+    while (binary && !THECONVEYOR->is_queue_full()) {
+        // the bytes in one piece are decoded where they are, and binbuf is told afterwards how many were used
+        uint16_t n;
+        const uint8_t *p = binbuf->read_span(&n);
+        if (n == 0)
+            break;
+        uint16_t i = 0;
+        while (i < n && binary && !THECONVEYOR->is_queue_full()) {
+            switch (decoder->put(p[i++])) {
+                case BinaryGcodeDecoder::NEED_MORE:
+                    break;
+
+                case BinaryGcodeDecoder::MOTION:
+                    BinaryGcodeDecoder::dispatch(decoder->get_record(), this);
+                    break;
+
+                case BinaryGcodeDecoder::TEXT_LINE: {
+                    struct SerialMessage message;
+                    message.message = decoder->get_text();
+                    message.stream = this;
+                    THEKERNEL->call_event(ON_CONSOLE_LINE_RECEIVED, &message );
+                    break;
+                }
+
+                case BinaryGcodeDecoder::ENDED:
+                    binary = false;
+                    printf("ok binary %lu\r\n", decoder->get_records() - 1);
+                    break;
+
+                case BinaryGcodeDecoder::ERROR:
+                    // the host is out of step with us so stop everything, it will have to send ^X or M999 as text
+                    binary = false;
+                    printf("Error: binary stream %s after %lu records\r\n", decoder->get_error(), decoder->get_records());
+                    THEKERNEL->call_event(ON_HALT, nullptr);
+                    break;
+            }
+        }
+        binbuf->consume(i);
+    }
+    rx_consumed();
 }
 
 void USBSerial::on_module_loaded()
@@ -288,14 +463,26 @@ void USBSerial::on_idle(void *argument)
             puts("HALTED, M999 or $X to exit HALT state\r\n");
         }
         rxbuf.flush(); // flush the recieve buffer, hopefully upstream has stopped sending
-        nl_in_rx = 0;
+        if (binary) {
+            // and the rest of a binary stream, the host sends text again after ^X
+            binary = false;
+            binbuf->flush();
+        }
+        rx_consumed();
+        window.stop();
     }
 
     if(query_flag) {
         query_flag = false;
-        puts(THEKERNEL->get_query_string().c_str());
+        puts_latest(THEKERNEL->get_query_string().c_str());
     }
 
+    if (attached) {
+        if (!binary)
+            report_window();
+        txbuf.put_waiting();
+        start_tx();
+    }
 }
 
 void USBSerial::on_main_loop(void *argument)
@@ -311,31 +498,30 @@ void USBSerial::on_main_loop(void *argument)
             puts("Smoothie\r\nok\r\n");
         } else {
             attached = false;
+            binary = false;
+            window.stop();
             THEKERNEL->streams->remove_stream(this);
             txbuf.flush();
             rxbuf.flush();
-            nl_in_rx = 0;
         }
     }
 
     // if we are in feed hold we do not process anything
     //if(THEKERNEL->get_feed_hold()) return;
 
-    if (nl_in_rx) {
-        string received;
-        while (available()) {
-            char c = _getc();
-            if( c == '\n' || c == '\r') {
-                struct SerialMessage message;
-                message.message = received;
-                message.stream = this;
-                iprintf("USBSerial Received: %s\n", message.message.c_str());
-                THEKERNEL->call_event(ON_CONSOLE_LINE_RECEIVED, &message );
-                return;
-            } else {
-                received += c;
-            }
-        }
+    if (binary) {
+        feed_binary();
+
+    } else if (rxbuf.has_line()) {
+        struct SerialMessage message;
+        rxbuf.get_line(message.message);
+        message.stream = this;
+        rx_consumed();
+        iprintf("USBSerial Received: %s\n", message.message.c_str());
+        window.line_taken(message.message.size() + 1);
+        THEKERNEL->call_event(ON_CONSOLE_LINE_RECEIVED, &message );
+        window.line_done();
+        report_window();
     }
 }
 
@@ -22,10 +22,15 @@
 #include "USBCDC.h"
 // #include "Stream.h"
 #include "CircBuffer.h"
+#include "LineBuffer.h"
+#include "TxBuffer.h"
+#include "AckWindow.h"
 
 #include "Module.h"
 #include "StreamOutput.h"
 
+class BinaryGcodeDecoder;
+
 class USBSerial_Receiver {
 protected:
     virtual bool SerialEvent_RX(void) = 0;
@@ -38,14 +43,19 @@ public:
     int _putc(int c);
     int _getc();
     int puts(const char *);
+    bool puts_nowait(const char *);
+    void puts_latest(const char *);
+    TxStats *get_tx_stats() { return &txbuf.get_stats(); }
 
     uint8_t available();
     bool ready();
+    bool start_binary();
+    bool start_window(bool on);
 
     uint16_t writeBlock(const uint8_t * buf, uint16_t size);
 
-    CircBuffer<uint8_t> rxbuf;
-    CircBuffer<uint8_t> txbuf;
+    LineBuffer<256> rxbuf;
+    TxBuffer<512> txbuf;
 
     void on_module_loaded(void);
     void on_main_loop(void *);
@@ -61,12 +71,13 @@ protected:
     virtual void on_attach(void);
     virtual void on_detach(void);
 
-    void ensure_tx_space(int);
-
-    // keep track of number of newlines in the buffer
-    // this makes it trivial to detect if there's a new line available
-    volatile int nl_in_rx;
-
+    bool ensure_tx_space(int);
+    void start_tx();
+    void rx_consumed();
+    void receive_text(const uint8_t *, uint32_t);
+    void feed_binary();
+    uint32_t take_realtime(uint8_t *p, uint32_t size);
+    void report_window();
 
     volatile struct {
         volatile bool attach:1;
@@ -74,14 +85,15 @@ protected:
         bool halt_flag:1;
         bool query_flag:1;
         bool last_char_was_dollar:1;
-        // if we receive a line that's longer than the buffer, to avoid a deadlock
-        // we must flush the buffer.
-        // then to avoid delivering the tail of a line to Smoothie we must keep
-        // flushing until we find a newline.
-        // this flag asserts when we are doing this
-        bool flush_to_nl:1;
+        volatile bool binary:1;     // received bytes go to binbuf undecoded, see start_binary()
     };
 
+    // only allocated once binary streaming is first used
+    CircBuffer<uint8_t> *binbuf;
+    BinaryGcodeDecoder *decoder;
+
+    AckWindow window;
+
 private:
     USB *usb;
 //     mbed::FunctionPointer rx;
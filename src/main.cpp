@@ -279,5 +279,6 @@ int main()
         }
         THEKERNEL->call_event(ON_MAIN_LOOP);
         THEKERNEL->call_event(ON_IDLE);
+        THEKERNEL->count_main_loop();
     }
 }
@@ -39,6 +39,12 @@ static bool is_allowed_mcode(int m) {
     return false;
 }
 
+// the text after the first skip characters of a command, like substr(skip) but safe if the command is shorter
+static string rest_of_command(const char *cmd, size_t len, size_t skip)
+{
+    return skip < len ? string(cmd + skip, len - skip) : string();
+}
+
 GcodeDispatch::GcodeDispatch()
 {
     uploading = false;
@@ -52,17 +58,29 @@ void GcodeDispatch::on_module_loaded()
     this->register_for_event(ON_CONSOLE_LINE_RECEIVED);
 }
 
+// returns the position of the first character of str[pos..len) that is in set, or len if there is none
+static size_t find_first_of(const char *str, size_t len, const char *set, size_t pos= 0)
+{
+    for (size_t i = pos; i < len; ++i) {
+        if(strchr(set, str[i]) != nullptr) return i;
+    }
+    return len;
+}
+
 // When a command is received, if it is a Gcode, dispatch it as an object via an event
+// The line is not copied, it is walked with a pointer and length and each command is parsed straight out of it
 void GcodeDispatch::on_console_line_received(void *line)
 {
-    SerialMessage new_message = *static_cast<SerialMessage *>(line);
-    string possible_command = new_message.message;
+    SerialMessage& new_message = *static_cast<SerialMessage *>(line);
+    const char *possible_command = new_message.message.data();
+    size_t possible_len = new_message.message.size();
+    string modal_line; // only used for the pycam syntax
 
     int ln = 0;
     int cs = 0;
 
     // just reply ok to empty lines
-    if(possible_command.empty()) {
+    if(possible_len == 0) {
         new_message.stream->printf("ok\r\n");
         return;
     }
@@ -70,7 +88,7 @@ void GcodeDispatch::on_console_line_received(void *line)
 try_again:
 
     char first_char = possible_command[0];
-    unsigned int n;
+    size_t n;
 
     if(first_char == '$') {
         // ignore as simpleshell will handle it
@@ -85,7 +103,7 @@ try_again:
 
         //Get linenumber
         if ( first_char == 'N' ) {
-            Gcode full_line = Gcode(possible_command, new_message.stream, false);
+            Gcode full_line(possible_command, possible_len, new_message.stream, false);
             ln = (int) full_line.get_value('N');
             int chksum = (int) full_line.get_value('*');
 
@@ -99,18 +117,20 @@ try_again:
             }
 
             //Strip checksum value from possible_command
-            size_t chkpos = possible_command.find_first_of("*");
-            possible_command = possible_command.substr(0, chkpos);
+            size_t chkpos = find_first_of(possible_command, possible_len, "*");
             //Calculate checksum
-            if ( chkpos != string::npos ) {
-                for (auto c = possible_command.cbegin(); *c != '*' && c != possible_command.cend(); c++)
-                    cs = cs ^ *c;
+            if ( chkpos != possible_len ) {
+                possible_len = chkpos;
+                for (size_t i = 0; i < possible_len; i++)
+                    cs = cs ^ possible_command[i];
                 cs &= 0xff;  // Defensive programming...
                 cs -= chksum;
             }
             //Strip line number value from possible_command
-            size_t lnsize = possible_command.find_first_not_of("N0123456789.,- ");
-            possible_command = possible_command.substr(lnsize);
+            size_t lnsize = 0;
+            while(lnsize < possible_len && strchr("N0123456789.,- ", possible_command[lnsize]) != nullptr) lnsize++;
+            possible_command += lnsize;
+            possible_len -= lnsize;
 
         } else {
             //Assume checks succeeded
@@ -119,10 +139,7 @@ try_again:
         }
 
         //Remove comments
-        size_t comment = possible_command.find_first_of(";(");
-        if( comment != string::npos ) {
-            possible_command = possible_command.substr(0, comment);
-        }
+        possible_len = find_first_of(possible_command, possible_len, ";(");
 
         //If checksum passes then process message, else request resend
         int nextline = currentline + 1;
@@ -131,35 +148,29 @@ try_again:
                 currentline = nextline;
             }
 
-            while(possible_command.size() > 0) {
+            while(possible_len > 0) {
                 // assumes G or M are always the first on the line
-                size_t nextcmd = possible_command.find_first_of("GM", 2);
-                string single_command;
-                if(nextcmd == string::npos) {
-                    single_command = possible_command;
-                    possible_command = "";
-                } else {
-                    single_command = possible_command.substr(0, nextcmd);
-                    possible_command = possible_command.substr(nextcmd);
-                }
-
+                size_t nextcmd = find_first_of(possible_command, possible_len, "GM", 2);
+                const char *single_command = possible_command;
+                size_t single_len = nextcmd;
+                possible_command += nextcmd;
+                possible_len -= nextcmd;
 
                 if(!uploading || upload_stream != new_message.stream) {
                     // Prepare gcode for dispatch
-                    Gcode *gcode = new Gcode(single_command, new_message.stream);
+                    Gcode gcode(single_command, single_len, new_message.stream);
 
                     if(THEKERNEL->is_halted()) {
                         // we ignore all commands until M999, unless it is in the exceptions list (like M105 get temp)
-                        if(gcode->has_m && gcode->m == 999) {
+                        if(gcode.has_m && gcode.m == 999) {
                             if(THEKERNEL->is_halted()) {
                                 THEKERNEL->call_event(ON_HALT, (void *)1); // clears on_halt
                                 new_message.stream->printf("WARNING: After HALT you should HOME as position is currently unknown\n");
                             }
                             new_message.stream->printf("ok\n");
-                            delete gcode;
                             continue;
 
-                        }else if(!is_allowed_mcode(gcode->m)) {
+                        }else if(!is_allowed_mcode(gcode.m)) {
                             // ignore everything, return error string to host
                             if(THEKERNEL->is_grbl_mode()) {
                                 new_message.stream->printf("error:Alarm lock\n");
@@ -167,34 +178,30 @@ try_again:
                             }else{
                                 new_message.stream->printf("!!\r\n");
                             }
-                            delete gcode;
                             continue;
                         }
                     }
 
-                    if(gcode->has_g) {
-                        if(gcode->g == 53) { // G53 makes next movement command use machine coordinates
+                    if(gcode.has_g) {
+                        if(gcode.g == 53) { // G53 makes next movement command use machine coordinates
                             // this is ugly to implement as there may or may not be a G0/G1 on the same line
                             // valid version seem to include G53 G0 X1 Y2 Z3 G53 X1 Y2
-                            if(possible_command.empty()) {
+                            if(possible_len == 0) {
                                 // use last gcode G1 or G0 if none on the line, and pass through as if it was a G0/G1
                                 // TODO it is really an error if the last is not G0 thru G3
                                 if(modal_group_1 > 3) {
-                                    delete gcode;
                                     new_message.stream->printf("ok - Invalid G53\r\n");
                                     return;
                                 }
                                 // use last G0 or G1
-                                gcode->g= modal_group_1;
+                                gcode.g= modal_group_1;
 
                             }else{
-                                delete gcode;
                                 // extract next G0/G1 from the rest of the line, ignore if it is not one of these
-                                gcode = new Gcode(possible_command, new_message.stream);
-                                possible_command= "";
-                                if(!gcode->has_g || gcode->g > 1) {
+                                gcode = Gcode(possible_command, possible_len, new_message.stream);
+                                possible_len= 0;
+                                if(!gcode.has_g || gcode.g > 1) {
                                     // not G0 or G1 so ignore it as it is invalid
-                                    delete gcode;
                                     new_message.stream->printf("ok - Invalid G53\r\n");
                                     return;
                                 }
@@ -205,17 +212,15 @@ try_again:
                         }
 
                         // remember last modal group 1 code
-                        if(gcode->g < 4) {
-                            modal_group_1= gcode->g;
+                        if(gcode.g < 4) {
+                            modal_group_1= gcode.g;
                         }
                     }
 
-                    if(gcode->has_m) {
-                        switch (gcode->m) {
+                    if(gcode.has_m) {
+                        switch (gcode.m) {
                             case 28: // start upload command
-                                delete gcode;
-
-                                this->upload_filename = "/sd/" + single_command.substr(4); // rest of line is filename
+                                this->upload_filename = "/sd/" + rest_of_command(single_command, single_len, 4); // rest of line is filename
                                 // open file
                                 upload_fd = fopen(this->upload_filename.c_str(), "w");
                                 if(upload_fd != NULL) {
@@ -250,14 +255,12 @@ try_again:
                                 // disables heaters and motors, ignores further incoming Gcode and clears block queue
                                 THEKERNEL->call_event(ON_HALT, nullptr);
                                 THEKERNEL->streams->printf("ok Emergency Stop Requested - reset or M999 required to exit HALT state\r\n");
-                                delete gcode;
                                 return;
 
                             case 117: // M117 is a special non compliant Gcode as it allows arbitrary text on the line following the command
                             {    // concatenate the command again and send to panel if enabled
-                                string str= single_command.substr(4) + possible_command;
+                                string str= rest_of_command(single_command, single_len + possible_len, 4);
                                 PublicData::set_value( panel_checksum, panel_display_message_checksum, &str );
-                                delete gcode;
                                 new_message.stream->printf("ok\r\n");
                                 return;
                             }
@@ -265,11 +268,9 @@ try_again:
                             case 1000: // M1000 is a special command that will pass thru the raw lowercased command to the simpleshell (for hosts that do not allow such things)
                             {
                                 // reconstruct entire command line again
-                                string str= single_command.substr(5) + possible_command;
+                                string str= rest_of_command(single_command, single_len + possible_len, 5);
                                 while(is_whitespace(str.front())){ str= str.substr(1); } // strip leading whitespace
 
-                                delete gcode;
-
                                 if(str.empty()) {
                                     SimpleShell::parse_command("help", "", new_message.stream);
 
@@ -296,11 +297,10 @@ try_again:
                                     // this also will truncate the existing file instead of deleting it
                                 }
                                 // replace stream with one that writes to config-override file
-                                gcode->stream = new AppendFileStream(THEKERNEL->config_override_filename());
+                                gcode.stream = new AppendFileStream(THEKERNEL->config_override_filename());
                                 // dispatch the M500 here so we can free up the stream when done
-                                THEKERNEL->call_event(ON_GCODE_RECEIVED, gcode );
-                                delete gcode->stream;
-                                delete gcode;
+                                THEKERNEL->call_event(ON_GCODE_RECEIVED, &gcode );
+                                delete gcode.stream;
                                 __enable_irq();
                                 new_message.stream->printf("Settings Stored to %s\r\nok\r\n", THEKERNEL->config_override_filename());
                                 continue;
@@ -308,19 +308,17 @@ try_again:
                             case 501: // load config override
                             case 504: // save to specific config override file
                                 {
-                                    string arg= get_arguments(single_command + possible_command); // rest of line is filename
+                                    string arg= get_arguments(string(single_command, single_len + possible_len)); // rest of line is filename
                                     if(arg.empty()) arg= "/sd/config-override";
                                     else arg= "/sd/config-override." + arg;
                                     //new_message.stream->printf("args: <%s>\n", arg.c_str());
-                                    SimpleShell::parse_command((gcode->m == 501) ? "load_command" : "save_command", arg, new_message.stream);
+                                    SimpleShell::parse_command((gcode.m == 501) ? "load_command" : "save_command", arg, new_message.stream);
                                 }
-                                delete gcode;
                                 new_message.stream->printf("ok\r\n");
                                 return;
 
                             case 502: // M502 deletes config-override so everything defaults to what is in config
                                 remove(THEKERNEL->config_override_filename());
-                                delete gcode;
                                 new_message.stream->printf("config override file deleted %s, reboot needed\r\nok\r\n", THEKERNEL->config_override_filename());
                                 continue;
 
@@ -333,18 +331,18 @@ try_again:
                                 } else {
                                     new_message.stream->printf("; No config override\n");
                                 }
-                                gcode->add_nl= true;
+                                gcode.add_nl= true;
                                 break; // fall through to process by modules
                             }
 
                         }
                     }
 
-                    //printf("dispatch %p: '%s' G%d M%d...", gcode, gcode->command.c_str(), gcode->g, gcode->m);
+                    //printf("dispatch %p: '%s' G%d M%d...", &gcode, gcode.get_command(), gcode.g, gcode.m);
                     //Dispatch message!
-                    THEKERNEL->call_event(ON_GCODE_RECEIVED, gcode );
+                    THEKERNEL->call_event(ON_GCODE_RECEIVED, &gcode );
 
-                    if (gcode->is_error) {
+                    if (gcode.is_error) {
                         // report error
                         if(THEKERNEL->is_grbl_mode()) {
                             new_message.stream->printf("error: ");
@@ -352,9 +350,9 @@ try_again:
                             new_message.stream->printf("Error: ");
                         }
 
-                        if(!gcode->txt_after_ok.empty()) {
-                            new_message.stream->printf("%s\r\n", gcode->txt_after_ok.c_str());
-                            gcode->txt_after_ok.clear();
+                        if(!gcode.txt_after_ok.empty()) {
+                            new_message.stream->printf("%s\r\n", gcode.txt_after_ok.c_str());
+                            gcode.txt_after_ok.clear();
 
                         }else{
                             new_message.stream->printf("unknown\r\n");
@@ -366,17 +364,17 @@ try_again:
 
                     }else{
 
-                        if(gcode->add_nl)
+                        if(gcode.add_nl)
                             new_message.stream->printf("\r\n");
 
-                        if(!gcode->txt_after_ok.empty()) {
-                            new_message.stream->printf("ok %s\r\n", gcode->txt_after_ok.c_str());
-                            gcode->txt_after_ok.clear();
+                        if(!gcode.txt_after_ok.empty()) {
+                            new_message.stream->printf("ok %s\r\n", gcode.txt_after_ok.c_str());
+                            gcode.txt_after_ok.clear();
 
                         } else {
                             if(THEKERNEL->is_ok_per_line() || THEKERNEL->is_grbl_mode()) {
                                 // only send ok once per line if this is a multi g code line send ok on the last one
-                                if(possible_command.empty())
+                                if(possible_len == 0)
                                     new_message.stream->printf("ok\r\n");
                             } else {
                                 // maybe should do the above for all hosts?
@@ -385,11 +383,9 @@ try_again:
                         }
                     }
 
-                    delete gcode;
-
                 } else {
                     // we are uploading and it is the upload stream so so save it
-                    if(single_command.substr(0, 3) == "M29") {
+                    if(single_len >= 3 && strncmp(single_command, "M29", 3) == 0) {
                         // done uploading, close file
                         fclose(upload_fd);
                         upload_fd = NULL;
@@ -406,9 +402,8 @@ try_again:
                         continue;
                     }
 
-                    single_command.append("\n");
                     static int cnt = 0;
-                    if(fwrite(single_command.c_str(), 1, single_command.size(), upload_fd) != single_command.size()) {
+                    if(fwrite(single_command, 1, single_len, upload_fd) != single_len || fputc('\n', upload_fd) == EOF) {
                         // error writing to file
                         new_message.stream->printf("Error:error writing to file.\r\n");
                         fclose(upload_fd);
@@ -416,7 +411,7 @@ try_again:
                         continue;
 
                     } else {
-                        cnt += single_command.size();
+                        cnt += single_len + 1;
                         if (cnt > 400) {
                             // HACK ALERT to get around fwrite corruption close and re open for append
                             fclose(upload_fd);
@@ -434,11 +429,14 @@ try_again:
             new_message.stream->printf("rs N%d\r\n", nextline);
         }
 
-    } else if( (n=possible_command.find_first_of("XYZF")) == 0 || (first_char == ' ' && n != string::npos) ) {
+    } else if( (n=find_first_of(possible_command, possible_len, "XYZF")) == 0 || (first_char == ' ' && n != possible_len) ) {
         // handle pycam syntax, use last modal group 1 command and resubmit if an X Y Z or F is found on its own line
         char buf[6];
         snprintf(buf, sizeof(buf), "G%d ", modal_group_1);
-        possible_command.insert(0, buf);
+        modal_line.assign(buf);
+        modal_line.append(possible_command, possible_len);
+        possible_command= modal_line.data();
+        possible_len= modal_line.size();
         goto try_again;
 
         // Ignore comments and blank lines
@@ -446,4 +444,3 @@ try_again:
         new_message.stream->printf("ok\r\n");
     }
 }
-
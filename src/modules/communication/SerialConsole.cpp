@@ -12,17 +12,36 @@ using std::string;
 #include "libs/Kernel.h"
 #include "libs/nuts_bolts.h"
 #include "SerialConsole.h"
-#include "libs/RingBuffer.h"
+#include "libs/LineBuffer.h"
 #include "libs/SerialMessage.h"
 #include "libs/StreamOutput.h"
 #include "libs/StreamOutputPool.h"
 
+// mbed::Serial with the UART's transmit register, so the TX interrupt can fill the FIFO rather than send a byte each time
+class FifoSerial : public mbed::Serial {
+    public:
+        static const int FIFO_SIZE= 16;
+
+        FifoSerial(PinName tx, PinName rx) : mbed::Serial(tx, rx) {}
+        // only when the FIFO has room, it does when writeable() and then for FIFO_SIZE bytes
+        void put_fifo(char c) { this->_serial.uart->THR= c; }
+};
+
 // Serial reading module
 // Treats every received line as a command and passes it ( via event call ) to the command dispatcher.
 // The command dispatcher will then ask other modules if they can do something with it
 SerialConsole::SerialConsole( PinName rx_pin, PinName tx_pin, int baud_rate ){
-    this->serial = new mbed::Serial( rx_pin, tx_pin );
+    this->serial = new FifoSerial( rx_pin, tx_pin );
     this->serial->baud(baud_rate);
+    this->tx_running= false;
+}
+
+// The first one made only lasts while the config is loaded, what it was sending must go before it does
+SerialConsole::~SerialConsole(){
+    while(!this->txbuf.is_empty()) wait_tx();
+    this->serial->attach(nullptr, mbed::Serial::TxIrq);
+    this->serial->attach(nullptr, mbed::Serial::RxIrq);
+    delete this->serial;
 }
 
 // Called when the module has just been loaded
@@ -52,9 +71,50 @@ void SerialConsole::on_serial_char_received(){
             halt_flag= true;
             continue;
         }
-        // convert CR to NL (for host OSs that don't send NL)
-        if( received == '\r' ){ received = '\n'; }
-        this->buffer.push_back(received);
+        // CR ends a line too (for host OSs that don't send NL)
+        this->buffer.put(received);
+    }
+}
+
+// Called on Serial::TxIrq interrupt, meaning the FIFO is empty
+void SerialConsole::on_serial_tx_empty(){
+    char c;
+    int n= 0;
+    while(n < FifoSerial::FIFO_SIZE && this->txbuf.get(c)) {
+        this->serial->put_fifo(c);
+        n++;
+    }
+    if(n == 0) {
+        // nothing left to send, puts() will start it again
+        this->serial->attach(nullptr, mbed::Serial::TxIrq);
+        this->tx_running= false;
+    }
+}
+
+// Fills the FIFO and enables the TX interrupt, which then sends the rest of txbuf
+void SerialConsole::start_tx(){
+    if(this->tx_running || this->txbuf.is_empty()) return;
+    this->tx_running= true;
+    // the interrupt comes when the FIFO empties, so only fill it now if it is empty already, otherwise the
+    // interrupt fills it when the bytes still in it have gone
+    if(this->serial->writeable()) {
+        char c;
+        for (int n = 0; n < FifoSerial::FIFO_SIZE && this->txbuf.get(c); ++n) {
+            this->serial->put_fifo(c);
+        }
+    }
+    this->serial->attach(this, &SerialConsole::on_serial_tx_empty, mbed::Serial::TxIrq);
+}
+
+// Waits for the TX interrupt to make room in txbuf, or makes it itself if the interrupt cannot come, as when
+// printing from a higher priority interrupt or with interrupts disabled
+void SerialConsole::wait_tx(){
+    start_tx();
+    if(__get_IPSR() != 0 || __get_PRIMASK() != 0) {
+        uint32_t primask= __get_PRIMASK();
+        __disable_irq();
+        if(this->serial->writeable()) on_serial_tx_empty();
+        __set_PRIMASK(primask);
     }
 }
 
@@ -62,8 +122,10 @@ void SerialConsole::on_idle(void * argument)
 {
     if(query_flag) {
         query_flag= false;
-        puts(THEKERNEL->get_query_string().c_str());
+        puts_latest(THEKERNEL->get_query_string().c_str());
     }
+    this->txbuf.put_waiting();
+    start_tx();
     if(halt_flag) {
         halt_flag= false;
         THEKERNEL->call_event(ON_HALT, nullptr);
@@ -72,49 +134,49 @@ void SerialConsole::on_idle(void * argument)
 
 // Actual event calling must happen in the main loop because if it happens in the interrupt we will loose data
 void SerialConsole::on_main_loop(void * argument){
-    if( this->has_char('\n') ){
-        string received;
-        received.reserve(20);
-        while(1){
-           char c;
-           this->buffer.pop_front(c);
-           if( c == '\n' ){
-                struct SerialMessage message;
-                message.message = received;
-                message.stream = this;
-                THEKERNEL->call_event(ON_CONSOLE_LINE_RECEIVED, &message );
-                return;
-            }else{
-                received += c;
-            }
-        }
+    if( this->buffer.has_line() ){
+        struct SerialMessage message;
+        this->buffer.get_line(message.message);
+        message.stream = this;
+        THEKERNEL->call_event(ON_CONSOLE_LINE_RECEIVED, &message );
     }
 }
 
 
+// Replies to this stream wait for room, the UART always makes it at the baud rate
 int SerialConsole::puts(const char* s)
 {
-    return fwrite(s, strlen(s), 1, (FILE*)(*this->serial));
+    size_t n= strlen(s);
+    size_t sent= this->txbuf.write(s, n);
+    while(sent < n) {
+        wait_tx();
+        sent += this->txbuf.write(s + sent, n - sent);
+    }
+    start_tx();
+    return n;
+}
+
+bool SerialConsole::puts_nowait(const char* s)
+{
+    bool ok= this->txbuf.put(s, strlen(s));
+    start_tx();
+    return ok;
+}
+
+void SerialConsole::puts_latest(const char* s)
+{
+    this->txbuf.put_latest(s, strlen(s));
+    start_tx();
 }
 
 int SerialConsole::_putc(int c)
 {
-    return this->serial->putc(c);
+    char s[2]= { (char)c, '\0' };
+    puts(s);
+    return c;
 }
 
 int SerialConsole::_getc()
 {
     return this->serial->getc();
 }
-
-// Does the queue have a given char ?
-bool SerialConsole::has_char(char letter){
-    int index = this->buffer.tail;
-    while( index != this->buffer.head ){
-        if( this->buffer.buffer[index] == letter ){
-            return true;
-        }
-        index = this->buffer.next_block_index(index);
-    }
-    return false;
-}
@@ -14,34 +14,48 @@
 #include <vector>
 #include <string>
 using std::string;
-#include "libs/RingBuffer.h"
+#include "libs/LineBuffer.h"
+#include "libs/TxBuffer.h"
 #include "libs/StreamOutput.h"
 
 
 #define baud_rate_setting_checksum CHECKSUM("baud_rate")
 
+class FifoSerial;
+
 class SerialConsole : public Module, public StreamOutput {
     public:
         SerialConsole( PinName rx_pin, PinName tx_pin, int baud_rate );
+        ~SerialConsole();
 
         void on_module_loaded();
         void on_serial_char_received();
+        void on_serial_tx_empty();
         void on_main_loop(void * argument);
         void on_idle(void * argument);
-        bool has_char(char letter);
 
         int _putc(int c);
         int _getc(void);
         int puts(const char*);
+        bool puts_nowait(const char*);
+        void puts_latest(const char*);
+        TxStats *get_tx_stats() { return &this->txbuf.get_stats(); }
 
         //string receive_buffer;                 // Received chars are stored here until a newline character is received
         //vector<std::string> received_lines;    // Received lines are stored here until they are requested
-        RingBuffer<char,256> buffer;             // Receive buffer
-        mbed::Serial* serial;
+        LineBuffer<256> buffer;                  // Receive buffer, filled by the RX interrupt
+        TxBuffer<1024> txbuf;                    // Transmit buffer, emptied by the TX interrupt
+        FifoSerial* serial;
+
+    private:
+        void start_tx();
+        void wait_tx();
+
         struct {
           bool query_flag:1;
           bool halt_flag:1;
         };
+        volatile bool tx_running;                // the TX interrupt is enabled, it clears this when txbuf is empty
 };
 
 #endif
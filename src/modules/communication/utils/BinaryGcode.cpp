@@ -0,0 +1,388 @@
+/*
+      This file is part of Smoothie (http://smoothieware.org/). The motion control part is heavily based on Grbl (https://github.com/simen/grbl).
+      Smoothie is free software: you can redistribute it and/or modify it under the terms of the GNU General Public License as published by the Free Software Foundation, either version 3 of the License, or (at your option) any later version.
+      Smoothie is distributed in the hope that it will be useful, but WITHOUT ANY WARRANTY; without even the implied warranty of MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the GNU General Public License for more details.
+      You should have received a copy of the GNU General Public License along with Smoothie. If not, see <http://www.gnu.org/licenses/>.
+*/
+
+#include "BinaryGcode.h"
+#include "Gcode.h"
+#include "libs/Kernel.h"
+#include "libs/StreamOutput.h"
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+
+const char BinaryGcodeDecoder::letters[8]= {'X', 'Y', 'Z', 'E', 'F', 'I', 'J', 'S'};
+
+// I and J are not delta encoded
+#define DELTA_MASK 0x9F
+
+static const float powers[]= {1e0F, 1e1F, 1e2F, 1e3F, 1e4F, 1e5F, 1e6F};
+
+bool BinaryGcodeDecoder::is_header(const char *buf, size_t n)
+{
+    return n >= 4 && buf[0] == 'S' && buf[1] == 'M' && buf[2] == 'B' && buf[3] == 1;
+}
+
+void BinaryGcodeDecoder::reset()
+{
+    state= HEADER;
+    pos= 0;
+    records= 0;
+    flags= 0;
+    escaped= false;
+    scale= 1000;
+    error= nullptr;
+    memset(last, 0, sizeof(last));
+}
+
+void BinaryGcodeDecoder::next_field()
+{
+    while(field < 8 && (record.mask & (1 << field)) == 0) field++;
+    varint= 0;
+    shift= 0;
+}
+
+BinaryGcodeDecoder::result_t BinaryGcodeDecoder::finish(result_t r)
+{
+    if(flags & 1) {
+        pending= r;
+        state= CRC;
+        return NEED_MORE;
+    }
+    state= OPCODE;
+    records++;
+    return r;
+}
+
+BinaryGcodeDecoder::result_t BinaryGcodeDecoder::put(uint8_t c)
+{
+    if(escaped) {
+        escaped= false;
+        c ^= 0x20;
+        if(!is_escaped(c)) return fail("bad escape");
+    } else if(c == ESCAPE) {
+        escaped= true;
+        return NEED_MORE;
+    } else if(c == HALT || c == QUERY) {
+        return fail("^X or ? in a record");
+    }
+
+    if((flags & 1) && state != HEADER && state != CRC) crc= BinaryGcodeEncoder::crc8(crc, c);
+
+    switch(state) {
+        case HEADER:
+            header[pos++]= c;
+            if(pos < header_size) return NEED_MORE;
+            if(!is_header((const char *)header, header_size) || header[5] > 6) return fail("not a binary gcode header");
+            flags= header[4];
+            scale= powers[header[5]];
+            state= OPCODE;
+            return NEED_MORE;
+
+        case OPCODE:
+            crc= BinaryGcodeEncoder::crc8(0, c);
+            record.op= c;
+            if(c <= M5) {
+                state= MASK;
+            } else if(c == TEXT) {
+                state= TEXT_LENGTH;
+            } else if(c == END) {
+                record.mask= 0;
+                return finish(ENDED);
+            } else {
+                return fail("unknown opcode");
+            }
+            return NEED_MORE;
+
+        case MASK:
+            if((record.op == M3 && (c & 0x7F) != 0) || (record.op == M5 && c != 0)) return fail("bad letters for M3 or M5");
+            record.mask= c;
+            field= 0;
+            next_field();
+            if(field == 8) return finish(MOTION);
+            state= FIELD;
+            return NEED_MORE;
+
+        case FIELD: {
+            varint |= (uint32_t)(c & 0x7F) << shift;
+            shift += 7;
+            if(c & 0x80) {
+                if(shift > 28) return fail("number too long");
+                return NEED_MORE;
+            }
+
+            int32_t v= (int32_t)(varint >> 1) ^ -(int32_t)(varint & 1);
+            if(DELTA_MASK & (1 << field)) {
+                last[field] += v;
+                v= last[field];
+            }
+            record.values[field]= v / scale;
+            field++;
+            next_field();
+            if(field == 8) return finish(MOTION);
+            return NEED_MORE;
+        }
+
+        case TEXT_LENGTH:
+            if(c == 0) return fail("empty text");
+            varint= c;
+            pos= 0;
+            state= TEXT_BODY;
+            return NEED_MORE;
+
+        case TEXT_BODY:
+            text[pos++]= c;
+            if(pos < varint) return NEED_MORE;
+            text[pos]= '\0';
+            return finish(TEXT_LINE);
+
+        case CRC:
+            if(c != crc) return fail("bad checksum");
+            state= OPCODE;
+            records++;
+            return pending;
+    }
+    return NEED_MORE;
+}
+
+// stops at the end of each record, used is how many bytes it took
+BinaryGcodeDecoder::result_t BinaryGcodeDecoder::put(const char *buf, size_t n, size_t& used)
+{
+    for (used= 0; used < n; ) {
+        result_t r= put((uint8_t)buf[used++]);
+        if(r != NEED_MORE) return r;
+    }
+    return NEED_MORE;
+}
+
+Gcode BinaryGcodeDecoder::make_gcode(const BinaryGcodeRecord& r, StreamOutput *stream)
+{
+    Gcode gcode(r.op <= G3 ? 'G' : 'M', r.op <= G3 ? r.op : (r.op == M3 ? 3 : 5), stream);
+    for (int i = 0; i < 8; ++i) {
+        if(r.mask & (1 << i)) gcode.set_value(letters[i], r.values[i]);
+    }
+    return gcode;
+}
+
+// like GcodeDispatch, nothing is done while halted and an error halts, but there is no ok for each record
+bool BinaryGcodeDecoder::dispatch(const BinaryGcodeRecord& r, StreamOutput *stream)
+{
+    if(THEKERNEL->is_halted()) return false;
+
+    Gcode gcode= make_gcode(r, stream);
+    THEKERNEL->call_event(ON_GCODE_RECEIVED, &gcode);
+
+    if(gcode.is_error) {
+        stream->printf("Error: %s\r\n", gcode.txt_after_ok.empty() ? "unknown" : gcode.txt_after_ok.c_str());
+        stream->printf("Entering Alarm/Halt state\n");
+        THEKERNEL->call_event(ON_HALT, nullptr);
+        return false;
+    }
+    return true;
+}
+
+BinaryGcodeEncoder::BinaryGcodeEncoder(int decimals, bool crc) : decimals(decimals), crc(crc)
+{
+    memset(last, 0, sizeof(last));
+    modal_group_1= 0xFF;
+    rounded= 0;
+}
+
+uint8_t BinaryGcodeEncoder::crc8(uint8_t crc, uint8_t c)
+{
+    crc ^= c;
+    for (int i = 0; i < 8; ++i) {
+        crc= (crc & 0x80) ? (crc << 1) ^ 0x07 : crc << 1;
+    }
+    return crc;
+}
+
+void BinaryGcodeEncoder::header(std::string& out) const
+{
+    const char h[BinaryGcodeDecoder::header_size]= {'S', 'M', 'B', 1, (char)(crc ? 1 : 0), (char)decimals, 0, 0};
+    out.append(h, sizeof(h));
+}
+
+void BinaryGcodeEncoder::end(std::string& out)
+{
+    put_record(std::string(1, (char)BinaryGcodeDecoder::END), out);
+}
+
+static void put_escaped(uint8_t b, std::string& out)
+{
+    if(BinaryGcodeDecoder::is_escaped(b)) {
+        out.push_back((char)BinaryGcodeDecoder::ESCAPE);
+        b ^= 0x20;
+    }
+    out.push_back((char)b);
+}
+
+void BinaryGcodeEncoder::put_record(const std::string& rec, std::string& out) const
+{
+    uint8_t c= 0;
+    for(char b : rec) {
+        put_escaped(b, out);
+        c= crc8(c, b);
+    }
+    if(crc) put_escaped(c, out);
+}
+
+bool BinaryGcodeEncoder::put_text(const char *line, size_t len, std::string& out) const
+{
+    if(len == 0 || len > 255) return false;
+    std::string rec;
+    rec.push_back((char)BinaryGcodeDecoder::TEXT);
+    rec.push_back((char)len);
+    rec.append(line, len);
+    put_record(rec, out);
+    return true;
+}
+
+// reads a plain decimal number into fixed point, rounding off any extra decimal places
+bool BinaryGcodeEncoder::scale_number(const char *&p, int32_t& v)
+{
+    bool neg= false;
+    if(*p == '-' || *p == '+') neg= (*p++ == '-');
+
+    int64_t n= 0;
+    int places= -1;  // decimal places seen, -1 before the point
+    bool any= false, round_up= false, lost= false;
+    for (; (*p >= '0' && *p <= '9') || (*p == '.' && places < 0); p++) {
+        if(*p == '.') {
+            places= 0;
+            continue;
+        }
+        any= true;
+        if(places >= decimals) {
+            if(places == decimals && *p >= '5') round_up= true;
+            if(*p != '0') lost= true;
+            places++;
+            continue;
+        }
+        n= n * 10 + (*p - '0');
+        if(places >= 0) places++;
+        if(n > INT32_MAX) return false;
+    }
+    if(!any || *p == 'e' || *p == 'E') return false;
+    if(lost) rounded++;
+
+    for (int i = places < 0 ? 0 : places; i < decimals; ++i) n *= 10;
+    if(round_up) n++;
+    if(n > INT32_MAX / 2) return false; // leave room for the differences
+    v= neg ? -n : n;
+    return true;
+}
+
+static void put_varint(int32_t v, std::string& out)
+{
+    uint32_t z= ((uint32_t)v << 1) ^ (uint32_t)(v >> 31);
+    while(z >= 0x80) {
+        out.push_back((char)(z | 0x80));
+        z >>= 7;
+    }
+    out.push_back((char)z);
+}
+
+BinaryGcodeEncoder::encoded_t BinaryGcodeEncoder::encode(const char *line, std::string& out)
+{
+    // take out comments, spaces, the line number and the checksum
+    char buf[256];
+    size_t len= 0;
+    bool in_paren= false;
+    for (const char *p= line; *p && *p != ';' && *p != '\n' && *p != '\r'; p++) {
+        if(in_paren) {
+            if(*p == ')') in_paren= false;
+        } else if(*p == '(') {
+            in_paren= true;
+        } else if(*p == '*') {
+            break;
+        } else if(len < sizeof(buf) - 1) {
+            buf[len++]= *p;
+        }
+    }
+    while(len > 0 && (buf[len - 1] == ' ' || buf[len - 1] == '\t')) len--;
+    buf[len]= '\0';
+    char *cmd= buf;
+    while(*cmd == ' ' || *cmd == '\t') cmd++;
+    if(*cmd == 'N') {
+        for (cmd++; *cmd >= '0' && *cmd <= '9'; cmd++);
+        while(*cmd == ' ' || *cmd == '\t') cmd++;
+    }
+    len= strlen(cmd);
+    if(len == 0) return SKIPPED;
+
+    // anything that is not one of the motion records goes as text, lines that rely on the modal G have it added
+    // as the G0 to G3 records do not go through GcodeDispatch to update its modal_group_1
+    const char *p= cmd;
+    int op= -1;
+    if(*p == 'G' || *p == 'M') {
+        char code= *p++;
+        char *e;
+        long n= strtol(p, &e, 10);
+        if(e > p && *e != '.') {
+            if(code == 'G' && n >= 0 && n <= 3) op= n;
+            else if(code == 'M' && n == 3) op= BinaryGcodeDecoder::M3;
+            else if(code == 'M' && n == 5) op= BinaryGcodeDecoder::M5;
+        }
+        p= e;
+    } else if((*p == 'X' || *p == 'Y' || *p == 'Z' || *p == 'F') && modal_group_1 <= 3) {
+        op= modal_group_1;
+    }
+
+    if(op >= 0) {
+        std::string rec;
+        rec.push_back((char)op);
+        rec.push_back(0);
+        int32_t values[8];
+        uint8_t mask= 0;
+        bool ok= true;
+        while(ok && *p) {
+            if(*p == ' ' || *p == '\t') {
+                p++;
+                continue;
+            }
+            const char *l= (const char *)memchr(BinaryGcodeDecoder::letters, *p, sizeof(BinaryGcodeDecoder::letters));
+            int i= l != nullptr ? l - BinaryGcodeDecoder::letters : 8;
+            if(i >= 8 || (mask & (1 << i)) || (op == BinaryGcodeDecoder::M3 && i != 7) || op == BinaryGcodeDecoder::M5) {
+                ok= false;
+                break;
+            }
+            p++;
+            ok= scale_number(p, values[i]);
+            mask |= 1 << i;
+        }
+
+        if(ok) {
+            rec[1]= (char)mask;
+            for (int i = 0; i < 8; ++i) {
+                if((mask & (1 << i)) == 0) continue;
+                if(DELTA_MASK & (1 << i)) {
+                    put_varint(values[i] - last[i], rec);
+                    last[i]= values[i];
+                } else {
+                    put_varint(values[i], rec);
+                }
+            }
+            put_record(rec, out);
+            if(op <= 3) modal_group_1= op;
+            return MOTION;
+        }
+    }
+
+    // a G0 to G3 line that could not be encoded still sets the modal G
+    if(*cmd == 'G') {
+        char *e;
+        long n= strtol(cmd + 1, &e, 10);
+        if(e > cmd + 1 && *e != '.' && n >= 0 && n <= 3) modal_group_1= n;
+    }
+
+    if((*cmd == 'X' || *cmd == 'Y' || *cmd == 'Z' || *cmd == 'F') && modal_group_1 <= 3) {
+        char modal[260];
+        int n= snprintf(modal, sizeof(modal), "G%d %s", modal_group_1, cmd);
+        return put_text(modal, n, out) ? TEXT : TOO_LONG;
+    }
+    return put_text(cmd, len, out) ? TEXT : TOO_LONG;
+}
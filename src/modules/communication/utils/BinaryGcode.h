@@ -0,0 +1,141 @@
+/*
+      This file is part of Smoothie (http://smoothieware.org/). The motion control part is heavily based on Grbl (https://github.com/simen/grbl).
+      Smoothie is free software: you can redistribute it and/or modify it under the terms of the GNU General Public License as published by the Free Software Foundation, either version 3 of the License, or (at your option) any later version.
+      Smoothie is distributed in the hope that it will be useful, but WITHOUT ANY WARRANTY; without even the implied warranty of MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the GNU General Public License for more details.
+      You should have received a copy of the GNU General Public License along with Smoothie. If not, see <http://www.gnu.org/licenses/>.
+*/
+
+#ifndef BINARYGCODE_H
+#define BINARYGCODE_H
+
+#include <stdint.h>
+#include <stddef.h>
+#include <string>
+
+class StreamOutput;
+class Gcode;
+
+/*
+Compact binary motion stream, gcode that has already been parsed.
+
+A file (or a stream after the binary command) starts with an 8 byte header:
+
+    'S' 'M' 'B' version(1) flags decimals 0 0
+
+flags bit 0 set means every record is followed by a CRC-8 (polynomial 0x07, starting at 0) of the record's bytes.
+decimals is how many decimal places the numbers are kept to, 0 to 6, 3 gives a resolution of 0.001.
+
+Then records, each starting with a one byte opcode:
+
+    0x00 G0, 0x01 G1, 0x02 G2, 0x03 G3, 0x04 M3, 0x05 M5
+        followed by a mask byte saying which letters follow, in this order:
+        bit 0 X, 1 Y, 2 Z, 3 E, 4 F, 5 I, 6 J, 7 S
+        M3 may only have S, M5 none.
+    0x06 text, followed by a length byte (1 to 255) and that many bytes of a gcode line or command,
+        for anything that is not one of the above
+    0x7F end, leaves binary streaming mode, optional in a file
+
+A stream answers the end record with "ok binary <records>", the number of records before it, once everything
+before it has been dispatched. The host waits for that before sending text again, a plain ok is from a text record.
+
+Each letter is the number scaled by 10^decimals as a signed LEB128 varint, zigzag encoded, so small numbers of
+either sign take one byte. X Y Z E F and S are the difference from the last value of the same letter (which starts
+at 0), I and J are the value itself as they are already relative.
+The numbers are what was written on the line, the machine still applies G90/G91, G20/G21, G92 and so on, which
+are sent as text.
+
+^X (0x18) and ? (0x3F) never appear in the records, so that a stream can still be aborted or asked for its status
+in the middle of them. They, and the escape byte 0x1B itself, are sent as 0x1B followed by the byte xor 0x20. This is
+done after the CRC, which is of the bytes before they were escaped. The header never needs it.
+*/
+struct BinaryGcodeRecord {
+    uint8_t op;
+    uint8_t mask;
+    float values[8];    // in the order of the mask bits
+};
+
+class BinaryGcodeDecoder {
+    public:
+        enum op_t { G0= 0, G1, G2, G3, M3, M5, TEXT, END= 0x7F };
+        enum result_t { NEED_MORE, MOTION, TEXT_LINE, ENDED, ERROR };
+
+        static const char letters[8];
+        static const uint8_t header_size= 8;
+        // the bytes that are escaped in the records
+        static const uint8_t ESCAPE= 0x1B, HALT= 0x18, QUERY= '?';
+        static bool is_escaped(uint8_t c) { return c == ESCAPE || c == HALT || c == QUERY; }
+        static bool is_header(const char *buf, size_t n);
+
+        BinaryGcodeDecoder() { reset(); }
+        void reset();
+
+        // takes the next byte of the stream, including the header
+        result_t put(uint8_t c);
+        result_t put(const char *buf, size_t n, size_t& used);
+
+        const BinaryGcodeRecord& get_record() const { return record; }
+        const char *get_text() const { return text; }
+        const char *get_error() const { return error; }
+        uint32_t get_records() const { return records; }
+
+        // makes the Gcode for a motion record
+        static Gcode make_gcode(const BinaryGcodeRecord& r, StreamOutput *stream);
+        // sends a motion record to the modules as if it had come through GcodeDispatch, returns false if it failed
+        static bool dispatch(const BinaryGcodeRecord& r, StreamOutput *stream);
+
+    private:
+        enum state_t { HEADER, OPCODE, MASK, FIELD, TEXT_LENGTH, TEXT_BODY, CRC };
+
+        result_t fail(const char *msg) { error= msg; state= HEADER; escaped= false; return ERROR; }
+        result_t finish(result_t r);
+        void next_field();
+
+        BinaryGcodeRecord record;
+        int32_t last[8];        // last value of each letter, fixed point
+        float scale;
+        uint32_t varint;
+        uint32_t records;
+        const char *error;
+        char text[256];
+        uint8_t header[header_size];
+        uint8_t pos;            // byte within the header, the varint or the text
+        uint8_t field;          // bit of the mask being read
+        uint8_t shift;
+        uint8_t crc;
+        uint8_t flags;
+        bool escaped;           // the last byte was ESCAPE
+        state_t state;
+        result_t pending;       // what the record is once its CRC has been checked
+};
+
+// turns gcode lines into the binary format, used by the converter and the benchmark
+class BinaryGcodeEncoder {
+    public:
+        enum encoded_t { SKIPPED, MOTION, TEXT, TOO_LONG };
+
+        BinaryGcodeEncoder(int decimals= 3, bool crc= false);
+
+        // the header goes at the start of the output
+        void header(std::string& out) const;
+        // appends the record for a line, blank lines and comments are SKIPPED, anything that is not a motion
+        // record goes as TEXT, unless it is TOO_LONG for that and nothing is added
+        encoded_t encode(const char *line, std::string& out);
+        void end(std::string& out);
+
+        // numbers that had more decimal places than are kept
+        uint32_t get_rounded() const { return rounded; }
+        static uint8_t crc8(uint8_t crc, uint8_t c);
+
+    private:
+        void put_record(const std::string& rec, std::string& out) const;
+        bool put_text(const char *line, size_t len, std::string& out) const;
+        bool scale_number(const char *&p, int32_t& v);
+
+        int32_t last[8];
+        int decimals;
+        uint8_t modal_group_1;
+        bool crc;
+        uint32_t rounded;
+};
+
+#endif
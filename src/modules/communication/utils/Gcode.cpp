@@ -10,34 +10,64 @@
 #include "libs/StreamOutput.h"
 #include "utils.h"
 #include <stdlib.h>
+#include <string.h>
 #include <algorithm>
 
 // This is a gcode object. It represents a GCode string/command, and caches some important values about that command for the sake of performance.
 // It gets passed around in events, and attached to the queue ( that'll change )
-Gcode::Gcode(const string &command, StreamOutput *stream, bool strip)
+// The command is kept in an inline buffer unless it is too long, and the letters and their values are tokenized once
+// when it is constructed, so a line being streamed does not need any heap allocations to be parsed and looked up
+Gcode::Gcode(const string &command, StreamOutput *stream, bool strip) : Gcode(command.c_str(), command.size(), stream, strip)
 {
-    this->command= strdup(command.c_str());
+}
+
+Gcode::Gcode(const char *command, StreamOutput *stream, bool strip) : Gcode(command, strlen(command), stream, strip)
+{
+}
+
+Gcode::Gcode(const char *command, size_t len, StreamOutput *stream, bool strip)
+{
+    set_command(command, len);
     this->m= 0;
     this->g= 0;
     this->subcode= 0;
     this->add_nl= false;
     this->is_error= false;
     this->stream= stream;
-    prepare_cached_values(strip);
     this->stripped= strip;
+    prepare_cached_values(strip);
+}
+
+// A G or M command whose letters are set with set_value() rather than parsed from text, for the binary format,
+// get_command() is empty
+Gcode::Gcode(char code, unsigned int number, StreamOutput *stream)
+{
+    set_command("", 0);
+    this->has_g= (code == 'G');
+    this->has_m= (code == 'M');
+    this->g= this->has_g ? number : 0;
+    this->m= this->has_m ? number : 0;
+    this->subcode= 0;
+    this->add_nl= false;
+    this->is_error= false;
+    this->stream= stream;
+    this->stripped= true;
+    letters= 0;
+    valued= 0;
+    arg_letters= 0;
+    num_args= 0;
 }
 
 Gcode::~Gcode()
 {
-    if(command != nullptr) {
-        // TODO we can reference count this so we share copies, may save more ram than the extra count we need to store
+    if(command != buffer) {
         free(command);
     }
 }
 
 Gcode::Gcode(const Gcode &to_copy)
 {
-    this->command               = strdup(to_copy.command); // TODO we can reference count this so we share copies, may save more ram than the extra count we need to store
+    set_command(to_copy.command, strlen(to_copy.command));
     this->has_m                 = to_copy.has_m;
     this->has_g                 = to_copy.has_g;
     this->m                     = to_copy.m;
@@ -45,14 +75,17 @@ Gcode::Gcode(const Gcode &to_copy)
     this->subcode               = to_copy.subcode;
     this->add_nl                = to_copy.add_nl;
     this->is_error              = to_copy.is_error;
+    this->stripped              = to_copy.stripped;
     this->stream                = to_copy.stream;
     this->txt_after_ok.assign( to_copy.txt_after_ok );
+    copy_table(to_copy);
 }
 
 Gcode &Gcode::operator= (const Gcode &to_copy)
 {
     if( this != &to_copy ) {
-        this->command               = strdup(to_copy.command); // TODO we can reference count this so we share copies, may save more ram than the extra count we need to store
+        if(command != buffer) free(command);
+        set_command(to_copy.command, strlen(to_copy.command));
         this->has_m                 = to_copy.has_m;
         this->has_g                 = to_copy.has_g;
         this->m                     = to_copy.m;
@@ -60,28 +93,143 @@ Gcode &Gcode::operator= (const Gcode &to_copy)
         this->subcode               = to_copy.subcode;
         this->add_nl                = to_copy.add_nl;
         this->is_error              = to_copy.is_error;
+        this->stripped              = to_copy.stripped;
         this->stream                = to_copy.stream;
         this->txt_after_ok.assign( to_copy.txt_after_ok );
+        copy_table(to_copy);
     }
     return *this;
 }
 
+void Gcode::set_command(const char *cmd, size_t len)
+{
+    if(len < sizeof(buffer)) {
+        command= buffer;
+    } else {
+        command= (char *)malloc(len + 1);
+    }
+    memcpy(command, cmd, len);
+    command[len]= '\0';
+}
 
-// Whether or not a Gcode has a letter
-bool Gcode::has_letter( char letter ) const
+void Gcode::copy_table(const Gcode &to_copy)
 {
-    for (size_t i = 0; i < strlen(this->command); ++i) {
-        if( command[i] == letter ) {
-            return true;
+    this->letters               = to_copy.letters;
+    this->valued                = to_copy.valued;
+    this->arg_letters           = to_copy.arg_letters;
+    this->num_args              = to_copy.num_args;
+    memcpy(this->values, to_copy.values, sizeof(values));
+    memcpy(this->offsets, to_copy.offsets, sizeof(offsets));
+}
+
+// Parses the common plain decimal numbers (like -12.345) without going through strtof, which is slow on the target,
+// anything else, like an exponent, is handed to strtof so the result is the same as it always was
+static float parse_number(const char *p, char **end)
+{
+    static const float powers[]= {1e0F, 1e1F, 1e2F, 1e3F, 1e4F, 1e5F, 1e6F, 1e7F, 1e8F, 1e9F, 1e10F};
+    const char *s= p;
+
+    while(*s == ' ' || *s == '\t') s++;
+
+    bool neg= false;
+    if(*s == '-' || *s == '+') {
+        neg= (*s == '-');
+        s++;
+    }
+
+    uint32_t mantissa= 0;
+    int digits= 0;     // significant digits kept in mantissa
+    int scale= 0;      // power of ten to apply to mantissa
+    bool any= false;
+
+    for (; *s >= '0' && *s <= '9'; s++) {
+        any= true;
+        if(digits < 9) {
+            mantissa= mantissa * 10 + (*s - '0');
+            if(mantissa != 0) digits++;
+        } else {
+            scale++;
         }
     }
-    return false;
+
+    if(*s == '.') {
+        s++;
+        for (; *s >= '0' && *s <= '9'; s++) {
+            any= true;
+            if(digits < 9) {
+                mantissa= mantissa * 10 + (*s - '0');
+                if(mantissa != 0) digits++;
+                scale--;
+            }
+        }
+    }
+
+    if(!any || *s == 'e' || *s == 'E' || scale < -10 || scale > 10) {
+        return strtof(p, end);
+    }
+
+    *end= (char *)s;
+    float v= scale < 0 ? (float)mantissa / powers[-scale] : (float)mantissa * powers[scale];
+    return neg ? -v : v;
 }
 
-// Retrieve the value for a given letter
-float Gcode::get_value( char letter, char **ptr ) const
+// One pass over the command, records which letters are present and parses the first number found after each of them
+void Gcode::tokenize()
+{
+    letters= 0;
+    valued= 0;
+    arg_letters= 0;
+    num_args= 0;
+
+    for (const char *p = command; *p; ++p) {
+        char c= *p;
+        if(c < 'A' || c > 'Z') continue;
+
+        int i= c - 'A';
+        uint32_t bit= 1 << i;
+        letters |= bit;
+
+        // when not stripped the first character is the G or M itself
+        if(c != 'T' && (stripped || p != command)) {
+            arg_letters |= bit;
+            ++num_args;
+        }
+
+        if(valued & bit) continue;
+
+        char *e;
+        float v= parse_number(p + 1, &e);
+        if(e > p + 1) {
+            valued |= bit;
+            values[i]= v;
+            offsets[i]= p + 1 - command;
+        }
+    }
+}
+
+// adds a letter and its value as if it had been parsed
+void Gcode::set_value(char letter, float value)
+{
+    int i= letter - 'A';
+    uint32_t bit= 1 << i;
+    if((arg_letters & bit) == 0 && letter != 'T') {
+        arg_letters |= bit;
+        ++num_args;
+    }
+    letters |= bit;
+    valued |= bit;
+    values[i]= value;
+    offsets[i]= no_text;
+}
+
+static inline bool is_table_letter(char letter)
+{
+    return letter >= 'A' && letter <= 'Z';
+}
+
+// used for anything that is not in the table, like the * checksum
+static float scan_value(const char *cs, char letter, char **ptr)
 {
-    const char *cs = command;
     char *cn = NULL;
     for (; *cs; cs++) {
         if( letter == *cs ) {
@@ -96,14 +244,13 @@ float Gcode::get_value( char letter, char **ptr ) const
     return 0;
 }
 
-int Gcode::get_int( char letter, char **ptr ) const
+static long scan_int(const char *cs, char letter, char **ptr, bool is_unsigned)
 {
-    const char *cs = command;
     char *cn = NULL;
     for (; *cs; cs++) {
         if( letter == *cs ) {
             cs++;
-            int r = strtol(cs, &cn, 10);
+            long r = is_unsigned ? strtoul(cs, &cn, 10) : strtol(cs, &cn, 10);
             if(ptr != nullptr) *ptr= cn;
             if (cn > cs)
                 return r;
@@ -113,43 +260,97 @@ int Gcode::get_int( char letter, char **ptr ) const
     return 0;
 }
 
+// Whether or not a Gcode has a letter
+bool Gcode::has_letter( char letter ) const
+{
+    if(is_table_letter(letter)) {
+        return (letters & (1 << (letter - 'A'))) != 0;
+    }
+    return letter != '\0' && strchr(command, letter) != nullptr;
+}
+
+// Retrieve the value for a given letter
+float Gcode::get_value( char letter, char **ptr ) const
+{
+    if(!is_table_letter(letter)) return scan_value(command, letter, ptr);
+
+    int i= letter - 'A';
+    if((valued & (1 << i)) == 0) {
+        if(ptr != nullptr) *ptr= nullptr;
+        return 0;
+    }
+
+    if(ptr != nullptr) {
+        if(offsets[i] == no_text) *ptr= nullptr;
+        else strtof(command + offsets[i], ptr);
+    }
+    return values[i];
+}
+
+int Gcode::get_int( char letter, char **ptr ) const
+{
+    if(!is_table_letter(letter)) return scan_int(command, letter, ptr, false);
+
+    int i= letter - 'A';
+    if((valued & (1 << i)) == 0) {
+        if(ptr != nullptr) *ptr= nullptr;
+        return 0;
+    }
+
+    if(offsets[i] == no_text) {
+        if(ptr != nullptr) *ptr= nullptr;
+        return values[i];
+    }
+
+    const char *cs= command + offsets[i];
+    char *cn;
+    int r = strtol(cs, &cn, 10);
+    if(cn > cs) {
+        if(ptr != nullptr) *ptr= cn;
+        return r;
+    }
+
+    // a float like .5 that is not an integer, look further along like the string scan does
+    return scan_int(cs, letter, ptr, false);
+}
+
 uint32_t Gcode::get_uint( char letter, char **ptr ) const
 {
-    const char *cs = command;
-    char *cn = NULL;
-    for (; *cs; cs++) {
-        if( letter == *cs ) {
-            cs++;
-            int r = strtoul(cs, &cn, 10);
-            if(ptr != nullptr) *ptr= cn;
-            if (cn > cs)
-                return r;
-        }
+    if(!is_table_letter(letter)) return scan_int(command, letter, ptr, true);
+
+    int i= letter - 'A';
+    if((valued & (1 << i)) == 0) {
+        if(ptr != nullptr) *ptr= nullptr;
+        return 0;
     }
-    if(ptr != nullptr) *ptr= nullptr;
-    return 0;
+
+    if(offsets[i] == no_text) {
+        if(ptr != nullptr) *ptr= nullptr;
+        return values[i];
+    }
+
+    const char *cs= command + offsets[i];
+    char *cn;
+    uint32_t r = strtoul(cs, &cn, 10);
+    if(cn > cs) {
+        if(ptr != nullptr) *ptr= cn;
+        return r;
+    }
+
+    return scan_int(cs, letter, ptr, true);
 }
 
 int Gcode::get_num_args() const
 {
-    int count = 0;
-    for(size_t i = stripped?0:1; i < strlen(command); i++) {
-        if( this->command[i] >= 'A' && this->command[i] <= 'Z' ) {
-            if(this->command[i] == 'T') continue;
-            count++;
-        }
-    }
-    return count;
+    return num_args;
 }
 
 std::map<char,float> Gcode::get_args() const
 {
     std::map<char,float> m;
-    for(size_t i = stripped?0:1; i < strlen(command); i++) {
-        char c= this->command[i];
-        if( c >= 'A' && c <= 'Z' ) {
-            if(c == 'T') continue;
-            m[c]= get_value(c);
+    for (int i = 0; i < 26; ++i) {
+        if(arg_letters & (1 << i)) {
+            m['A' + i]= (valued & (1 << i)) ? values[i] : 0;
         }
     }
     return m;
@@ -158,11 +359,9 @@ std::map<char,float> Gcode::get_args() const
 std::map<char,int> Gcode::get_args_int() const
 {
     std::map<char,int> m;
-    for(size_t i = stripped?0:1; i < strlen(command); i++) {
-        char c= this->command[i];
-        if( c >= 'A' && c <= 'Z' ) {
-            if(c == 'T') continue;
-            m[c]= get_int(c);
+    for (int i = 0; i < 26; ++i) {
+        if(arg_letters & (1 << i)) {
+            m['A' + i]= get_int('A' + i);
         }
     }
     return m;
@@ -172,17 +371,19 @@ std::map<char,int> Gcode::get_args_int() const
 void Gcode::prepare_cached_values(bool strip)
 {
     char *p= nullptr;
-    if( this->has_letter('G') ) {
+    const char *c= strchr(command, 'G');
+    if( c != nullptr ) {
         this->has_g = true;
-        this->g = this->get_int('G', &p);
+        this->g = scan_int(c, 'G', &p, false);
 
     } else {
         this->has_g = false;
     }
 
-    if( this->has_letter('M') ) {
+    c= strchr(command, 'M');
+    if( c != nullptr ) {
         this->has_m = true;
-        this->m = this->get_int('M', &p);
+        this->m = scan_int(c, 'M', &p, false);
 
     } else {
         this->has_m = false;
@@ -198,29 +399,28 @@ void Gcode::prepare_cached_values(bool strip)
         }
     }
 
-    if(!strip) return;
-
-    // remove the Gxxx or Mxxx from string
-    if (p != nullptr) {
-        char *n= strdup(p); // create new string starting at end of the numeric value
-        free(command);
-        command= n;
+    // remove the Gxxx or Mxxx from string, it is moved down in place so no new copy is needed
+    if (strip && p != nullptr) {
+        memmove(command, p, strlen(p) + 1);
     }
+
+    tokenize();
 }
 
 // strip off X Y Z I J K parameters if G0/1/2/3
 void Gcode::strip_parameters()
 {
     if(has_g && g < 4){
-        // strip the command of the XYZIJK parameters
-        string newcmd;
+        // strip the command of the XYZIJK parameters, the result is never longer so it is done in place
+        char *out= command;
         char *cn= command;
         // find the start of each parameter
         char *pch= strpbrk(cn, "XYZIJK");
         while (pch != nullptr) {
             if(pch > cn) {
-                // copy non parameters to new string
-                newcmd.append(cn, pch-cn);
+                // copy non parameters down
+                memmove(out, cn, pch-cn);
+                out += pch-cn;
             }
             // find the end of the parameter and its value
             char *eos;
@@ -229,14 +429,11 @@ void Gcode::strip_parameters()
             pch= strpbrk(cn, "XYZIJK"); // find next parameter
         }
         // append anything left on the line
-        newcmd.append(cn);
+        memmove(out, cn, strlen(cn) + 1);
 
         // strip whitespace to save even more, this causes problems so don't do it
         //newcmd.erase(std::remove_if(newcmd.begin(), newcmd.end(), ::isspace), newcmd.end());
 
-        // release the old one
-        free(command);
-        // copy the new shortened one
-        command= strdup(newcmd.c_str());
+        tokenize();
     }
 }
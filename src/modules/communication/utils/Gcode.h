@@ -10,6 +10,8 @@
 #define GCODE_H
 #include <string>
 #include <map>
+#include <stdint.h>
+#include <stddef.h>
 
 using std::string;
 
@@ -19,6 +21,9 @@ class StreamOutput;
 class Gcode {
     public:
         Gcode(const string&, StreamOutput*, bool strip=true);
+        Gcode(const char *cmd, StreamOutput*, bool strip=true);
+        Gcode(const char *cmd, size_t len, StreamOutput*, bool strip=true);
+        Gcode(char code, unsigned int number, StreamOutput*);
         Gcode(const Gcode& to_copy);
         Gcode& operator= (const Gcode& to_copy);
         ~Gcode();
@@ -32,6 +37,7 @@ class Gcode {
         std::map<char,float> get_args() const;
         std::map<char,int> get_args_int() const;
         void strip_parameters();
+        void set_value(char letter, float value);
 
         // FIXME these should be private
         unsigned int m;
@@ -50,7 +56,21 @@ class Gcode {
         string txt_after_ok;
 
     private:
+        void set_command(const char *cmd, size_t len);
         void prepare_cached_values(bool strip=true);
-        char *command;
+        void tokenize();
+        void copy_table(const Gcode& to_copy);
+
+        char *command;          // points to buffer, or to the heap if the command does not fit in it
+        char buffer[64];
+
+        // filled in once by tokenize() so looking up a letter does not have to scan the command
+        uint32_t letters;       // bit per letter A-Z found in the command
+        uint32_t valued;        // bit per letter A-Z followed by a number
+        uint32_t arg_letters;   // letters counted as arguments (not T, not the leading G or M if not stripped)
+        uint16_t num_args;
+        float values[26];
+        uint16_t offsets[26];   // where the number after the letter starts, for get_int() and get_uint()
+        static const uint16_t no_text= 0xFFFF; // the value was set with set_value(), there is no number in the command
 };
 #endif
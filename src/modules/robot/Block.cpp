@@ -26,6 +26,7 @@ using std::string;
 #define STEP_TICKER_FREQUENCY_2 (STEP_TICKER_FREQUENCY*STEP_TICKER_FREQUENCY)
 
 uint8_t Block::n_actuators= 0;
+float Block::jerk_limit= 0.0F;
 
 // A block represents a movement, it's length for each stepper motor, and the corresponding acceleration curves.
 // It's stacked on a queue, and that queue is then executed in order, to move the motors.
@@ -60,11 +61,15 @@ void Block::clear()
     is_ticking          = false;
     is_g123             = false;
     locked              = false;
+    s_curve             = false;
     s_value             = 0.0F;
+    n_actions           = 0;
 
     acceleration_per_tick= 0;
     deceleration_per_tick= 0;
     total_move_ticks= 0;
+    n_active_motors= 0;
+    step_loops= 1;
     if(tick_info.size() != n_actuators) {
         tick_info.resize(n_actuators);
     }
@@ -78,6 +83,10 @@ void Block::clear()
         i.step_count= 0;
         i.next_accel_event= 0;
     }
+
+    if(jerk_limit > 0.0F && jerk_info.size() != n_actuators) {
+        jerk_info.resize(n_actuators);
+    }
 }
 
 void Block::debug() const
@@ -213,15 +222,131 @@ void Block::calculate_trapezoid( float entryspeed, float exitspeed )
     this->initial_rate = initial_rate;
     this->exit_speed = exitspeed;
 
+    this->s_curve = (jerk_limit > 0.0F && !this->jerk_info.empty());
+    if(this->s_curve) {
+        calculate_s_curve(final_rate);
+    }
+
     // prepare the block for stepticker
     this->prepare();
     this->locked= false;
 }
 
+// Works out the length in ticks of the two jerk phases of a ramp that changes the rate by delta steps/sec in ramp_ticks,
+// they last acceleration/jerk with constant acceleration in between, if the ramp is too short for that the acceleration
+// becomes a triangle. jerk_per_tick is set to the jerk that gives exactly delta, in steps/tick³. With ramp_ticks from
+// s_curve_time() that keeps the peak at acceleration and the jerk at jerk
+static uint32_t s_curve_ramp(float delta, uint32_t ramp_ticks, float acceleration, float jerk, float &jerk_per_tick)
+{
+    jerk_per_tick = 0;
+    if(ramp_ticks < 2 || delta <= 0.0F) return 0;
+
+    uint32_t n = roundf((acceleration / jerk) * STEP_TICKER_FREQUENCY);
+    if(n < 1) n = 1;
+    if(n > ramp_ticks / 2) n = ramp_ticks / 2;
+
+    jerk_per_tick = (delta / STEP_TICKER_FREQUENCY) / ((float)n * (ramp_ticks - n));
+    return n;
+}
+
+// Replaces the trapezoid worked out by calculate_trapezoid() with a 7 phase S-curve, the acceleration changes at no more
+// than jerk_limit and goes no higher than the block's acceleration, so the ramps are longer than the trapezoid's and the
+// plateau is shorter or the maximum rate lower. The planner allows for the longer ramps through max_allowable_speed()
+void Block::calculate_s_curve(float final_rate)
+{
+    // the limits in steps of the primary axis, the same simplification as acceleration_per_second
+    float acceleration = (this->acceleration * this->steps_event_count) / this->millimeters;
+    float jerk = (jerk_limit * this->steps_event_count) / this->millimeters;
+    float initial_rate = this->initial_rate;
+
+    // steps taken by the ramps up to rate and down again
+    auto ramps_distance = [=](float rate) {
+        return ((initial_rate + rate) / 2.0F) * s_curve_time(rate - initial_rate, acceleration, jerk) +
+               ((rate + final_rate) / 2.0F) * s_curve_time(rate - final_rate, acceleration, jerk);
+    };
+
+    // the planner has made sure a single ramp from the entry to the exit rate fits, so halve the interval between that
+    // and the nominal rate until the rate the two ramps just fit in is known to well under a percent
+    float low = std::max(initial_rate, final_rate);
+    float high = std::max(low, this->nominal_rate);
+    if(ramps_distance(high) > this->steps_event_count) {
+        for (int i = 0; i < 12; ++i) {
+            float mid = (low + high) / 2.0F;
+            if(ramps_distance(mid) > this->steps_event_count) high = mid;
+            else low = mid;
+        }
+        high = low;
+    }
+    this->maximum_rate = high;
+
+    // rounded up so neither limit is exceeded
+    float time_to_accelerate = s_curve_time(this->maximum_rate - initial_rate, acceleration, jerk);
+    float time_to_decelerate = s_curve_time(this->maximum_rate - final_rate, acceleration, jerk);
+    float plateau_time = (this->maximum_rate > 0.0F) ? (this->steps_event_count - ramps_distance(this->maximum_rate)) / this->maximum_rate : 0.0F;
+    uint32_t acceleration_ticks = ceilf(time_to_accelerate * STEP_TICKER_FREQUENCY);
+    uint32_t deceleration_ticks = ceilf(time_to_decelerate * STEP_TICKER_FREQUENCY);
+    uint32_t plateau_ticks = (plateau_time > 0.0F) ? floorf(plateau_time * STEP_TICKER_FREQUENCY) : 0;
+
+    this->accelerate_until = acceleration_ticks;
+    this->decelerate_after = acceleration_ticks + plateau_ticks;
+    this->total_move_ticks = acceleration_ticks + plateau_ticks + deceleration_ticks;
+
+    uint32_t na = s_curve_ramp(this->maximum_rate - initial_rate, acceleration_ticks, acceleration, jerk, this->acceleration_jerk_per_tick);
+    uint32_t nd = s_curve_ramp(this->maximum_rate - final_rate, deceleration_ticks, acceleration, jerk, this->deceleration_jerk_per_tick);
+
+    this->jerk_phase_end[0] = na;
+    this->jerk_phase_end[1] = this->accelerate_until - na;
+    this->jerk_phase_end[2] = this->accelerate_until;
+    this->jerk_phase_end[3] = this->decelerate_after;
+    this->jerk_phase_end[4] = this->decelerate_after + nd;
+    this->jerk_phase_end[5] = this->total_move_ticks - nd;
+    this->jerk_phase_end[6] = this->total_move_ticks;
+}
+
+// The time an S-curve ramp takes to change the speed by delta with the acceleration going no higher than acceleration
+// and changing no faster than jerk. Up to a change of acceleration²/jerk the acceleration never gets to its limit and
+// is a triangle. Works in mm or in steps, the distance covered is the average of the two speeds times this
+float Block::s_curve_time(float delta, float acceleration, float jerk)
+{
+    if(delta <= 0.0F) return 0.0F;
+    if(delta * jerk >= acceleration * acceleration) return delta / acceleration + acceleration / jerk;
+    return 2.0F * sqrtf(delta / jerk);
+}
+
+// The highest speed an S-curve ramp can get down to target_velocity from within distance, the inverse of the distance
+// from s_curve_time(). It is quadratic in the change of speed when the acceleration gets to its limit, and cubic in
+// the square root of it when it does not
+float Block::s_curve_max_speed(float acceleration, float jerk, float target_velocity, float distance)
+{
+    if(distance <= 0.0F) return target_velocity;
+    float a2j = acceleration * acceleration / jerk; // the change of speed at which the acceleration gets to its limit
+
+    float delta;
+    if(distance >= (2.0F * target_velocity + a2j) * acceleration / jerk) {
+        // delta² + (2v + a²/j)delta + 2v a²/j - 2 d a = 0
+        float b = 2.0F * target_velocity + a2j;
+        float c = 2.0F * (target_velocity * a2j - distance * acceleration);
+        delta = (sqrtf(b * b - 4.0F * c) - b) / 2.0F;
+
+    } else {
+        // u³ + 2v u - d sqrt(j) = 0 with delta = u², which has the one real root from Cardano's formula, then a
+        // Newton step to take out the rounding when v is large
+        float s = distance * sqrtf(jerk) / 2.0F;
+        float p3 = 2.0F * target_velocity / 3.0F;
+        float w = cbrtf(s + sqrtf(s * s + p3 * p3 * p3));
+        float u = w - p3 / w;
+        u -= (u * u * u + 3.0F * p3 * u - 2.0F * s) / (3.0F * u * u + 3.0F * p3);
+        delta = u * u;
+    }
+
+    return target_velocity + delta;
+}
+
 // Calculates the maximum allowable speed at this point when you must be able to reach target_velocity using the
-// acceleration within the allotted distance.
+// acceleration within the allotted distance, with S-curve ramps when jerk_limit is set.
 float Block::max_allowable_speed(float acceleration, float target_velocity, float distance)
 {
+    if(jerk_limit > 0.0F) return s_curve_max_speed(fabsf(acceleration), jerk_limit, target_velocity, distance);
     return sqrtf(target_velocity * target_velocity - 2.0F * acceleration * distance);
 }
 
@@ -300,11 +425,15 @@ float Block::max_exit_speed()
 void Block::prepare()
 {
     float inv = 1.0F / this->steps_event_count;
+    this->n_active_motors = 0;
+    this->step_loops = THEKERNEL->step_ticker->get_step_loops(this->maximum_rate);
     for (uint8_t m = 0; m < n_actuators; m++) {
         uint32_t steps = this->steps[m];
         this->tick_info[m].steps_to_move = steps;
         if(steps == 0) continue;
 
+        this->active_motors[this->n_active_motors++] = m;
+
         float aratio = inv * steps;
         this->tick_info[m].steps_per_tick = STEPTICKER_TOFP((this->initial_rate * aratio) / STEP_TICKER_FREQUENCY); // steps/sec / tick frequency to get steps per tick in 2.30 fixed point
         this->tick_info[m].counter = 0; // 2.30 fixed point
@@ -329,7 +458,47 @@ void Block::prepare()
         this->tick_info[m].acceleration_change= STEPTICKER_TOFP(acceleration_change * aratio);
         this->tick_info[m].deceleration_change= -STEPTICKER_TOFP(this->deceleration_per_tick * aratio);
         this->tick_info[m].plateau_rate= STEPTICKER_TOFP((this->maximum_rate * aratio) / STEP_TICKER_FREQUENCY);
+
+        if(this->s_curve) {
+            this->jerk_info[m].acceleration= 0;
+            this->jerk_info[m].acceleration_jerk= STEPTICKER_JERK_TOFP(this->acceleration_jerk_per_tick * aratio);
+            this->jerk_info[m].deceleration_jerk= STEPTICKER_JERK_TOFP(this->deceleration_jerk_per_tick * aratio);
+            this->jerk_info[m].phase= 0;
+            this->jerk_info[m].jerk= 0;
+            // the trapezoid acceleration is not used
+            this->tick_info[m].acceleration_change= 0;
+            jerk_phase(m, 0);
+        }
+    }
+}
+
+// Moves the S-curve for this motor on to the phase the given tick is in, and sets the jerk and the tick of the next
+// phase change. Called from prepare() and by the step ticker when next_accel_event is reached
+void Block::jerk_phase(uint8_t m, uint32_t tick)
+{
+    tickinfo_t &ti = this->tick_info[m];
+    jerkinfo_t &ji = this->jerk_info[m];
+
+    uint8_t p = ji.phase;
+    while(p < JERK_PHASES && tick >= this->jerk_phase_end[p]) ++p;
+
+    switch(p) {
+        case 0: ji.jerk = ji.acceleration_jerk; break;
+        case 2: ji.jerk = -ji.acceleration_jerk; break;
+        case 4: ji.jerk = -ji.deceleration_jerk; break;
+        case 6: ji.jerk = ji.deceleration_jerk; break;
+        default: ji.jerk = 0; break; // constant acceleration, plateau or done
+    }
+
+    if(p >= 3 && ji.phase < 3) {
+        // the acceleration ramp is over, start the plateau at exactly the plateau rate to remove any rounding errors
+        ji.acceleration = 0;
+        if(p == 3) ti.steps_per_tick = ti.plateau_rate;
     }
+    if(p == JERK_PHASES) ji.acceleration = 0;
+
+    ji.phase = p;
+    ti.next_accel_event = (p < JERK_PHASES) ? this->jerk_phase_end[p] : UINT32_MAX;
 }
 
 // returns current rate (steps/sec) for the given actuator
@@ -16,6 +16,8 @@ class Block {
         Block();
         void calculate_trapezoid( float entry_speed, float exit_speed );
         float max_allowable_speed( float acceleration, float target_velocity, float distance);
+        static float s_curve_time(float delta, float acceleration, float jerk);
+        static float s_curve_max_speed(float acceleration, float jerk, float target_velocity, float distance);
 
         float reverse_pass(float exit_speed);
         float forward_pass(float next_entry_speed);
@@ -24,6 +26,8 @@ class Block {
         void ready() { is_ready= true; }
         void clear();
         void prepare();
+        void calculate_s_curve(float final_rate);
+        void jerk_phase(uint8_t m, uint32_t tick);
 
         float get_trapezoid_rate(int i) const;
 
@@ -40,6 +44,8 @@ class Block {
 
         float acceleration_per_tick{0};
         float deceleration_per_tick {0};
+        float acceleration_jerk_per_tick{0};
+        float deceleration_jerk_per_tick{0};
 
         float max_entry_speed;
 
@@ -49,6 +55,16 @@ class Block {
         uint32_t total_move_ticks;
         std::bitset<k_max_actuators> direction_bits;     // Direction for each axis in bit form, relative to the direction port's mask
 
+        // the motors that have steps in this block, the step ticker removes them as they finish
+        uint8_t active_motors[k_max_actuators];
+        uint8_t n_active_motors;
+        uint8_t step_loops;       // ticks per step ticker interrupt
+
+        // S-curve profile, the tick at which each of the 7 phases ends
+        // jerk up, constant acceleration, jerk down, plateau, jerk down, constant deceleration, jerk up
+        enum { JERK_PHASES= 7 };
+        uint32_t jerk_phase_end[JERK_PHASES];
+
         // this is the data needed to determine when each motor needs to be issued a step
         using tickinfo_t= struct {
             int32_t steps_per_tick; // 2.30 fixed point
@@ -66,6 +82,17 @@ class Block {
         std::vector<tickinfo_t> tick_info;
         static uint8_t n_actuators;
 
+        // the extra data needed for S-curve ramps, only allocated when planner.jerk_limit is set
+        using jerkinfo_t= struct {
+            int64_t acceleration; // 2.62 fixed point signed
+            int64_t jerk; // 2.62 fixed point signed, for the current phase
+            int64_t acceleration_jerk; // 2.62 fixed point
+            int64_t deceleration_jerk; // 2.62 fixed point
+            uint8_t phase;
+        };
+        std::vector<jerkinfo_t> jerk_info;
+        static float jerk_limit; // in mm/s³, 0 uses trapezoids
+
         struct {
             bool recalculate_flag:1;             // Planner flag to recalculate trapezoids on entry junction
             bool nominal_length_flag:1;          // Planner flag for nominal speed always reached
@@ -74,6 +101,9 @@ class Block {
             bool is_g123:1;                      // set if this is a G1, G2 or G3
             volatile bool is_ticking:1;          // set when this block is being actively ticked by the stepticker
             volatile bool locked:1;              // set to true when the critical data is being updated, stepticker will have to skip if this is set
+            bool s_curve:1;                      // set if the step ticker has to use jerk_info for this block
             uint16_t s_value:12;                 // for laser 1.11 Fixed point
+            uint8_t n_actions:4;                 // actions queued by Conveyor::queue_action() to be done as this starts
         };
+        static const uint8_t max_actions= 15;
 };
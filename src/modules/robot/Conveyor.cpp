@@ -92,6 +92,9 @@ void Conveyor::on_halt(void* argument)
     if(argument == nullptr) {
         halted = true;
         flush_queue();
+
+        // the actions of the blocks flushed went with them, and those waiting for a block will not get one
+        for(; pending_actions > 0; --pending_actions) actions.head= actions.prev_block_index(actions.head);
     } else {
         halted = false;
     }
@@ -103,6 +106,22 @@ void Conveyor::on_idle(void*)
         check_queue();
     }
 
+    // actions that no block came for are done once the moves queued before them have finished
+    if(pending_actions > 0 && !halted && is_idle()) {
+        apply_actions(pending_actions);
+        pending_actions= 0;
+    }
+
+    // segments held by the planner for merging are released if the step ticker is about to run out of blocks,
+    // or if they have waited as long as the queue would
+    Planner *planner= THEKERNEL->planner;
+    if(planner != nullptr && planner->is_merging()) {
+        unsigned int ahead= (queue.head_i + queue.length - queue.isr_tail_i) % queue.length;
+        if(ahead <= 1 || planner->get_merge_age_us() >= queue_delay_time_ms * 1000) {
+            planner->flush_merge();
+        }
+    }
+
     // we can garbage collect the block queue here
     if (queue.tail_i != queue.isr_tail_i) {
         if (queue.is_empty()) {
@@ -122,6 +141,8 @@ void Conveyor::on_idle(void*)
 // checks that all motors are no longer moving
 bool Conveyor::is_idle() const
 {
+    if(THEKERNEL->planner != nullptr && THEKERNEL->planner->is_merging()) return false;
+
     if(queue.is_empty()) {
         for(auto &a : THEROBOT->actuators) {
             if(a->is_moving()) return false;
@@ -135,6 +156,9 @@ bool Conveyor::is_idle() const
 // Wait for the queue to be empty and for all the jobs to finish in step ticker
 void Conveyor::wait_for_idle(bool wait_for_motors)
 {
+    // anything the planner is holding back to merge has to be queued first
+    if(THEKERNEL->planner != nullptr) THEKERNEL->planner->flush_merge();
+
     // wait for the job queue to empty, this means cycling everything on the block queue into the job queue
     // forcing them to be jobs
     running = false; // stops on_idle calling check_queue
@@ -148,12 +172,62 @@ void Conveyor::wait_for_idle(bool wait_for_motors)
         while(!is_idle()) {
             THEKERNEL->call_event(ON_IDLE, this);
         }
+
+        // everything queued has finished, so actions waiting for another block are done now
+        if(pending_actions > 0 && !halted) {
+            apply_actions(pending_actions);
+            pending_actions= 0;
+        }
     }
 
+    // the step ticker ran out of blocks because we waited for it to, the next block is not late
+    THEKERNEL->step_ticker->clear_starving();
+
     running = true;
     // returning now means that everything has totally finished
 }
 
+void Conveyor::queue_action(BlockActionTarget *target, uint8_t action, float value)
+{
+    if(halted) return;
+
+    // segments held for merging were before this, they cannot be part of the block it goes with
+    if(THEKERNEL->planner != nullptr) THEKERNEL->planner->flush_merge();
+
+    // a block can only carry so many, those have to wait for the moves before them to finish
+    if(pending_actions == Block::max_actions) wait_for_idle();
+
+    if(pending_actions == 0 && is_idle()) {
+        target->block_action(action, value);
+        return;
+    }
+
+    // the ring is shared with the actions of queued blocks, which make room as they start
+    while(actions.size() == actions.capacity()) {
+        THEKERNEL->call_event(ON_IDLE, this);
+        if(halted) return;
+    }
+
+    actions.push_back({target, value, action});
+    ++pending_actions;
+}
+
+// called from the step ticker ISR as a block starts, or from the main loop when nothing is moving
+void Conveyor::apply_actions(uint8_t n)
+{
+    for(; n > 0; --n) {
+        action_t a;
+        actions.pop_front(a);
+        a.target->block_action(a.action, a.value);
+    }
+}
+
+// called from the step ticker ISR for blocks that are flushed before they start
+void Conveyor::discard_actions(uint8_t n)
+{
+    for(; n > 0; --n) actions.delete_tail();
+}
+
 /*
  * push the pre-prepared head block onto the queue
  */
@@ -172,6 +246,10 @@ void Conveyor::queue_head_block()
         return; // if we got a halt then we are done here
     }
 
+    // the actions queued since the last block are done as this one starts
+    queue.head_ref()->n_actions= pending_actions;
+    pending_actions= 0;
+
     queue.produce_head();
 
     // not sure if this is the correct place but we need to turn on the motors if they were not already on
@@ -203,6 +281,8 @@ bool Conveyor::get_next_block(Block **block)
     // mark entire queue for GC if flush flag is asserted
     if (flush){
         while (queue.isr_tail_i != queue.head_i) {
+            Block *b= queue.item_ref(queue.isr_tail_i);
+            if(!b->is_ticking) discard_actions(b->n_actions);
             queue.isr_tail_i = queue.next(queue.isr_tail_i);
         }
     }
@@ -224,6 +304,12 @@ bool Conveyor::get_next_block(Block **block)
         b->recalculate_flag= false;
         this->current_feedrate= b->nominal_speed;
         *block= b;
+
+        // this is where the block begins, so whatever was queued between the last block and this one is done now
+        if(b->n_actions > 0) apply_actions(b->n_actions);
+
+        unsigned int depth= queue.head_i >= queue.isr_tail_i ? queue.head_i - queue.isr_tail_i : queue.head_i + queue.length - queue.isr_tail_i;
+        ++depth_histogram[depth * depth_histogram.size() / queue.length];
         return true;
     }
 
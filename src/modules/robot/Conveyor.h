@@ -8,15 +8,26 @@
 #pragma once
 
 #include "libs/Module.h"
+#include "libs/RingBuffer.h"
 #include "HeapRing.h"
 
 using namespace std;
 #include <string>
 #include <vector>
+#include <array>
 
 class Gcode;
 class Block;
 
+// a module that has things done in step with the moves, see Conveyor::queue_action()
+class BlockActionTarget
+{
+public:
+    // called from the step ticker interrupt as the block it was queued before starts, or from the main loop if
+    // nothing was moving when it was queued, so it must be quick
+    virtual void block_action(uint8_t action, float value)= 0;
+};
+
 class Conveyor : public Module
 {
 public:
@@ -28,8 +39,12 @@ public:
     void on_halt(void *);
 
     void wait_for_idle(bool wait_for_motors=true);
+    // has target do action when the next block queued starts, so a change between two moves happens between them
+    // without the queue being drained, or straight away if nothing is queued or moving
+    void queue_action(BlockActionTarget *target, uint8_t action, float value);
     bool is_queue_empty() { return queue.is_empty(); };
     bool is_queue_full() { return queue.is_full(); };
+    unsigned int get_free_blocks() const { return queue.free_count(); }
     bool is_idle() const;
 
     // returns next available block writes it to block and returns true
@@ -40,12 +55,19 @@ public:
     void flush_queue(void);
     float get_current_feedrate() const { return current_feedrate; }
 
+    // number of blocks queued when the step ticker took each block, in eighths of the queue, read by the stats command
+    const std::array<uint32_t, 8>& get_depth_histogram() const { return depth_histogram; }
+    size_t get_queue_size() const { return queue_size; }
+    void reset_stats() { depth_histogram.fill(0); }
+
     friend class Planner; // for queue
 
 private:
     // void all_moves_finished();
     void check_queue(bool force= false);
     void queue_head_block(void);
+    void apply_actions(uint8_t n);
+    void discard_actions(uint8_t n);
 
     using  Queue_t= HeapRing<Block>;
     Queue_t queue;  // Queue of Blocks
@@ -54,6 +76,16 @@ private:
     uint32_t queue_delay_time_ms;
     size_t queue_size;
     float current_feedrate{0}; // actual nominal feedrate that current block is running at in mm/sec
+    std::array<uint32_t, 8> depth_histogram{};
+
+    // actions in the order they were queued, each block that has some takes them off the front as it starts
+    struct action_t {
+        BlockActionTarget *target;
+        float value;
+        uint8_t action;
+    };
+    RingBuffer<action_t, 16> actions;
+    uint8_t pending_actions{0}; // at the back of actions, for the next block queued
 
     struct {
         volatile bool running:1;
@@ -23,12 +23,17 @@ using namespace std;
 #include "Robot.h"
 #include "ConfigValue.h"
 
+#include "us_ticker_api.h" // mbed
+
 #include <math.h>
 #include <algorithm>
 
 #define junction_deviation_checksum    CHECKSUM("junction_deviation")
 #define z_junction_deviation_checksum  CHECKSUM("z_junction_deviation")
 #define minimum_planner_speed_checksum CHECKSUM("minimum_planner_speed")
+#define planner_checksum               CHECKSUM("planner")
+#define merge_tolerance_checksum       CHECKSUM("merge_tolerance")
+#define jerk_limit_checksum            CHECKSUM("jerk_limit")
 
 // The Planner does the acceleration math for the queue of Blocks ( movements ).
 // It makes sure the speed stays within the configured constraints ( acceleration, junction_deviation, etc )
@@ -46,32 +51,168 @@ void Planner::config_load()
     this->junction_deviation = THEKERNEL->config->value(junction_deviation_checksum)->by_default(0.05F)->as_number();
     this->z_junction_deviation = THEKERNEL->config->value(z_junction_deviation_checksum)->by_default(NAN)->as_number(); // disabled by default
     this->minimum_planner_speed = THEKERNEL->config->value(minimum_planner_speed_checksum)->by_default(0.0f)->as_number();
+
+    // merge runs of nearly collinear segments into one block if they stay within this distance of the merged line
+    this->merge_tolerance = THEKERNEL->config->value(planner_checksum, merge_tolerance_checksum)->by_default(0.0f)->as_number();
+    if(this->merge_tolerance > 0.0F && this->merge == nullptr) {
+        this->merge = new merge_t;
+    }
+
+    // use S-curve acceleration ramps that change the acceleration no faster than this (mm/s³), 0 uses trapezoids
+    Block::jerk_limit = THEKERNEL->config->value(planner_checksum, jerk_limit_checksum)->by_default(0.0f)->as_number();
 }
 
 
 // Append a block to the queue, compute it's speed factors
-bool Planner::append_block( ActuatorCoordinates &actuator_pos, uint8_t n_motors, float rate_mm_s, float distance, float *unit_vec, float acceleration, float s_value, bool g123)
+// If merging is enabled primary axis moves are held, and a run of them that stays within merge_tolerance of a straight line
+// is queued as one block. A block moves its actuators in a straight line, which is only a straight line in XYZ when the
+// arm solution is linear, so merging is only done when the caller gives the cartesian end of the move
+bool Planner::append_block( ActuatorCoordinates &actuator_pos, uint8_t n_motors, float rate_mm_s, float distance, float *unit_vec, float acceleration, float s_value, bool g123, const float *cartesian)
 {
-    // Create ( recycle ) a new block
-    Block* block = THECONVEYOR->queue.head_ref();
+    int32_t steps[n_motors];
+    float start[n_motors];
 
-    // Direction bits
     bool has_steps = false;
     for (size_t i = 0; i < n_motors; i++) {
-        int32_t steps = THEROBOT->actuators[i]->steps_to_target(actuator_pos[i]);
+        start[i] = THEROBOT->actuators[i]->get_last_milestone();
+        steps[i] = THEROBOT->actuators[i]->steps_to_target(actuator_pos[i]);
         // Update current position
-        if(steps != 0) {
-            THEROBOT->actuators[i]->update_last_milestones(actuator_pos[i], steps);
+        if(steps[i] != 0) {
+            THEROBOT->actuators[i]->update_last_milestones(actuator_pos[i], steps[i]);
             has_steps = true;
         }
+    }
+
+    // sometimes even though there is a detectable movement it turns out there are no steps to be had from such a small move
+    if(!has_steps) {
+        return false;
+    }
+
+    if(merge != nullptr && unit_vec != nullptr && cartesian != nullptr) {
+        if(merge_count > 0 && merge_count < max_merge_segments && can_merge(actuator_pos, cartesian, n_motors, rate_mm_s, distance, acceleration, s_value, g123)) {
+            // extend the run to the end of this segment
+            for (size_t i = 0; i < n_motors; i++) {
+                merge->steps[i] += steps[i];
+                merge->end[i] = actuator_pos[i];
+            }
+            memcpy(merge->cartesian_ends[merge_count], cartesian, sizeof(merge->cartesian_ends[0]));
+            merge->distance += distance;
+            memcpy(merge->exit_unit_vec, unit_vec, sizeof(merge->exit_unit_vec));
+            ++merge_count;
+            return true;
+        }
+
+        // start a new run with this segment
+        flush_merge();
+        for (size_t i = 0; i < n_motors; i++) {
+            merge->steps[i] = steps[i];
+            merge->start[i] = start[i];
+            merge->end[i] = actuator_pos[i];
+        }
+        for (size_t i = X_AXIS; i <= Z_AXIS; i++) {
+            merge->cartesian_start[i] = cartesian[i] - unit_vec[i] * distance;
+        }
+        memcpy(merge->cartesian_ends[0], cartesian, sizeof(merge->cartesian_ends[0]));
+        merge->distance = distance;
+        merge->rate_mm_s = rate_mm_s;
+        merge->acceleration = acceleration;
+        merge->s_value = s_value;
+        merge->g123 = g123;
+        merge->n_motors = n_motors;
+        memcpy(merge->entry_unit_vec, unit_vec, sizeof(merge->entry_unit_vec));
+        memcpy(merge->exit_unit_vec, unit_vec, sizeof(merge->exit_unit_vec));
+        merge->start_us = us_ticker_read();
+        merge_count = 1;
+        return true;
+    }
+
+    // anything held must go first
+    flush_merge();
+
+    return queue_block(steps, n_motors, rate_mm_s, distance, unit_vec, unit_vec, acceleration, s_value, g123);
+}
+
+// see if a segment ending at target can be added to the run being merged
+bool Planner::can_merge(const ActuatorCoordinates &target, const float *cartesian, uint8_t n_motors, float rate_mm_s, float distance, float acceleration, float s_value, bool g123) const
+{
+    // the laser power has to stay the same for the whole block, and so does the speed
+    if(n_motors != merge->n_motors || g123 != merge->g123 || s_value != merge->s_value) return false;
+    if(fabsf(rate_mm_s - merge->rate_mm_s) > 0.01F * merge->rate_mm_s) return false;
+    if(fabsf(acceleration - merge->acceleration) > 0.01F * merge->acceleration) return false;
+
+    // every segment end so far must be within merge_tolerance of the line from the start of the run to the new end
+    float line[3];
+    float len2 = 0;
+    for (size_t i = X_AXIS; i <= Z_AXIS; i++) {
+        line[i] = cartesian[i] - merge->cartesian_start[i];
+        len2 += line[i] * line[i];
+    }
+    if(len2 <= 0.0F) return false;
+
+    float tol2 = merge_tolerance * merge_tolerance;
+    for (size_t s = 0; s < merge_count; s++) {
+        float dot = 0;
+        for (size_t i = X_AXIS; i <= Z_AXIS; i++) {
+            dot += (merge->cartesian_ends[s][i] - merge->cartesian_start[i]) * line[i];
+        }
+        float t = std::max(0.0F, std::min(1.0F, dot / len2));
+
+        float d2 = 0;
+        for (size_t i = X_AXIS; i <= Z_AXIS; i++) {
+            float d = merge->cartesian_ends[s][i] - (merge->cartesian_start[i] + t * line[i]);
+            d2 += d * d;
+        }
+        if(d2 > tol2) return false;
+    }
+
+    // the extruders move in step with XYZ over the whole block, so they have to be moving at the same rate per mm
+    for (size_t i = E_AXIS; i < n_motors; i++) {
+        float run = (merge->end[i] - merge->start[i]) / merge->distance;
+        float segment = (target[i] - merge->end[i]) / distance;
+        if(fabsf(segment - run) > 0.01F * fabsf(run) + 0.00001F) return false;
+    }
+
+    return true;
+}
+
+// queue whatever is being merged
+void Planner::flush_merge()
+{
+    if(merge_count == 0) return;
+
+    // cleared first as queue_block() calls ON_IDLE while it waits for room, which may end up back here
+    merge_count = 0;
+
+    // the positions are corrected after a halt, there is nothing to queue
+    if(THEKERNEL->is_halted()) return;
+
+    queue_block(merge->steps, merge->n_motors, merge->rate_mm_s, merge->distance, merge->entry_unit_vec, merge->exit_unit_vec, merge->acceleration, merge->s_value, merge->g123);
+}
+
+uint32_t Planner::get_merge_age_us() const
+{
+    return merge_count > 0 ? us_ticker_read() - merge->start_us : 0;
+}
+
+// Fill in the head block with the steps for each actuator, plan it and queue it
+// entry_unit_vec is used for the junction with the previous block, exit_unit_vec for the junction with the next one
+bool Planner::queue_block(const int32_t *steps, uint8_t n_motors, float rate_mm_s, float distance, const float *entry_unit_vec, const float *exit_unit_vec, float acceleration, float s_value, bool g123)
+{
+    // Create ( recycle ) a new block
+    Block* block = THECONVEYOR->queue.head_ref();
+
+    // Direction bits
+    bool has_steps = false;
+    for (size_t i = 0; i < n_motors; i++) {
+        if(steps[i] != 0) has_steps = true;
 
         // find direction
-        block->direction_bits[i] = (steps < 0) ? 1 : 0;
+        block->direction_bits[i] = (steps[i] < 0) ? 1 : 0;
         // save actual steps in block
-        block->steps[i] = labs(steps);
+        block->steps[i] = labs(steps[i]);
     }
 
-    // sometimes even though there is a detectable movement it turns out there are no steps to be had from such a small move
+    // a merged run can end up back where it started
     if(!has_steps) {
         block->clear();
         return false;
@@ -133,16 +274,16 @@ bool Planner::append_block( ActuatorCoordinates &actuator_pos, uint8_t n_motors,
     float vmax_junction = minimum_planner_speed; // Set default max junction speed
 
     // if unit_vec was null then it was not a primary axis move so we skip the junction deviation stuff
-    if (unit_vec != nullptr && !THECONVEYOR->is_queue_empty()) {
+    if (entry_unit_vec != nullptr && !THECONVEYOR->is_queue_empty()) {
         Block *prev_block = THECONVEYOR->queue.item_ref(THECONVEYOR->queue.prev(THECONVEYOR->queue.head_i));
         float previous_nominal_speed = prev_block->primary_axis ? prev_block->nominal_speed : 0;
 
         if (junction_deviation > 0.0F && previous_nominal_speed > 0.0F) {
             // Compute cosine of angle between previous and current path. (prev_unit_vec is negative)
             // NOTE: Max junction velocity is computed without sin() or acos() by trig half angle identity.
-            float cos_theta = - this->previous_unit_vec[X_AXIS] * unit_vec[X_AXIS]
-                              - this->previous_unit_vec[Y_AXIS] * unit_vec[Y_AXIS]
-                              - this->previous_unit_vec[Z_AXIS] * unit_vec[Z_AXIS] ;
+            float cos_theta = - this->previous_unit_vec[X_AXIS] * entry_unit_vec[X_AXIS]
+                              - this->previous_unit_vec[Y_AXIS] * entry_unit_vec[Y_AXIS]
+                              - this->previous_unit_vec[Z_AXIS] * entry_unit_vec[Z_AXIS] ;
 
             // Skip and use default max junction speed for 0 degree acute junction.
             if (cos_theta < 0.95F) {
@@ -177,8 +318,8 @@ bool Planner::append_block( ActuatorCoordinates &actuator_pos, uint8_t n_motors,
     block->recalculate_flag = true;
 
     // Update previous path unit_vector and nominal speed
-    if(unit_vec != nullptr) {
-        memcpy(previous_unit_vec, unit_vec, sizeof(previous_unit_vec)); // previous_unit_vec[] = unit_vec[]
+    if(exit_unit_vec != nullptr) {
+        memcpy(previous_unit_vec, exit_unit_vec, sizeof(previous_unit_vec)); // previous_unit_vec[] = exit_unit_vec[]
     } else {
         memset(previous_unit_vec, 0, sizeof(previous_unit_vec));
     }
@@ -239,10 +380,22 @@ void Planner::recalculate()
     block_index = queue.head_i;
     current     = queue.item_ref(block_index);
 
+    ++recalculate_count;
+    ++recalculate_blocks;
+
     if (!queue.is_empty()) {
+        // blocks with recalculate_flag cleared are the planned watermark (the grbl planned pointer), their entry speed
+        // can no longer change so neither can anything before them
         while ((block_index != queue.tail_i) && current->recalculate_flag) {
+            float previous_entry_speed = current->entry_speed;
             entry_speed = current->reverse_pass(entry_speed);
 
+            // if a block that was already planned keeps its entry speed then the exit speed of the block before it
+            // has not changed, nothing further back can change either, so stop here and let the forward pass start from
+            // this block
+            if (block_index != queue.head_i && entry_speed == previous_entry_speed) break;
+
+            ++recalculate_blocks;
             block_index = queue.prev(block_index);
             current     = queue.item_ref(block_index);
         }
@@ -250,8 +403,8 @@ void Planner::recalculate()
         /*
          * Step 2:
          * now current points to either tail or first non-recalculate block
-         * and has not had its reverse_pass called
-         * or its calculate_trapezoid
+         * and has not had its reverse_pass called, or to a block whose entry speed the reverse pass left unchanged
+         * it has not had its calculate_trapezoid
          * entry_speed is set to the *exit* speed of current.
          * each block from current to head has its entry speed set to its max entry speed- limited by decel or nominal_rate
          */
@@ -286,6 +439,8 @@ void Planner::recalculate()
 // acceleration within the allotted distance.
 float Planner::max_allowable_speed(float acceleration, float target_velocity, float distance)
 {
+    // the ramps are longer with a jerk limit, the same as Block::max_allowable_speed()
+    if(Block::jerk_limit > 0.0F) return Block::s_curve_max_speed(fabsf(acceleration), Block::jerk_limit, target_velocity, distance);
     // Was acceleration*60*60*distance, in case this breaks, but here we prefer to use seconds instead of minutes
     return(sqrtf(target_velocity * target_velocity - 2.0F * acceleration * distance));
 }
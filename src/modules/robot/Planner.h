@@ -9,6 +9,8 @@
 #define PLANNER_H
 
 #include "ActuatorCoordinates.h"
+
+#include <stdint.h>
 class Block;
 
 class Planner
@@ -17,16 +19,54 @@ public:
     Planner();
     float max_allowable_speed( float acceleration, float target_velocity, float distance);
 
+    // segments being merged are held here until a segment that cannot be merged arrives, or this is called
+    void flush_merge();
+    bool is_merging() const { return merge_count > 0; }
+    uint32_t get_merge_age_us() const;
+
+    // average number of blocks recalculate() had to visit for each block appended
+    float get_blocks_per_append() const { return recalculate_count > 0 ? (float)recalculate_blocks / recalculate_count : 0.0F; }
+    uint32_t get_append_count() const { return recalculate_count; }
+    void reset_recalculate_stats() { recalculate_count= 0; recalculate_blocks= 0; }
+
     friend class Robot; // for acceleration, junction deviation, minimum_planner_speed
 
 private:
-    bool append_block(ActuatorCoordinates &target, uint8_t n_motors, float rate_mm_s, float distance, float unit_vec[], float accleration, float s_value, bool g123);
+    // cartesian is the XYZ the move ends at, only given when the actuators move linearly with it so moves can be merged
+    bool append_block(ActuatorCoordinates &target, uint8_t n_motors, float rate_mm_s, float distance, float unit_vec[], float accleration, float s_value, bool g123, const float *cartesian);
+    bool queue_block(const int32_t *steps, uint8_t n_motors, float rate_mm_s, float distance, const float *entry_unit_vec, const float *exit_unit_vec, float acceleration, float s_value, bool g123);
+    bool can_merge(const ActuatorCoordinates &target, const float *cartesian, uint8_t n_motors, float rate_mm_s, float distance, float acceleration, float s_value, bool g123) const;
     void recalculate();
     void config_load();
     float previous_unit_vec[3];
     float junction_deviation;    // Setting
     float z_junction_deviation;  // Setting
     float minimum_planner_speed; // Setting
+    float merge_tolerance;       // Setting, 0 disables merging
+
+    // the run of nearly collinear segments being merged into one block
+    static const uint8_t max_merge_segments= 16;
+    struct merge_t {
+        int32_t steps[k_max_actuators];         // signed steps of the whole run
+        float start[k_max_actuators];           // actuator position at the start of the run
+        float end[k_max_actuators];             // and at the end of the last segment
+        float cartesian_start[3];               // XYZ at the start of the run
+        float cartesian_ends[max_merge_segments][3]; // and at the end of each segment
+        float distance;
+        float rate_mm_s;
+        float acceleration;
+        float s_value;
+        float entry_unit_vec[3];
+        float exit_unit_vec[3];
+        uint32_t start_us;
+        uint8_t n_motors;
+        bool g123;
+    };
+    merge_t *merge{nullptr};     // only allocated if merging is enabled
+    uint8_t merge_count{0};
+
+    uint32_t recalculate_count{0};  // number of times recalculate() ran
+    uint32_t recalculate_blocks{0}; // total blocks it visited
 };
 
 
@@ -103,6 +103,7 @@ Robot::Robot()
     memset(this->last_milestone, 0, sizeof last_milestone);
     memset(this->last_machine_position, 0, sizeof last_machine_position);
     this->arm_solution = NULL;
+    this->ik_cache = nullptr;
     seconds_per_minute = 60.0F;
     this->clearToolOffset();
     this->compensationTransform = nullptr;
@@ -166,6 +167,7 @@ void Robot::load_config()
     } else {
         this->arm_solution = new CartesianSolution(THEKERNEL->config);
     }
+    arm_solution_updated();
 
     this->feed_rate           = THEKERNEL->config->value(default_feed_rate_checksum   )->by_default(  100.0F)->as_number();
     this->seek_rate           = THEKERNEL->config->value(default_seek_rate_checksum   )->by_default(  100.0F)->as_number();
@@ -368,6 +370,9 @@ void Robot::on_gcode_received(void *argument)
 {
     Gcode *gcode = static_cast<Gcode *>(argument);
 
+    // anything other than a move must not overtake moves the planner is holding back to merge
+    if(!gcode->has_g || gcode->g > 3) THEKERNEL->planner->flush_merge();
+
     enum MOTION_MODE_T motion_mode= NONE;
 
     if( gcode->has_g) {
@@ -737,6 +742,7 @@ void Robot::on_gcode_received(void *argument)
                 if(options.size() > 0) {
                     // set the specified options
                     arm_solution->set_optional(options);
+                    arm_solution_updated();
                 }
                 options.clear();
                 if(arm_solution->get_optional(options)) {
@@ -1020,7 +1026,7 @@ bool Robot::append_milestone(const float target[], float rate_mm_s)
     // find actuator position given the machine position, use actual adjusted target
     ActuatorCoordinates actuator_pos;
     if(!disable_arm_solution) {
-        arm_solution->cartesian_to_actuator( transformed_target, actuator_pos );
+        inverse_kinematics( transformed_target, actuator_pos );
 
     }else{
         // basically the same as cartesian, would be used for special homing situations like for scara
@@ -1083,7 +1089,9 @@ bool Robot::append_milestone(const float target[], float rate_mm_s)
 
     // Append the block to the planner
     // NOTE that distance here should be either the distance travelled by the XYZ axis, or the E mm travel if a solo E move
-    if(THEKERNEL->planner->append_block( actuator_pos, n_motors, rate_mm_s, distance, auxilliary_move ? nullptr : unit_vec, acceleration, s_value, is_g123)) {
+    // moves can only be merged when the actuators move in a straight line with XYZ
+    const float *cartesian = (linear_arm_solution || disable_arm_solution) ? transformed_target : nullptr;
+    if(THEKERNEL->planner->append_block( actuator_pos, n_motors, rate_mm_s, distance, auxilliary_move ? nullptr : unit_vec, acceleration, s_value, is_g123, cartesian)) {
         // this is the machine position
         memcpy(this->last_machine_position, transformed_target, n_motors*sizeof(float));
         return true;
@@ -1121,6 +1129,55 @@ bool Robot::delta_move(const float *delta, float rate_mm_s, uint8_t naxis)
     return false;
 }
 
+// Called whenever the arm solution is created or its parameters change
+void Robot::arm_solution_updated()
+{
+    this->linear_arm_solution= arm_solution->get_linear_transform(this->linear_transform);
+
+    if(this->linear_arm_solution) {
+        delete[] ik_cache;
+        ik_cache= nullptr;
+
+    } else {
+        // any cached results are stale now
+        if(ik_cache == nullptr) ik_cache= new ik_cache_t[ik_cache_size];
+        for (int i = 0; i < ik_cache_size; ++i) {
+            ik_cache[i].cartesian[X_AXIS]= NAN; // NAN never compares equal so the entry is never used
+        }
+    }
+    ik_cache_hits= ik_cache_misses= 0;
+}
+
+// convert the XYZ cartesian position to actuator positions with the arm solution
+void Robot::inverse_kinematics(const float cartesian[], ActuatorCoordinates &actuator_pos)
+{
+    if(linear_arm_solution) {
+        for (int i = 0; i < 3; ++i) {
+            actuator_pos[i]= linear_transform[i][X_AXIS] * cartesian[X_AXIS] + linear_transform[i][Y_AXIS] * cartesian[Y_AXIS] + linear_transform[i][Z_AXIS] * cartesian[Z_AXIS];
+        }
+        return;
+    }
+
+    uint32_t h= 0;
+    for (int i = X_AXIS; i <= Z_AXIS; ++i) {
+        h= (h * 31) + (uint32_t)lroundf(cartesian[i] * 100.0F);
+    }
+    ik_cache_t& e= ik_cache[(h ^ (h >> 8)) % ik_cache_size];
+
+    if(e.cartesian[X_AXIS] == cartesian[X_AXIS] && e.cartesian[Y_AXIS] == cartesian[Y_AXIS] && e.cartesian[Z_AXIS] == cartesian[Z_AXIS]) {
+        for (int i = 0; i < 3; ++i) actuator_pos[i]= e.actuator[i];
+        ++ik_cache_hits;
+        return;
+    }
+
+    arm_solution->cartesian_to_actuator(cartesian, actuator_pos);
+    for (int i = 0; i < 3; ++i) {
+        e.cartesian[i]= cartesian[i];
+        e.actuator[i]= actuator_pos[i];
+    }
+    ++ik_cache_misses;
+}
+
 // Append a move to the queue ( cutting it into segments if needed )
 bool Robot::append_line(Gcode *gcode, const float target[], float rate_mm_s, float delta_e)
 {
@@ -1160,6 +1217,10 @@ bool Robot::append_line(Gcode *gcode, const float target[], float rate_mm_s, flo
     if(this->disable_segmentation || (!segment_z_moves && !gcode->has_letter('X') && !gcode->has_letter('Y'))) {
         segments= 1;
 
+    } else if(this->linear_arm_solution && !compensationTransform) {
+        // a straight line in XYZ is a straight line for the actuators too, so there is nothing to gain from segmenting
+        segments= 1;
+
     } else if(this->delta_segments_per_second > 1.0F) {
         // enabled if set to something > 1, it is set to 0.0 by default
         // segment based on current speed and requested segments per second
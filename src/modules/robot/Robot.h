@@ -61,6 +61,9 @@ class Robot : public Module {
         bool delta_move(const float delta[], float rate_mm_s, uint8_t naxis);
         uint8_t register_motor(StepperMotor*);
         uint8_t get_number_registered_motors() const {return n_motors; }
+        void arm_solution_updated();
+        uint32_t get_ik_cache_hits() const { return ik_cache_hits; }
+        uint32_t get_ik_cache_misses() const { return ik_cache_misses; }
 
         BaseSolution* arm_solution;                           // Selected Arm solution ( millimeters to step calculation )
 
@@ -86,6 +89,7 @@ class Robot : public Module {
             bool segment_z_moves:1;
             bool save_g92:1;                                  // save g92 on M500 if set
             bool is_g123:1;
+            bool linear_arm_solution:1;                       // set if the arm solution is a linear transform, lines are then never segmented
             uint8_t plane_axis_0:2;                           // Current plane ( XY, XZ, YZ )
             uint8_t plane_axis_1:2;
             uint8_t plane_axis_2:2;
@@ -110,6 +114,7 @@ class Robot : public Module {
         float theta(float x, float y);
         void select_plane(uint8_t axis_0, uint8_t axis_1, uint8_t axis_2);
         void clearToolOffset();
+        void inverse_kinematics(const float cartesian[], ActuatorCoordinates &actuator_pos);
 
 
         std::array<wcs_t, MAX_WCS> wcs_offsets; // these are persistent once saved with M500
@@ -124,6 +129,19 @@ class Robot : public Module {
         float last_milestone[k_max_actuators]; // Last requested position, in millimeters, which is what we were requested to move to in the gcode after offsets applied but before compensation transform
         float last_machine_position[k_max_actuators]; // Last machine position, which is the position before converting to actuator coordinates (includes compensation transform)
 
+        float linear_transform[3][3];                        // actuator = linear_transform * cartesian, valid when linear_arm_solution is set
+
+        // small cache of recent inverse kinematics results for non linear arm solutions, arcs and zigzags revisit the same points
+        // entries are found by a hash of the position quantized to 0.01mm but are only used if the position matches exactly
+        struct ik_cache_t {
+            float cartesian[3];
+            float actuator[3];
+        };
+        static const uint8_t ik_cache_size= 16;
+        ik_cache_t *ik_cache;
+        uint32_t ik_cache_hits;
+        uint32_t ik_cache_misses;
+
         float seek_rate;                                     // Current rate for seeking moves ( mm/min )
         float feed_rate;                                     // Current rate for feeding moves ( mm/min )
         float mm_per_line_segment;                           // Setting : Used to split lines into segments
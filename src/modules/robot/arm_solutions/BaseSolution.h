@@ -14,6 +14,9 @@ class BaseSolution {
         virtual ~BaseSolution() {};
         virtual void cartesian_to_actuator(const float[], ActuatorCoordinates &) const = 0;
         virtual void actuator_to_cartesian(const ActuatorCoordinates &, float[]) const = 0;
+        // solutions where the actuator positions are a linear function of XYZ fill in matrix so that
+        // actuator = matrix * cartesian and return true, moves then need neither segmenting nor cartesian_to_actuator
+        virtual bool get_linear_transform(float matrix[3][3]) const { return false; };
         typedef std::map<char, float> arm_options_t;
         virtual bool set_optional(const arm_options_t& options) { return false; };
         virtual bool get_optional(arm_options_t& options, bool force_all= false) const { return false; };
@@ -1,6 +1,7 @@
 #include "CartesianSolution.h"
 #include "ActuatorCoordinates.h"
 #include <math.h>
+#include <string.h>
 
 void CartesianSolution::cartesian_to_actuator( const float cartesian_mm[], ActuatorCoordinates &actuator_mm ) const {
     actuator_mm[ALPHA_STEPPER] = cartesian_mm[X_AXIS];
@@ -13,3 +14,13 @@ void CartesianSolution::actuator_to_cartesian( const ActuatorCoordinates &actuat
     cartesian_mm[BETA_STEPPER ] = actuator_mm[Y_AXIS];
     cartesian_mm[GAMMA_STEPPER] = actuator_mm[Z_AXIS];
 }
+
+bool CartesianSolution::get_linear_transform(float matrix[3][3]) const {
+    const float m[3][3]= {
+        {1, 0, 0},
+        {0, 1, 0},
+        {0, 0, 1}
+    };
+    memcpy(matrix, m, sizeof(m));
+    return true;
+}
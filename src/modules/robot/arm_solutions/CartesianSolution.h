@@ -13,4 +13,5 @@ class CartesianSolution : public BaseSolution {
         CartesianSolution(Config*){};
         void cartesian_to_actuator( const float millimeters[], ActuatorCoordinates &steps ) const override;
         void actuator_to_cartesian( const ActuatorCoordinates &steps, float millimeters[] ) const override;
+        bool get_linear_transform(float matrix[3][3]) const override;
 };
@@ -3,6 +3,8 @@
 #include "ConfigValue.h"
 #include "checksumm.h"
 
+#include <string.h>
+
 #define x_reduction_checksum         CHECKSUM("x_reduction")
 #define z_reduction_checksum         CHECKSUM("z_reduction")
 
@@ -23,3 +25,13 @@ void CoreXZSolution::actuator_to_cartesian(const ActuatorCoordinates &actuator_m
     cartesian_mm[Z_AXIS] = (0.5F/this->z_reduction) * (actuator_mm[ALPHA_STEPPER] - actuator_mm[BETA_STEPPER]);
     cartesian_mm[Y_AXIS] = actuator_mm[GAMMA_STEPPER];
 }
+
+bool CoreXZSolution::get_linear_transform(float matrix[3][3]) const {
+    const float m[3][3]= {
+        {this->x_reduction, 0,  this->z_reduction},
+        {this->x_reduction, 0, -this->z_reduction},
+        {0,                 1,  0}
+    };
+    memcpy(matrix, m, sizeof(m));
+    return true;
+}
@@ -12,6 +12,7 @@ class CoreXZSolution : public BaseSolution {
         CoreXZSolution(Config*);
         void cartesian_to_actuator(const float[], ActuatorCoordinates & ) const override;
         void actuator_to_cartesian(const ActuatorCoordinates &, float[] ) const override;
+        bool get_linear_transform(float matrix[3][3]) const override;
 
     private:
         float x_reduction;
@@ -0,0 +1,94 @@
+#include "FastKinematics.h"
+
+static const float degrees_per_radian= 57.29577951F;
+
+// atan(i/256) in degrees
+static const float atan_table[257]= {
+    0.0000000F, 0.2238105F, 0.4476142F, 0.6714042F, 0.8951737F, 1.1189159F, 1.3426240F, 1.5662912F,
+    1.7899106F, 2.0134755F, 2.2369791F, 2.4604145F, 2.6837752F, 2.9070542F, 3.1302449F, 3.3533405F,
+    3.5763344F, 3.7992198F, 4.0219902F, 4.2446388F, 4.4671591F, 4.6895444F, 4.9117882F, 5.1338839F,
+    5.3558250F, 5.5776051F, 5.7992176F, 6.0206562F, 6.2419143F, 6.4629858F, 6.6838641F, 6.9045431F,
+    7.1250163F, 7.3452778F, 7.5653211F, 7.7851401F, 8.0047289F, 8.2240811F, 8.4431909F, 8.6620523F,
+    8.8806592F, 9.0990057F, 9.3170861F, 9.5348944F, 9.7524249F, 9.9696720F, 10.1866298F, 10.4032927F,
+    10.6196553F, 10.8357119F, 11.0514570F, 11.2668853F, 11.4819914F, 11.6967698F, 11.9112154F, 12.1253230F,
+    12.3390873F, 12.5525032F, 12.7655658F, 12.9782699F, 13.1906107F, 13.4025833F, 13.6141827F, 13.8254044F,
+    14.0362435F, 14.2466953F, 14.4567554F, 14.6664191F, 14.8756820F, 15.0845396F, 15.2929877F, 15.5010218F,
+    15.7086378F, 15.9158315F, 16.1225988F, 16.3289356F, 16.5348379F, 16.7403018F, 16.9453234F, 17.1498989F,
+    17.3540246F, 17.5576968F, 17.7609119F, 17.9636663F, 18.1659565F, 18.3677791F, 18.5691307F, 18.7700080F,
+    18.9704078F, 19.1703268F, 19.3697620F, 19.5687103F, 19.7671687F, 19.9651342F, 20.1626040F, 20.3595752F,
+    20.5560452F, 20.7520112F, 20.9474706F, 21.1424208F, 21.3368593F, 21.5307837F, 21.7241915F, 21.9170805F,
+    22.1094483F, 22.3012929F, 22.4926119F, 22.6834034F, 22.8736652F, 23.0633954F, 23.2525922F, 23.4412535F,
+    23.6293777F, 23.8169630F, 24.0040076F, 24.1905100F, 24.3764686F, 24.5618818F, 24.7467482F, 24.9310664F,
+    25.1148349F, 25.2980525F, 25.4807179F, 25.6628300F, 25.8443876F, 26.0253895F, 26.2058347F, 26.3857222F,
+    26.5650512F, 26.7438206F, 26.9220296F, 27.0996775F, 27.2767634F, 27.4532867F, 27.6292467F, 27.8046428F,
+    27.9794744F, 28.1537410F, 28.3274422F, 28.5005775F, 28.6731465F, 28.8451489F, 29.0165843F, 29.1874526F,
+    29.3577535F, 29.5274869F, 29.6966525F, 29.8652504F, 30.0332804F, 30.2007426F, 30.3676370F, 30.5339636F,
+    30.6997226F, 30.8649140F, 31.0295381F, 31.1935951F, 31.3570852F, 31.5200088F, 31.6823660F, 31.8441574F,
+    32.0053832F, 32.1660439F, 32.3261400F, 32.4856719F, 32.6446401F, 32.8030453F, 32.9608879F, 33.1181686F,
+    33.2748880F, 33.4310468F, 33.5866457F, 33.7416853F, 33.8961666F, 34.0500901F, 34.2034568F, 34.3562675F,
+    34.5085230F, 34.6602242F, 34.8113720F, 34.9619673F, 35.1120112F, 35.2615045F, 35.4104483F, 35.5588436F,
+    35.7066914F, 35.8539928F, 36.0007490F, 36.1469609F, 36.2926297F, 36.4377567F, 36.5823428F, 36.7263894F,
+    36.8698976F, 37.0128687F, 37.1553039F, 37.2972044F, 37.4385716F, 37.5794066F, 37.7197109F, 37.8594857F,
+    37.9987324F, 38.1374524F, 38.2756469F, 38.4133174F, 38.5504653F, 38.6870920F, 38.8231988F, 38.9587873F,
+    39.0938589F, 39.2284150F, 39.3624571F, 39.4959867F, 39.6290053F, 39.7615144F, 39.8935154F, 40.0250100F,
+    40.1559996F, 40.2864858F, 40.4164702F, 40.5459542F, 40.6749396F, 40.8034277F, 40.9314203F, 41.0589189F,
+    41.1859252F, 41.3124406F, 41.4384669F, 41.5640057F, 41.6890585F, 41.8136270F, 41.9377129F, 42.0613178F,
+    42.1844433F, 42.3070911F, 42.4292629F, 42.5509603F, 42.6721849F, 42.7929385F, 42.9132227F, 43.0330392F,
+    43.1523897F, 43.2712759F, 43.3896994F, 43.5076619F, 43.6251652F, 43.7422109F, 43.8588007F, 43.9749364F,
+    44.0906196F, 44.2058519F, 44.3206352F, 44.4349712F, 44.5488615F, 44.6623078F, 44.7753118F, 44.8878753F,
+    45.0000000F,
+};
+
+// digit by digit, takes two bits of x for each bit of the root
+static inline void sqrt_bits(uint32_t word, int shift, uint32_t &root, uint32_t &rem)
+{
+    for (; shift >= 0; shift -= 2) {
+        rem= (rem << 2) | ((word >> shift) & 3);
+        uint32_t trial= (root << 2) | 1;
+        root <<= 1;
+        if(rem >= trial) {
+            rem -= trial;
+            root |= 1;
+        }
+    }
+}
+
+uint32_t fixed_sqrt(uint64_t x)
+{
+    // the remainder is never more than twice the root so it fits in 32 bits, and taking the bits from
+    // each half of x in turn keeps all the shifts 32 bit, starting at the highest pair of bits that is set
+    uint32_t hi= x >> 32;
+    uint32_t lo= (uint32_t)x;
+    uint32_t root= 0;
+    uint32_t rem= 0;
+    if(hi != 0) {
+        sqrt_bits(hi, (31 - __builtin_clz(hi)) & ~1, root, rem);
+        sqrt_bits(lo, 30, root, rem);
+    } else if(lo != 0) {
+        sqrt_bits(lo, (31 - __builtin_clz(lo)) & ~1, root, rem);
+    }
+
+    // rem is x - root², x is nearer (root + 1)² when x >= root² + root + 1/4
+    if(rem > root) ++root;
+    return root;
+}
+
+float table_atan_degrees(float v)
+{
+    bool negative= v < 0;
+    if(negative) v= -v;
+
+    // atan(v) = 90 - atan(1/v) keeps the lookup within the table
+    bool inverted= v > 1.0F;
+    if(inverted) v= 1.0F / v;
+
+    // atan(v) = atan(i/256) + atan(t) with t = (v - i/256) / (1 + v * i/256), from the nearest entry |t| <= 1/512,
+    // so atan(t) = t to within t³/3, 0.0000001 degrees
+    int i= (int)(v * 256.0F + 0.5F);
+    float vi= i * (1.0F / 256.0F);
+    float t= (v - vi) / (1.0F + v * vi);
+    float a= atan_table[i] + t * degrees_per_radian;
+
+    if(inverted) a= 90.0F - a;
+    return negative ? -a : a;
+}
@@ -0,0 +1,19 @@
+#pragma once
+
+#include <stdint.h>
+
+// Math used by the delta arm solutions when delta_fast_kinematics is set.
+// The LPC1769 has no FPU, so every float operation is a library call, these replace the slowest ones.
+
+// Q16.16 fixed point, enough range for +/-32768mm with 0.000015mm resolution
+#define FIXED_SHIFT 16
+#define FIXED_ONE   (1 << FIXED_SHIFT)
+
+inline int32_t float_to_fixed(float f) { return (int32_t)(f * FIXED_ONE + (f < 0 ? -0.5F : 0.5F)); }
+inline float fixed_to_float(int32_t q) { return q * (1.0F / FIXED_ONE); }
+
+// square root of a Q32.32 number as a Q16.16 number rounded to nearest, the root must be less than 1024
+uint32_t fixed_sqrt(uint64_t x);
+
+// atanf(v) in degrees from a table, within 0.0000002 degrees and the rounding of the table to float
+float table_atan_degrees(float v);
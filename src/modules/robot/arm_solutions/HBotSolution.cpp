@@ -1,6 +1,7 @@
 #include "HBotSolution.h"
 #include "ActuatorCoordinates.h"
 #include <math.h>
+#include <string.h>
 
 void HBotSolution::cartesian_to_actuator(const float cartesian_mm[], ActuatorCoordinates &actuator_mm ) const
 {
@@ -15,3 +16,14 @@ void HBotSolution::actuator_to_cartesian(const ActuatorCoordinates &actuator_mm,
     cartesian_mm[Y_AXIS] = 0.5F * (actuator_mm[ALPHA_STEPPER] - actuator_mm[BETA_STEPPER]);
     cartesian_mm[Z_AXIS] = actuator_mm[GAMMA_STEPPER];
 }
+
+bool HBotSolution::get_linear_transform(float matrix[3][3]) const
+{
+    const float m[3][3]= {
+        {1,  1, 0},
+        {1, -1, 0},
+        {0,  0, 1}
+    };
+    memcpy(matrix, m, sizeof(m));
+    return true;
+}
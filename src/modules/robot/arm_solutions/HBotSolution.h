@@ -13,4 +13,5 @@ class HBotSolution : public BaseSolution {
         HBotSolution(Config*){};
         void cartesian_to_actuator(const float[], ActuatorCoordinates &) const override;
         void actuator_to_cartesian(const ActuatorCoordinates &, float[]) const override;
+        bool get_linear_transform(float matrix[3][3]) const override;
 };
@@ -8,6 +8,7 @@
 
 #include <fastmath.h>
 #include "Vector3.h"
+#include "FastKinematics.h"
 
 
 #define arm_length_checksum         CHECKSUM("arm_length")
@@ -19,6 +20,7 @@
 #define tower1_angle_checksum       CHECKSUM("delta_tower1_angle")
 #define tower2_angle_checksum       CHECKSUM("delta_tower2_angle")
 #define tower3_angle_checksum       CHECKSUM("delta_tower3_angle")
+#define fast_kinematics_checksum    CHECKSUM("delta_fast_kinematics")
 
 #define SQ(x) powf(x, 2)
 #define ROUND(x, y) (roundf(x * (float)(1e ## y)) / (float)(1e ## y))
@@ -38,6 +40,9 @@ LinearDeltaSolution::LinearDeltaSolution(Config* config)
     tower2_offset = config->value(tower2_offset_checksum)->by_default(0.0f)->as_number();
     tower3_offset = config->value(tower3_offset_checksum)->by_default(0.0f)->as_number();
 
+    // use fixed point math for the inverse kinematics, faster on a CPU without an FPU
+    fast_kinematics = config->value(fast_kinematics_checksum)->by_default(false)->as_bool();
+
     init();
 }
 
@@ -54,10 +59,26 @@ void LinearDeltaSolution::init()
     delta_tower2_y = (delta_radius + tower2_offset) * sinf((330.0F + tower2_angle) * PIOVER180);
     delta_tower3_x = (delta_radius + tower3_offset) * cosf((90.0F  + tower3_angle) * PIOVER180); // back middle tower
     delta_tower3_y = (delta_radius + tower3_offset) * sinf((90.0F  + tower3_angle) * PIOVER180);
+
+    tower_x_fixed[0] = float_to_fixed(delta_tower1_x);
+    tower_y_fixed[0] = float_to_fixed(delta_tower1_y);
+    tower_x_fixed[1] = float_to_fixed(delta_tower2_x);
+    tower_y_fixed[1] = float_to_fixed(delta_tower2_y);
+    tower_x_fixed[2] = float_to_fixed(delta_tower3_x);
+    tower_y_fixed[2] = float_to_fixed(delta_tower3_y);
+    int32_t l = float_to_fixed(arm_length);
+    arm_length_squared_fixed = (int64_t)l * l;
+
+    // fixed_sqrt() is limited to roots below 1024mm
+    use_fixed = fast_kinematics && arm_length < 1000.0F;
 }
 
 void LinearDeltaSolution::cartesian_to_actuator(const float cartesian_mm[], ActuatorCoordinates &actuator_mm ) const
 {
+    if(use_fixed) {
+        cartesian_to_actuator_fixed(cartesian_mm, actuator_mm);
+        return;
+    }
 
     actuator_mm[ALPHA_STEPPER] = sqrtf(this->arm_length_squared
                                        - SQ(delta_tower1_x - cartesian_mm[X_AXIS])
@@ -73,6 +94,21 @@ void LinearDeltaSolution::cartesian_to_actuator(const float cartesian_mm[], Actu
                                       ) + cartesian_mm[Z_AXIS];
 }
 
+// same as the float version but the squares and root are done in 64 bit integers, only the conversions in and out and adding
+// Z use floats. As there, positions the arms can't reach give NAN
+void LinearDeltaSolution::cartesian_to_actuator_fixed(const float cartesian_mm[], ActuatorCoordinates &actuator_mm ) const
+{
+    int32_t x = float_to_fixed(cartesian_mm[X_AXIS]);
+    int32_t y = float_to_fixed(cartesian_mm[Y_AXIS]);
+
+    for (int i = 0; i < 3; ++i) {
+        int64_t dx = (int64_t)tower_x_fixed[i] - x;
+        int64_t dy = (int64_t)tower_y_fixed[i] - y;
+        int64_t d2 = arm_length_squared_fixed - dx * dx - dy * dy;
+        actuator_mm[ALPHA_STEPPER + i] = (d2 > 0 ? fixed_to_float(fixed_sqrt(d2)) : NAN) + cartesian_mm[Z_AXIS];
+    }
+}
+
 void LinearDeltaSolution::actuator_to_cartesian(const ActuatorCoordinates &actuator_mm, float cartesian_mm[] ) const
 {
     // from http://en.wikipedia.org/wiki/Circumscribed_circle#Barycentric_coordinates_from_cross-_and_dot-products
@@ -3,6 +3,8 @@
 #include "libs/Module.h"
 #include "BaseSolution.h"
 
+#include <stdint.h>
+
 class Config;
 
 class LinearDeltaSolution : public BaseSolution {
@@ -13,9 +15,11 @@ class LinearDeltaSolution : public BaseSolution {
 
         bool set_optional(const arm_options_t& options) override;
         bool get_optional(arm_options_t& options, bool force_all) const override;
+        void set_fast_kinematics(bool f) { fast_kinematics= f; init(); }
 
     private:
         void init();
+        void cartesian_to_actuator_fixed(const float[], ActuatorCoordinates &) const;
 
         float arm_length;
         float arm_radius;
@@ -33,4 +37,14 @@ class LinearDeltaSolution : public BaseSolution {
         float tower1_angle;
         float tower2_angle;
         float tower3_angle;
+
+        // the same tower positions in Q16.16 and the arm length squared in Q32.32 for cartesian_to_actuator_fixed()
+        int32_t tower_x_fixed[3];
+        int32_t tower_y_fixed[3];
+        int64_t arm_length_squared_fixed;
+
+        struct {
+            bool fast_kinematics:1;                // set by delta_fast_kinematics, use fixed point inverse kinematics
+            bool use_fixed:1;                      // fast_kinematics and the arm is short enough for fixed_sqrt()
+        };
 };
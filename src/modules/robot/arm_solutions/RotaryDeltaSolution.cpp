@@ -8,6 +8,7 @@
 #include "libs/Config.h"
 #include "libs/utils.h"
 #include "StreamOutputPool.h"
+#include "FastKinematics.h"
 #include <fastmath.h>
 
 #define delta_e_checksum                CHECKSUM("delta_e")
@@ -20,6 +21,7 @@
 #define tool_offset_checksum            CHECKSUM("delta_tool_offset")
 
 #define delta_mirror_xy_checksum        CHECKSUM("delta_mirror_xy")
+#define delta_fast_kinematics_checksum  CHECKSUM("delta_fast_kinematics")
 
 const static float pi     = 3.14159265358979323846;    // PI
 const static float two_pi = 2 * pi;
@@ -56,6 +58,9 @@ RotaryDeltaSolution::RotaryDeltaSolution(Config *config)
     // mirror the XY axis
     mirror_xy= config->value(delta_mirror_xy_checksum)->by_default(true)->as_bool();
 
+    // take atan from a table for the inverse kinematics, faster on a CPU without an FPU
+    fast_kinematics= config->value(delta_fast_kinematics_checksum)->by_default(false)->as_bool();
+
     debug_flag= false;
     init();
 }
@@ -76,7 +81,11 @@ int RotaryDeltaSolution::delta_calcAngleYZ(float x0, float y0, float z0, float &
     float yj = (y1 - a * b - sqrtf(d)) / (b * b + 1.0F);               // choosing outer point
     float zj = a + b * yj;
 
-    theta = 180.0F * atanf(-zj / (y1 - yj)) / pi + ((yj > y1) ? 180.0F : 0.0F);
+    if(fast_kinematics) {
+        theta = table_atan_degrees(-zj / (y1 - yj)) + ((yj > y1) ? 180.0F : 0.0F);
+    } else {
+        theta = 180.0F * atanf(-zj / (y1 - yj)) / pi + ((yj > y1) ? 180.0F : 0.0F);
+    }
     return 0;
 }
 
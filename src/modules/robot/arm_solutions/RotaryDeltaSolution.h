@@ -13,6 +13,7 @@ class RotaryDeltaSolution : public BaseSolution {
 
         bool set_optional(const arm_options_t& options) override;
         bool get_optional(arm_options_t& options, bool force_all) const override;
+        void set_fast_kinematics(bool f) { fast_kinematics= f; }
 
     private:
         void init();
@@ -33,5 +34,6 @@ class RotaryDeltaSolution : public BaseSolution {
         struct {
             bool debug_flag:1;
             bool mirror_xy:1;
+            bool fast_kinematics:1;     // use the atan table for the inverse kinematics
         };
 };
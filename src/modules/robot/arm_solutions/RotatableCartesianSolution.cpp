@@ -1,5 +1,6 @@
 #include "RotatableCartesianSolution.h"
 #include <math.h>
+#include <string.h>
 #include "ActuatorCoordinates.h"
 #include "checksumm.h"
 #include "ConfigValue.h"
@@ -30,3 +31,14 @@ void RotatableCartesianSolution::rotate(const float in[], float out[], float sin
     out[BETA_STEPPER ] = sin * in[X_AXIS] + cos * in[Y_AXIS];
     out[GAMMA_STEPPER] =       in[Z_AXIS];
 }
+
+bool RotatableCartesianSolution::get_linear_transform(float matrix[3][3]) const
+{
+    const float m[3][3]= {
+        {cos_alpha, -sin_alpha, 0},
+        {sin_alpha,  cos_alpha, 0},
+        {0,          0,         1}
+    };
+    memcpy(matrix, m, sizeof(m));
+    return true;
+}
@@ -14,6 +14,7 @@ class RotatableCartesianSolution : public BaseSolution {
         RotatableCartesianSolution(Config*);
         void cartesian_to_actuator(const float[], ActuatorCoordinates &) const override;
         void actuator_to_cartesian(const ActuatorCoordinates &, float[] ) const override;
+        bool get_linear_transform(float matrix[3][3]) const override;
 
     private:
         void rotate(const float in[], float out[], float sin, float cos) const;
@@ -29,6 +29,7 @@
 #include "StepTicker.h"
 #include "BaseSolution.h"
 #include "SerialMessage.h"
+#include "InterruptIn.h" // mbed
 
 #include <ctype.h>
 
@@ -89,6 +90,7 @@
 
 #define endstop_debounce_count_checksum  CHECKSUM("endstop_debounce_count")
 #define endstop_debounce_ms_checksum     CHECKSUM("endstop_debounce_ms")
+#define endstop_glitch_filter_checksum   CHECKSUM("endstop_glitch_filter")
 
 #define alpha_homing_direction_checksum  CHECKSUM("alpha_homing_direction")
 #define beta_homing_direction_checksum   CHECKSUM("beta_homing_direction")
@@ -110,6 +112,11 @@
 #define homing_order_checksum            CHECKSUM("homing_order")
 #define move_to_origin_checksum          CHECKSUM("move_to_origin_after_home")
 
+static const uint16_t endstop_pin_checksums[6]= {
+    alpha_min_endstop_checksum, beta_min_endstop_checksum, gamma_min_endstop_checksum,
+    alpha_max_endstop_checksum, beta_max_endstop_checksum, gamma_max_endstop_checksum
+};
+
 #define STEPPER THEROBOT->actuators
 #define STEPS_PER_MM(a) (STEPPER[a]->get_steps_per_mm())
 
@@ -130,6 +137,8 @@ Endstops::Endstops()
     this->status = NOT_HOMING;
     home_offset[0] = home_offset[1] = home_offset[2] = 0.0F;
     debounce.fill(0);
+    triggered.reset();
+    overrun[0] = overrun[1] = overrun[2] = 0.0F;
 }
 
 void Endstops::on_module_loaded()
@@ -147,18 +156,32 @@ void Endstops::on_module_loaded()
     // Settings
     this->load_config();
 
+    // homing endstops on pins that can interrupt are caught on the edge, wherever the motors are between two ticks of
+    // the step ticker, otherwise and as a back stop they are read in this timer
+    this->edge_pins = false;
+    for ( int c = X_AXIS; c <= Z_AXIS; c++ ) {
+        int n = c + (this->home_direction[c] ? 0 : 3);
+        if(this->pins[n].can_interrupt()) {
+            this->edge_pins = true;
+            mbed::InterruptIn *edge_pin = this->pins[n].interrupt_pin();
+            // the mbed set up turns the pull up on, put back what was configured
+            this->pins[n].from_string(THEKERNEL->config->value(endstop_pin_checksums[n])->as_string())->as_input();
+            if(this->pins[n].is_inverting()) {
+                edge_pin->fall(this, &Endstops::on_pin_edge);
+            } else {
+                edge_pin->rise(this, &Endstops::on_pin_edge);
+            }
+        }
+    }
     THEKERNEL->slow_ticker->attach(1000, this, &Endstops::read_endstops);
 }
 
 // Get config
 void Endstops::load_config()
 {
-    this->pins[0].from_string( THEKERNEL->config->value(alpha_min_endstop_checksum          )->by_default("nc" )->as_string())->as_input();
-    this->pins[1].from_string( THEKERNEL->config->value(beta_min_endstop_checksum           )->by_default("nc" )->as_string())->as_input();
-    this->pins[2].from_string( THEKERNEL->config->value(gamma_min_endstop_checksum          )->by_default("nc" )->as_string())->as_input();
-    this->pins[3].from_string( THEKERNEL->config->value(alpha_max_endstop_checksum          )->by_default("nc" )->as_string())->as_input();
-    this->pins[4].from_string( THEKERNEL->config->value(beta_max_endstop_checksum           )->by_default("nc" )->as_string())->as_input();
-    this->pins[5].from_string( THEKERNEL->config->value(gamma_max_endstop_checksum          )->by_default("nc" )->as_string())->as_input();
+    for (int i = 0; i < 6; ++i) {
+        this->pins[i].from_string( THEKERNEL->config->value(endstop_pin_checksums[i])->by_default("nc" )->as_string())->as_input();
+    }
 
     // These are the old ones in steps still here for backwards compatibility
     this->fast_rates[0] =  THEKERNEL->config->value(alpha_fast_homing_rate_checksum     )->by_default(4000 )->as_number() / STEPS_PER_MM(0);
@@ -185,6 +208,8 @@ void Endstops::load_config()
     // NOTE the debouce count is in milliseconds so probably does not need to beset anymore
     this->debounce_ms= THEKERNEL->config->value(endstop_debounce_ms_checksum       )->by_default(0)->as_number();
     this->debounce_count= THEKERNEL->config->value(endstop_debounce_count_checksum    )->by_default(100)->as_number();
+    // on an edge the endstop must still read triggered this many more times in a row or it was a glitch
+    this->glitch_filter= THEKERNEL->config->value(endstop_glitch_filter_checksum       )->by_default(0)->as_number();
 
     // get homing direction and convert to boolean where true is home to min, and false is home to max
     this->home_direction[0]= THEKERNEL->config->value(alpha_homing_direction_checksum)->by_default("home_to_min")->as_string() != "home_to_max";
@@ -411,8 +436,7 @@ uint32_t Endstops::read_endstops(uint32_t dummy)
                     if(debounce[m] < debounce_ms) {
                         debounce[m]++;
                     } else {
-                        // we signal the motor to stop, which will preempt any moves on that axis
-                        STEPPER[m]->stop_moving();
+                        trigger(m);
                     }
 
                 } else {
@@ -431,10 +455,7 @@ uint32_t Endstops::read_endstops(uint32_t dummy)
                     if(debounce[m] < debounce_ms) {
                         debounce[m]++;
                     } else {
-                        // we signal all the motors to stop, as on corexy X and Y motors will move for X and Y axis homing and we only hom eone axis at a time
-                        STEPPER[X_AXIS]->stop_moving();
-                        STEPPER[Y_AXIS]->stop_moving();
-                        STEPPER[Z_AXIS]->stop_moving();
+                        trigger(m);
                     }
 
                 } else {
@@ -448,6 +469,72 @@ uint32_t Endstops::read_endstops(uint32_t dummy)
     return 0;
 }
 
+// Called on the edge of a homing endstop, at a lower priority than the step ticker so the motors are between ticks
+void Endstops::on_pin_edge()
+{
+    if(this->status != MOVING_TO_ENDSTOP_SLOW && this->status != MOVING_TO_ENDSTOP_FAST) return;
+
+    for ( int m = X_AXIS; m <= Z_AXIS; m++ ) {
+        // as in read_endstops() corexy checks the axis that is homing
+        if(is_corexy ? !axis_to_home[m] : !STEPPER[m]->is_moving()) continue;
+
+        Pin& pin= this->pins[m + (this->home_direction[m] ? 0 : 3)];
+        bool hit= true;
+        for (uint32_t i = 0; i <= glitch_filter && hit; ++i) {
+            hit= pin.get();
+        }
+        if(hit) trigger(m);
+    }
+}
+
+// latch where the actuators are and stop them, from the edge interrupt or the timer whichever is first
+void Endstops::trigger(int m)
+{
+    __disable_irq();
+    if(!is_corexy) {
+        if(!triggered[m]) {
+            trigger_steps[m]= STEPPER[m]->get_current_step();
+            triggered.set(m);
+        }
+        // we signal the motor to stop, which will preempt any moves on that axis
+        STEPPER[m]->stop_moving();
+
+    } else {
+        // we signal all the motors to stop, as on corexy X and Y motors will move for X and Y axis homing and we only home one axis at a time
+        if(triggered.none()) {
+            for ( int a = X_AXIS; a <= Z_AXIS; a++ ) trigger_steps[a]= STEPPER[a]->get_current_step();
+            triggered.set();
+        }
+        STEPPER[X_AXIS]->stop_moving();
+        STEPPER[Y_AXIS]->stop_moving();
+        STEPPER[Z_AXIS]->stop_moving();
+    }
+    __enable_irq();
+}
+
+// the motors step on to the end of the tick they were stopped in, find how far that is past where the endstops triggered
+// so the homed position is set for where they triggered
+void Endstops::latch_overrun()
+{
+    ActuatorCoordinates current, latched;
+    for ( int a = X_AXIS; a <= Z_AXIS; a++ ) {
+        current[a]= STEPPER[a]->get_current_position();
+        latched[a]= triggered[a] ? trigger_steps[a] / STEPS_PER_MM(a) : current[a];
+    }
+
+    if(this->is_delta || this->is_rdelta) {
+        for ( int a = X_AXIS; a <= Z_AXIS; a++ ) overrun[a]= current[a] - latched[a];
+
+    } else {
+        float current_pos[3], latched_pos[3];
+        THEROBOT->arm_solution->actuator_to_cartesian(current, current_pos);
+        THEROBOT->arm_solution->actuator_to_cartesian(latched, latched_pos);
+        for ( int c = X_AXIS; c <= Z_AXIS; c++ ) {
+            if(axis_to_home[c]) overrun[c]= current_pos[c] - latched_pos[c];
+        }
+    }
+}
+
 void Endstops::home_xy()
 {
     if(axis_to_home[X_AXIS] && axis_to_home[Y_AXIS]) {
@@ -479,6 +566,7 @@ void Endstops::home(std::bitset<3> a)
 {
     // reset debounce counts
     debounce.fill(0);
+    triggered.reset();
 
     // turn off any compensation transform
     auto savect= THEROBOT->compensationTransform;
@@ -488,6 +576,8 @@ void Endstops::home(std::bitset<3> a)
 
     // Start moving the axes to the origin
     this->status = MOVING_TO_ENDSTOP_FAST;
+    // the endstops latch between two step ticks only while the edge interrupt is above the rest
+    if(this->edge_pins) this->edge_priority = Pin::raise_edge_priority();
 
     THEROBOT->disable_segmentation= true; // we must disable segmentation as this won't work with it enabled
 
@@ -526,6 +616,7 @@ void Endstops::home(std::bitset<3> a)
     THECONVEYOR->wait_for_idle();
 
     // Start moving the axes towards the endstops slowly
+    triggered.reset();
     this->status = MOVING_TO_ENDSTOP_SLOW;
     for ( int c = X_AXIS; c <= Z_AXIS; c++ ) {
         if(axis_to_home[c]) {
@@ -538,6 +629,7 @@ void Endstops::home(std::bitset<3> a)
     THEROBOT->delta_move(delta, feed_rate, 3);
     // wait until finished
     THECONVEYOR->wait_for_idle();
+    latch_overrun();
 
     // TODO should check that the endstops were hit and it did not stop short for some reason
     // we did not complete movement the full distance if we hit the endstops
@@ -548,6 +640,7 @@ void Endstops::home(std::bitset<3> a)
     // restore compensationTransform
     THEROBOT->compensationTransform= savect;
 
+    if(this->edge_pins) Pin::restore_edge_priority(this->edge_priority);
     this->status = NOT_HOMING;
 }
 
@@ -611,6 +704,7 @@ void Endstops::process_home_command(Gcode* gcode)
 
     // First wait for the queue to be empty
     THECONVEYOR->wait_for_idle();
+    overrun[0] = overrun[1] = overrun[2] = 0.0F;
 
     // deltas always home Z axis only, which moves all three actuators
     bool home_in_z = this->is_delta || this->is_rdelta;
@@ -691,11 +785,11 @@ void Endstops::process_home_command(Gcode* gcode)
             ActuatorCoordinates ideal_actuator_position;
             THEROBOT->arm_solution->cartesian_to_actuator(ideal_position, ideal_actuator_position);
 
-            // We are actually not at the ideal position, but a trim away
+            // We are actually not at the ideal position, but a trim away, and past it by the overrun
             ActuatorCoordinates real_actuator_position = {
-                ideal_actuator_position[X_AXIS] - this->trim_mm[X_AXIS],
-                ideal_actuator_position[Y_AXIS] - this->trim_mm[Y_AXIS],
-                ideal_actuator_position[Z_AXIS] - this->trim_mm[Z_AXIS]
+                ideal_actuator_position[X_AXIS] - this->trim_mm[X_AXIS] + this->overrun[X_AXIS],
+                ideal_actuator_position[Y_AXIS] - this->trim_mm[Y_AXIS] + this->overrun[Y_AXIS],
+                ideal_actuator_position[Z_AXIS] - this->trim_mm[Z_AXIS] + this->overrun[Z_AXIS]
             };
 
             float real_position[3];
@@ -707,7 +801,7 @@ void Endstops::process_home_command(Gcode* gcode)
             // without endstop trim, real_position == ideal_position
             if(is_rdelta) {
                 // with a rotary delta we set the actuators angle then use the FK to calculate the resulting cartesian coordinates
-                ActuatorCoordinates real_actuator_position = {ideal_position[0], ideal_position[1], ideal_position[2]};
+                ActuatorCoordinates real_actuator_position = {ideal_position[0] + this->overrun[0], ideal_position[1] + this->overrun[1], ideal_position[2] + this->overrun[2]};
                 THEROBOT->reset_actuator_position(real_actuator_position);
 
             } else {
@@ -717,10 +811,10 @@ void Endstops::process_home_command(Gcode* gcode)
         }
 
     } else {
-        // Zero the ax(i/e)s position, add in the home offset
+        // Zero the ax(i/e)s position, add in the home offset and how far past the endstop it stopped
         for ( int c = X_AXIS; c <= Z_AXIS; c++ ) {
             if (haxis[c]) { // if we requested this axis to home
-                THEROBOT->reset_axis_position(this->homing_position[c] + this->home_offset[c], c);
+                THEROBOT->reset_axis_position(this->homing_position[c] + this->home_offset[c] + this->overrun[c], c);
             }
         }
     }
@@ -35,6 +35,9 @@ class Endstops : public Module{
         void process_home_command(Gcode* gcode);
         void set_homing_offset(Gcode* gcode);
         uint32_t read_endstops(uint32_t dummy);
+        void on_pin_edge();
+        void trigger(int m);
+        void latch_overrun();
 
         float homing_position[3];
         float home_offset[3];
@@ -43,6 +46,7 @@ class Endstops : public Module{
 
         uint32_t debounce_count;
         uint32_t  debounce_ms;
+        uint32_t glitch_filter;
         float  retract_mm[3];
         float  trim_mm[3];
         float  fast_rates[3];
@@ -50,9 +54,16 @@ class Endstops : public Module{
         Pin    pins[6];
         std::array<uint16_t, 3> debounce;
 
+        // actuator steps when each endstop triggered, and how far past that the motors ran before they stopped, in
+        // actuator units on deltas and axis units otherwise
+        int32_t trigger_steps[3];
+        std::bitset<3> triggered;
+        float overrun[3];
+
         std::bitset<3> home_direction;
         std::bitset<3> limit_enable;
         std::bitset<3> axis_to_home;
+        uint32_t edge_priority;     // of the pin edge interrupt before homing
 
         struct {
             uint8_t homing_order:6;
@@ -64,5 +75,6 @@ class Endstops : public Module{
             bool is_scara:1;
             bool home_z_first:1;
             bool move_to_origin_after_home:1;
+            bool edge_pins:1;
         };
 };
@@ -70,56 +70,33 @@
 
 #include "libs/Kernel.h"
 #include "StreamOutputPool.h"
-#include "BufferedSoftSerial.h"
 #include "ModbusSpindleControl.h"
 #include "HuanyangSpindleControl.h"
-#include "gpio.h"
 #include "Modbus.h"
+#include "us_ticker_api.h"
+
+// The frames are queued and sent in the background, so none of these wait for the spindle. Each is echoed by the VFD,
+// a missing or bad echo is reported.
+
+static void check_echo(const char *what, bool ok)
+{
+    if(!ok) THEKERNEL->streams->printf("Spindle: no reply from the VFD to %s\n", what);
+}
 
 void HuanyangSpindleControl::turn_on() 
 {
-    // prepare data for the spindle off command
-    char turn_on_msg[6] = { 0x01, 0x03, 0x01, 0x01, 0x00, 0x00 };
-    // calculate CRC16 checksum
-    unsigned int crc = modbus->crc16(turn_on_msg, sizeof(turn_on_msg)-2);
-    turn_on_msg[4] = crc & 0xFF;
-    turn_on_msg[5] = (crc >> 8);
-
-    // enable transmitter
-    modbus->dir_output->set();
-    modbus->delay(1);
-    // send the actual message
-    modbus->serial->write(turn_on_msg, sizeof(turn_on_msg));
-    // wait a calculated time for the data to be sent 
-    modbus->delay((int) ceil(sizeof(turn_on_msg) * modbus->delay_time));
-    // disable transmitter
-    modbus->dir_output->clear();
-    // wait 50ms, required by the Modbus standard
-    modbus->delay(50);
+    // prepare data for the spindle on command, the CRC is added by modbus
+    char turn_on_msg[4] = { 0x01, 0x03, 0x01, 0x01 };
+    modbus->send(turn_on_msg, sizeof(turn_on_msg), sizeof(turn_on_msg) + 2, [](bool ok, const char *, int) { check_echo("spindle on", ok); });
     spindle_on = true;
 
 }
 
 void HuanyangSpindleControl::turn_off() 
 {
-    // prepare data for the spindle off command
-    char turn_off_msg[6] = { 0x01, 0x03, 0x01, 0x08, 0x00, 0x00 };
-    // calculate CRC16 checksum
-    unsigned int crc = modbus->crc16(turn_off_msg, sizeof(turn_off_msg)-2);
-    turn_off_msg[4] = crc & 0xFF;
-    turn_off_msg[5] = (crc >> 8);
-
-    // enable transmitter
-    modbus->dir_output->set();
-    modbus->delay(1);
-    // send the actual message
-    modbus->serial->write(turn_off_msg, sizeof(turn_off_msg));
-    // wait a calculated time for the data to be sent 
-    modbus->delay((int) ceil(sizeof(turn_off_msg) * modbus->delay_time));
-    // disable transmitter
-    modbus->dir_output->clear();
-    // wait 50ms, required by the Modbus standard
-    modbus->delay(50);
+    // prepare data for the spindle off command, the CRC is added by modbus
+    char turn_off_msg[4] = { 0x01, 0x03, 0x01, 0x08 };
+    modbus->send(turn_off_msg, sizeof(turn_off_msg), sizeof(turn_off_msg) + 2, [](bool ok, const char *, int) { check_echo("spindle off", ok); });
     spindle_on = false;
 
 }
@@ -128,69 +105,52 @@ void HuanyangSpindleControl::set_speed(int target_rpm)
 {
 
     // prepare data for the set speed command
-    char set_speed_msg[7] = { 0x01, 0x05, 0x02, 0x00, 0x00, 0x00, 0x00 };
+    char set_speed_msg[5] = { 0x01, 0x05, 0x02, 0x00, 0x00 };
     // convert RPM into Hz
     unsigned int hz = target_rpm / 60 * 100; 
     set_speed_msg[3] = (hz >> 8);
     set_speed_msg[4] = hz & 0xFF;
-    // calculate CRC16 checksum
-    unsigned int crc = modbus->crc16(set_speed_msg, sizeof(set_speed_msg)-2);
-    set_speed_msg[5] = crc & 0xFF;
-    set_speed_msg[6] = (crc >> 8);
-
-    // enable transmitter
-    modbus->dir_output->set();
-    modbus->delay(1);
-    // send the actual message
-    modbus->serial->write(set_speed_msg, sizeof(set_speed_msg));
-    // wait a calculated time for the data to be sent 
-    modbus->delay((int) ceil(sizeof(set_speed_msg) * modbus->delay_time));
-    // disable transmitter
-    modbus->dir_output->clear();
-    // wait 50ms, required by the Modbus standard
-    modbus->delay(50);
+    modbus->send(set_speed_msg, sizeof(set_speed_msg), sizeof(set_speed_msg) + 2, [](bool ok, const char *, int) { check_echo("set speed", ok); });
 
 }
 
-void HuanyangSpindleControl::report_speed() 
+// queues a read of the output frequency, and reports it when it comes if asked to
+void HuanyangSpindleControl::read_speed(bool report)
 {
-    // clear RX buffer before start
-    while(modbus->serial->readable()){
-        modbus->serial->getc();
-    }
+    reading = true;
+    last_poll_us = us_ticker_read();
 
     // prepare data for the get speed command
-    char get_speed_msg[8] = { 0x01, 0x04, 0x03, 0x00, 0x00, 0x00, 0x00, 0x00 };
-    // calculate CRC16 checksum
-    unsigned int crc = modbus->crc16(get_speed_msg, sizeof(get_speed_msg)-2);
-    get_speed_msg[6] = crc & 0xFF;
-    get_speed_msg[7] = (crc >> 8);
-
-    // enable transmitter
-    modbus->dir_output->set();
-    modbus->delay(1);
-    // send the actual message
-    modbus->serial->write(get_speed_msg, sizeof(get_speed_msg));
-    // wait a calculated time for the data to be sent 
-    modbus->delay((int) ceil(sizeof(get_speed_msg) * modbus->delay_time));
-    // disable transmitter
-    modbus->dir_output->clear();
-    // wait 50ms, required by the Modbus standard
-    modbus->delay(50);
-
-    // wait for the complete message to be received
-    modbus->delay((int) ceil(8 * modbus->delay_time));
-    // prepare an array for the answer
-    char speed[8] = { 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00 };
-   
-    // read the answer into the buffer
-    for(int i=0; i<8; i++) {
-        speed[i] = modbus->serial->getc();
+    char get_speed_msg[6] = { 0x01, 0x04, 0x03, 0x00, 0x00, 0x00 };
+    modbus->send(get_speed_msg, sizeof(get_speed_msg), 8, [this, report](bool ok, const char *reply, int len) {
+        reading = false;
+        if(!ok) {
+            if(report) THEKERNEL->streams->printf("Spindle: no reply from the VFD to read speed\n");
+            return;
+        }
+        // get the Hz value from the answer and convert it into an RPM value
+        unsigned int hz = ((uint8_t)reply[4] << 8) | (uint8_t)reply[5];
+        current_rpm = hz / 100 * 60;
+        // report the current RPM value
+        if(report) THEKERNEL->streams->printf("Current RPM: %d\n", current_rpm);
+    });
+}
+
+void HuanyangSpindleControl::report_speed() 
+{
+    if(poll_ms > 0 && current_rpm >= 0) {
+        // it is read all the time, so report the last one
+        THEKERNEL->streams->printf("Current RPM: %d\n", current_rpm);
+    } else {
+        read_speed(true);
     }
-    // get the Hz value from trhe answer and convert it into an RPM value
-    unsigned int hz = (speed[4] << 8) | speed[5];
-    unsigned int rpm = hz / 100 * 60;
+}
+
+// reads the speed every poll_ms, when the last read has finished
+void HuanyangSpindleControl::on_idle(void *argument)
+{
+    ModbusSpindleControl::on_idle(argument);
 
-    // report the current RPM value
-    THEKERNEL->streams->printf("Current RPM: %d\n", rpm);
+    if(poll_ms == 0 || reading || us_ticker_read() - last_poll_us < poll_ms * 1000) return;
+    read_speed(false);
 }
@@ -23,6 +23,10 @@ class HuanyangSpindleControl: public ModbusSpindleControl {
         void turn_off(void);
         void set_speed(int);
         void report_speed(void);
+        void on_idle(void *);
+        void read_speed(bool report);
+
+        bool reading{false};        // a read of the speed is queued
 };
 
 #endif
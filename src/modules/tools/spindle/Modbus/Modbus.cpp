@@ -9,8 +9,13 @@
 #include "libs/Kernel.h"
 #include "libs/nuts_bolts.h"
 #include "libs/gpio.h"
+#include "SlowTicker.h"
 #include "BufferedSoftSerial.h"
 #include "Modbus.h"
+#include "us_ticker_api.h"
+
+#include <math.h>
+#include <string.h>
 
 Modbus::Modbus( PinName tx_pin, PinName rx_pin, PinName dir_pin){
     serial = new BufferedSoftSerial( tx_pin, rx_pin );
@@ -18,8 +23,7 @@ Modbus::Modbus( PinName tx_pin, PinName rx_pin, PinName dir_pin){
     serial->format(8,serial->Parity::None,1);
     calculate_delay(9600, 8, 0, 1);
     dir_output = new GPIO(dir_pin);
-    dir_output->output();
-    dir_output->clear();
+    init();
 }
 
 Modbus::Modbus( PinName tx_pin, PinName rx_pin, PinName dir_pin, int baud_rate){
@@ -28,8 +32,7 @@ Modbus::Modbus( PinName tx_pin, PinName rx_pin, PinName dir_pin, int baud_rate){
     serial->format(8,serial->Parity::None,1);
     calculate_delay(baud_rate, 8, 0, 1);
     dir_output = new GPIO(dir_pin);
-    dir_output->output();
-    dir_output->clear();
+    init();
 }
 
 Modbus::Modbus( PinName tx_pin, PinName rx_pin, PinName dir_pin, int baud_rate, const char *format){
@@ -53,38 +56,145 @@ Modbus::Modbus( PinName tx_pin, PinName rx_pin, PinName dir_pin, int baud_rate,
         calculate_delay(baud_rate, 8, 0, 1);
     }
     dir_output = new GPIO(dir_pin);
+    init();
+}
+
+void Modbus::init() {
     dir_output->output();
     dir_output->clear();
+    state= IDLE;
+    state_us= 0;
+    gap_us= ceilf(3.5F * delay_time * 1000);
+    // release the transmitter as soon as the last byte of a frame is out
+    serial->attach_tx_done(this, &Modbus::on_sent);
 }
 
 // Called when the module has just been loaded
 void Modbus::on_module_loaded() {
-    // We want to be called every time a new char is received
-    serial->attach(this, &Modbus::on_serial_char_received, BufferedSoftSerial::RxIrq);
+    register_for_event(ON_IDLE);
+    // a byte takes about a millisecond at 9600 baud
+    THEKERNEL->slow_ticker->attach(1000, this, &Modbus::tick);
 }
 
-// Called on Serial::RxIrq interrupt, meaning we have received a char
-void Modbus::on_serial_char_received(){
-    buffer.push_back(serial->getc());
+void Modbus::send(const char *frame, int len, int reply_len, done_t done) {
+    if(len + 2 > MAX_FRAME || reply_len > MAX_FRAME) return;
+
+    // the old blocking code waited for every frame, so this only waits when that many are queued
+    while(queue.size() >= queue.capacity()) {
+        THEKERNEL->call_event(ON_IDLE, this);
+    }
+
+    request_t r;
+    memcpy(r.frame, frame, len);
+    unsigned int crc = crc16(frame, len);
+    r.frame[len] = crc;             // CRC LSB
+    r.frame[len+1] = (crc >> 8);    // CRC MSB
+    r.len= len + 2;
+    r.reply_len= reply_len;
+    r.received= 0;
+    r.ok= false;
+    r.done= done;
+    queue.push_back(r);
 }
 
-void Modbus::read_coil(int slave_addr, int coil_addr, int n_coils){
-    char telegram[8];
-    unsigned int crc;
+// Called from the serial interrupt when the last byte of a frame has been sent
+void Modbus::on_sent() {
+    dir_output->clear();
+    if(state == SENDING) {
+        state_us= us_ticker_read();
+        state= RECEIVING;
+    }
+}
+
+// Called by the SlowTicker, steps the request at the front of the queue through sending it and receiving its reply
+uint32_t Modbus::tick(uint32_t dummy) {
+    uint32_t now= us_ticker_read();
+
+    switch(state) {
+        case GAP:
+            if(now - state_us < gap_us) break;
+            state= IDLE;
+            // fall through
+
+        case IDLE:
+            if(queue.size() == 0) break;
+            // anything left over from a late reply is not for this request
+            while(serial->readable()) serial->getc();
+            state_us= now;
+            state= SENDING;
+            dir_output->set();
+            serial->write(queue.get_tail_ref()->frame, queue.get_tail_ref()->len);
+            break;
+
+        case SENDING:
+            // on_sent() moves on from here, unless the serial port has stopped
+            if(now - state_us < TIMEOUT_MS * 1000) break;
+            dir_output->clear();
+            state= FINISHED;
+            break;
+
+        case RECEIVING: {
+            request_t *r= queue.get_tail_ref();
+            while(serial->readable() && r->received < MAX_FRAME) {
+                r->reply[r->received++]= serial->getc();
+            }
+            if(r->reply_len == 0) {
+                // nothing to wait for
+                r->ok= true;
+            } else {
+                int status= check_reply(r->frame, r->reply, r->received, r->reply_len);
+                if(status == REPLY_INCOMPLETE && now - state_us < TIMEOUT_MS * 1000) break;
+                r->ok= (status == REPLY_OK);
+            }
+            state= FINISHED;
+            break;
+        }
+
+        case FINISHED:
+            // waiting for on_idle to call back
+            break;
+    }
+
+    return 0;
+}
+
+// Calls back for a request that has finished, then the next can be sent after the silent interval
+void Modbus::on_idle(void *) {
+    if(state != FINISHED) return;
+
+    request_t *r= queue.get_tail_ref();
+    if(r->done) r->done(r->ok, r->reply, r->received);
+    r->done= nullptr;
+    queue.delete_tail();
+
+    state_us= us_ticker_read();
+    state= GAP;
+}
+
+int Modbus::check_reply(const char *frame, const char *reply, int len, int reply_len) {
+    if(len < 2) return REPLY_INCOMPLETE;
+    if(reply[0] != frame[0] || (reply[1] & 0x7F) != frame[1]) return REPLY_BAD;
+
+    // an exception reply is the function with its top bit set, the exception code and the CRC
+    bool exception= (reply[1] & 0x80) != 0;
+    int expected= exception ? 5 : reply_len;
+    if(len < expected) return REPLY_INCOMPLETE;
+
+    unsigned int crc = crc16(reply, expected - 2);
+    if(reply[expected-2] != (char)(crc & 0xFF) || reply[expected-1] != (char)(crc >> 8)) return REPLY_BAD;
+    return exception ? REPLY_BAD : REPLY_OK;
+}
+
+void Modbus::read_coil(int slave_addr, int coil_addr, int n_coils, done_t done){
+    char telegram[6];
     telegram[0] = slave_addr;       // Slave address
     telegram[1] = 0x01;             // Function code
     telegram[2] = (coil_addr >> 8); // Coil address MSB
     telegram[3] = coil_addr & 0xFF; // Coil address LSB
     telegram[4] = (n_coils >> 8);   // number of coils to read MSB
     telegram[5] = n_coils & 0xFF;   // number of coils to read LSB
-    crc = crc16(telegram, 6);       
-    telegram[6] = crc;              // CRC LSB
-    telegram[7] = (crc >> 8);       // CRC MSB
-    dir_output->set();
-    serial->write(telegram,8);
-    delay((int) ceil(50 + 8 * delay_time));
-    dir_output->clear();
-    // TODO: read reply from buffer and return it
+    // the reply is the address, function, byte count, a bit per coil and the CRC
+    send(telegram, 6, 3 + (n_coils + 7) / 8 + 2, done);
 }
 
 void Modbus::read_holding_register(int slave_addr, int reg_addr, int n_regs){
@@ -93,40 +203,28 @@ void Modbus::read_holding_register(int slave_addr, int reg_addr, int n_regs){
 }
 
 void Modbus::write_coil(int slave_addr, int coil_addr, bool data){
-    char telegram[8];
-    unsigned int crc;
+    char telegram[6];
     telegram[0] = slave_addr;       // Slave address
     telegram[1] = 0x05;             // Function code
     telegram[2] = (coil_addr >> 8); // Coil address MSB
     telegram[3] = coil_addr & 0xFF; // Coil address LSB
     telegram[4] = 0x00;             // Data MSB
     telegram[5] = (data == true) ? 0xFF : 0x00; // Data LSB
-    crc = crc16(telegram, 6);       
-    telegram[6] = crc;              // CRC LSB
-    telegram[7] = (crc >> 8);       // CRC MSB
-    dir_output->set();
-    serial->write(telegram,8);
-    delay((int) ceil(50 + 8 * delay_time));
-    dir_output->clear();
+    // the reply echoes the request
+    send(telegram, 6, 8);
 }
 
 
 void Modbus::write_holding_register(int slave_addr, int reg_addr, int data){
-    char telegram[8];
-    unsigned int crc;
+    char telegram[6];
     telegram[0] = slave_addr;       // Slave address
     telegram[1] = 0x06;             // Function code
     telegram[2] = (reg_addr >> 8);  // Register address MSB
     telegram[3] = reg_addr;         // Register address LSB
     telegram[4] = (data >> 8);      // Data MSB
     telegram[5] = data;             // Data LSB
-    crc = crc16(telegram, 6);       
-    telegram[6] = crc;              // CRC LSB
-    telegram[7] = (crc >> 8);       // CRC MSB
-    dir_output->set();
-    serial->write(telegram,8);
-    delay((int) ceil(50 + 8 * delay_time));
-    dir_output->clear();
+    // the reply echoes the request
+    send(telegram, 6, 8);
 }
 
 void Modbus::diagnostic(int slave_addr, int test_sub_code, int data){
@@ -153,16 +251,7 @@ void Modbus::calculate_delay(int baudrate, int bits, int parity, int stop) {
     delay_time = bittime * (1 + bits + parity + 1);
 }
 
-void Modbus::delay(unsigned int value) {
-    
-    uint32_t start = us_ticker_read(); // mbed call
-    while ((us_ticker_read() - start) < value*1000) {
-        THEKERNEL->call_event(ON_IDLE, this);
-    }
-
-}
-
-unsigned int Modbus::crc16(char *data, unsigned int len) {
+unsigned int Modbus::crc16(const char *data, unsigned int len) {
     
     static const unsigned short crc_table[] = {
     0X0000, 0XC0C1, 0XC181, 0X0140, 0XC301, 0X03C0, 0X0280, 0XC241,
@@ -9,21 +9,44 @@
 #define MODBUS_H
 
 #include "libs/Module.h"
-#include <vector>
+#include "libs/RingBuffer.h"
+#include "PinNames.h"
+
+#include <functional>
+#include <stdint.h>
 
 class BufferedSoftSerial;
 class GPIO;
 
+// Modbus RTU master on a soft serial port with an RS485 direction pin.
+// Frames are queued by send() and go out one at a time without blocking the caller. The SlowTicker steps each one
+// through sending, waiting for its reply and the silent interval before the next, and the end of sending is caught in
+// the serial interrupt so the transmitter is released straight away. A reply is checked for its length, address,
+// function and CRC, and a request that gets no reply within the timeout fails. The callback given with a frame is
+// called from the idle loop once it has finished.
 class Modbus : public Module {
     public:
+        // ok is false on a timeout, a bad CRC or an exception reply, reply and len are what was received
+        typedef std::function<void(bool ok, const char *reply, int len)> done_t;
+
+        // the longest a reply is waited for
+        static const uint32_t TIMEOUT_MS= 100;
+        // the longest frame that can be sent or received, including its CRC
+        static const int MAX_FRAME= 16;
+
         Modbus( PinName rx_pin, PinName tx_pin, PinName dir_pin);
         Modbus( PinName rx_pin, PinName tx_pin, PinName dir_pin, int baud_rate);
         Modbus( PinName rx_pin, PinName tx_pin, PinName dir_pin, int baud_rate, const char *format);
 
         void on_module_loaded();
-        void on_serial_char_received();
+        void on_idle(void *);
+
+        // queues a frame, the CRC is added here, reply_len is the length of the reply with its CRC or 0 if there is
+        // none, waits only if the queue is full
+        void send(const char *frame, int len, int reply_len, done_t done= nullptr);
+        bool is_idle() { return queue.size() == 0; }
 
-        void read_coil(int slave_addr, int coil_addr, int n_coils);
+        void read_coil(int slave_addr, int coil_addr, int n_coils, done_t done= nullptr);
         void read_holding_register(int slave_addr, int reg_addr, int n_regs);
         void write_coil(int slave_addr, int coil_addr, bool data);
         void write_holding_register(int slave_addr, int reg_addr, int data);
@@ -32,15 +55,39 @@ class Modbus : public Module {
         void write_multiple_registers(int slave_addr, int start_addr, int data);
         void read_write_multiple_holding_registers(int slave_addr, int read_addr, int n_read, int write_addr, int data);
         void calculate_delay(int baudrate, int bits, int parity, int stop);
-        void delay(unsigned int);
-        unsigned int crc16(char *data, unsigned int len); 
+        static unsigned int crc16(const char *data, unsigned int len);
+        // checks the len bytes received so far in reply to frame, which is good if it is reply_len long with the
+        // address and function of the frame and a good CRC, and bad if it is wrong or an exception reply
+        enum REPLY { REPLY_INCOMPLETE, REPLY_OK, REPLY_BAD };
+        static int check_reply(const char *frame, const char *reply, int len, int reply_len);
 
         GPIO *dir_output;
 
         BufferedSoftSerial* serial;
-        std::vector<int> buffer;
 
-        float delay_time;        
+        float delay_time;           // ms per character
+
+    private:
+        struct request_t {
+            char frame[MAX_FRAME];
+            char reply[MAX_FRAME];
+            uint8_t len;
+            uint8_t reply_len;
+            uint8_t received;
+            bool ok;
+            done_t done;
+        };
+
+        enum STATE { IDLE, SENDING, RECEIVING, FINISHED, GAP };
+
+        void init();
+        uint32_t tick(uint32_t dummy);
+        void on_sent();
+
+        RingBuffer<request_t, 8> queue;
+        uint32_t state_us;          // when the current state started
+        uint32_t gap_us;            // the silent interval between frames, 3.5 characters
+        volatile uint8_t state;
 };
 
 #endif
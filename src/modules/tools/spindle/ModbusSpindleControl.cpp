@@ -19,6 +19,7 @@
 #define spindle_rx_pin_checksum             CHECKSUM("rx_pin")
 #define spindle_tx_pin_checksum             CHECKSUM("tx_pin")
 #define spindle_dir_pin_checksum            CHECKSUM("dir_pin")
+#define spindle_poll_ms_checksum            CHECKSUM("poll_ms")
 
 void ModbusSpindleControl::on_module_loaded()
 {
@@ -46,10 +47,49 @@ void ModbusSpindleControl::on_module_loaded()
         delete smoothie_pin;
     }
 
-    // setup the Modbus interface
+    // setup the Modbus interface, it sends the frames it is given in the background
     modbus = new Modbus(tx_pin, rx_pin, dir_pin);
+    THEKERNEL->add_module(modbus);
+
+    poll_ms = THEKERNEL->config->value(spindle_checksum, spindle_poll_ms_checksum)->by_default(0)->as_number();
+    last_poll_us = 0;
+    current_rpm = -1;
+    requested_on = -1;
+    requested_rpm = -1;
 
     // register for events
     register_for_event(ON_GCODE_RECEIVED);
+    register_for_event(ON_IDLE);
+}
+
+void ModbusSpindleControl::block_action(uint8_t action, float value)
+{
+    switch(action) {
+        case SPINDLE_ON: requested_on = 1; break;
+        case SPINDLE_OFF: requested_on = 0; break;
+        case SPINDLE_SPEED: requested_rpm = value < 0 ? 0 : value; break;
+    }
+}
+
+// sends the VFD what the actions have asked for since the last time
+void ModbusSpindleControl::on_idle(void *)
+{
+    if(requested_on < 0 && requested_rpm < 0) return;
+
+    __disable_irq();
+    int8_t on = requested_on;
+    int rpm = requested_rpm;
+    requested_on = -1;
+    requested_rpm = -1;
+    __enable_irq();
+
+    if(on == 1 && !spindle_on) {
+        turn_on();
+    } else if(on == 0 && spindle_on) {
+        turn_off();
+    }
+    if(rpm >= 0) {
+        set_speed(rpm);
+    }
 }
 
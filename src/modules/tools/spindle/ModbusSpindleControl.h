@@ -18,6 +18,9 @@ class ModbusSpindleControl: public SpindleControl {
         ModbusSpindleControl() {};
         virtual ~ModbusSpindleControl() {};
         void on_module_loaded();
+        void on_idle(void *);
+        // the VFD cannot be sent anything from the step ticker interrupt, so what is asked for is kept for on_idle()
+        void block_action(uint8_t action, float value);
         
         Modbus* modbus;
         
@@ -26,6 +29,16 @@ class ModbusSpindleControl: public SpindleControl {
         virtual void set_speed(int);
         virtual void report_speed(void);
 
+    protected:
+        // how often the speed is read in the background, 0 to only read it for M957
+        uint32_t poll_ms;
+        uint32_t last_poll_us;
+        int current_rpm;            // from the last read, -1 if there has not been one
+
+        // asked for by the actions done since on_idle() last ran
+        volatile int8_t requested_on;   // 1 on, 0 off, -1 no change
+        volatile int requested_rpm;     // -1 no change
+
 };
 
 #endif
@@ -38,6 +38,7 @@ private:
 
      RingBuffer<char,32> _rxbuf;
      RingBuffer<char,32> _txbuf;
+     FunctionPointer _tx_done;
     //Buffer <char> _rxbuf;
     //Buffer <char> _txbuf;
  
@@ -93,6 +94,15 @@ public:
      *  @return The number of bytes written to the Serial Port Buffer
      */
     virtual ssize_t write(const void *s, std::size_t length);
+
+    /** Attach a member function to call from the interrupt when the last byte in the tx buffer has been sent
+     *  @param tptr pointer to the object to call the member function on
+     *  @param mptr pointer to the member function to be called
+     */
+    template<typename T>
+    void attach_tx_done(T* tptr, void (T::*mptr)(void)) {
+        _tx_done.attach(tptr, mptr);
+    }
 };
 
 #endif
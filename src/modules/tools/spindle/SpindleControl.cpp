@@ -39,27 +39,42 @@ void SpindleControl::on_gcode_received(void *argument)
         }
         else if (gcode->m == 3) 
         {
-            THECONVEYOR->wait_for_idle();
             // M3: Spindle on
-            if(!spindle_on) {
-                turn_on();
-            }
+            THECONVEYOR->queue_action(this, SPINDLE_ON, 0);
             
             // M3 with S value provided: set speed
             if (gcode->has_letter('S'))
             {
-                set_speed(gcode->get_value('S'));
+                THECONVEYOR->queue_action(this, SPINDLE_SPEED, gcode->get_value('S'));
             }
         }
         else if (gcode->m == 5)
         {
-            THECONVEYOR->wait_for_idle();
             // M5: spindle off
+            THECONVEYOR->queue_action(this, SPINDLE_OFF, 0);
+        }
+    }
+
+}
+
+void SpindleControl::block_action(uint8_t action, float value)
+{
+    switch(action) {
+        case SPINDLE_ON:
+            if(!spindle_on) {
+                turn_on();
+            }
+            break;
+
+        case SPINDLE_OFF:
             if(spindle_on) {
                 turn_off();
             }
-        }
-    }
+            break;
 
+        case SPINDLE_SPEED:
+            set_speed(value);
+            break;
+    }
 }
 
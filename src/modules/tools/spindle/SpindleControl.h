@@ -9,14 +9,21 @@
 #define SPINDLE_CONTROL_MODULE_H
 
 #include "libs/Module.h"
+#include "modules/robot/Conveyor.h"
 
-class SpindleControl: public Module {
+class SpindleControl: public Module, public BlockActionTarget {
     public:
         SpindleControl() {};
         virtual ~SpindleControl() {};
         virtual void on_module_loaded() {};
 
+        // M3, M5 and speed changes are done as the block queued after them starts, so the moves around them run on
+        // without stopping, by default straight from the step ticker interrupt
+        virtual void block_action(uint8_t action, float value);
+
     protected:
+        enum ACTION { SPINDLE_ON, SPINDLE_OFF, SPINDLE_SPEED };
+
         bool spindle_on;
 
     private:
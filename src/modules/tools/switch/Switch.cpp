@@ -45,6 +45,7 @@
 #define    pwm_period_ms_checksum       CHECKSUM("pwm_period_ms")
 #define    failsafe_checksum            CHECKSUM("failsafe_set_to")
 #define    ignore_onhalt_checksum       CHECKSUM("ignore_on_halt")
+#define    sync_with_motion_checksum    CHECKSUM("sync_with_motion")
 
 Switch::Switch() {}
 
@@ -99,6 +100,7 @@ void Switch::on_config_reload(void *argument)
     string type = THEKERNEL->config->value(switch_checksum, this->name_checksum, output_type_checksum )->by_default("pwm")->as_string();
     this->failsafe= THEKERNEL->config->value(switch_checksum, this->name_checksum, failsafe_checksum )->by_default(0)->as_number();
     this->ignore_on_halt= THEKERNEL->config->value(switch_checksum, this->name_checksum, ignore_onhalt_checksum )->by_default(false)->as_bool();
+    this->sync_with_motion= THEKERNEL->config->value(switch_checksum, this->name_checksum, sync_with_motion_checksum )->by_default(false)->as_bool();
 
     if(type == "pwm"){
         this->output_type= SIGMADELTA;
@@ -243,53 +245,71 @@ void Switch::on_gcode_received(void *argument)
         return;
     }
 
-    // we need to sync this with the queue, so we need to wait for queue to empty, however due to certain slicers
-    // issuing redundant swicth on calls regularly we need to optimize by making sure the value is actually changing
-    // hence we need to do the wait for queue in each case rather than just once at the start
+    // we need to sync this with the queue, either by having the block queued next do it as it starts or by waiting
+    // for the queue to empty, however due to certain slicers issuing redundant swicth on calls regularly we need to
+    // optimize by making sure the value is actually changing hence we need to do the sync in each case rather than
+    // just once at the start
+    uint8_t action;
+    float value= 0;
     if(match_input_on_gcode(gcode)) {
+        action= OUTPUT_ON;
         if (this->output_type == SIGMADELTA) {
             // SIGMADELTA output pin turn on (or off if S0)
             if(gcode->has_letter('S')) {
                 int v = roundf(gcode->get_value('S') * sigmadelta_pin->max_pwm() / 255.0F); // scale by max_pwm so input of 255 and max_pwm of 128 would set value to 128
-                if(v != this->sigmadelta_pin->get_pwm()){ // optimize... ignore if already set to the same pwm
-                    // drain queue
-                    THEKERNEL->conveyor->wait_for_idle();
-                    this->sigmadelta_pin->pwm(v);
-                    this->switch_state= (v > 0);
-                }
+                if(v == this->sigmadelta_pin->get_pwm() && !this->sync_with_motion) return; // optimize... ignore if already set to the same pwm
+                value= v;
             } else {
-                // drain queue
-                THEKERNEL->conveyor->wait_for_idle();
-                this->sigmadelta_pin->pwm(this->switch_value);
-                this->switch_state= (this->switch_value > 0);
+                value= this->switch_value;
             }
 
         } else if (this->output_type == HWPWM) {
-            // drain queue
-            THEKERNEL->conveyor->wait_for_idle();
             // PWM output pin set duty cycle 0 - 100
             if(gcode->has_letter('S')) {
                 float v = gcode->get_value('S');
                 if(v > 100) v= 100;
                 else if(v < 0) v= 0;
-                this->pwm_pin->write(v/100.0F);
-                this->switch_state= (v != 0);
+                value= v/100.0F;
             } else {
-                this->pwm_pin->write(this->switch_value);
-                this->switch_state= (this->switch_value != 0);
+                value= this->switch_value;
             }
 
+        } else if (this->output_type != DIGITAL) {
+            return;
+        }
+
+    } else {
+        action= OUTPUT_OFF;
+    }
+
+    if(this->sync_with_motion) {
+        THEKERNEL->conveyor->queue_action(this, action, value);
+    } else {
+        // drain queue
+        THEKERNEL->conveyor->wait_for_idle();
+        block_action(action, value);
+    }
+}
+
+// value is the pwm for SIGMADELTA and the duty cycle for HWPWM
+void Switch::block_action(uint8_t action, float value)
+{
+    if(action == OUTPUT_ON) {
+        if (this->output_type == SIGMADELTA) {
+            this->sigmadelta_pin->pwm(value);
+            this->switch_state= (value > 0);
+
+        } else if (this->output_type == HWPWM) {
+            this->pwm_pin->write(value);
+            this->switch_state= (value != 0);
+
         } else if (this->output_type == DIGITAL) {
-            // drain queue
-            THEKERNEL->conveyor->wait_for_idle();
             // logic pin turn on
             this->digital_pin->set(true);
             this->switch_state = true;
         }
 
-    } else if(match_input_off_gcode(gcode)) {
-        // drain queue
-        THEKERNEL->conveyor->wait_for_idle();
+    } else {
         this->switch_state = false;
         if (this->output_type == SIGMADELTA) {
             // SIGMADELTA output pin
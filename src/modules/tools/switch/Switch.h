@@ -10,6 +10,7 @@
 
 #include "Pin.h"
 #include "Pwm.h"
+#include "modules/robot/Conveyor.h"
 #include <math.h>
 
 #include <string>
@@ -22,7 +23,7 @@ namespace mbed {
     class PwmOut;
 }
 
-class Switch : public Module {
+class Switch : public Module, public BlockActionTarget {
     public:
         Switch();
         Switch(uint16_t name);
@@ -36,9 +37,13 @@ class Switch : public Module {
         void on_halt(void *arg);
 
         uint32_t pinpoll_tick(uint32_t dummy);
+        // sets the output, from the step ticker interrupt if it is synced with the moves
+        void block_action(uint8_t action, float value);
         enum OUTPUT_TYPE {NONE, SIGMADELTA, DIGITAL, HWPWM};
 
     private:
+        enum ACTION { OUTPUT_OFF, OUTPUT_ON };
+
         void flip();
         void send_gcode(string msg, StreamOutput* stream);
         bool match_input_on_gcode(const Gcode* gcode) const;
@@ -60,13 +65,14 @@ class Switch : public Module {
         uint16_t  input_off_command_code;
         char      input_on_command_letter;
         char      input_off_command_letter;
+        volatile bool switch_state;     // not in the bitfield as block_action() sets it from an interrupt
         struct {
             uint8_t   subcode:4;
             bool      switch_changed:1;
             bool      input_pin_state:1;
-            bool      switch_state:1;
             bool      ignore_on_halt:1;
             uint8_t   failsafe:1;
+            bool      sync_with_motion:1;
         };
 };
 
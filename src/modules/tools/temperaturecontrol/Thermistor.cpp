@@ -22,6 +22,7 @@
 #include <fastmath.h>
 
 #include "MRI_Hooks.h"
+#include "mbed.h"
 
 #define UNDEFINED -1
 
@@ -38,12 +39,21 @@
 #define coefficients_checksum              CHECKSUM("coefficients")
 #define use_beta_table_checksum            CHECKSUM("use_beta_table")
 
+// the lookup table covers readings up to this temperature
+#define TABLE_MAX_TEMP 300.0F
+// and is first built to this, the tolerance is raised if that takes too many points
+#define TABLE_TOLERANCE 0.05F
+
 
 Thermistor::Thermistor()
 {
     this->bad_config = false;
     this->use_steinhart_hart= false;
     this->beta= 0.0F; // not used by default
+    this->r0= 100000;
+    this->t0= 25;
+    this->r1= 0;
+    this->r2= 4700;
     min_temp= 999;
     max_temp= 0;
     this->thermistor_number= 0; // not a predefined thermistor
@@ -125,6 +135,7 @@ void Thermistor::UpdateConfig(uint16_t module_checksum, uint16_t name_checksum)
     // Thermistor pin for ADC readings
     this->thermistor_pin.from_string(THEKERNEL->config->value(module_checksum, name_checksum, thermistor_pin_checksum )->required()->as_string());
     THEKERNEL->adc->enable_pin(&thermistor_pin);
+    THEKERNEL->adc->configure_filter(&thermistor_pin, module_checksum, name_checksum);
 
     // specify the three Steinhart-Hart coefficients
     // specified as three comma separated floats, no spaces
@@ -180,6 +191,7 @@ void Thermistor::UpdateConfig(uint16_t module_checksum, uint16_t name_checksum)
         return;
     }
 
+    build_table();
 }
 
 // print out predefined thermistors
@@ -234,6 +246,56 @@ void Thermistor::calc_jk()
     }
 }
 
+// builds the table from the curve, from TABLE_MAX_TEMP to where the thermistor looks open circuit
+void Thermistor::build_table()
+{
+    InterpolationTable<table_points> t;
+    if(!this->bad_config) {
+        const uint32_t max_adc_value= THEKERNEL->adc->get_max_value();
+
+        // the temperature falls as the reading rises, find the first reading at or below TABLE_MAX_TEMP
+        uint32_t lo= 1, hi= max_adc_value - 1;
+        while(hi - lo > 1) {
+            uint32_t mid= (lo + hi) / 2;
+            if(calculate_temperature(mid) > TABLE_MAX_TEMP) lo= mid;
+            else hi= mid;
+        }
+        uint32_t x_min= hi;
+
+        // and the last reading that is not open circuit
+        lo= x_min; hi= max_adc_value - 1;
+        if(isfinite(calculate_temperature(hi))) {
+            lo= hi;
+        } else {
+            while(hi - lo > 1) {
+                uint32_t mid= (lo + hi) / 2;
+                if(isfinite(calculate_temperature(mid))) lo= mid;
+                else hi= mid;
+            }
+        }
+        uint32_t x_max= lo;
+
+        t.build(x_min, x_max, [this](uint16_t x) { return calculate_temperature(x); }, TABLE_TOLERANCE);
+    }
+
+    // the reading tick may be using the old one
+    __disable_irq();
+    this->table= t;
+    __enable_irq();
+}
+
+void Thermistor::print_table(StreamOutput *stream)
+{
+    if(this->table.is_empty()) {
+        stream->printf("no lookup table, every reading is calculated\n");
+        return;
+    }
+
+    float e= this->table.max_error([this](uint16_t x) { return calculate_temperature(x); });
+    stream->printf("lookup table: %d points from %1.1f to %1.1f, max interpolation error= %1.3f\n",
+                   this->table.size(), this->table.lookup(this->table.get_max()), this->table.lookup(this->table.get_min()), e);
+}
+
 float Thermistor::get_temperature()
 {
     if(bad_config) return infinityf();
@@ -270,6 +332,8 @@ void Thermistor::get_raw()
         THEKERNEL->streams->printf("beta temp= %f, min= %f, max= %f, delta= %f\n", t, min_temp, max_temp, max_temp-min_temp);
     }
 
+    print_table(THEKERNEL->streams);
+
     // if using a predefined thermistor show its name and which table it is from
     if(thermistor_number != 0) {
         string name= (thermistor_number&0x80) ? predefined_thermistors_beta[(thermistor_number&0x7F)-1].name :  predefined_thermistors[thermistor_number-1].name;
@@ -281,6 +345,16 @@ void Thermistor::get_raw()
 }
 
 float Thermistor::adc_value_to_temperature(uint32_t adc_value)
+{
+    if(!this->table.is_empty() && adc_value >= this->table.get_min() && adc_value <= this->table.get_max()) {
+        return this->table.lookup(adc_value);
+    }
+
+    return calculate_temperature(adc_value);
+}
+
+// the curve itself, used for readings outside the table and to build it
+float Thermistor::calculate_temperature(uint32_t adc_value) const
 {
     const uint32_t max_adc_value= THEKERNEL->adc->get_max_value();
     if ((adc_value >= max_adc_value) || (adc_value == 0))
@@ -352,6 +426,7 @@ bool Thermistor::set_optional(const sensor_options_t& options) {
             calc_jk();
             thermistor_number= predefined;
             this->bad_config= false;
+            build_table();
             return true;
 
         }else {
@@ -370,6 +445,7 @@ bool Thermistor::set_optional(const sensor_options_t& options) {
             use_steinhart_hart= true;
             thermistor_number= predefined;
             this->bad_config= false;
+            build_table();
             return true;
         }
     }
@@ -397,6 +473,7 @@ bool Thermistor::set_optional(const sensor_options_t& options) {
 
     if(this->bad_config) this->bad_config= false;
 
+    build_table();
     return true;
 }
 
@@ -10,6 +10,7 @@
 
 #include "TempSensor.h"
 #include "RingBuffer.h"
+#include "InterpolationTable.h"
 #include "Pin.h"
 
 #include <tuple>
@@ -32,11 +33,15 @@ class Thermistor : public TempSensor
         void get_raw();
         static std::tuple<float,float,float> calculate_steinhart_hart_coefficients(float t1, float r1, float t2, float r2, float t3, float r3);
         static void print_predefined_thermistors(StreamOutput*);
+        // prints how closely the lookup table follows the curve
+        void print_table(StreamOutput*);
 
     private:
         int new_thermistor_reading();
         float adc_value_to_temperature(uint32_t adc_value);
+        float calculate_temperature(uint32_t adc_value) const;
         void calc_jk();
+        void build_table();
 
         // Thermistor computation settings using beta, not used if using Steinhart-Hart
         float r0;
@@ -62,6 +67,10 @@ class Thermistor : public TempSensor
 
         Pin  thermistor_pin;
 
+        // the curve from the ADC reading to the temperature, readings hotter than it covers are calculated
+        static const int table_points= 32;
+        InterpolationTable<table_points> table;
+
         float min_temp, max_temp;
         struct {
             bool bad_config:1;
@@ -379,6 +379,7 @@ bool DeltaCalibrationStrategy::calibrate_delta_radius(Gcode *gcode)
         // set the new delta radius
         options['R'] = delta_radius;
         THEROBOT->arm_solution->set_optional(options);
+        THEROBOT->arm_solution_updated();
         gcode->stream->printf("Setting delta radius to: %1.4f\n", delta_radius);
 
         zprobe->home();
@@ -26,6 +26,7 @@
 #include "LevelingStrategy.h"
 #include "StepTicker.h"
 #include "utils.h"
+#include "InterruptIn.h" // mbed
 
 // strategies we know about
 #include "DeltaCalibrationStrategy.h"
@@ -36,6 +37,7 @@
 #define enable_checksum          CHECKSUM("enable")
 #define probe_pin_checksum       CHECKSUM("probe_pin")
 #define debounce_ms_checksum     CHECKSUM("debounce_ms")
+#define glitch_filter_checksum   CHECKSUM("glitch_filter")
 #define slow_feedrate_checksum   CHECKSUM("slow_feedrate")
 #define fast_feedrate_checksum   CHECKSUM("fast_feedrate")
 #define return_feedrate_checksum CHECKSUM("return_feedrate")
@@ -71,8 +73,18 @@ void ZProbe::on_module_loaded()
     // register event-handlers
     register_for_event(ON_GCODE_RECEIVED);
 
-    // we read the probe in this timer, currently only for G38 probes.
     probing= false;
+
+    // on a pin that can interrupt the probe is caught on the edge, wherever the motors are between two ticks of the
+    // step ticker, otherwise and as a back stop it is read in this timer
+    if(this->pin.can_interrupt()) {
+        this->edge_pin= this->pin.interrupt_pin();
+        // the mbed set up turns the pull up on, put back what was configured
+        this->pin.from_string(THEKERNEL->config->value(zprobe_checksum, probe_pin_checksum)->as_string())->as_input();
+        // both edges as M670 I can change which one is the trigger
+        this->edge_pin->rise(this, &ZProbe::on_pin_edge);
+        this->edge_pin->fall(this, &ZProbe::on_pin_edge);
+    }
     THEKERNEL->slow_ticker->attach(1000, this, &ZProbe::read_probe);
 }
 
@@ -80,6 +92,8 @@ void ZProbe::config_load()
 {
     this->pin.from_string( THEKERNEL->config->value(zprobe_checksum, probe_pin_checksum)->by_default("nc" )->as_string())->as_input();
     this->debounce_ms    = THEKERNEL->config->value(zprobe_checksum, debounce_ms_checksum)->by_default(0  )->as_number();
+    // on an edge the pin must still read triggered this many more times in a row or it was a glitch
+    this->glitch_filter  = THEKERNEL->config->value(zprobe_checksum, glitch_filter_checksum)->by_default(0  )->as_number();
 
     // get strategies to load
     vector<uint16_t> modules;
@@ -146,10 +160,7 @@ uint32_t ZProbe::read_probe(uint32_t dummy)
             if(debounce < debounce_ms) {
                 debounce++;
             } else {
-                // we signal the motors to stop, which will preempt any moves on that axis
-                // we do all motors as it may be a delta
-                for(auto &a : THEROBOT->actuators) a->stop_moving();
-                probe_detected= true;
+                trigger();
                 debounce= 0;
             }
 
@@ -162,6 +173,41 @@ uint32_t ZProbe::read_probe(uint32_t dummy)
     return 0;
 }
 
+// Called on either edge of the probe pin, at a lower priority than the step ticker so the motors are between ticks
+void ZProbe::on_pin_edge()
+{
+    if(!probing || probe_detected) return;
+    if(!(STEPPER[X_AXIS]->is_moving() || STEPPER[Y_AXIS]->is_moving() || STEPPER[Z_AXIS]->is_moving())) return;
+
+    for (uint16_t i = 0; i <= glitch_filter; ++i) {
+        if(!this->pin.get()) return;
+    }
+    trigger();
+}
+
+// latch where the actuators are and stop them, from the edge interrupt or the timer whichever is first
+void ZProbe::trigger()
+{
+    __disable_irq();
+    if(!probe_detected) {
+        for (int i = X_AXIS; i <= Z_AXIS; ++i) {
+            trigger_steps[i]= STEPPER[i]->get_current_step();
+        }
+        // we signal the motors to stop, which will preempt any moves on that axis
+        // we do all motors as it may be a delta
+        for(auto &a : THEROBOT->actuators) a->stop_moving();
+        probe_detected= true;
+    }
+    __enable_irq();
+}
+
+// where the actuator was when the probe triggered, or where it is if it did not
+float ZProbe::get_trigger_position(int axis) const
+{
+    if(!probe_detected) return STEPPER[axis]->get_current_position();
+    return (int32_t)trigger_steps[axis] / STEPS_PER_MM(axis);
+}
+
 // single probe in Z with custom feedrate
 // returns boolean value indicating if probe was triggered
 bool ZProbe::run_probe(float& mm, float feedrate, float max_dist, bool reverse)
@@ -171,6 +217,8 @@ bool ZProbe::run_probe(float& mm, float feedrate, float max_dist, bool reverse)
     probing= true;
     probe_detected= false;
     debounce= 0;
+    // the probe latches between two step ticks only while the edge interrupt is above the rest
+    if(edge_pin != nullptr) edge_priority= Pin::raise_edge_priority();
 
     // save current actuator position so we can report how far we moved
     ActuatorCoordinates start_pos{
@@ -190,19 +238,22 @@ bool ZProbe::run_probe(float& mm, float feedrate, float max_dist, bool reverse)
     THECONVEYOR->wait_for_idle();
     THEROBOT->disable_segmentation= false;
 
-    // now see how far we moved, get delta in z we moved
+    // now see how far we moved to where the probe triggered, get delta in z we moved
     // NOTE this works for deltas as well as all three actuators move the same amount in Z
-    mm= start_pos[2] - THEROBOT->actuators[2]->get_current_position();
+    mm= start_pos[2] - get_trigger_position(Z_AXIS);
+    // the motors step on to the end of the tick they were stopped in, return_probe() moves back that far too
+    overrun_mm= get_trigger_position(Z_AXIS) - THEROBOT->actuators[Z_AXIS]->get_current_position();
 
     // set the last probe position to the actuator units moved during this home
     THEROBOT->set_last_probe_position(
         std::make_tuple(
-            start_pos[0] - THEROBOT->actuators[0]->get_current_position(),
-            start_pos[1] - THEROBOT->actuators[1]->get_current_position(),
+            start_pos[0] - get_trigger_position(X_AXIS),
+            start_pos[1] - get_trigger_position(Y_AXIS),
             mm,
             probe_detected?1:0));
 
     probing= false;
+    if(edge_pin != nullptr) Pin::restore_edge_priority(edge_priority);
 
     if(probe_detected) {
         // if the probe stopped the move we need to correct the last_milestone as it did not reach where it thought
@@ -212,8 +263,12 @@ bool ZProbe::run_probe(float& mm, float feedrate, float max_dist, bool reverse)
     return probe_detected;
 }
 
+// mm is as returned by run_probe(), the overrun past the trigger is added so it gets back to where it started
 bool ZProbe::return_probe(float mm, bool reverse)
 {
+    mm += overrun_mm;
+    overrun_mm= 0;
+
     // move probe back to where it was
     float fr;
     if(this->return_feedrate != 0) { // use return_feedrate if set
@@ -291,17 +346,18 @@ void ZProbe::on_gcode_received(void *argument)
                 // the result is in actuator coordinates and raw steps
                 gcode->stream->printf("Z:%1.4f\n", mm);
 
-                // set the last probe position to the current actuator units
+                // set the last probe position to the actuator units where it triggered
                 THEROBOT->set_last_probe_position(std::make_tuple(
-                    THEROBOT->actuators[X_AXIS]->get_current_position(),
-                    THEROBOT->actuators[Y_AXIS]->get_current_position(),
-                    THEROBOT->actuators[Z_AXIS]->get_current_position(),
+                    get_trigger_position(X_AXIS),
+                    get_trigger_position(Y_AXIS),
+                    get_trigger_position(Z_AXIS),
                     1));
 
                 // move back to where it started, unless a Z is specified (and not a rotary delta)
                 if(gcode->has_letter('Z') && !is_rdelta) {
-                    // set Z to the specified value, and leave probe where it is
-                    THEROBOT->reset_axis_position(gcode->get_value('Z'), Z_AXIS);
+                    // set Z to the specified value where it triggered, and leave probe where it is
+                    THEROBOT->reset_axis_position(gcode->get_value('Z') - overrun_mm, Z_AXIS);
+                    overrun_mm= 0;
 
                 } else {
                     // return to pre probe position
@@ -437,6 +493,7 @@ void ZProbe::probe_XYZ(Gcode *gcode, int axis)
     // enable the probe checking in the timer
     probing= true;
     probe_detected= false;
+    if(edge_pin != nullptr) edge_priority= Pin::raise_edge_priority();
     THEROBOT->disable_segmentation= true; // we must disable segmentation as this won't work with it enabled (beware on deltas probing in X or Y)
 
     // get probe feedrate in mm/min and convert to mm/sec if specified
@@ -453,19 +510,20 @@ void ZProbe::probe_XYZ(Gcode *gcode, int axis)
 
     // disable probe checking
     probing= false;
+    if(edge_pin != nullptr) Pin::restore_edge_priority(edge_priority);
     THEROBOT->disable_segmentation= false;
 
     float pos[3];
     {
-        // get the current position
-        ActuatorCoordinates current_position{
-            THEROBOT->actuators[X_AXIS]->get_current_position(),
-            THEROBOT->actuators[Y_AXIS]->get_current_position(),
-            THEROBOT->actuators[Z_AXIS]->get_current_position()
+        // get the position where the probe triggered
+        ActuatorCoordinates trigger_position{
+            get_trigger_position(X_AXIS),
+            get_trigger_position(Y_AXIS),
+            get_trigger_position(Z_AXIS)
         };
 
         // get machine position from the actuator position using FK
-        THEROBOT->arm_solution->actuator_to_cartesian(current_position, pos);
+        THEROBOT->arm_solution->actuator_to_cartesian(trigger_position, pos);
     }
 
     uint8_t probeok= this->probe_detected ? 1 : 0;
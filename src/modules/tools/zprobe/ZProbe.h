@@ -17,6 +17,10 @@
 #define zprobe_checksum            CHECKSUM("zprobe")
 #define leveling_strategy_checksum CHECKSUM("leveling-strategy")
 
+namespace mbed {
+    class InterruptIn;
+}
+
 class StepperMotor;
 class Gcode;
 class StreamOutput;
@@ -26,7 +30,7 @@ class ZProbe: public Module
 {
 
 public:
-    ZProbe() : invert_override(false) {};
+    ZProbe() : edge_pin(nullptr), overrun_mm(0), invert_override(false) {};
     virtual ~ZProbe() {};
 
     void on_module_loaded();
@@ -51,6 +55,9 @@ private:
     void config_load();
     void probe_XYZ(Gcode *gc, int axis);
     uint32_t read_probe(uint32_t dummy);
+    void on_pin_edge();
+    void trigger();
+    float get_trigger_position(int axis) const;
 
     float slow_feedrate;
     float fast_feedrate;
@@ -59,8 +66,15 @@ private:
     float max_z;
 
     Pin pin;
+    mbed::InterruptIn *edge_pin;
+    uint32_t edge_priority;     // of the pin edge interrupt before the probe moved
     std::vector<LevelingStrategy*> strategies;
     uint16_t debounce_ms, debounce;
+    uint16_t glitch_filter;
+
+    // actuator steps when the probe triggered, and how far Z ran on past that before it stopped
+    int32_t trigger_steps[3];
+    float overrun_mm;
 
     volatile struct {
         bool is_delta:1;
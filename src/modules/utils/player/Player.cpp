@@ -16,6 +16,7 @@
 #include "libs/StreamOutputPool.h"
 #include "libs/StreamOutput.h"
 #include "Gcode.h"
+#include "BinaryGcode.h"
 #include "checksumm.h"
 #include "Config.h"
 #include "ConfigValue.h"
@@ -29,6 +30,7 @@
 #include "TemperatureControlPublicAccess.h"
 #include "TemperatureControlPool.h"
 #include "ExtruderPublicAccess.h"
+#include "platform_memory.h"
 
 #include <cstddef>
 #include <cmath>
@@ -41,6 +43,7 @@
 #define after_suspend_gcode_checksum      CHECKSUM("after_suspend_gcode")
 #define before_resume_gcode_checksum      CHECKSUM("before_resume_gcode")
 #define leave_heaters_on_suspend_checksum CHECKSUM("leave_heaters_on_suspend")
+#define player_read_ahead_size_checksum   CHECKSUM("player_read_ahead_size")
 
 extern SDFAT mounter;
 
@@ -53,12 +56,18 @@ Player::Player()
     this->reply_stream = nullptr;
     this->suspended= false;
     this->suspend_loops= 0;
+    this->played_lines= 0;
+    this->last_played_lines= 0;
+    this->lines_per_sec= 0;
+    this->skip_lines= 0;
+    this->binary_decoder= nullptr;
 }
 
 void Player::on_module_loaded()
 {
     this->register_for_event(ON_CONSOLE_LINE_RECEIVED);
     this->register_for_event(ON_MAIN_LOOP);
+    this->register_for_event(ON_IDLE);
     this->register_for_event(ON_SECOND_TICK);
     this->register_for_event(ON_GET_PUBLIC_DATA);
     this->register_for_event(ON_SET_PUBLIC_DATA);
@@ -73,18 +82,36 @@ void Player::on_module_loaded()
     std::replace( this->after_suspend_gcode.begin(), this->after_suspend_gcode.end(), '_', ' '); // replace _ with space
     std::replace( this->before_resume_gcode.begin(), this->before_resume_gcode.end(), '_', ' '); // replace _ with space
     this->leave_heaters_on = THEKERNEL->config->value(leave_heaters_on_suspend_checksum)->by_default(false)->as_bool();
+
+    // size of each half of the read ahead buffer, a whole number of sectors, 0 reads a line at a time with fgets
+    this->read_ahead_size = THEKERNEL->config->value(player_read_ahead_size_checksum)->by_default(2048)->as_int() & ~511;
 }
 
 void Player::on_halt(void* argument)
 {
     if(argument == nullptr && this->playing_file ) {
+        // what was read is a queue's worth of moves ahead of what was done, but it is somewhere to start from
+        THEKERNEL->streams->printf("Playing %s stopped at byte %lu line %lu, play it with -b or -l to start again near there\r\n",
+            this->filename.c_str(), this->played_cnt, this->played_lines);
         abort_command("1", &(StreamOutput::NullStream));
     }
 }
 
 void Player::on_second_tick(void *)
 {
-    if(this->playing_file) this->elapsed_secs++;
+    if(this->playing_file) {
+        this->elapsed_secs++;
+        this->lines_per_sec = this->played_lines - this->last_played_lines;
+    }
+    this->last_played_lines = this->played_lines;
+}
+
+// the number after an option such as -b, 0 if it is not there
+static unsigned long option_value(const string& options, const char *opt)
+{
+    size_t pos= options.find(opt);
+    if(pos == string::npos) return 0;
+    return strtoul(options.c_str() + pos + strlen(opt), nullptr, 10);
 }
 
 // extract any options found on line, terminates args at the space before the first option (-v)
@@ -119,6 +146,7 @@ void Player::on_gcode_received(void *argument)
                 this->playing_file = false;
                 fclose(this->current_file_handler);
             }
+            release_read_ahead();
             this->current_file_handler = fopen( this->filename.c_str(), "r");
 
             if(this->current_file_handler == NULL) {
@@ -140,6 +168,7 @@ void Player::on_gcode_received(void *argument)
 
 
             this->played_cnt = 0;
+            this->played_lines = 0;
             this->elapsed_secs = 0;
 
         } else if (gcode->m == 24) { // start print
@@ -190,6 +219,7 @@ void Player::on_gcode_received(void *argument)
                 this->playing_file = false;
                 fclose(this->current_file_handler);
             }
+            release_read_ahead();
 
             this->current_file_handler = fopen( this->filename.c_str(), "r");
             if(this->current_file_handler == NULL) {
@@ -208,6 +238,7 @@ void Player::on_gcode_received(void *argument)
             }
 
             this->played_cnt = 0;
+            this->played_lines = 0;
             this->elapsed_secs = 0;
 
         } else if (gcode->m == 600) { // suspend print, Not entirely Marlin compliant, M600.1 will leave the heaters on
@@ -279,6 +310,7 @@ void Player::play_command( string parameters, StreamOutput *stream )
     if(this->current_file_handler != NULL) { // must have been a paused print
         fclose(this->current_file_handler);
     }
+    release_read_ahead();
 
     this->current_file_handler = fopen( this->filename.c_str(), "r");
     if(this->current_file_handler == NULL) {
@@ -309,7 +341,36 @@ void Player::play_command( string parameters, StreamOutput *stream )
         stream->printf("  File size %ld\r\n", file_size);
     }
     this->played_cnt = 0;
+    this->played_lines = 0;
     this->elapsed_secs = 0;
+
+    // -b starts at the first line that starts at or after that byte, -l at that line (or record of a binary file),
+    // counted from where -b starts. The lines before are not run, so whatever they set up must be done first
+    unsigned long start_byte = option_value(options, "-b");
+    unsigned long start_line = option_value(options, "-l");
+    this->skip_lines = start_line > 1 ? start_line - 1 : 0;
+    if(start_byte > 0) {
+        char header[BinaryGcodeDecoder::header_size];
+        size_t n = fread(header, 1, sizeof(header), this->current_file_handler);
+        if(BinaryGcodeDecoder::is_header(header, n)) {
+            stream->printf("A binary file can only be started at a line\r\n");
+            abort_command("1", stream);
+            return;
+        }
+
+        // the seek looks the cluster up in the file's cluster link map rather than following the FAT from the start
+        if(file_size > 0 && start_byte > (unsigned long)file_size) start_byte = file_size;
+        fseek(this->current_file_handler, start_byte - 1, SEEK_SET);
+        int c;
+        do {
+            c = fgetc(this->current_file_handler);
+        } while(c != EOF && c != '\n');
+        this->played_cnt = ftell(this->current_file_handler);
+        stream->printf("  Starting at byte %lu\r\n", this->played_cnt);
+    }
+    if(this->skip_lines > 0) {
+        stream->printf("  Skipping to line %lu\r\n", start_line);
+    }
 }
 
 void Player::progress_command( string parameters, StreamOutput *stream )
@@ -346,6 +407,9 @@ void Player::progress_command( string parameters, StreamOutput *stream )
             if(est > 0) {
                 stream->printf(", est time: %02lu:%02lu:%02lu",  est / 3600, (est % 3600) / 60, est % 60);
             }
+            if(this->elapsed_secs > 0) {
+                stream->printf(", %lu lines/sec (average %lu)", this->lines_per_sec, this->played_lines / this->elapsed_secs);
+            }
             stream->printf("\r\n");
         } else {
             stream->printf("SD printing byte %lu/%lu\r\n", played_cnt, file_size);
@@ -366,10 +430,12 @@ void Player::abort_command( string parameters, StreamOutput *stream )
     playing_file = false;
     played_cnt = 0;
     file_size = 0;
+    skip_lines = 0;
     this->filename = "";
     this->current_stream = NULL;
     fclose(current_file_handler);
     current_file_handler = NULL;
+    release_read_ahead();
     if(parameters.empty()) {
         // clear out the block queue, will wait until queue is empty
         // MUST be called in on_main_loop to make sure there are no blocked main loops waiting to put something on the queue
@@ -405,36 +471,63 @@ void Player::on_main_loop(void *argument)
             return;
         }
 
-        char buf[130]; // lines upto 128 characters are allowed, anything longer is discarded
-        bool discard = false;
+        if(this->read_ahead.get_buffer() == nullptr && this->played_lines == 0 && start_read_ahead()) {
+            // a file in the binary format is recognised by its header
+            fill_read_ahead();
+            const char *p;
+            size_t n= this->read_ahead.peek(p);
+            if(this->played_cnt == 0 && BinaryGcodeDecoder::is_header(p, n)) this->binary_decoder= new BinaryGcodeDecoder;
+        }
 
-        while(fgets(buf, sizeof(buf), this->current_file_handler) != NULL) {
-            int len = strlen(buf);
-            if(len == 0) continue; // empty line? should not be possible
-            if(buf[len - 1] == '\n' || feof(this->current_file_handler)) {
-                if(discard) { // we are discarding a long line
-                    discard = false;
-                    continue;
-                }
-                if(len == 1) continue; // empty line
+        if(this->binary_decoder != nullptr) {
+            if(!feed_records()) return;
+
+        } else if(this->read_ahead.get_buffer() != nullptr) {
+            // as many lines as the queue will take, the rest of the file is finished off below
+            if(!feed_lines()) return;
 
-                if(this->current_stream != nullptr) {
-                    this->current_stream->printf("%s", buf);
+        } else {
+            char buf[130]; // lines upto 128 characters are allowed, anything longer is discarded
+            bool discard = false;
+
+            while(fgets(buf, sizeof(buf), this->current_file_handler) != NULL) {
+                int len = strlen(buf);
+                if(len == 0) continue; // empty line? should not be possible
+                if(this->played_cnt == 0 && BinaryGcodeDecoder::is_header(buf, len)) {
+                    THEKERNEL->streams->printf("Binary gcode files need player_read_ahead_size set\r\n");
+                    break;
                 }
+                if(buf[len - 1] == '\n' || feof(this->current_file_handler)) {
+                    if(discard) { // we are discarding a long line
+                        discard = false;
+                        continue;
+                    }
+                    if(this->skip_lines > 0) {
+                        this->skip_lines--;
+                        played_cnt += len;
+                        continue;
+                    }
+                    if(len == 1) continue; // empty line
 
-                struct SerialMessage message;
-                message.message = buf;
-                message.stream = this->current_stream == nullptr ? &(StreamOutput::NullStream) : this->current_stream;
+                    if(this->current_stream != nullptr) {
+                        this->current_stream->printf("%s", buf);
+                    }
 
-                // waits for the queue to have enough room
-                THEKERNEL->call_event(ON_CONSOLE_LINE_RECEIVED, &message);
-                played_cnt += len;
-                return; // we feed one line per main loop
+                    struct SerialMessage message;
+                    message.message = buf;
+                    message.stream = this->current_stream == nullptr ? &(StreamOutput::NullStream) : this->current_stream;
 
-            } else {
-                // discard long line
-                if(this->current_stream != nullptr) { this->current_stream->printf("Warning: Discarded long line\n"); }
-                discard = true;
+                    // waits for the queue to have enough room
+                    THEKERNEL->call_event(ON_CONSOLE_LINE_RECEIVED, &message);
+                    played_cnt += len;
+                    played_lines++;
+                    return; // we feed one line per main loop
+
+                } else {
+                    // discard long line
+                    if(this->current_stream != nullptr) { this->current_stream->printf("Warning: Discarded long line\n"); }
+                    discard = true;
+                }
             }
         }
 
@@ -444,6 +537,7 @@ void Player::on_main_loop(void *argument)
         file_size = 0;
         fclose(this->current_file_handler);
         current_file_handler = NULL;
+        release_read_ahead();
         this->current_stream = NULL;
 
         if(this->reply_stream != NULL) {
@@ -454,6 +548,155 @@ void Player::on_main_loop(void *argument)
     }
 }
 
+// reads the next chunk of the file while the queue is full and the main loop is waiting for room
+void Player::on_idle(void *argument)
+{
+    if(this->playing_file && !THEKERNEL->is_halted()) fill_read_ahead();
+}
+
+bool Player::start_read_ahead()
+{
+    if(this->read_ahead_size == 0) return false;
+
+    // in AHB0 so it does not come out of the heap, if there is not room the file is read a line at a time
+    char *buf = (char *)AHB0.alloc(2 * this->read_ahead_size);
+    if(buf == nullptr) return false;
+    this->read_ahead.attach(buf, this->read_ahead_size);
+    return true;
+}
+
+void Player::release_read_ahead()
+{
+    delete this->binary_decoder;
+    this->binary_decoder = nullptr;
+    if(this->read_ahead.get_buffer() != nullptr) {
+        AHB0.dealloc(this->read_ahead.get_buffer());
+        this->read_ahead.attach(nullptr, 0);
+    }
+}
+
+// reads a chunk into the half of the buffer that has been used up, if there is one
+bool Player::fill_read_ahead()
+{
+    char *p = this->read_ahead.free_chunk();
+    if(p == nullptr) return false;
+    this->read_ahead.filled(fread(p, 1, this->read_ahead.get_chunk_size(), this->current_file_handler));
+    return true;
+}
+
+// feeds lines until the queue is full, rather than one per main loop, returns true when the file has all been played
+bool Player::feed_lines()
+{
+    char buf[130]; // lines upto 128 characters are allowed, anything longer is discarded
+
+    // stop after a queue's worth anyway so lines that do not queue anything cannot hold up the main loop
+    for(size_t n = 0; n < THECONVEYOR->get_queue_size(); ) {
+        // a line may have paused, suspended or aborted the file
+        if(!this->playing_file || THEKERNEL->is_halted() || THECONVEYOR->is_queue_full()) return false;
+
+        size_t used;
+        ReadAheadBuffer::line_t r = this->read_ahead.get_line(buf, sizeof(buf), used);
+        played_cnt += used;
+
+        if(r == ReadAheadBuffer::NO_LINE) {
+            if(this->read_ahead.is_finished()) return true;
+            fill_read_ahead();
+            continue;
+        }
+
+        if(this->skip_lines > 0) {
+            this->skip_lines--;
+            n++;
+            continue;
+        }
+
+        if(r == ReadAheadBuffer::LONG_LINE) {
+            if(this->current_stream != nullptr) { this->current_stream->printf("Warning: Discarded long line\n"); }
+            continue;
+        }
+
+        if(buf[0] == '\n' && buf[1] == '\0') continue; // empty line
+
+        if(this->current_stream != nullptr) {
+            this->current_stream->printf("%s", buf);
+        }
+
+        struct SerialMessage message;
+        message.message = buf;
+        message.stream = this->current_stream == nullptr ? &(StreamOutput::NullStream) : this->current_stream;
+
+        // waits for the queue to have enough room
+        THEKERNEL->call_event(ON_CONSOLE_LINE_RECEIVED, &message);
+        played_lines++;
+        n++;
+    }
+    return false;
+}
+
+// the same for a binary file, the motion records go straight to the modules without being parsed
+bool Player::feed_records()
+{
+    StreamOutput *stream = this->current_stream == nullptr ? &(StreamOutput::NullStream) : this->current_stream;
+
+    for(size_t n = 0; n < THECONVEYOR->get_queue_size(); ) {
+        if(!this->playing_file || THEKERNEL->is_halted() || THECONVEYOR->is_queue_full()) return false;
+
+        const char *p;
+        size_t avail = this->read_ahead.peek(p);
+        if(avail == 0) {
+            if(this->read_ahead.is_finished()) return true;
+            fill_read_ahead();
+            continue;
+        }
+
+        size_t used;
+        BinaryGcodeDecoder::result_t r = this->binary_decoder->put(p, avail, used);
+        this->read_ahead.consume(used);
+        played_cnt += used;
+
+        switch(r) {
+            case BinaryGcodeDecoder::NEED_MORE:
+                break;
+
+            case BinaryGcodeDecoder::MOTION:
+                if(this->skip_lines > 0) {
+                    this->skip_lines--;
+                    n++;
+                    break;
+                }
+                BinaryGcodeDecoder::dispatch(this->binary_decoder->get_record(), stream);
+                played_lines++;
+                n++;
+                break;
+
+            case BinaryGcodeDecoder::TEXT_LINE: {
+                if(this->skip_lines > 0) {
+                    this->skip_lines--;
+                    n++;
+                    break;
+                }
+                struct SerialMessage message;
+                message.message = this->binary_decoder->get_text();
+                message.stream = stream;
+                THEKERNEL->call_event(ON_CONSOLE_LINE_RECEIVED, &message);
+                played_lines++;
+                n++;
+                break;
+            }
+
+            case BinaryGcodeDecoder::ENDED:
+                return true;
+
+            case BinaryGcodeDecoder::ERROR:
+                // the rest of the file cannot be trusted
+                THEKERNEL->streams->printf("Error: %s at byte %lu of %s\r\n", this->binary_decoder->get_error(), played_cnt, this->filename.c_str());
+                THEKERNEL->call_event(ON_HALT, nullptr);
+                return false;
+        }
+    }
+    return false;
+}
+
 void Player::on_get_public_data(void *argument)
 {
     PublicDataRequest *pdr = static_cast<PublicDataRequest *>(argument);
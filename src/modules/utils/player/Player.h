@@ -9,6 +9,7 @@
 #pragma once
 
 #include "Module.h"
+#include "ReadAheadBuffer.h"
 
 #include <stdio.h>
 #include <string>
@@ -17,6 +18,7 @@
 using std::string;
 
 class StreamOutput;
+class BinaryGcodeDecoder;
 
 class Player : public Module {
     public:
@@ -25,6 +27,7 @@ class Player : public Module {
         void on_module_loaded();
         void on_console_line_received( void* argument );
         void on_main_loop( void* argument );
+        void on_idle( void* argument );
         void on_second_tick(void* argument);
         void on_get_public_data(void* argument);
         void on_set_public_data(void* argument);
@@ -39,6 +42,11 @@ class Player : public Module {
         void resume_command( string parameters, StreamOutput* stream );
         string extract_options(string& args);
         void suspend_part2();
+        bool start_read_ahead();
+        void release_read_ahead();
+        bool fill_read_ahead();
+        bool feed_lines();
+        bool feed_records();
 
         string filename;
         string after_suspend_gcode;
@@ -51,6 +59,13 @@ class Player : public Module {
         long file_size;
         unsigned long played_cnt;
         unsigned long elapsed_secs;
+        unsigned long played_lines;
+        unsigned long last_played_lines;
+        unsigned long lines_per_sec;
+        unsigned long skip_lines;   // lines (or binary records) still to be skipped before the one play starts at
+        ReadAheadBuffer read_ahead;
+        BinaryGcodeDecoder *binary_decoder; // set when the file is in the binary format
+        uint32_t read_ahead_size;
         float saved_position[3]; // only saves XYZ
         std::map<uint16_t, float> saved_temperatures;
         struct {
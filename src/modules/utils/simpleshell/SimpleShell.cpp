@@ -12,7 +12,10 @@
 #include "libs/utils.h"
 #include "libs/SerialMessage.h"
 #include "libs/StreamOutput.h"
+#include "libs/StreamOutputPool.h"
+#include "libs/TxBuffer.h"
 #include "modules/robot/Conveyor.h"
+#include "modules/robot/Planner.h"
 #include "DirHandle.h"
 #include "mri.h"
 #include "version.h"
@@ -27,6 +30,7 @@
 #include "GcodeDispatch.h"
 #include "BaseSolution.h"
 #include "StepperMotor.h"
+#include "StepTicker.h"
 #include "Configurator.h"
 #include "Block.h"
 
@@ -75,6 +79,9 @@ const SimpleShell::ptentry_t SimpleShell::commands_table[] = {
     {"?",        SimpleShell::help_command},
     {"version",  SimpleShell::version_command},
     {"mem",      SimpleShell::mem_command},
+    {"stats",    SimpleShell::stats_command},
+    {"binary",   SimpleShell::binary_command},
+    {"window",   SimpleShell::window_command},
     {"get",      SimpleShell::get_command},
     {"set_temp", SimpleShell::set_temp_command},
     {"switch",   SimpleShell::switch_command},
@@ -594,6 +601,59 @@ void SimpleShell::mem_command( string parameters, StreamOutput *stream)
     stream->printf("Block size: %u bytes\n", sizeof(Block));
 }
 
+// show the motion throughput counters, -r resets them afterwards
+void SimpleShell::stats_command( string parameters, StreamOutput *stream)
+{
+    Conveyor *conveyor= THEKERNEL->conveyor;
+    StepTicker *step_ticker= THEKERNEL->step_ticker;
+    Planner *planner= THEKERNEL->planner;
+
+    // depth d is counted in bucket d * 8 / size, so bucket b starts at the first d with d * 8 >= b * size
+    const std::array<uint32_t, 8>& histogram= conveyor->get_depth_histogram();
+    size_t size= conveyor->get_queue_size();
+    stream->printf("queue depth at block start (%u blocks):", size);
+    for (size_t b = 0; b < histogram.size(); ++b) {
+        size_t from= (b * size + histogram.size() - 1) / histogram.size();
+        size_t to= ((b + 1) * size + histogram.size() - 1) / histogram.size() - 1;
+        if(to < from) continue;
+        stream->printf(" %u-%u: %lu", from, to, (unsigned long)histogram[b]);
+    }
+    stream->printf("\n");
+
+    stream->printf("starvation: %lu times, %1.3f s waiting for blocks\n", (unsigned long)step_ticker->get_starvations(), step_ticker->get_starved_seconds());
+
+    float avg= step_ticker->get_isr_avg_cycles();
+    uint32_t max= step_ticker->get_isr_max_cycles();
+    float mhz= SystemCoreClock / 1000000.0F;
+    stream->printf("step ticker: %llu interrupts, avg %1.0f cycles (%1.2f us), max %lu cycles (%1.2f us)\n",
+        (unsigned long long)step_ticker->get_isr_count(), avg, avg / mhz, (unsigned long)max, max / mhz);
+
+    uint32_t min_loops= THEKERNEL->get_min_main_loops_per_second();
+    stream->printf("main loop: %lu/s, min %lu/s\n", (unsigned long)THEKERNEL->get_main_loops_per_second(), min_loops == UINT32_MAX ? 0UL : (unsigned long)min_loops);
+
+    stream->printf("planner: appended: %lu, blocks visited per append: %1.2f\n", (unsigned long)planner->get_append_count(), planner->get_blocks_per_append());
+
+    bool reset= shift_parameter( parameters ) == "-r";
+
+    // the streams are in no particular order, the one this is being sent to is marked
+    int n= 0;
+    for(StreamOutput *s : THEKERNEL->streams->get_streams()) {
+        TxStats *tx= s->get_tx_stats();
+        if(tx == nullptr) continue;
+        stream->printf("output %d%s: %lu bytes, %lu lines dropped, %lu status lines replaced\n", ++n, s == stream ? " (this)" : "",
+            (unsigned long)tx->bytes, (unsigned long)tx->dropped, (unsigned long)tx->replaced);
+        if(reset) tx->bytes= tx->dropped= tx->replaced= 0;
+    }
+
+    if(reset) {
+        conveyor->reset_stats();
+        step_ticker->reset_stats();
+        planner->reset_recalculate_stats();
+        THEKERNEL->reset_main_loop_stats();
+        stream->printf("stats reset\n");
+    }
+}
+
 static uint32_t getDeviceType()
 {
 #define IAP_LOCATION 0x1FFF1FF1
@@ -844,6 +904,12 @@ void SimpleShell::get_command( string parameters, StreamOutput *stream)
         // also ? on serial and usb
         stream->printf("%s\n", THEKERNEL->get_query_string().c_str());
 
+    } else if (what == "planner") {
+        // how much of the queue recalculate has to walk for each new block, -r resets the counts
+        Planner *planner= THEKERNEL->planner;
+        stream->printf("appended: %lu, blocks visited per append: %1.2f\n", (unsigned long)planner->get_append_count(), planner->get_blocks_per_append());
+        if(shift_parameter( parameters ) == "-r") planner->reset_recalculate_stats();
+
     } else {
         stream->printf("error:unknown option %s\n", what.c_str());
     }
@@ -890,6 +956,14 @@ void SimpleShell::calc_thermistor_command( string parameters, StreamOutput *stre
         float c1, c2, c3;
         std::tie(c1, c2, c3) = Thermistor::calculate_steinhart_hart_coefficients(trl[0], trl[1], trl[2], trl[3], trl[4], trl[5]);
         stream->printf("Steinhart Hart coefficients:  I%1.18f J%1.18f K%1.18f\n", c1, c2, c3);
+
+        // readings are looked up in a table built from the curve, show how far that strays from it
+        Thermistor t;
+        TempSensor::sensor_options_t options{{'I', c1}, {'J', c2}, {'K', c3}};
+        if(t.set_optional(options)) {
+            stream->printf("  With r2 of 4700: ");
+            t.print_table(stream);
+        }
         if(saveto == -1) {
             stream->printf("  Paste the above in the M305 S0 command, then save with M500\n");
         }else{
@@ -1111,11 +1185,33 @@ void SimpleShell::test_command( string parameters, StreamOutput *stream)
     }
 }
 
+// switches the stream to the binary format of BinaryGcode.h until the end record
+void SimpleShell::binary_command( string parameters, StreamOutput *stream )
+{
+    if(!stream->start_binary()) {
+        stream->printf("error:binary streaming is not supported on this connection, or needs window off first\n");
+        return;
+    }
+    stream->printf("ok\n");
+}
+
+// switches the stream to windowed acknowledgements, see AckWindow.h, the first report is the reply
+void SimpleShell::window_command( string parameters, StreamOutput *stream )
+{
+    bool on= shift_parameter(parameters) != "off";
+    if(!stream->start_window(on)) {
+        stream->printf("error:windowed acknowledgements are not supported on this connection\n");
+        return;
+    }
+    if(!on) stream->printf("ok\n");
+}
+
 void SimpleShell::help_command( string parameters, StreamOutput *stream )
 {
     stream->printf("Commands:\r\n");
     stream->printf("version\r\n");
     stream->printf("mem [-v]\r\n");
+    stream->printf("stats [-r] - queue depth, starvation, step ticker, main loop and output counters, -r resets them\r\n");
     stream->printf("ls [-s] [folder]\r\n");
     stream->printf("cd folder\r\n");
     stream->printf("pwd\r\n");
@@ -1123,7 +1219,9 @@ void SimpleShell::help_command( string parameters, StreamOutput *stream )
     stream->printf("rm file\r\n");
     stream->printf("mv file newfile\r\n");
     stream->printf("remount\r\n");
-    stream->printf("play file [-v]\r\n");
+    stream->printf("play file [-v] [-b byte] [-l line]\r\n");
+    stream->printf("binary - sends the following data in the binary gcode format, up to its end record\r\n");
+    stream->printf("window [off] - acknowledges lines with a report every so often instead of an ok for each\r\n");
     stream->printf("progress - shows progress of current play\r\n");
     stream->printf("abort - abort currently playing file\r\n");
     stream->printf("reset - reset smoothie\r\n");
@@ -1131,7 +1229,7 @@ void SimpleShell::help_command( string parameters, StreamOutput *stream )
     stream->printf("break - break into debugger\r\n");
     stream->printf("config-get [<configuration_source>] <configuration_setting>\r\n");
     stream->printf("config-set [<configuration_source>] <configuration_setting> <value>\r\n");
-    stream->printf("get [pos|wcs|state|status|fk|ik]\r\n");
+    stream->printf("get [pos|wcs|state|status|fk|ik|planner]\r\n");
     stream->printf("get temp [bed|hotend]\r\n");
     stream->printf("set_temp bed|hotend 185\r\n");
     stream->printf("net\r\n");
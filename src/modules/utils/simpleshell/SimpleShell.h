@@ -51,6 +51,9 @@ private:
 
     static void switch_command(string parameters, StreamOutput *stream );
     static void mem_command(string parameters, StreamOutput *stream );
+    static void stats_command(string parameters, StreamOutput *stream );
+    static void binary_command(string parameters, StreamOutput *stream );
+    static void window_command(string parameters, StreamOutput *stream );
 
     static void net_command( string parameters, StreamOutput *stream);
 
@@ -0,0 +1,104 @@
+#include "AckWindow.h"
+
+#include <string>
+#include <string.h>
+
+#include "easyunit/test.h"
+
+static std::string report(AckWindow& w, uint32_t waiting, uint32_t room, uint32_t blocks, uint32_t now)
+{
+    char buf[32];
+    size_t n= w.report(waiting, room, blocks, now, buf, sizeof(buf));
+    return std::string(buf, n);
+}
+
+TEST(AckWindowTest,start)
+{
+    AckWindow w;
+
+    // nothing is reported and every ok is sent until it is started
+    ASSERT_TRUE(!w.is_ok("ok\r\n"));
+    ASSERT_TRUE(report(w, 0, 256, 32, 0) == "");
+
+    // the window command's own line was taken before the start and is not counted when it is done
+    w.line_taken(7);
+    w.start(0);
+    w.line_done();
+    ASSERT_TRUE(w.is_ok("ok\r\n"));
+    ASSERT_TRUE(w.is_ok("ok\n"));
+    ASSERT_TRUE(!w.is_ok("ok T:21.0 /0.0 @0\n"));
+    ASSERT_TRUE(!w.is_ok("error:Unsupported command\n"));
+
+    // the first report is sent straight away, at the starting average of 32 bytes a line
+    ASSERT_TRUE(report(w, 0, 192, 32, 10) == "ack 0 6\n");
+    ASSERT_TRUE(report(w, 0, 192, 32, 20) == "");
+
+    w.stop();
+    ASSERT_TRUE(!w.is_ok("ok\r\n"));
+}
+
+TEST(AckWindowTest,batch)
+{
+    AckWindow w;
+    w.start(0);
+    ASSERT_TRUE(report(w, 0, 192, 32, 0) == "ack 0 6\n");
+
+    // lines done are saved up until half the window is used
+    for (int i = 0; i < 2; ++i) {
+        w.line_taken(32);
+        w.line_done();
+        ASSERT_TRUE(report(w, 3, 96, 32, 100) == "");
+    }
+    w.line_taken(32);
+    w.line_done();
+    ASSERT_TRUE(report(w, 2, 128, 32, 200) == "ack 3 8\n");
+
+    // or for a while
+    w.line_taken(32);
+    w.line_done();
+    ASSERT_TRUE(report(w, 1, 160, 32, 300) == "");
+    ASSERT_TRUE(report(w, 1, 160, 32, 300 + AckWindow::REPORT_US) == "ack 4 7\n");
+
+    // a window that has only grown is not worth a report while there are lines to do
+    ASSERT_TRUE(report(w, 1, 192, 32, 400 + 2 * AckWindow::REPORT_US) == "");
+}
+
+TEST(AckWindowTest,stalled)
+{
+    AckWindow w;
+    w.start(0);
+    ASSERT_TRUE(report(w, 0, 64, 0, 0) == "ack 0 2\n");
+
+    // the host has sent both lines it was allowed, it hears as soon as they are done
+    w.line_taken(32);
+    ASSERT_TRUE(report(w, 1, 0, 0, 10) == "");
+    w.line_done();
+    w.line_taken(32);
+    w.line_done();
+    ASSERT_TRUE(report(w, 0, 0, 0, 20) == "ack 2 0\n");
+
+    // and when it was allowed nothing, as soon as the window opens
+    ASSERT_TRUE(report(w, 0, 16, 0, 30) == "");
+    ASSERT_TRUE(report(w, 0, 64, 0, 40) == "ack 2 2\n");
+}
+
+TEST(AckWindowTest,window)
+{
+    AckWindow w;
+    w.start(0);
+
+    // lines held count, and waiting lines that will go straight into free blocks will make room
+    w.line_taken(32);
+    ASSERT_TRUE(w.get_window(2, 64, 0) == 1 + 2 + 2);
+    ASSERT_TRUE(w.get_window(2, 64, 1) == 1 + 2 + 2 + 1);
+    ASSERT_TRUE(w.get_window(2, 64, 32) == 1 + 2 + 2 + 2);
+
+    // the average follows the lines taken
+    w.line_done();
+    ASSERT_TRUE(w.get_window(0, 256, 0) == 8);
+    for (int i = 0; i < 40; ++i) {
+        w.line_taken(64);
+        w.line_done();
+    }
+    ASSERT_TRUE(w.get_window(0, 256, 0) == 4);
+}
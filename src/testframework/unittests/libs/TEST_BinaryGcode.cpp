@@ -0,0 +1,174 @@
+#include "BinaryGcode.h"
+#include "Gcode.h"
+
+#include <string>
+#include <string.h>
+#include <stdio.h>
+
+#include "easyunit/test.h"
+
+// decodes the whole of s, returns the number of records and leaves the last one in d
+static int decode_all(BinaryGcodeDecoder& d, const std::string& s, BinaryGcodeDecoder::result_t& last)
+{
+    int n= 0;
+    last= BinaryGcodeDecoder::NEED_MORE;
+    for(size_t i= 0, used; i < s.size(); i += used) {
+        last= d.put(&s[i], s.size() - i, used);
+        if(last == BinaryGcodeDecoder::ERROR) return n;
+        if(last != BinaryGcodeDecoder::NEED_MORE) n++;
+    }
+    return n;
+}
+
+TEST(BinaryGcodeTest,round_trip)
+{
+    BinaryGcodeEncoder e(3);
+    std::string s;
+    e.header(s);
+    ASSERT_TRUE(e.encode("G1 X10.5 Y-2 F3000 ; move", s) == BinaryGcodeEncoder::MOTION);
+    ASSERT_TRUE(e.encode("X10.25 Y-2.001", s) == BinaryGcodeEncoder::MOTION);
+    ASSERT_TRUE(e.encode("(just a comment)", s) == BinaryGcodeEncoder::SKIPPED);
+    ASSERT_TRUE(e.encode("G2 X0 Y0 I-5 J0", s) == BinaryGcodeEncoder::MOTION);
+    ASSERT_TRUE(e.encode("M3 S0.75", s) == BinaryGcodeEncoder::MOTION);
+    ASSERT_TRUE(e.encode("G28 X0", s) == BinaryGcodeEncoder::TEXT);
+    ASSERT_TRUE(e.encode("M5", s) == BinaryGcodeEncoder::MOTION);
+    e.end(s);
+
+    BinaryGcodeDecoder d;
+    size_t used;
+    ASSERT_TRUE(d.put(s.data(), BinaryGcodeDecoder::header_size, used) == BinaryGcodeDecoder::NEED_MORE);
+    const char *p= s.data() + used;
+    size_t left= s.size() - used;
+
+    // G1 X10.5 Y-2 F3000
+    ASSERT_TRUE(d.put(p, left, used) == BinaryGcodeDecoder::MOTION);
+    p += used; left -= used;
+    Gcode g1= BinaryGcodeDecoder::make_gcode(d.get_record(), nullptr);
+    ASSERT_TRUE(g1.has_g && g1.g == 1);
+    ASSERT_EQUALS_V(3, g1.get_num_args());
+    ASSERT_EQUALS_DELTA_V(10.5, g1.get_value('X'), 0.0001);
+    ASSERT_EQUALS_DELTA_V(-2, g1.get_value('Y'), 0.0001);
+    ASSERT_EQUALS_V(3000, g1.get_int('F'));
+    ASSERT_TRUE(!g1.has_letter('Z'));
+
+    // the modal G1, with values that are differences from the last ones
+    ASSERT_TRUE(d.put(p, left, used) == BinaryGcodeDecoder::MOTION);
+    p += used; left -= used;
+    ASSERT_EQUALS_V(BinaryGcodeDecoder::G1, d.get_record().op);
+    ASSERT_EQUALS_DELTA_V(10.25, d.get_record().values[0], 0.0001);
+    ASSERT_EQUALS_DELTA_V(-2.001, d.get_record().values[1], 0.0001);
+
+    // I and J are not differences
+    ASSERT_TRUE(d.put(p, left, used) == BinaryGcodeDecoder::MOTION);
+    p += used; left -= used;
+    Gcode g2= BinaryGcodeDecoder::make_gcode(d.get_record(), nullptr);
+    ASSERT_TRUE(g2.has_g && g2.g == 2);
+    ASSERT_EQUALS_DELTA_V(-5, g2.get_value('I'), 0.0001);
+    ASSERT_EQUALS_DELTA_V(0, g2.get_value('J'), 0.0001);
+
+    ASSERT_TRUE(d.put(p, left, used) == BinaryGcodeDecoder::MOTION);
+    p += used; left -= used;
+    Gcode m3= BinaryGcodeDecoder::make_gcode(d.get_record(), nullptr);
+    ASSERT_TRUE(m3.has_m && m3.m == 3);
+    ASSERT_EQUALS_DELTA_V(0.75, m3.get_value('S'), 0.0001);
+
+    ASSERT_TRUE(d.put(p, left, used) == BinaryGcodeDecoder::TEXT_LINE);
+    p += used; left -= used;
+    ASSERT_TRUE(strcmp(d.get_text(), "G28 X0") == 0);
+
+    ASSERT_TRUE(d.put(p, left, used) == BinaryGcodeDecoder::MOTION);
+    p += used; left -= used;
+    ASSERT_EQUALS_V(BinaryGcodeDecoder::M5, d.get_record().op);
+
+    ASSERT_TRUE(d.put(p, left, used) == BinaryGcodeDecoder::ENDED);
+    ASSERT_TRUE(used == left);
+    ASSERT_EQUALS_V(7, d.get_records());
+}
+
+TEST(BinaryGcodeTest,rounding_and_text)
+{
+    BinaryGcodeEncoder e(2);
+    std::string s;
+    e.header(s);
+    ASSERT_TRUE(e.encode("N10 G0 X1.005 Y2.004*57", s) == BinaryGcodeEncoder::MOTION);
+    ASSERT_TRUE(e.encode("G1 X1e3", s) == BinaryGcodeEncoder::TEXT);
+    // still modal G1, so it goes as text with the G added
+    ASSERT_TRUE(e.encode("X1 A2", s) == BinaryGcodeEncoder::TEXT);
+    ASSERT_EQUALS_V(2, e.get_rounded());
+
+    BinaryGcodeDecoder d;
+    BinaryGcodeDecoder::result_t last;
+    int n= decode_all(d, s, last);
+    ASSERT_EQUALS_V(3, n);
+    ASSERT_TRUE(last == BinaryGcodeDecoder::TEXT_LINE);
+    ASSERT_TRUE(strcmp(d.get_text(), "G1 X1 A2") == 0);
+}
+
+TEST(BinaryGcodeTest,checksums)
+{
+    BinaryGcodeEncoder e(3, true);
+    std::string s;
+    e.header(s);
+    e.encode("G1 X1 Y2 Z3", s);
+    e.encode("G1 X2 Y3 Z4", s);
+    e.end(s);
+
+    BinaryGcodeDecoder d;
+    BinaryGcodeDecoder::result_t last;
+    int n= decode_all(d, s, last);
+    ASSERT_EQUALS_V(3, n);
+    ASSERT_TRUE(last == BinaryGcodeDecoder::ENDED);
+
+    // any byte changed after the header is caught
+    for(size_t i= BinaryGcodeDecoder::header_size; i < s.size(); i++) {
+        std::string bad= s;
+        bad[i] ^= 0x10;
+        d.reset();
+        decode_all(d, bad, last);
+        ASSERT_TRUE(last == BinaryGcodeDecoder::ERROR);
+    }
+
+    d.reset();
+    decode_all(d, std::string("G1 X1 Y2\n"), last);
+    ASSERT_TRUE(last == BinaryGcodeDecoder::ERROR);
+}
+
+TEST(BinaryGcodeTest,escapes)
+{
+    // X 0.012 is the varint 0x18 and Y -0.032 is 0x3F, the text has a ? and the CRCs come out as all sorts
+    BinaryGcodeEncoder e(3, true);
+    std::string s;
+    e.header(s);
+    e.encode("G1 X0.012 Y-0.032", s);
+    e.encode("M117 why? \x1b", s);
+    for(int i= 0; i < 64; i++) {
+        char line[32];
+        snprintf(line, sizeof(line), "G1 X%d.%03d", i, i * 7);
+        e.encode(line, s);
+    }
+    e.end(s);
+    ASSERT_TRUE(s.find('\x18') == std::string::npos);
+    ASSERT_TRUE(s.find('?') == std::string::npos);
+
+    BinaryGcodeDecoder d;
+    size_t used;
+    d.put(s.data(), s.size(), used);
+    ASSERT_TRUE(d.get_record().op == BinaryGcodeDecoder::G1);
+    ASSERT_EQUALS_DELTA_V(0.012, d.get_record().values[0], 0.0001);
+    ASSERT_EQUALS_DELTA_V(-0.032, d.get_record().values[1], 0.0001);
+    size_t at= used;
+    ASSERT_TRUE(d.put(s.data() + at, s.size() - at, used) == BinaryGcodeDecoder::TEXT_LINE);
+    ASSERT_TRUE(strcmp(d.get_text(), "M117 why? \x1b") == 0);
+
+    BinaryGcodeDecoder::result_t last;
+    d.reset();
+    int n= decode_all(d, s, last);
+    ASSERT_EQUALS_V(67, n);
+    ASSERT_TRUE(last == BinaryGcodeDecoder::ENDED);
+
+    // they are only ever out of band, so one in a record is an error
+    std::string bad= s.substr(0, BinaryGcodeDecoder::header_size + 2) + "?";
+    d.reset();
+    decode_all(d, bad, last);
+    ASSERT_TRUE(last == BinaryGcodeDecoder::ERROR);
+}
@@ -0,0 +1,51 @@
+#include "CircBuffer.h"
+
+#include <string>
+#include <string.h>
+
+#include "easyunit/test.h"
+
+TEST(CircBufferTest,spans)
+{
+    CircBuffer<uint8_t> cb(16);
+    uint16_t n;
+
+    // all but one slot is free, and at the start in one piece
+    uint8_t *w = cb.write_span(&n);
+    ASSERT_TRUE(n == 15);
+    memcpy(w, "0123456789", 10);
+    cb.commit(10);
+    ASSERT_TRUE(cb.available() == 10);
+
+    const uint8_t *r = cb.read_span(&n);
+    ASSERT_TRUE(n == 10 && memcmp(r, "0123456789", 10) == 0);
+    cb.consume(8);
+
+    // the free space wraps, so the first piece runs to the end of the buffer
+    cb.write_span(&n);
+    ASSERT_TRUE(n == 6);
+    ASSERT_TRUE(cb.queue((const uint8_t *)"abcdefghij", 10) == 10);
+    ASSERT_TRUE(cb.free() == 3);
+    r = cb.read_span(&n);
+    ASSERT_TRUE(n == 8 && memcmp(r, "89abcdef", 8) == 0);
+}
+
+TEST(CircBufferTest,bulk)
+{
+    CircBuffer<uint8_t> cb(16);
+    uint8_t buf[32];
+
+    // bulk queue takes what fits and never overwrites, bulk dequeue reassembles across the wrap
+    for (int i = 0; i < 10; ++i) {
+        ASSERT_TRUE(cb.queue((const uint8_t *)"G1 X1 Y2 Z3 F6000", 17) == 15);
+        ASSERT_TRUE(cb.isFull());
+        ASSERT_TRUE(cb.dequeue(buf, 7) == 7);
+        ASSERT_TRUE(memcmp(buf, "G1 X1 Y", 7) == 0);
+        ASSERT_TRUE(cb.dequeue(buf, sizeof(buf)) == 8);
+        ASSERT_TRUE(memcmp(buf, "2 Z3 F60", 8) == 0);
+        ASSERT_TRUE(cb.isEmpty());
+        cb.queue('x');
+        uint8_t c;
+        ASSERT_TRUE(cb.dequeue(&c) && c == 'x');
+    }
+}
@@ -0,0 +1,144 @@
+#include "CommandArena.h"
+
+#include <string>
+#include <string.h>
+
+#include "easyunit/test.h"
+
+// the arena only compares the stream pointers, it never uses them
+static StreamOutput *stream(int i)
+{
+    static char streams[4];
+    return reinterpret_cast<StreamOutput *>(&streams[i]);
+}
+
+static bool put_text(CommandArena& a, StreamOutput *s, const char *text)
+{
+    return a.put(s, 0, text, strlen(text) + 1);
+}
+
+static std::string get_text(CommandArena& a, StreamOutput *&s)
+{
+    char buf[64];
+    uint8_t kind;
+    uint16_t n;
+    if(!a.get(s, kind, buf, n)) return "none";
+    return buf;
+}
+
+TEST(CommandArenaTest,order)
+{
+    uint8_t buf[64];
+    CommandArena a;
+    a.attach(buf, sizeof(buf), sizeof(buf));
+    StreamOutput *s;
+
+    ASSERT_TRUE(put_text(a, stream(0), "G1 X1"));
+    ASSERT_TRUE(put_text(a, stream(1), "M105"));
+    ASSERT_TRUE(put_text(a, stream(0), "G1 X2"));
+    ASSERT_TRUE(a.get_entries() == 3);
+
+    ASSERT_TRUE(get_text(a, s) == "G1 X1");
+    ASSERT_TRUE(s == stream(0));
+    ASSERT_TRUE(get_text(a, s) == "M105");
+    ASSERT_TRUE(s == stream(1));
+    ASSERT_TRUE(get_text(a, s) == "G1 X2");
+    ASSERT_TRUE(s == stream(0));
+    ASSERT_TRUE(get_text(a, s) == "none");
+    ASSERT_TRUE(a.get_free() == sizeof(buf));
+}
+
+TEST(CommandArenaTest,wrap)
+{
+    uint8_t buf[50];
+    CommandArena a;
+    a.attach(buf, sizeof(buf), sizeof(buf));
+    StreamOutput *s;
+
+    // commands that wrap around the end of the ring come out whole
+    for (int i = 0; i < 30; ++i) {
+        ASSERT_TRUE(put_text(a, stream(0), "G1 X10.5 Y3"));
+        ASSERT_TRUE(put_text(a, stream(0), "M3 S100"));
+        ASSERT_TRUE(get_text(a, s) == "G1 X10.5 Y3");
+        ASSERT_TRUE(get_text(a, s) == "M3 S100");
+    }
+    ASSERT_TRUE(a.get_entries() == 0);
+}
+
+TEST(CommandArenaTest,full)
+{
+    uint8_t buf[32];
+    CommandArena a;
+    a.attach(buf, sizeof(buf), sizeof(buf));
+    StreamOutput *s;
+
+    // each is 4 bytes of header and 8 of text
+    ASSERT_TRUE(a.has_room(stream(0), 8));
+    ASSERT_TRUE(put_text(a, stream(0), "G1 X100"));
+    ASSERT_TRUE(put_text(a, stream(0), "G1 X200"));
+    ASSERT_TRUE(!a.has_room(stream(0), 8));
+    ASSERT_TRUE(!put_text(a, stream(0), "G1 X300"));
+    ASSERT_TRUE(a.get_entries() == 2);
+
+    ASSERT_TRUE(get_text(a, s) == "G1 X100");
+    ASSERT_TRUE(put_text(a, stream(0), "G1 X300"));
+    ASSERT_TRUE(get_text(a, s) == "G1 X200");
+    ASSERT_TRUE(get_text(a, s) == "G1 X300");
+}
+
+TEST(CommandArenaTest,quota)
+{
+    uint8_t buf[64];
+    CommandArena a;
+    a.attach(buf, sizeof(buf), 32);
+    StreamOutput *s;
+
+    // one stream cannot take more than the quota, the others still get in
+    ASSERT_TRUE(put_text(a, stream(0), "G1 X100"));
+    ASSERT_TRUE(put_text(a, stream(0), "G1 X200"));
+    ASSERT_TRUE(!put_text(a, stream(0), "G1 X300"));
+    ASSERT_TRUE(a.get_used(stream(0)) == 24);
+    ASSERT_TRUE(put_text(a, stream(1), "M105"));
+    ASSERT_TRUE(put_text(a, stream(2), "M114"));
+    ASSERT_TRUE(a.get_used(stream(1)) == 9);
+
+    ASSERT_TRUE(get_text(a, s) == "G1 X100");
+    ASSERT_TRUE(a.get_used(stream(0)) == 12);
+    ASSERT_TRUE(put_text(a, stream(0), "G1 X300"));
+}
+
+TEST(CommandArenaTest,slots)
+{
+    uint8_t buf[512];
+    CommandArena a;
+    a.attach(buf, sizeof(buf), sizeof(buf));
+    StreamOutput *s;
+    char streams[CommandArena::MAX_STREAMS + 1];
+
+    // a stream gets a slot while it has commands in the arena, and gives it up when they have all gone
+    for (int i = 0; i < CommandArena::MAX_STREAMS; ++i) {
+        ASSERT_TRUE(put_text(a, reinterpret_cast<StreamOutput *>(&streams[i]), "M105"));
+    }
+    ASSERT_TRUE(!a.has_room(reinterpret_cast<StreamOutput *>(&streams[CommandArena::MAX_STREAMS]), 5));
+    ASSERT_TRUE(a.has_room(reinterpret_cast<StreamOutput *>(&streams[0]), 5));
+
+    ASSERT_TRUE(get_text(a, s) == "M105");
+    ASSERT_TRUE(s == reinterpret_cast<StreamOutput *>(&streams[0]));
+    ASSERT_TRUE(put_text(a, reinterpret_cast<StreamOutput *>(&streams[CommandArena::MAX_STREAMS]), "M114"));
+    for (int i = 1; i < CommandArena::MAX_STREAMS; ++i) {
+        ASSERT_TRUE(get_text(a, s) == "M105");
+        ASSERT_TRUE(s == reinterpret_cast<StreamOutput *>(&streams[i]));
+    }
+    ASSERT_TRUE(get_text(a, s) == "M114");
+    ASSERT_TRUE(s == reinterpret_cast<StreamOutput *>(&streams[CommandArena::MAX_STREAMS]));
+}
+
+TEST(CommandArenaTest,unattached)
+{
+    CommandArena a;
+    StreamOutput *s;
+
+    ASSERT_TRUE(!a.has_room(stream(0), 1));
+    ASSERT_TRUE(!put_text(a, stream(0), "M105"));
+    ASSERT_TRUE(get_text(a, s) == "none");
+}
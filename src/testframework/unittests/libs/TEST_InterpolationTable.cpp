@@ -0,0 +1,57 @@
+#include "InterpolationTable.h"
+
+#include <math.h>
+
+#include "easyunit/test.h"
+
+// an EPCOS 100K thermistor with a 4700 pullup, as the ADC reading with 2 bits of oversampling
+static float thermistor(uint16_t adc)
+{
+    float r= 4700.0F / ((16380.0F / adc) - 1.0F);
+    if(r > 800000.0F) return INFINITY;
+    return 1.0F / ((1.0F / 298.15F) + (1.0F / 4066.0F) * logf(r / 100000.0F)) - 273.15F;
+}
+
+TEST(InterpolationTableTest,points)
+{
+    InterpolationTable<32> t;
+    ASSERT_TRUE(t.is_empty());
+    ASSERT_TRUE(t.build(487, 16284, thermistor, 0.05F));
+    ASSERT_TRUE(t.size() <= 32);
+    ASSERT_TRUE(t.get_min() == 487 && t.get_max() == 16284);
+
+    // the ends are exact
+    ASSERT_EQUALS_DELTA_V(thermistor(487), t.lookup(487), 0.0001F);
+    ASSERT_EQUALS_DELTA_V(thermistor(16284), t.lookup(16284), 0.0001F);
+
+    // the tolerance had to be raised to fit, and the error over the whole table is close to it
+    ASSERT_TRUE(t.get_tolerance() > 0.05F);
+    float e= t.max_error(thermistor);
+    ASSERT_TRUE(e < 0.3F);
+    ASSERT_TRUE(e < t.get_tolerance() * 1.2F);
+    for (uint32_t x = 487; x <= 16284; x += 97) {
+        ASSERT_TRUE(fabsf(t.lookup(x) - thermistor(x)) <= e);
+    }
+}
+
+TEST(InterpolationTableTest,straight)
+{
+    // a straight line needs only its ends
+    InterpolationTable<4> t;
+    ASSERT_TRUE(t.build(10, 1000, [](uint16_t x) { return 2.0F * x + 1.0F; }, 0.01F));
+    ASSERT_TRUE(t.size() == 2);
+    ASSERT_EQUALS_DELTA_V(201.0F, t.lookup(100), 0.001F);
+    ASSERT_EQUALS_DELTA_V(0.0F, t.max_error([](uint16_t x) { return 2.0F * x + 1.0F; }), 0.001F);
+}
+
+TEST(InterpolationTableTest,bad)
+{
+    InterpolationTable<32> t;
+
+    // nothing to cover
+    ASSERT_TRUE(!t.build(100, 100, thermistor, 0.05F));
+
+    // open circuit inside the range
+    ASSERT_TRUE(!t.build(487, 16379, thermistor, 0.05F));
+    ASSERT_TRUE(t.is_empty());
+}
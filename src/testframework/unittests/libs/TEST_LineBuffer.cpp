@@ -0,0 +1,145 @@
+#include "LineBuffer.h"
+
+#include <string>
+#include <string.h>
+
+#include "easyunit/test.h"
+
+template<int length, int lines> static void put_string(LineBuffer<length, lines>& lb, const char *s)
+{
+    while(*s) lb.put(*s++);
+}
+
+TEST(LineBufferTest,lines)
+{
+    LineBuffer<32, 8> lb;
+    std::string s;
+
+    ASSERT_TRUE(!lb.has_line());
+    put_string(lb, "G1 X1");
+    ASSERT_TRUE(!lb.has_line());
+    put_string(lb, "\nG1 X2\r\n");
+    ASSERT_TRUE(lb.has_line());
+
+    ASSERT_TRUE(lb.get_line(s) == 5);
+    ASSERT_TRUE(s == "G1 X1");
+    ASSERT_TRUE(lb.get_line(s) == 5);
+    ASSERT_TRUE(s == "G1 X2");
+    // the \n after the \r is an empty line
+    ASSERT_TRUE(lb.has_line());
+    ASSERT_TRUE(lb.get_line(s) == 0);
+    ASSERT_TRUE(!lb.has_line());
+    ASSERT_TRUE(lb.is_empty());
+}
+
+TEST(LineBufferTest,wrap)
+{
+    LineBuffer<16, 4> lb;
+    std::string s;
+    char buf[16];
+
+    // lines that wrap around the end of the buffer come out whole
+    for (int i = 0; i < 20; ++i) {
+        put_string(lb, "M105 S1\n");
+        ASSERT_TRUE(lb.get_line(s) == 7);
+        ASSERT_TRUE(s == "M105 S1");
+        put_string(lb, "abcdef\n");
+        ASSERT_TRUE(lb.get_line(buf, sizeof(buf)) == 6);
+        ASSERT_TRUE(strcmp(buf, "abcdef") == 0);
+    }
+}
+
+TEST(LineBufferTest,overflow)
+{
+    LineBuffer<16, 4> lb;
+    std::string s;
+
+    // a line longer than the buffer is dropped up to the next newline, not delivered in pieces
+    put_string(lb, "G1 X1\n");
+    put_string(lb, "0123456789abcdefghij\n");
+    put_string(lb, "G1 X2\n");
+    ASSERT_TRUE(lb.get_line(s) == 5 && s == "G1 X1");
+    ASSERT_TRUE(lb.get_line(s) == 5 && s == "G1 X2");
+    ASSERT_TRUE(!lb.has_line());
+
+    // backspace only removes characters from the line being received
+    put_string(lb, "G1\nX9");
+    lb.unput();
+    lb.unput();
+    lb.unput();
+    put_string(lb, "M2\n");
+    ASSERT_TRUE(lb.get_line(s) == 2 && s == "G1");
+    ASSERT_TRUE(lb.get_line(s) == 2 && s == "M2");
+
+    // flush drops complete lines and the one being received
+    put_string(lb, "a\nb\nc");
+    lb.flush();
+    ASSERT_TRUE(!lb.has_line());
+    put_string(lb, "d\n");
+    ASSERT_TRUE(lb.get_line(s) == 1 && s == "d");
+}
+
+TEST(LineBufferTest,get)
+{
+    LineBuffer<16, 4> lb;
+    char c;
+
+    // characters come out one at a time with the end of line, but only from complete lines
+    put_string(lb, "ab\x04" "c");
+    ASSERT_TRUE(lb.get(c) && c == 'a');
+    ASSERT_TRUE(lb.get(c) && c == 'b');
+    ASSERT_TRUE(lb.get(c) && c == 4);
+    ASSERT_TRUE(!lb.get(c));
+    ASSERT_TRUE(lb.available() == 1);
+}
+
+TEST(LineBufferTest,runs)
+{
+    LineBuffer<16, 4> lb;
+    std::string s;
+
+    // runs of characters without an end of line go in in one go, and wrap like single ones
+    for (int i = 0; i < 10; ++i) {
+        ASSERT_TRUE(lb.put("G1 X", 4));
+        ASSERT_TRUE(lb.put("10.5", 4));
+        lb.put('\n');
+        ASSERT_TRUE(lb.get_line(s) == 8 && s == "G1 X10.5");
+    }
+
+    // a run that does not fit drops the whole line, up to the next end of line
+    ASSERT_TRUE(lb.put("G1 X1", 5));
+    ASSERT_TRUE(!lb.put("0123456789ab", 12));
+    ASSERT_TRUE(!lb.put("cd", 2));
+    lb.put('\n');
+    ASSERT_TRUE(lb.put("M2", 2));
+    lb.put('\n');
+    ASSERT_TRUE(lb.get_line(s) == 2 && s == "M2");
+    ASSERT_TRUE(!lb.has_line());
+}
+
+TEST(LineBufferTest,long_lines)
+{
+    // as telnet uses it, with lines taken out into a buffer for a command of up to 131 characters
+    LineBuffer<256, 4> lb;
+    char buf[132];
+
+    // the longest command fits
+    for (int i = 0; i < 131; ++i) lb.put('a' + i % 26);
+    lb.put('\n');
+    ASSERT_TRUE(lb.get_line(buf, sizeof(buf)) == 131);
+
+    // a longer line is cut short, and the rest of it is not another line
+    for (int i = 0; i < 200; ++i) lb.put('b');
+    lb.put('\n');
+    ASSERT_TRUE(lb.get_line(buf, sizeof(buf)) == 131);
+    ASSERT_TRUE(!lb.has_line());
+
+    // one too long for the buffer is dropped
+    for (int i = 0; i < 300; ++i) lb.put('c');
+    lb.put('\n');
+    ASSERT_TRUE(!lb.has_line());
+    lb.put('M');
+    lb.put('2');
+    lb.put('\n');
+    ASSERT_TRUE(lb.get_line(buf, sizeof(buf)) == 2 && strcmp(buf, "M2") == 0);
+}
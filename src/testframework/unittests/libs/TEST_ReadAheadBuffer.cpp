@@ -0,0 +1,92 @@
+#include "ReadAheadBuffer.h"
+
+#include <algorithm>
+#include <string>
+#include <string.h>
+
+#include "easyunit/test.h"
+
+// reads the file a chunk at a time as the player does, and gives back all the lines joined with |
+static std::string read_lines(ReadAheadBuffer& rab, const char *file, size_t size, int *long_lines= nullptr, size_t *total= nullptr)
+{
+    size_t pos= 0, used_total= 0;
+    size_t len= strlen(file);
+    std::string out;
+    char line[size];
+    while(!rab.is_finished()) {
+        size_t used;
+        ReadAheadBuffer::line_t r= rab.get_line(line, size, used);
+        used_total += used;
+        if(r == ReadAheadBuffer::LINE) {
+            out.append(line).append("|");
+        } else if(r == ReadAheadBuffer::LONG_LINE) {
+            if(long_lines != nullptr) ++*long_lines;
+        } else {
+            char *p= rab.free_chunk();
+            if(p == nullptr) break;
+            size_t n= std::min(rab.get_chunk_size(), len - pos);
+            memcpy(p, file + pos, n);
+            pos += n;
+            rab.filled(n);
+        }
+    }
+    if(total != nullptr) *total= used_total;
+    return out;
+}
+
+TEST(ReadAheadBufferTest,lines)
+{
+    char buf[16];
+    ReadAheadBuffer rab;
+    rab.attach(buf, 8);
+
+    ASSERT_TRUE(rab.free_chunk() == buf);
+    size_t total;
+    // lines wrap around the end of the buffer, and the last one has no \n
+    std::string s= read_lines(rab, "G1 X1\nG1 X2\nM105\n\nG1 X10 Y10\nM2", 16, nullptr, &total);
+    ASSERT_TRUE(s == "G1 X1\n|G1 X2\n|M105\n|\n|G1 X10 Y10\n|M2|");
+    ASSERT_TRUE(total == 31);
+    ASSERT_TRUE(rab.is_finished());
+    ASSERT_TRUE(rab.free_chunk() == nullptr);
+}
+
+TEST(ReadAheadBufferTest,read_ahead)
+{
+    char buf[16];
+    ReadAheadBuffer rab;
+    rab.attach(buf, 8);
+
+    // the second half can be read as soon as the first is, the first only when all its lines have been taken
+    memcpy(rab.free_chunk(), "G1 X1\nG1", 8);
+    rab.filled(8);
+    ASSERT_TRUE(rab.free_chunk() == &buf[8]);
+    memcpy(rab.free_chunk(), " X2\nM105", 8);
+    rab.filled(8);
+    ASSERT_TRUE(rab.free_chunk() == nullptr);
+
+    char line[16];
+    size_t used;
+    ASSERT_TRUE(rab.get_line(line, sizeof(line), used) == ReadAheadBuffer::LINE);
+    ASSERT_TRUE(rab.free_chunk() == nullptr);
+    ASSERT_TRUE(rab.get_line(line, sizeof(line), used) == ReadAheadBuffer::LINE);
+    ASSERT_TRUE(strcmp(line, "G1 X2\n") == 0);
+    ASSERT_TRUE(rab.free_chunk() == buf);
+    ASSERT_TRUE(rab.get_line(line, sizeof(line), used) == ReadAheadBuffer::NO_LINE);
+    ASSERT_TRUE(rab.available() == 4);
+}
+
+TEST(ReadAheadBufferTest,long_lines)
+{
+    char buf[32];
+    ReadAheadBuffer rab;
+    rab.attach(buf, 16);
+
+    // longer than the line, and longer than the whole buffer
+    int long_lines= 0;
+    size_t total;
+    const char *file= "G1 X1\nG1 X1.23456789 Y1\nM105\nG1 X1.234567890123456789 Y1.234567890123456789\nG1 X3\n";
+    std::string s= read_lines(rab, file, 12, &long_lines, &total);
+    ASSERT_TRUE(s == "G1 X1\n|M105\n|G1 X3\n|");
+    ASSERT_TRUE(long_lines == 2);
+    ASSERT_TRUE(total == strlen(file));
+}
@@ -0,0 +1,89 @@
+#include "SampleFilter.h"
+
+#include <algorithm>
+#include <stdlib.h>
+
+#include "easyunit/test.h"
+
+TEST(SampleFilterTest,median)
+{
+    SampleFilter f;
+    ASSERT_TRUE(f.is_empty());
+    ASSERT_EQUALS_V(0, f.get());
+    ASSERT_TRUE(f.get_type() == SampleFilter::MEDIAN && f.get_window() == 5);
+
+    // a spike is thrown out
+    f.add(100);
+    ASSERT_EQUALS_V(100, f.get());
+    f.add(4000);
+    ASSERT_EQUALS_V(2050, f.get());
+    f.add(102);
+    ASSERT_EQUALS_V(102, f.get());
+    f.add(101);
+    f.add(0);
+    ASSERT_EQUALS_V(101, f.get());
+
+    // the spike leaves the window with the readings after it
+    f.add(103);
+    f.add(103);
+    f.add(103);
+    ASSERT_EQUALS_V(103, f.get());
+}
+
+TEST(SampleFilterTest,running_median)
+{
+    // the same as sorting the last window readings every time
+    SampleFilter f;
+    f.set(SampleFilter::MEDIAN, 7);
+    uint16_t last[7];
+    srand(1);
+    for (int i = 0; i < 1000; ++i) {
+        uint16_t x = rand() % 50;
+        f.add(x);
+        last[i % 7] = x;
+        if(i >= 6) {
+            uint16_t s[7];
+            std::copy(last, last + 7, s);
+            std::sort(s, s + 7);
+            ASSERT_EQUALS_V(s[3], f.get());
+        }
+    }
+}
+
+TEST(SampleFilterTest,average)
+{
+    SampleFilter f;
+    f.set(SampleFilter::AVERAGE, 4);
+    f.add(10);
+    f.add(20);
+    ASSERT_EQUALS_V(15, f.get());
+    f.add(30);
+    f.add(40);
+    ASSERT_EQUALS_V(25, f.get());
+    f.add(50);
+    ASSERT_EQUALS_V(35, f.get());
+
+    // too big a window is the largest there is
+    f.set(SampleFilter::AVERAGE, 100);
+    ASSERT_TRUE(f.is_empty());
+    ASSERT_EQUALS_V(SampleFilter::MAX_WINDOW, f.get_window());
+}
+
+TEST(SampleFilterTest,iir)
+{
+    SampleFilter f;
+    f.set(SampleFilter::IIR, 12);
+    ASSERT_EQUALS_V(8, f.get_window());
+
+    // starts at the first reading, then closes an eighth of the gap each time
+    f.add(1000);
+    ASSERT_EQUALS_V(1000, f.get());
+    f.add(1800);
+    ASSERT_EQUALS_V(1100, f.get());
+    for (int i = 0; i < 200; ++i) f.add(1800);
+    ASSERT_EQUALS_V(1800, f.get());
+
+    // and keeps the steps too small to show
+    for (int i = 0; i < 200; ++i) f.add(i & 1 ? 16380 : 16379);
+    ASSERT_TRUE(f.get() == 16379 || f.get() == 16380);
+}
@@ -0,0 +1,108 @@
+#include "TxBuffer.h"
+
+#include <string>
+#include <string.h>
+
+#include "easyunit/test.h"
+
+template<int length> static std::string get_all(TxBuffer<length>& tb)
+{
+    std::string s;
+    char c;
+    while(tb.get(c)) s.push_back(c);
+    return s;
+}
+
+TEST(TxBufferTest,put)
+{
+    TxBuffer<16> tb;
+
+    ASSERT_TRUE(tb.is_empty());
+    ASSERT_TRUE(tb.free() == 15);
+    ASSERT_TRUE(tb.put("ok\n", 3));
+    ASSERT_TRUE(tb.put("G1 X1\n", 6));
+    ASSERT_TRUE(tb.available() == 9);
+
+    // a line that does not all fit is not queued at all
+    ASSERT_TRUE(!tb.put("M105 T0\n", 8));
+    ASSERT_TRUE(tb.available() == 9);
+    ASSERT_TRUE(tb.get_stats().dropped == 1);
+    ASSERT_TRUE(tb.get_stats().bytes == 9);
+
+    ASSERT_TRUE(get_all(tb) == "ok\nG1 X1\n");
+    ASSERT_TRUE(tb.is_empty());
+}
+
+TEST(TxBufferTest,wrap)
+{
+    TxBuffer<16> tb;
+    char buf[16];
+
+    // lines that wrap around the end of the ring come out whole, taken a byte or many at a time
+    for (int i = 0; i < 20; ++i) {
+        ASSERT_TRUE(tb.put("ok T:21.3\n", 10));
+        if(i & 1) {
+            ASSERT_TRUE(get_all(tb) == "ok T:21.3\n");
+        } else {
+            ASSERT_TRUE(tb.get(buf, 4) == 4);
+            ASSERT_TRUE(tb.get(&buf[4], sizeof(buf)) == 6);
+            ASSERT_TRUE(std::string(buf, 10) == "ok T:21.3\n");
+        }
+    }
+    ASSERT_TRUE(tb.get_stats().bytes == 200);
+}
+
+TEST(TxBufferTest,write)
+{
+    TxBuffer<16> tb;
+
+    // write takes what fits, the caller waits and writes the rest
+    ASSERT_TRUE(tb.write("0123456789abcdefghij", 20) == 15);
+    ASSERT_TRUE(tb.free() == 0);
+    ASSERT_TRUE(tb.write("x", 1) == 0);
+    char buf[8];
+    ASSERT_TRUE(tb.get(buf, 8) == 8);
+    ASSERT_TRUE(tb.write("fghij", 5) == 5);
+    ASSERT_TRUE(get_all(tb) == "89abcdefghij");
+    ASSERT_TRUE(tb.get_stats().dropped == 0);
+}
+
+TEST(TxBufferTest,latest)
+{
+    TxBuffer<32> tb;
+
+    // with room the status line goes straight in
+    tb.put_latest("<Idle|MPos:0>\n", 14);
+    ASSERT_TRUE(tb.available() == 14);
+    ASSERT_TRUE(tb.put("ok ok ok ok ok\n", 15));
+
+    // without room it waits, and a newer one replaces it
+    tb.put_latest("<Run|MPos:1>\n", 13);
+    tb.put_latest("<Run|MPos:2>\n", 13);
+    ASSERT_TRUE(tb.get_stats().replaced == 1);
+    ASSERT_TRUE(!tb.put_waiting());
+    ASSERT_TRUE(tb.available() == 29);
+
+    char buf[32];
+    ASSERT_TRUE(tb.get(buf, 14) == 14);
+    ASSERT_TRUE(tb.put_waiting());
+    ASSERT_TRUE(get_all(tb) == "ok ok ok ok ok\n<Run|MPos:2>\n");
+    ASSERT_TRUE(tb.put_waiting());
+
+    // one too long for the ring is dropped rather than left waiting for ever
+    tb.put_latest("<Run|MPos:1.000,2.000,3.000|F:0>\n", 33);
+    ASSERT_TRUE(tb.get_stats().dropped == 1);
+    ASSERT_TRUE(tb.put_waiting());
+}
+
+TEST(TxBufferTest,flush)
+{
+    TxBuffer<16> tb;
+
+    ASSERT_TRUE(tb.put("0123456789", 10));
+    tb.put_latest("<Idle>\n", 7);
+    tb.flush();
+    ASSERT_TRUE(tb.is_empty());
+    ASSERT_TRUE(tb.put_waiting());
+    ASSERT_TRUE(tb.free() == 15);
+}
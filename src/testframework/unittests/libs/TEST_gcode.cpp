@@ -60,3 +60,51 @@ TEST(GCodeTest,subcode)
     ASSERT_EQUALS_DELTA_V(2.3, gc4.get_value('Y'), 0.001);
 
 }
+
+TEST(GCodeTest,letter_table)
+{
+    Gcode gc1("G1 X10.5 Y-2 Z.25 F3000 E1e1", nullptr);
+
+    ASSERT_TRUE(gc1.has_g);
+    ASSERT_EQUALS_V(1, gc1.g);
+    ASSERT_EQUALS_V(5, gc1.get_num_args());
+    ASSERT_TRUE(!gc1.has_letter('G'));
+    ASSERT_TRUE(!gc1.has_letter('I'));
+    ASSERT_EQUALS_DELTA_V(10.5, gc1.get_value('X'), 0.0001);
+    ASSERT_EQUALS_DELTA_V(-2.0, gc1.get_value('Y'), 0.0001);
+    ASSERT_EQUALS_DELTA_V(0.25, gc1.get_value('Z'), 0.0001);
+    ASSERT_EQUALS_DELTA_V(10.0, gc1.get_value('E'), 0.0001);
+    ASSERT_EQUALS_V(3000, gc1.get_int('F'));
+    ASSERT_EQUALS_V(10, gc1.get_int('X'));
+    ASSERT_EQUALS_V(0, gc1.get_value('I'));
+
+    // the first occurrence with a value wins, a letter without one is still present
+    Gcode gc2("M123 P S5 S6", nullptr);
+    ASSERT_TRUE(gc2.has_m);
+    ASSERT_EQUALS_V(123, gc2.m);
+    ASSERT_TRUE(gc2.has_letter('P'));
+    ASSERT_EQUALS_V(0, gc2.get_int('P'));
+    ASSERT_EQUALS_V(5, gc2.get_int('S'));
+    ASSERT_EQUALS_V(3, gc2.get_num_args());
+
+    // anything that is not a letter is still found
+    Gcode gc3("N10 G1 X1*45", nullptr, false);
+    ASSERT_EQUALS_V(10, gc3.get_int('N'));
+    ASSERT_EQUALS_V(45, gc3.get_int('*'));
+    ASSERT_TRUE(gc3.has_letter('*'));
+    ASSERT_TRUE(gc3.has_letter('G'));
+
+    // longer than the inline buffer
+    Gcode gc4("G1 X1.000000000 Y2.000000000 Z3.000000000 A4.000000000 B5.000000000 C6.000000000", nullptr);
+    ASSERT_EQUALS_V(6, gc4.get_num_args());
+    ASSERT_EQUALS_DELTA_V(6.0, gc4.get_value('C'), 0.0001);
+    Gcode gc5(gc4);
+    ASSERT_EQUALS_DELTA_V(5.0, gc5.get_value('B'), 0.0001);
+    gc5= gc1;
+    ASSERT_EQUALS_DELTA_V(10.5, gc5.get_value('X'), 0.0001);
+    ASSERT_TRUE(!gc5.has_letter('C'));
+
+    std::map<char,float> args= gc1.get_args();
+    ASSERT_EQUALS_V(5, (int)args.size());
+    ASSERT_EQUALS_DELTA_V(0.25, args['Z'], 0.0001);
+}